@@ -0,0 +1,240 @@
+#include "errorDataDetection.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define EDD_BENCH_HAS_TSC (1u) /**< Time stamp counter available for cycle counts */
+#else
+#define EDD_BENCH_HAS_TSC (0u) /**< No portable cycle counter: bytesPerCycle is reported as null */
+#endif
+
+/**
+ * @file errorDataDetection_bench.c
+ * @brief Benchmark of the CRC-8 services of the Error Data Detection module.
+ *
+ * @details
+ * Measures `EDD_CalcCrc8`, `EDD_VerifyCrc8`, `EDD_Crc8Update` and the LIN
+ * checksum `EDD_CalcLinEnhanced` on the host build of the module and writes the results as JSON, so that runs before and
+ * after a change of the CRC path can be compared.
+ *
+ * - Short buffers (1..255 bytes, typical CAN/LIN payloads) for all services.
+ * - Long buffers (1 KB..16 MB) for the services taking a 32-bit length;
+ *   `EDD_Crc8Update` is a per-byte service and is only measured on short data.
+ *
+ * Every point is measured `EDD_BENCH_RUNS` times and the fastest run is kept.
+ * `bytesPerCycle` is based on the x86 time stamp counter (reference cycles).
+ *
+ * Usage: `ErrorDataDetectionBench [-o results.json]` (default: stdout).
+ */
+
+/* =============================
+ *  Private Constants and Types
+ * ============================= */
+
+#define EDD_BENCH_RUNS (5u)                     /**< Repetitions per point, fastest one is reported */
+#define EDD_BENCH_BYTES_PER_RUN (16uL << 20)    /**< Bytes processed per run (calls x size) */
+#define EDD_BENCH_MAX_SIZE (16uL << 20)         /**< Largest buffer size measured */
+
+/**
+ * @brief Benchmarked services.
+ */
+typedef enum {
+  EDD_BENCH_CALC = 0, /**< EDD_CalcCrc8 */
+  EDD_BENCH_VERIFY,   /**< EDD_VerifyCrc8 */
+  EDD_BENCH_UPDATE,   /**< EDD_Crc8Update, one call per byte */
+  EDD_BENCH_LIN       /**< EDD_CalcLinEnhanced */
+} EDD_BenchFunctionType;
+
+/**
+ * @brief Result of one measurement point.
+ */
+typedef struct {
+  double nsPerCall;    /**< Time per call (per buffer) in ns. */
+  double nsPerByte;    /**< Time per byte in ns. */
+  double bytesPerCycle; /**< Bytes per TSC cycle (< 0 if not available). */
+  uint32_t iterations; /**< Buffers processed per run. */
+} EDD_BenchResultType;
+
+static const char *const EDD_BenchFunctionName[4] = {"EDD_CalcCrc8", "EDD_VerifyCrc8", "EDD_Crc8Update", "EDD_CalcLinEnhanced"};
+
+static const uint32_t EDD_BenchShortSizes[] = {1u, 2u, 3u, 4u, 7u, 8u, 12u, 16u, 24u, 32u, 48u, 63u, 64u, 100u, 127u, 128u, 200u, 255u};
+
+static const uint32_t EDD_BenchLongSizes[] = {1024u, 4096u, 16384u, 65536u, 262144u, 1048576u, 4194304u, 16777216u};
+
+static volatile uint8_t EDD_BenchSink; /**< Keeps the results alive */
+
+/* =============================
+ *  Static Helpers
+ * ============================= */
+
+/**
+ * @brief Read the monotonic clock in ns.
+ */
+static double EDD_BenchNowNs(void) {
+  struct timespec ts;
+
+  (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+
+  return ((double)ts.tv_sec * 1.0e9) + (double)ts.tv_nsec;
+}
+
+/**
+ * @brief Read the cycle counter (0 if not available).
+ */
+static uint64_t EDD_BenchCycles(void) {
+#if(EDD_BENCH_HAS_TSC == 1u)
+  return (uint64_t)__rdtsc();
+#else
+  return 0u;
+#endif
+}
+
+/**
+ * @brief Run one service `iterations` times over `size` bytes.
+ */
+static void EDD_BenchRun(EDD_BenchFunctionType function, const uint8_t *data, uint32_t size, uint32_t iterations) {
+  uint8_t crc = 0u;
+  uint8_t result = 0u;
+  uint32_t it;
+  uint32_t i;
+
+  for(it = 0u; it < iterations; it++) {
+    switch(function) {
+    case EDD_BENCH_CALC:
+      (void)EDD_CalcCrc8(data, size, &crc);
+      break;
+    case EDD_BENCH_VERIFY:
+      (void)EDD_VerifyCrc8(data, size, crc, &result);
+      crc ^= result;
+      break;
+    case EDD_BENCH_UPDATE:
+      for(i = 0u; i < size; i++) { (void)EDD_Crc8Update(&crc, data[i]); }
+      break;
+    default:
+      (void)EDD_CalcLinEnhanced(crc, data, size, &crc);
+      break;
+    }
+  }
+
+  EDD_BenchSink = (uint8_t)(crc ^ result);
+}
+
+/**
+ * @brief Measure one service at one buffer size (fastest of `EDD_BENCH_RUNS` runs).
+ */
+static EDD_BenchResultType EDD_BenchMeasure(EDD_BenchFunctionType function, const uint8_t *data, uint32_t size) {
+  EDD_BenchResultType result;
+  double bestNs = 0.0;
+  uint64_t bestCycles = 0u;
+  double startNs;
+  double ns;
+  uint64_t startCycles;
+  uint64_t cycles;
+  uint32_t run;
+
+  result.iterations = (uint32_t)(EDD_BENCH_BYTES_PER_RUN / size);
+  if(result.iterations == 0u) { result.iterations = 1u; }
+
+  EDD_BenchRun(function, data, size, 1u); /* warm-up: caches, CPU feature detection */
+
+  for(run = 0u; run < EDD_BENCH_RUNS; run++) {
+    startNs = EDD_BenchNowNs();
+    startCycles = EDD_BenchCycles();
+    EDD_BenchRun(function, data, size, result.iterations);
+    cycles = EDD_BenchCycles() - startCycles;
+    ns = EDD_BenchNowNs() - startNs;
+
+    if((run == 0u) || (ns < bestNs)) {
+      bestNs = ns;
+      bestCycles = cycles;
+    }
+  }
+
+  result.nsPerCall = bestNs / (double)result.iterations;
+  result.nsPerByte = result.nsPerCall / (double)size;
+  result.bytesPerCycle = (bestCycles != 0u) ? (((double)size * (double)result.iterations) / (double)bestCycles) : -1.0;
+
+  return result;
+}
+
+/**
+ * @brief Write one JSON result object.
+ */
+static void EDD_BenchPrint(FILE *out, EDD_BenchFunctionType function, uint32_t size, const EDD_BenchResultType *result, uint8_t last) {
+  (void)fprintf(out, "    {\"function\": \"%s\", \"size\": %lu, \"iterations\": %lu, \"nsPerCall\": %.3f, \"nsPerByte\": %.4f, ", EDD_BenchFunctionName[function],
+                (unsigned long)size, (unsigned long)result->iterations, result->nsPerCall, result->nsPerByte);
+
+  if(result->bytesPerCycle < 0.0) {
+    (void)fprintf(out, "\"bytesPerCycle\": null}%s\n", (last != 0u) ? "" : ",");
+  } else {
+    (void)fprintf(out, "\"bytesPerCycle\": %.4f}%s\n", result->bytesPerCycle, (last != 0u) ? "" : ",");
+  }
+}
+
+/* =============================
+ *  Main
+ * ============================= */
+
+int main(int argc, char **argv) {
+  const uint32_t shortCount = (uint32_t)(sizeof(EDD_BenchShortSizes) / sizeof(EDD_BenchShortSizes[0]));
+  const uint32_t longCount = (uint32_t)(sizeof(EDD_BenchLongSizes) / sizeof(EDD_BenchLongSizes[0]));
+  EDD_Crc8ModeInfoType info;
+  EDD_BenchResultType result;
+  FILE *out = stdout;
+  uint8_t *data;
+  uint32_t f;
+  uint32_t i;
+  uint32_t seed = 0x12345678u;
+
+  if((argc == 3) && (strcmp(argv[1], "-o") == 0)) {
+    out = fopen(argv[2], "w");
+    if(out == NULL) {
+      (void)fprintf(stderr, "cannot open %s\n", argv[2]);
+      return 1;
+    }
+  } else if(argc != 1) {
+    (void)fprintf(stderr, "usage: %s [-o results.json]\n", argv[0]);
+    return 1;
+  }
+
+  data = (uint8_t *)malloc(EDD_BENCH_MAX_SIZE);
+  if(data == NULL) {
+    (void)fprintf(stderr, "out of memory\n");
+    return 1;
+  }
+
+  for(i = 0u; i < EDD_BENCH_MAX_SIZE; i++) {
+    seed = (seed * 1103515245u) + 12345u;
+    data[i] = (uint8_t)(seed >> 16);
+  }
+
+  (void)EDD_GetCrc8ModeInfo(&info);
+
+  (void)fprintf(out, "{\n  \"module\": \"ErrorDataDetection\",\n  \"crcMode\": %u,\n  \"tableBytes\": %u,\n  \"nominalCyclesPerByte\": %u,\n", (unsigned)info.mode,
+                (unsigned)info.tableBytes, (unsigned)info.cyclesPerByte);
+  (void)fprintf(out, "  \"cycleCounter\": \"%s\",\n  \"runs\": %u,\n  \"results\": [\n", (EDD_BENCH_HAS_TSC == 1u) ? "tsc" : "none", (unsigned)EDD_BENCH_RUNS);
+
+  for(f = (uint32_t)EDD_BENCH_CALC; f <= (uint32_t)EDD_BENCH_LIN; f++) {
+    for(i = 0u; i < shortCount; i++) {
+      result = EDD_BenchMeasure((EDD_BenchFunctionType)f, data, EDD_BenchShortSizes[i]);
+      EDD_BenchPrint(out, (EDD_BenchFunctionType)f, EDD_BenchShortSizes[i], &result, 0u);
+    }
+  }
+
+  for(f = (uint32_t)EDD_BENCH_CALC; f <= (uint32_t)EDD_BENCH_VERIFY; f++) {
+    for(i = 0u; i < longCount; i++) {
+      result = EDD_BenchMeasure((EDD_BenchFunctionType)f, data, EDD_BenchLongSizes[i]);
+      EDD_BenchPrint(out, (EDD_BenchFunctionType)f, EDD_BenchLongSizes[i], &result, ((f == (uint32_t)EDD_BENCH_VERIFY) && (i == (longCount - 1u))) ? 1u : 0u);
+    }
+  }
+
+  (void)fprintf(out, "  ]\n}\n");
+
+  free(data);
+  if(out != stdout) { (void)fclose(out); }
+
+  return 0;
+}
@@ -0,0 +1,573 @@
+#include "errorDataDetection.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/**
+ * @file errorDataDetection_cli.c
+ * @brief Command-line CRC tool for flash images and bus logs.
+ *
+ * @details
+ * Computes a CRC with the Error Data Detection kernels (the same code as on
+ * target) over a memory-mapped file, either over the whole file or over the
+ * address ranges listed in a map file. The work is spread over a pool of
+ * worker threads. Every range is cut into chunks of `EDD_CLI_CHUNK` bytes and
+ * the chunk CRCs are merged in address order, so even a single large range
+ * uses all workers:
+ * - CRC-8 (CRC-8/ATM) with `EDD_Crc8Combine()`.
+ * - Other polynomials with `EDD_CliCombine()`, which removes their init and
+ *   XOROut values before shifting the left part over the right chunk.
+ *
+ * Usage:
+ * @code
+ * ErrorDataDetectionCrc [-a crc8|crc8sae|crc8h2f|crc16|crc32|crc32p4] [-j threads]
+ *                       [-m map file] [-b base address] <file>
+ * @endcode
+ *
+ * Map file: one range per line, `<name> <start> <length> [expected CRC]`,
+ * numbers in decimal or 0x-hex, `#` starts a comment. Start addresses are
+ * reduced by the base address (`-b`, e.g. the flash start) to get file
+ * offsets. When an expected CRC is given the range is verified and the tool
+ * exits with status 2 if any range mismatches.
+ */
+
+/* =============================
+ *  Private Constants and Types
+ * ============================= */
+
+#define EDD_CLI_CHUNK (4uL << 20)    /**< Chunk size handed to one task, in bytes */
+#define EDD_CLI_MAX_THREADS (256u)   /**< Upper limit of the -j option */
+#define EDD_CLI_NAME_LENGTH (64u)    /**< Maximum range name length incl. terminator */
+#define EDD_CLI_EXIT_MISMATCH (2)    /**< Exit status when a verified range mismatches */
+
+/**
+ * @brief Supported CRC algorithms.
+ */
+typedef enum {
+  EDD_CLI_CRC8 = 0,    /**< CRC-8/ATM (EDD_CalcCrc8) */
+  EDD_CLI_CRC8_SAE,    /**< CRC-8 SAE J1850 */
+  EDD_CLI_CRC8_H2F,    /**< CRC-8H2F */
+  EDD_CLI_CRC16,       /**< CRC-16-CCITT */
+  EDD_CLI_CRC32,       /**< CRC-32 (IEEE 802.3) */
+  EDD_CLI_CRC32P4,     /**< CRC-32P4 (E2E Profile 4) */
+  EDD_CLI_ALGORITHM_COUNT
+} EDD_CliAlgorithmType;
+
+/**
+ * @brief CRC model of an algorithm, as needed to merge chunk CRCs.
+ *
+ * @details
+ * The polynomial is given in the bit order of the kernel register: normal
+ * form for MSB-first CRCs, reflected form for reflected CRCs (as in
+ * errorDataDetection_priv.h), without the x^width term.
+ */
+typedef struct {
+  uint32_t poly;     /**< Generator polynomial in register bit order. */
+  uint32_t init;     /**< Initial register value. */
+  uint32_t xorout;   /**< Final XOR value. */
+  uint8_t width;     /**< CRC width in bits (8, 16 or 32). */
+  uint8_t reflected; /**< 1 if the register is shifted LSB first. */
+} EDD_CliCrcModelType;
+
+/**
+ * @brief One address range to checksum.
+ */
+typedef struct {
+  char name[EDD_CLI_NAME_LENGTH]; /**< Range name from the map file. */
+  uint64_t start;                 /**< Start address (before base subtraction). */
+  size_t offset;                  /**< File offset. */
+  size_t length;                  /**< Length in bytes. */
+  uint32_t expected;              /**< Expected CRC (valid if hasExpected). */
+  uint8_t hasExpected;            /**< 1 if the range shall be verified. */
+  uint32_t crc;                   /**< Computed CRC. */
+  EDD_ReturnType status;          /**< Result of the computation. */
+  size_t firstTask;               /**< Index of the first task of this range. */
+  size_t taskCount;               /**< Number of tasks of this range. */
+} EDD_CliRangeType;
+
+/**
+ * @brief One unit of work for the thread pool.
+ */
+typedef struct {
+  const uint8_t *data;   /**< First byte of the task. */
+  size_t length;         /**< Task length in bytes. */
+  uint32_t crc;          /**< Computed (partial) CRC. */
+  EDD_ReturnType status; /**< Result of the computation. */
+} EDD_CliTaskType;
+
+/**
+ * @brief Shared state of the thread pool.
+ */
+typedef struct {
+  EDD_CliTaskType *tasks;         /**< Task array. */
+  size_t taskCount;               /**< Number of tasks. */
+  size_t nextTask;                /**< Next task to hand out (protected by lock). */
+  pthread_mutex_t lock;           /**< Protects nextTask. */
+  EDD_CliAlgorithmType algorithm; /**< Algorithm of all tasks. */
+} EDD_CliPoolType;
+
+static const char *const EDD_CliAlgorithmName[EDD_CLI_ALGORITHM_COUNT] = {"crc8", "crc8sae", "crc8h2f", "crc16", "crc32", "crc32p4"};
+
+static const uint8_t EDD_CliAlgorithmDigits[EDD_CLI_ALGORITHM_COUNT] = {2u, 2u, 2u, 4u, 8u, 8u};
+
+static const EDD_CliCrcModelType EDD_CliCrcModel[EDD_CLI_ALGORITHM_COUNT] = {
+    {0x07u, 0x00u, 0x00u, 8u, 0u},                       /* CRC-8/ATM */
+    {0x1Du, 0xFFu, 0xFFu, 8u, 0u},                       /* CRC-8 SAE J1850 */
+    {0x2Fu, 0xFFu, 0xFFu, 8u, 0u},                       /* CRC-8H2F */
+    {0x1021u, 0xFFFFu, 0x0000u, 16u, 0u},                /* CRC-16-CCITT-FALSE */
+    {0xEDB88320uL, 0xFFFFFFFFuL, 0xFFFFFFFFuL, 32u, 1u}, /* CRC-32, reflected */
+    {0xC8DF352FuL, 0xFFFFFFFFuL, 0xFFFFFFFFuL, 32u, 1u}  /* CRC-32P4, reflected */
+};
+
+/* =============================
+ *  Static Helpers
+ * ============================= */
+
+/**
+ * @brief Multiply two polynomials modulo the generator of `model`.
+ *
+ * @details
+ * Both factors and the product are CRC registers in the bit order of the
+ * model: bit 0 holds x^0 for MSB-first CRCs and x^(width-1) for reflected ones.
+ */
+static uint32_t EDD_CliGfMul(const EDD_CliCrcModelType *model, uint32_t a, uint32_t b) {
+  const uint32_t top = (uint32_t)1u << (model->width - 1u);
+  const uint32_t mask = (top << 1) - 1u;
+  uint32_t product = 0u;
+  uint8_t bit;
+
+  for(bit = 0u; bit < model->width; bit++) {
+    if((b & (model->reflected != 0u ? (top >> bit) : ((uint32_t)1u << bit))) != 0u) { product ^= a; }
+    if(model->reflected != 0u) {
+      a = ((a & 1u) != 0u) ? ((a >> 1) ^ model->poly) : (a >> 1);
+    } else {
+      a = ((a & top) != 0u) ? (((a << 1) ^ model->poly) & mask) : ((a << 1) & mask);
+    }
+  }
+
+  return product;
+}
+
+/**
+ * @brief Advance a raw CRC register over `length` zero bytes (square-and-multiply).
+ *
+ * @return `crc * x^(8 * length)` modulo the generator of `model`.
+ */
+static uint32_t EDD_CliShiftZeros(const EDD_CliCrcModelType *model, uint32_t crc, uint32_t length) {
+  uint32_t power = (model->reflected != 0u) ? ((uint32_t)1u << (model->width - 1u)) : 1u; /* x^0 */
+  uint8_t bit;
+
+  /* x^0 -> x^8 */
+  for(bit = 0u; bit < 8u; bit++) { power = EDD_CliGfMul(model, power, (model->reflected != 0u) ? ((uint32_t)1u << (model->width - 2u)) : 2u); }
+
+  while(length != 0u) {
+    if((length & 0x01u) != 0u) { crc = EDD_CliGfMul(model, crc, power); }
+    power = EDD_CliGfMul(model, power, power);
+    length >>= 1;
+  }
+
+  return crc;
+}
+
+/**
+ * @brief Merge the CRCs of two adjacent chunks A and B.
+ *
+ * @details
+ * With the raw register update R and `CRC(M) = R(init, M) XOR xorout`:
+ * `CRC(A || B) = (CRC(A) XOR xorout XOR init) * x^(8 * |B|) XOR CRC(B)`.
+ * CRC-8/ATM (init and XOROut 0) is merged by the module's `EDD_Crc8Combine()`.
+ */
+static uint32_t EDD_CliCombine(EDD_CliAlgorithmType algorithm, uint32_t crcA, uint32_t crcB, uint32_t lengthB) {
+  const EDD_CliCrcModelType *model = &EDD_CliCrcModel[algorithm];
+  uint8_t crc8 = 0u;
+
+  if(algorithm == EDD_CLI_CRC8) {
+    (void)EDD_Crc8Combine((uint8_t)crcA, (uint8_t)crcB, lengthB, &crc8);
+    return crc8;
+  }
+
+  return EDD_CliShiftZeros(model, crcA ^ model->xorout ^ model->init, lengthB) ^ crcB;
+}
+
+/**
+ * @brief Compute the CRC of one task with the selected algorithm.
+ *
+ * @details
+ * Tasks are at most `EDD_CLI_CHUNK` bytes.
+ */
+static void EDD_CliComputeTask(EDD_CliAlgorithmType algorithm, EDD_CliTaskType *task) {
+  uint8_t crc8 = 0u;
+  uint16_t crc16 = 0u;
+  uint32_t crc32 = 0u;
+
+  switch(algorithm) {
+  case EDD_CLI_CRC8:
+    task->status = EDD_CalcCrc8(task->data, (uint32_t)task->length, &crc8);
+    task->crc = crc8;
+    break;
+#if(EDD_CRC8_SAE_J1850_SUPPORT == 1u)
+  case EDD_CLI_CRC8_SAE:
+    task->status = EDD_CalcCrc8SaeJ1850(task->data, (uint32_t)task->length, &crc8);
+    task->crc = crc8;
+    break;
+#endif
+#if(EDD_CRC8H2F_SUPPORT == 1u)
+  case EDD_CLI_CRC8_H2F:
+    task->status = EDD_CalcCrc8H2F(task->data, (uint32_t)task->length, &crc8);
+    task->crc = crc8;
+    break;
+#endif
+#if(EDD_CRC16_SUPPORT == 1u)
+  case EDD_CLI_CRC16:
+    task->status = EDD_CalcCrc16(task->data, (uint32_t)task->length, &crc16);
+    task->crc = crc16;
+    break;
+#endif
+#if(EDD_CRC32_SUPPORT == 1u)
+  case EDD_CLI_CRC32:
+    task->status = EDD_CalcCrc32(task->data, (uint32_t)task->length, &crc32);
+    task->crc = crc32;
+    break;
+#endif
+#if(EDD_CRC32P4_SUPPORT == 1u)
+  case EDD_CLI_CRC32P4:
+    task->status = EDD_CalcCrc32P4(task->data, (uint32_t)task->length, &crc32);
+    task->crc = crc32;
+    break;
+#endif
+  default:
+    task->status = EDD_INVALID_LENGTH;
+    break;
+  }
+
+  (void)crc16;
+  (void)crc32;
+}
+
+/**
+ * @brief Worker thread: take tasks from the pool until none is left.
+ */
+static void *EDD_CliWorker(void *arg) {
+  EDD_CliPoolType *pool = (EDD_CliPoolType *)arg;
+  size_t index;
+
+  for(;;) {
+    (void)pthread_mutex_lock(&pool->lock);
+    index = pool->nextTask;
+    if(index < pool->taskCount) { pool->nextTask++; }
+    (void)pthread_mutex_unlock(&pool->lock);
+
+    if(index >= pool->taskCount) { break; }
+
+    EDD_CliComputeTask(pool->algorithm, &pool->tasks[index]);
+  }
+
+  return NULL;
+}
+
+/**
+ * @brief Run all tasks on `threads` workers (the calling thread is one of them).
+ */
+static void EDD_CliRunPool(EDD_CliPoolType *pool, uint32_t threads) {
+  pthread_t ids[EDD_CLI_MAX_THREADS];
+  uint32_t started = 0u;
+  uint32_t i;
+
+  if((size_t)threads > pool->taskCount) { threads = (uint32_t)pool->taskCount; }
+
+  for(i = 1u; i < threads; i++) {
+    if(pthread_create(&ids[started], NULL, EDD_CliWorker, pool) == 0) { started++; }
+  }
+
+  (void)EDD_CliWorker(pool);
+
+  for(i = 0u; i < started; i++) { (void)pthread_join(ids[i], NULL); }
+}
+
+/**
+ * @brief Parse a number in decimal or 0x-hex notation.
+ *
+ * @return 1 if the whole token is a valid number, 0 otherwise.
+ */
+static uint8_t EDD_CliParseNumber(const char *text, uint64_t *value) {
+  char *end = NULL;
+  unsigned long long parsed;
+
+  errno = 0;
+  parsed = strtoull(text, &end, 0);
+  if((errno != 0) || (end == text) || (*end != '\0') || (text[0] == '-')) { return 0u; }
+
+  *value = (uint64_t)parsed;
+
+  return 1u;
+}
+
+/**
+ * @brief Read the range list of a map file.
+ *
+ * @return Number of ranges (0 on error, message printed).
+ */
+static size_t EDD_CliReadMap(const char *path, uint64_t base, EDD_CliRangeType **ranges_out) {
+  EDD_CliRangeType *ranges = NULL;
+  EDD_CliRangeType *grown;
+  size_t count = 0u;
+  size_t capacity = 0u;
+  unsigned long lineNumber = 0u;
+  char line[512];
+  char name[EDD_CLI_NAME_LENGTH];
+  char startText[32];
+  char lengthText[32];
+  char expectedText[32];
+  char *comment;
+  uint64_t start;
+  uint64_t length;
+  uint64_t expected;
+  int fields;
+  FILE *map = fopen(path, "r");
+
+  if(map == NULL) {
+    (void)fprintf(stderr, "cannot open map file %s: %s\n", path, strerror(errno));
+    return 0u;
+  }
+
+  while(fgets(line, (int)sizeof(line), map) != NULL) {
+    lineNumber++;
+    comment = strchr(line, '#');
+    if(comment != NULL) { *comment = '\0'; }
+
+    fields = sscanf(line, "%63s %31s %31s %31s", name, startText, lengthText, expectedText);
+    if(fields <= 0) { continue; }
+
+    if((fields < 3) || (EDD_CliParseNumber(startText, &start) == 0u) || (EDD_CliParseNumber(lengthText, &length) == 0u) || (length == 0u) || (start < base) ||
+       ((fields == 4) && (EDD_CliParseNumber(expectedText, &expected) == 0u))) {
+      (void)fprintf(stderr, "%s:%lu: expected '<name> <start> <length> [expected CRC]' with start >= base and length > 0\n", path, lineNumber);
+      count = 0u;
+      break;
+    }
+
+    if(count == capacity) {
+      capacity = (capacity == 0u) ? 16u : (capacity * 2u);
+      grown = (EDD_CliRangeType *)realloc(ranges, capacity * sizeof(EDD_CliRangeType));
+      if(grown == NULL) {
+        (void)fprintf(stderr, "out of memory\n");
+        count = 0u;
+        break;
+      }
+      ranges = grown;
+    }
+
+    (void)memset(&ranges[count], 0, sizeof(EDD_CliRangeType));
+    (void)strcpy(ranges[count].name, name);
+    ranges[count].start = start;
+    ranges[count].offset = (size_t)(start - base);
+    ranges[count].length = (size_t)length;
+    ranges[count].hasExpected = (fields == 4) ? 1u : 0u;
+    ranges[count].expected = (fields == 4) ? (uint32_t)expected : 0u;
+    count++;
+  }
+
+  (void)fclose(map);
+
+  if(count == 0u) {
+    if(lineNumber != 0u) { (void)fprintf(stderr, "%s: no usable range\n", path); }
+    free(ranges);
+    ranges = NULL;
+  }
+
+  *ranges_out = ranges;
+
+  return count;
+}
+
+/**
+ * @brief Print the command-line usage.
+ */
+static void EDD_CliUsage(const char *program) {
+  (void)fprintf(stderr, "usage: %s [-a crc8|crc8sae|crc8h2f|crc16|crc32|crc32p4] [-j threads] [-m map file] [-b base address] <file>\n", program);
+}
+
+/* =============================
+ *  Main
+ * ============================= */
+
+int main(int argc, char **argv) {
+  EDD_CliAlgorithmType algorithm = EDD_CLI_CRC8;
+  EDD_CliRangeType *ranges = NULL;
+  EDD_CliTaskType *tasks;
+  EDD_CliPoolType pool;
+  const char *mapPath = NULL;
+  const uint8_t *image;
+  struct stat info;
+  uint64_t value;
+  uint64_t base = 0u;
+  uint32_t threads = 0u;
+  size_t rangeCount;
+  size_t taskCount = 0u;
+  size_t r;
+  size_t t;
+  size_t piece;
+  long online;
+  int mismatches = 0;
+  int option;
+  int fd;
+  uint32_t a;
+
+  while((option = getopt(argc, argv, "a:j:m:b:")) != -1) {
+    switch(option) {
+    case 'a':
+      for(a = 0u; a < (uint32_t)EDD_CLI_ALGORITHM_COUNT; a++) {
+        if(strcmp(optarg, EDD_CliAlgorithmName[a]) == 0) { break; }
+      }
+      if(a == (uint32_t)EDD_CLI_ALGORITHM_COUNT) {
+        EDD_CliUsage(argv[0]);
+        return 1;
+      }
+      algorithm = (EDD_CliAlgorithmType)a;
+      break;
+    case 'j':
+      if((EDD_CliParseNumber(optarg, &value) == 0u) || (value == 0u) || (value > EDD_CLI_MAX_THREADS)) {
+        (void)fprintf(stderr, "-j expects 1..%u\n", EDD_CLI_MAX_THREADS);
+        return 1;
+      }
+      threads = (uint32_t)value;
+      break;
+    case 'm':
+      mapPath = optarg;
+      break;
+    case 'b':
+      if(EDD_CliParseNumber(optarg, &base) == 0u) {
+        EDD_CliUsage(argv[0]);
+        return 1;
+      }
+      break;
+    default:
+      EDD_CliUsage(argv[0]);
+      return 1;
+    }
+  }
+
+  if(optind != (argc - 1)) {
+    EDD_CliUsage(argv[0]);
+    return 1;
+  }
+
+  if(threads == 0u) {
+    online = sysconf(_SC_NPROCESSORS_ONLN);
+    threads = (online > 0) ? (uint32_t)online : 1u;
+    if(threads > EDD_CLI_MAX_THREADS) { threads = EDD_CLI_MAX_THREADS; }
+  }
+
+  fd = open(argv[optind], O_RDONLY);
+  if((fd < 0) || (fstat(fd, &info) != 0) || (info.st_size <= 0)) {
+    (void)fprintf(stderr, "cannot read %s (missing or empty)\n", argv[optind]);
+    if(fd >= 0) { (void)close(fd); }
+    return 1;
+  }
+
+  image = (const uint8_t *)mmap(NULL, (size_t)info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  (void)close(fd);
+  if(image == (const uint8_t *)MAP_FAILED) {
+    (void)fprintf(stderr, "cannot map %s: %s\n", argv[optind], strerror(errno));
+    return 1;
+  }
+  (void)madvise((void *)(uintptr_t)image, (size_t)info.st_size, MADV_SEQUENTIAL);
+
+  if(mapPath != NULL) {
+    rangeCount = EDD_CliReadMap(mapPath, base, &ranges);
+  } else {
+    rangeCount = 1u;
+    ranges = (EDD_CliRangeType *)calloc(1u, sizeof(EDD_CliRangeType));
+    if(ranges != NULL) {
+      (void)strcpy(ranges[0].name, "file");
+      ranges[0].start = base;
+      ranges[0].length = (size_t)info.st_size;
+    }
+  }
+
+  if((rangeCount == 0u) || (ranges == NULL)) {
+    (void)munmap((void *)(uintptr_t)image, (size_t)info.st_size);
+    return 1;
+  }
+
+  /* Validate the ranges and count the tasks */
+  for(r = 0u; r < rangeCount; r++) {
+    if((ranges[r].offset > (size_t)info.st_size) || (ranges[r].length > ((size_t)info.st_size - ranges[r].offset))) {
+      (void)fprintf(stderr, "range %s (0x%llx, %zu bytes) is outside of %s\n", ranges[r].name, (unsigned long long)ranges[r].start, ranges[r].length, argv[optind]);
+      free(ranges);
+      (void)munmap((void *)(uintptr_t)image, (size_t)info.st_size);
+      return 1;
+    }
+    ranges[r].firstTask = taskCount;
+    ranges[r].taskCount = ((ranges[r].length - 1u) / EDD_CLI_CHUNK) + 1u;
+    taskCount += ranges[r].taskCount;
+  }
+
+  tasks = (EDD_CliTaskType *)calloc(taskCount, sizeof(EDD_CliTaskType));
+  if(tasks == NULL) {
+    (void)fprintf(stderr, "out of memory\n");
+    free(ranges);
+    (void)munmap((void *)(uintptr_t)image, (size_t)info.st_size);
+    return 1;
+  }
+
+  for(r = 0u; r < rangeCount; r++) {
+    for(t = 0u; t < ranges[r].taskCount; t++) {
+      piece = t * EDD_CLI_CHUNK;
+      tasks[ranges[r].firstTask + t].data = &image[ranges[r].offset + piece];
+      tasks[ranges[r].firstTask + t].length = ((ranges[r].length - piece) > EDD_CLI_CHUNK) ? EDD_CLI_CHUNK : (ranges[r].length - piece);
+    }
+  }
+
+  pool.tasks = tasks;
+  pool.taskCount = taskCount;
+  pool.nextTask = 0u;
+  pool.algorithm = algorithm;
+  (void)pthread_mutex_init(&pool.lock, NULL);
+
+  EDD_CliRunPool(&pool, threads);
+
+  (void)pthread_mutex_destroy(&pool.lock);
+
+  /* Merge the chunk results in address order and report */
+  for(r = 0u; r < rangeCount; r++) {
+    ranges[r].status = EDD_OK;
+
+    for(t = 0u; t < ranges[r].taskCount; t++) {
+      const EDD_CliTaskType *task = &tasks[ranges[r].firstTask + t];
+
+      if(task->status != EDD_OK) { ranges[r].status = task->status; }
+
+      ranges[r].crc = (t == 0u) ? task->crc : EDD_CliCombine(algorithm, ranges[r].crc, task->crc, (uint32_t)task->length);
+    }
+
+    if(ranges[r].status != EDD_OK) {
+      (void)printf("%s 0x%08llx %zu %s ERROR (algorithm not enabled in this build)\n", ranges[r].name, (unsigned long long)ranges[r].start, ranges[r].length,
+                   EDD_CliAlgorithmName[algorithm]);
+      mismatches++;
+    } else {
+      (void)printf("%s 0x%08llx %zu %s 0x%0*lX", ranges[r].name, (unsigned long long)ranges[r].start, ranges[r].length, EDD_CliAlgorithmName[algorithm],
+                   (int)EDD_CliAlgorithmDigits[algorithm], (unsigned long)ranges[r].crc);
+      if(ranges[r].hasExpected != 0u) {
+        if(ranges[r].crc == ranges[r].expected) {
+          (void)printf(" OK");
+        } else {
+          (void)printf(" MISMATCH (expected 0x%0*lX)", (int)EDD_CliAlgorithmDigits[algorithm], (unsigned long)ranges[r].expected);
+          mismatches++;
+        }
+      }
+      (void)printf("\n");
+    }
+  }
+
+  free(tasks);
+  free(ranges);
+  (void)munmap((void *)(uintptr_t)image, (size_t)info.st_size);
+
+  return (mismatches != 0) ? EDD_CLI_EXIT_MISMATCH : 0;
+}
@@ -0,0 +1,175 @@
+#include "errorDataDetection_crcEmu.h"
+#include <pthread.h>
+#include <time.h>
+
+/**
+ * @file errorDataDetection_crcEmu.c
+ * @brief Host emulation of a CRC-8 peripheral.
+ *
+ * @details
+ * One request at a time, like the ECU peripheral: `start` hands the buffer to
+ * the worker thread and returns, the worker completes it in the background.
+ * The module's critical section (`EDD_CRITICAL_SECTION_SUPPORT`) is the
+ * emulator mutex, so the busy state of the asynchronous API written by the
+ * worker thread and by the callers is always accessed under one lock.
+ */
+
+/* =============================
+ *  Private Types and Constants
+ * ============================= */
+
+/**
+ * @brief State of the emulated peripheral (shared with the worker thread, under EDD_HostCrcEmuLock).
+ */
+typedef struct {
+  pthread_t worker;       /**< Worker thread. */
+  uint8_t running;        /**< 1 between Init and Deinit. */
+  uint8_t stop;           /**< Set by Deinit to end the worker. */
+  uint8_t pending;        /**< 1 while a request waits for or is in the worker. */
+  uint32_t nsPerByte;     /**< Emulated transfer time per byte. */
+  const uint8_t *data;    /**< Buffer of the request. */
+  uint32_t length;        /**< Length of the request. */
+  EDD_Crc8DoneType done;  /**< Completion hook of the request. */
+} EDD_HostCrcEmuType;
+
+static EDD_HostCrcEmuType EDD_HostCrcEmu;
+static pthread_mutex_t EDD_HostCrcEmuLock = PTHREAD_MUTEX_INITIALIZER;  /**< Protects EDD_HostCrcEmu */
+static pthread_cond_t EDD_HostCrcEmuWakeup = PTHREAD_COND_INITIALIZER;  /**< Signals a new request or the stop request */
+
+/* =============================
+ *  Static Helpers Implementation
+ * ============================= */
+
+/**
+ * @brief Wait the emulated transfer time of a request (private).
+ *
+ * @param length Request length in bytes.
+ */
+static void EDD_HostCrcEmuDelay(uint32_t length) {
+  uint64_t ns = (uint64_t)length * EDD_HostCrcEmu.nsPerByte;
+  struct timespec ts;
+
+  if(ns == 0u) { return; }
+
+  ts.tv_sec = (time_t)(ns / 1000000000uLL);
+  ts.tv_nsec = (long)(ns % 1000000000uLL);
+  (void)nanosleep(&ts, NULL);
+}
+
+/**
+ * @brief Peripheral emulation loop (thread entry point, private).
+ *
+ * @details
+ * Serves one request at a time: computes the CRC-8 with the platform code,
+ * waits the transfer time and calls the completion hook outside the lock
+ * (the hook may start the next request).
+ *
+ * @param arg Unused.
+ *
+ * @return Always NULL.
+ */
+static void *EDD_HostCrcEmuWorker(void *arg) {
+  const uint8_t *data;
+  uint32_t length;
+  EDD_Crc8DoneType done;
+  uint8_t crc = 0u;
+
+  (void)arg;
+
+  (void)pthread_mutex_lock(&EDD_HostCrcEmuLock);
+  for(;;) {
+    while((EDD_HostCrcEmu.pending == 0u) && (EDD_HostCrcEmu.stop == 0u)) { (void)pthread_cond_wait(&EDD_HostCrcEmuWakeup, &EDD_HostCrcEmuLock); }
+
+    if(EDD_HostCrcEmu.pending == 0u) { break; }
+
+    data = EDD_HostCrcEmu.data;
+    length = EDD_HostCrcEmu.length;
+    done = EDD_HostCrcEmu.done;
+    (void)pthread_mutex_unlock(&EDD_HostCrcEmuLock);
+
+    (void)EDD_CalcCrc8(data, length, &crc);
+    EDD_HostCrcEmuDelay(length);
+
+    /* Free the peripheral before the "interrupt" so that it can chain a request */
+    (void)pthread_mutex_lock(&EDD_HostCrcEmuLock);
+    EDD_HostCrcEmu.pending = 0u;
+    (void)pthread_mutex_unlock(&EDD_HostCrcEmuLock);
+    done(crc);
+    (void)pthread_mutex_lock(&EDD_HostCrcEmuLock);
+  }
+  (void)pthread_mutex_unlock(&EDD_HostCrcEmuLock);
+
+  return NULL;
+}
+
+/**
+ * @brief Driver entry: hand a request to the worker thread (private).
+ *
+ * @param data   Buffer to process.
+ * @param length Buffer length (> 0, checked by the caller).
+ * @param done   Completion hook.
+ *
+ * @return EDD_OK if the request was queued, EDD_BUSY if the emulator is not
+ *         running or still processing a request.
+ */
+static EDD_ReturnType EDD_HostCrcEmuStart(const uint8_t *data, uint32_t length, EDD_Crc8DoneType done) {
+  EDD_ReturnType ret = EDD_BUSY;
+
+  (void)pthread_mutex_lock(&EDD_HostCrcEmuLock);
+  if((EDD_HostCrcEmu.running != 0u) && (EDD_HostCrcEmu.stop == 0u) && (EDD_HostCrcEmu.pending == 0u)) {
+    EDD_HostCrcEmu.data = data;
+    EDD_HostCrcEmu.length = length;
+    EDD_HostCrcEmu.done = done;
+    EDD_HostCrcEmu.pending = 1u;
+    (void)pthread_cond_signal(&EDD_HostCrcEmuWakeup);
+    ret = EDD_OK;
+  }
+  (void)pthread_mutex_unlock(&EDD_HostCrcEmuLock);
+
+  return ret;
+}
+
+/* =============================
+ *  Public API Implementation
+ * ============================= */
+
+const EDD_Crc8DriverType EDD_HostCrcEmuDriver = {&EDD_HostCrcEmuStart};
+
+void EDD_EnterCritical(void) { (void)pthread_mutex_lock(&EDD_HostCrcEmuLock); }
+
+void EDD_ExitCritical(void) { (void)pthread_mutex_unlock(&EDD_HostCrcEmuLock); }
+
+EDD_ReturnType EDD_HostCrcEmuInit(uint32_t nsPerByte) {
+  EDD_ReturnType ret = EDD_BUSY;
+
+  (void)pthread_mutex_lock(&EDD_HostCrcEmuLock);
+  if(EDD_HostCrcEmu.running == 0u) {
+    EDD_HostCrcEmu.nsPerByte = nsPerByte;
+    EDD_HostCrcEmu.stop = 0u;
+    EDD_HostCrcEmu.pending = 0u;
+    if(pthread_create(&EDD_HostCrcEmu.worker, NULL, EDD_HostCrcEmuWorker, NULL) == 0) {
+      EDD_HostCrcEmu.running = 1u;
+      ret = EDD_OK;
+    }
+  }
+  (void)pthread_mutex_unlock(&EDD_HostCrcEmuLock);
+
+  return ret;
+}
+
+void EDD_HostCrcEmuDeinit(void) {
+  (void)pthread_mutex_lock(&EDD_HostCrcEmuLock);
+  if(EDD_HostCrcEmu.running == 0u) {
+    (void)pthread_mutex_unlock(&EDD_HostCrcEmuLock);
+    return;
+  }
+  EDD_HostCrcEmu.stop = 1u;
+  (void)pthread_cond_signal(&EDD_HostCrcEmuWakeup);
+  (void)pthread_mutex_unlock(&EDD_HostCrcEmuLock);
+
+  (void)pthread_join(EDD_HostCrcEmu.worker, NULL);
+
+  (void)pthread_mutex_lock(&EDD_HostCrcEmuLock);
+  EDD_HostCrcEmu.running = 0u;
+  (void)pthread_mutex_unlock(&EDD_HostCrcEmuLock);
+}
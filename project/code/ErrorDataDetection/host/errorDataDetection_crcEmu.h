@@ -0,0 +1,81 @@
+#ifndef ERRORDATADETECTION_CRCEMU_H
+#define ERRORDATADETECTION_CRCEMU_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "errorDataDetection.h"
+#include <stdint.h>
+
+/**
+ * @file errorDataDetection_crcEmu.h
+ * @brief Host emulation of a CRC-8 peripheral for the asynchronous CRC API.
+ *
+ * @details
+ * Stands in for a hardware CRC unit fed by DMA so that @ref EDD_CalcCrc8Async
+ * and the application code built around it can be exercised on the host. A
+ * worker thread plays the peripheral: it computes the CRC-8 with the platform
+ * code, waits the configured transfer time and then calls the completion hook,
+ * like the CRC/DMA interrupt would on the ECU.
+ *
+ * Usage:
+ * - @ref EDD_HostCrcEmuInit, then `EDD_Crc8SetDriver(&EDD_HostCrcEmuDriver)`;
+ * - `EDD_Crc8SetDriver(NULL)`, then @ref EDD_HostCrcEmuDeinit.
+ *
+ * The emulator also provides `EDD_EnterCritical()` / `EDD_ExitCritical()` of
+ * the host build (`EDD_CRITICAL_SECTION_SUPPORT` = 1u) on its mutex, so
+ * several threads may call @ref EDD_CalcCrc8Async.
+ */
+
+/* =============================
+ *  Public API
+ * ============================= */
+
+/**
+ * @brief CRC-8 driver backed by the emulated peripheral.
+ */
+extern const EDD_Crc8DriverType EDD_HostCrcEmuDriver;
+
+/**
+ * @brief Start the emulated CRC peripheral.
+ *
+ * @details
+ * **Goal of the function**
+ *
+ * The purpose of this function is to start the worker thread that serves the
+ * requests of @ref EDD_HostCrcEmuDriver.
+ *
+ * The processing logic:
+ * - Rejects the call with `EDD_BUSY` if the emulator is already running.
+ * - Stores the transfer time per byte (`nsPerByte`, 0 = complete as soon as
+ *   the CRC is computed).
+ * - Starts the worker thread; returns `EDD_BUSY` if it cannot be created.
+ *
+ * @par Interface summary
+ *
+ * | Interface | In | Out | Data type / Signature | Param | Data factor | Data offset | Data size | Data range | Data unit |
+ * |----------|:--:|:---:|-----------------------|:-----:|------------:|------------:|----------:|------------|----------|
+ * | nsPerByte | X |     | uint32_t              |   -   |      1      |      0      |     1    | [0..]      | ns       |
+ *
+ * @return EDD_ReturnType
+ * - EDD_OK if the emulator was started.
+ * - EDD_BUSY if it is already running or the thread cannot be created.
+ */
+EDD_ReturnType EDD_HostCrcEmuInit(uint32_t nsPerByte);
+
+/**
+ * @brief Stop the emulated CRC peripheral.
+ *
+ * @details
+ * Lets the worker finish the request in progress (its completion is still
+ * delivered) and joins the thread. Does nothing if the emulator is not
+ * running.
+ */
+void EDD_HostCrcEmuDeinit(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ERRORDATADETECTION_CRCEMU_H */
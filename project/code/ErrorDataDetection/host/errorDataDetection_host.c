@@ -0,0 +1,143 @@
+#include "errorDataDetection_host.h"
+#include <pthread.h>
+#include <unistd.h>
+
+/**
+ * @file errorDataDetection_host.c
+ * @brief Host-side services of the Error Data Detection module.
+ *
+ * @details
+ * Splits large buffers across POSIX threads and merges the partial CRC-8
+ * values with @ref EDD_Crc8Combine. Only the public API of the platform code
+ * is used.
+ */
+
+/* =============================
+ *  Private Types and Constants
+ * ============================= */
+
+#define EDD_HOST_MAX_PIECE (0x80000000uL) /**< Largest length passed to one uint32_t based platform call */
+
+/**
+ * @brief Work item of one worker thread.
+ */
+typedef struct {
+  const uint8_t *data; /**< First byte of the chunk. */
+  size_t length;       /**< Chunk length in bytes. */
+  uint8_t crc;         /**< CRC-8 of the chunk (output). */
+} EDD_HostChunkType;
+
+/* =============================
+ *  Static Helpers Implementation
+ * ============================= */
+
+/**
+ * @brief Compute the CRC-8 of one chunk (thread entry point, private).
+ *
+ * @details
+ * Chunks longer than the 32-bit length of the platform API are fed to a
+ * streaming context in several pieces.
+ *
+ * @param arg Pointer to an `EDD_HostChunkType`.
+ *
+ * @return Always NULL.
+ */
+static void *EDD_HostChunkWorker(void *arg) {
+  EDD_HostChunkType *chunk = (EDD_HostChunkType *)arg;
+  EDD_Crc8Ctx ctx;
+  size_t offset = 0u;
+  size_t piece;
+
+  (void)EDD_Crc8CtxInit(&ctx);
+
+  while(offset < chunk->length) {
+    piece = chunk->length - offset;
+    if(piece > EDD_HOST_MAX_PIECE) { piece = EDD_HOST_MAX_PIECE; }
+    (void)EDD_Crc8CtxUpdate(&ctx, &chunk->data[offset], (uint32_t)piece);
+    offset += piece;
+  }
+
+  (void)EDD_Crc8CtxFinal(&ctx, &chunk->crc);
+
+  return NULL;
+}
+
+/**
+ * @brief Combine two CRC-8 values for a second block of any size (private).
+ *
+ * @param crcA    CRC-8 of the first block.
+ * @param crcB    CRC-8 of the second block.
+ * @param lengthB Length of the second block in bytes.
+ *
+ * @return CRC-8 of the concatenation.
+ */
+static uint8_t EDD_HostCombine(uint8_t crcA, uint8_t crcB, size_t lengthB) {
+  uint8_t crc = crcA;
+
+  /* Shift over the leading part of B with zero CRC, then combine the rest */
+  while(lengthB > EDD_HOST_MAX_PIECE) {
+    (void)EDD_Crc8Combine(crc, 0u, (uint32_t)EDD_HOST_MAX_PIECE, &crc);
+    lengthB -= EDD_HOST_MAX_PIECE;
+  }
+  (void)EDD_Crc8Combine(crc, crcB, (uint32_t)lengthB, &crc);
+
+  return crc;
+}
+
+/* =============================
+ *  Public API Implementation
+ * ============================= */
+
+EDD_ReturnType EDD_HostCalcCrc8Parallel(const uint8_t *data, size_t length, uint32_t threads, uint8_t *crc_out) {
+  EDD_HostChunkType chunks[EDD_HOST_MAX_THREADS];
+  pthread_t ids[EDD_HOST_MAX_THREADS];
+  uint8_t started[EDD_HOST_MAX_THREADS];
+  size_t chunkLength;
+  size_t offset;
+  uint32_t count;
+  uint32_t i;
+  uint8_t crc;
+  long online;
+
+  if((data == NULL) || (crc_out == NULL)) { return EDD_NULL_PTR; }
+
+  if(length == 0u) { return EDD_INVALID_LENGTH; }
+
+  count = threads;
+  if(count == 0u) {
+    online = sysconf(_SC_NPROCESSORS_ONLN);
+    count = (online > 0) ? (uint32_t)online : 1u;
+  }
+  if(count > EDD_HOST_MAX_THREADS) { count = EDD_HOST_MAX_THREADS; }
+  if(((size_t)count * EDD_HOST_MIN_CHUNK) > length) { count = (uint32_t)(length / EDD_HOST_MIN_CHUNK); }
+  if(count == 0u) { count = 1u; }
+
+  chunkLength = length / count;
+  offset = 0u;
+
+  for(i = 0u; i < count; i++) {
+    chunks[i].data = &data[offset];
+    chunks[i].length = (i == (count - 1u)) ? (length - offset) : chunkLength;
+    offset += chunks[i].length;
+  }
+
+  /* Chunk 0 is computed by the caller while the workers run */
+  for(i = 1u; i < count; i++) { started[i] = (pthread_create(&ids[i], NULL, EDD_HostChunkWorker, &chunks[i]) == 0) ? 1u : 0u; }
+
+  (void)EDD_HostChunkWorker(&chunks[0]);
+
+  for(i = 1u; i < count; i++) {
+    if(started[i] != 0u) {
+      (void)pthread_join(ids[i], NULL);
+    } else {
+      (void)EDD_HostChunkWorker(&chunks[i]);
+    }
+  }
+
+  crc = chunks[0].crc;
+  for(i = 1u; i < count; i++) { crc = EDD_HostCombine(crc, chunks[i].crc, chunks[i].length); }
+
+  *crc_out = crc;
+
+  return EDD_OK;
+}
@@ -0,0 +1,100 @@
+#ifndef ERRORDATADETECTION_HOST_H
+#define ERRORDATADETECTION_HOST_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "errorDataDetection.h"
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @file errorDataDetection_host.h
+ * @brief Host-side (build server / tester PC) services of the Error Data Detection module.
+ *
+ * @details
+ * These services are not part of the ECU software. They use POSIX threads and
+ * are built by the host CMake project in `host/` together with the platform
+ * sources, so they compute exactly the same CRC values as the ECU.
+ */
+
+/* =============================
+ *  Constants
+ * ============================= */
+
+#define EDD_HOST_MAX_THREADS (64u)         /**< Highest number of worker threads used by one call */
+#define EDD_HOST_MIN_CHUNK (64uL * 1024uL) /**< Smallest chunk handed to a worker thread, in bytes */
+
+/* =============================
+ *  Public API
+ * ============================= */
+
+/**
+ * @brief Compute the CRC-8 of a large buffer on several cores.
+ *
+ * @details
+ * **Goal of the function**
+ *
+ * The purpose of this function is to compute the CRC-8 (CRC-8/ATM, same value
+ * as @ref EDD_CalcCrc8) of buffers such as complete flash images using every
+ * core of the host instead of one.
+ *
+ * The processing logic:
+ * - Validates input pointers (`data`, `crc_out`) and `length`.
+ * - Selects the number of workers: `threads` (0 = number of online CPUs),
+ *   limited to `EDD_HOST_MAX_THREADS` and to one worker per
+ *   `EDD_HOST_MIN_CHUNK` bytes.
+ * - Splits the buffer into that many contiguous chunks and computes the
+ *   CRC-8 of each chunk in its own thread (the calling thread takes the first
+ *   chunk).
+ * - Merges the chunk CRCs in order with @ref EDD_Crc8Combine.
+ *
+ * If a worker thread cannot be created, its chunk is computed by the calling
+ * thread; the result is the same, only slower.
+ *
+ * @par Interface summary
+ *
+ * | Interface | In | Out | Data type / Signature | Param | Data factor | Data offset | Data size | Data range     | Data unit |
+ * |----------|:--:|:---:|-----------------------|:-----:|------------:|------------:|----------:|----------------|----------|
+ * | data     | X  |     | const uint8_t*        |   -   |      1      |      0      |  length  | [0,255]        | [-]      |
+ * | length   | X  |     | size_t                |   -   |      1      |      0      |     -    | [1..SIZE_MAX]  | bytes    |
+ * | threads  | X  |     | uint32_t              |   -   |      1      |      0      |     -    | [0..]          | [-]      |
+ * | crc_out  | X  |  X  | uint8_t*              |   -   |      1      |      0      |     1    | [0,255]        | [-]      |
+ *
+ * @par Activity diagram (PlantUML)
+ *
+ * @startuml
+ * start
+ * if (data == NULL OR crc_out == NULL) then (YES)
+ *   :return EDD_NULL_PTR;
+ *   stop
+ * endif
+ * if (length == 0) then (YES)
+ *   :return EDD_INVALID_LENGTH;
+ *   stop
+ * endif
+ * :select worker count;
+ * :start one thread per chunk (chunk 0 in caller);
+ * :join threads;
+ * :crc = chunk[0];
+ * while (more chunks?) is (YES)
+ *   :crc = Combine(crc, chunk[i], len[i]);
+ * endwhile (NO)
+ * :*crc_out = crc;
+ * :return EDD_OK;
+ * stop
+ * @enduml
+ *
+ * @return EDD_ReturnType
+ * - EDD_OK if the CRC was computed.
+ * - EDD_NULL_PTR if any input pointer is NULL.
+ * - EDD_INVALID_LENGTH if length is zero.
+ */
+EDD_ReturnType EDD_HostCalcCrc8Parallel(const uint8_t *data, size_t length, uint32_t threads, uint8_t *crc_out);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ERRORDATADETECTION_HOST_H */
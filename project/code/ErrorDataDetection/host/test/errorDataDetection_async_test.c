@@ -0,0 +1,190 @@
+#include "errorDataDetection.h"
+#include "errorDataDetection_crcEmu.h"
+#include <pthread.h>
+#include <stdio.h>
+#include <string.h>
+
+/**
+ * @file errorDataDetection_async_test.c
+ * @brief Host test of the asynchronous CRC-8 API with the emulated peripheral.
+ *
+ * @details
+ * Checks what the Unity tests of `EDD_CalcCrc8Async` cannot: completion from
+ * another thread, work overlapped with a running request, chaining from the
+ * callback, concurrent callers and the return to the software driver.
+ *
+ * Run by CTest; the exit code is the number of failed checks.
+ */
+
+/* =============================
+ *  Private Constants and Types
+ * ============================= */
+
+#define EDD_ASYNC_TEST_SIZE (256uL * 1024uL) /**< Bytes per request */
+#define EDD_ASYNC_TEST_NS_PER_BYTE (20u)     /**< Emulated transfer time: ~5 ms per request */
+#define EDD_ASYNC_TEST_CHAIN (4u)            /**< Requests issued back to back from the callback */
+#define EDD_ASYNC_TEST_CALLERS (4u)          /**< Threads requesting a CRC at the same time */
+#define EDD_ASYNC_TEST_ROUNDS (20u)          /**< Rounds of concurrent requests */
+
+/* =============================
+ *  Private Data
+ * ============================= */
+
+static uint8_t EDD_AsyncTestData[EDD_ASYNC_TEST_SIZE];
+static pthread_mutex_t EDD_AsyncTestLock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t EDD_AsyncTestCond = PTHREAD_COND_INITIALIZER;
+static uint32_t EDD_AsyncTestCompleted;
+static uint8_t EDD_AsyncTestCrc;
+static uint32_t EDD_AsyncTestChained;
+static uint32_t EDD_AsyncTestFailures;
+static pthread_barrier_t EDD_AsyncTestStart;
+static uint32_t EDD_AsyncTestAccepted;
+
+/* =============================
+ *  Static Helpers Implementation
+ * ============================= */
+
+static void EDD_AsyncTestCheck(int condition, const char *what) {
+  if(!condition) {
+    EDD_AsyncTestFailures++;
+    (void)fprintf(stderr, "FAIL: %s\n", what);
+  }
+}
+
+static void EDD_AsyncTestCallback(uint8_t crc) {
+  (void)pthread_mutex_lock(&EDD_AsyncTestLock);
+  EDD_AsyncTestCrc = crc;
+  EDD_AsyncTestCompleted++;
+  (void)pthread_cond_broadcast(&EDD_AsyncTestCond);
+  (void)pthread_mutex_unlock(&EDD_AsyncTestLock);
+}
+
+static void EDD_AsyncTestChainCallback(uint8_t crc) {
+  /* Each completion starts the next request on the next quarter of the buffer */
+  if(EDD_AsyncTestChained < EDD_ASYNC_TEST_CHAIN) {
+    uint32_t quarter = EDD_ASYNC_TEST_SIZE / EDD_ASYNC_TEST_CHAIN;
+    EDD_AsyncTestChained++;
+    EDD_AsyncTestCheck(EDD_CalcCrc8Async(&EDD_AsyncTestData[EDD_AsyncTestChained * quarter - quarter], quarter,
+                                         (EDD_AsyncTestChained < EDD_ASYNC_TEST_CHAIN) ? EDD_AsyncTestChainCallback : EDD_AsyncTestCallback) == EDD_OK,
+                       "chained request accepted from the callback");
+  }
+  (void)crc;
+}
+
+static void *EDD_AsyncTestCaller(void *arg) {
+  EDD_ReturnType ret;
+
+  (void)arg;
+  (void)pthread_barrier_wait(&EDD_AsyncTestStart);
+  ret = EDD_CalcCrc8Async(EDD_AsyncTestData, EDD_ASYNC_TEST_SIZE, EDD_AsyncTestCallback);
+
+  (void)pthread_mutex_lock(&EDD_AsyncTestLock);
+  if(ret == EDD_OK) { EDD_AsyncTestAccepted++; }
+  EDD_AsyncTestCheck((ret == EDD_OK) || (ret == EDD_BUSY), "concurrent request accepted or busy");
+  (void)pthread_mutex_unlock(&EDD_AsyncTestLock);
+
+  return NULL;
+}
+
+static void EDD_AsyncTestWait(uint32_t completions) {
+  (void)pthread_mutex_lock(&EDD_AsyncTestLock);
+  while(EDD_AsyncTestCompleted < completions) { (void)pthread_cond_wait(&EDD_AsyncTestCond, &EDD_AsyncTestLock); }
+  (void)pthread_mutex_unlock(&EDD_AsyncTestLock);
+}
+
+/* =============================
+ *  Test Cases
+ * ============================= */
+
+static void EDD_AsyncTestOverlap(void) {
+  uint8_t syncCrc = 0u;
+  uint8_t otherCrc = 0u;
+  uint32_t before;
+
+  (void)EDD_CalcCrc8(EDD_AsyncTestData, EDD_ASYNC_TEST_SIZE, &syncCrc);
+
+  before = EDD_AsyncTestCompleted;
+  EDD_AsyncTestCheck(EDD_CalcCrc8Async(EDD_AsyncTestData, EDD_ASYNC_TEST_SIZE, EDD_AsyncTestCallback) == EDD_OK, "request accepted");
+
+  /* The peripheral is busy for ~5 ms: the caller keeps working in the meantime */
+  EDD_AsyncTestCheck(EDD_CalcCrc8Async(EDD_AsyncTestData, 16u, EDD_AsyncTestCallback) == EDD_BUSY, "second request rejected while busy");
+  EDD_AsyncTestCheck(EDD_Crc8SetDriver(NULL) == EDD_BUSY, "driver change rejected while busy");
+  (void)EDD_CalcCrc8(&EDD_AsyncTestData[1], 64u, &otherCrc);
+
+  EDD_AsyncTestWait(before + 1u);
+  EDD_AsyncTestCheck(EDD_AsyncTestCrc == syncCrc, "asynchronous CRC equals EDD_CalcCrc8");
+}
+
+static void EDD_AsyncTestChain(void) {
+  uint8_t lastCrc = 0u;
+  uint32_t quarter = EDD_ASYNC_TEST_SIZE / EDD_ASYNC_TEST_CHAIN;
+  uint32_t before = EDD_AsyncTestCompleted;
+
+  (void)EDD_CalcCrc8(&EDD_AsyncTestData[(EDD_ASYNC_TEST_CHAIN - 1u) * quarter], quarter, &lastCrc);
+
+  EDD_AsyncTestChained = 1u;
+  EDD_AsyncTestCheck(EDD_CalcCrc8Async(EDD_AsyncTestData, quarter, EDD_AsyncTestChainCallback) == EDD_OK, "first chained request accepted");
+
+  EDD_AsyncTestWait(before + 1u);
+  EDD_AsyncTestCheck(EDD_AsyncTestChained == EDD_ASYNC_TEST_CHAIN, "all chained requests issued");
+  EDD_AsyncTestCheck(EDD_AsyncTestCrc == lastCrc, "last chained CRC");
+}
+
+static void EDD_AsyncTestConcurrent(void) {
+  pthread_t callers[EDD_ASYNC_TEST_CALLERS];
+  uint32_t round;
+  uint32_t i;
+  uint32_t before;
+
+  (void)pthread_barrier_init(&EDD_AsyncTestStart, NULL, EDD_ASYNC_TEST_CALLERS);
+
+  /* The request takes ~5 ms: of callers released together exactly one claims the engine */
+  for(round = 0u; round < EDD_ASYNC_TEST_ROUNDS; round++) {
+    before = EDD_AsyncTestCompleted;
+    EDD_AsyncTestAccepted = 0u;
+    for(i = 0u; i < EDD_ASYNC_TEST_CALLERS; i++) { (void)pthread_create(&callers[i], NULL, EDD_AsyncTestCaller, NULL); }
+    for(i = 0u; i < EDD_ASYNC_TEST_CALLERS; i++) { (void)pthread_join(callers[i], NULL); }
+
+    EDD_AsyncTestCheck(EDD_AsyncTestAccepted == 1u, "one of the concurrent requests accepted");
+    EDD_AsyncTestWait(before + 1u);
+  }
+
+  (void)pthread_barrier_destroy(&EDD_AsyncTestStart);
+}
+
+static void EDD_AsyncTestSoftwareDriver(void) {
+  uint8_t syncCrc = 0u;
+  uint32_t before = EDD_AsyncTestCompleted;
+
+  (void)EDD_CalcCrc8(EDD_AsyncTestData, 1000u, &syncCrc);
+
+  EDD_AsyncTestCheck(EDD_CalcCrc8Async(EDD_AsyncTestData, 1000u, EDD_AsyncTestCallback) == EDD_OK, "software request accepted");
+  EDD_AsyncTestCheck(EDD_AsyncTestCompleted == before + 1u, "software driver completes before returning");
+  EDD_AsyncTestCheck(EDD_AsyncTestCrc == syncCrc, "software CRC equals EDD_CalcCrc8");
+}
+
+int main(void) {
+  uint32_t i;
+
+  for(i = 0u; i < EDD_ASYNC_TEST_SIZE; i++) { EDD_AsyncTestData[i] = (uint8_t)((i * 131u) ^ (i >> 9)); }
+
+  EDD_AsyncTestCheck(EDD_CalcCrc8Async(NULL, 1u, EDD_AsyncTestCallback) == EDD_NULL_PTR, "NULL data rejected");
+  EDD_AsyncTestCheck(EDD_HostCrcEmuDriver.start(EDD_AsyncTestData, 1u, EDD_AsyncTestCallback) == EDD_BUSY, "emulator not started");
+
+  EDD_AsyncTestCheck(EDD_HostCrcEmuInit(EDD_ASYNC_TEST_NS_PER_BYTE) == EDD_OK, "emulator started");
+  EDD_AsyncTestCheck(EDD_HostCrcEmuInit(EDD_ASYNC_TEST_NS_PER_BYTE) == EDD_BUSY, "emulator started twice");
+  EDD_AsyncTestCheck(EDD_Crc8SetDriver(&EDD_HostCrcEmuDriver) == EDD_OK, "emulator driver selected");
+
+  EDD_AsyncTestOverlap();
+  EDD_AsyncTestChain();
+  EDD_AsyncTestConcurrent();
+
+  EDD_AsyncTestCheck(EDD_Crc8SetDriver(NULL) == EDD_OK, "software driver selected");
+  EDD_HostCrcEmuDeinit();
+
+  EDD_AsyncTestSoftwareDriver();
+
+  (void)printf("%s: %u failed check(s)\n", (EDD_AsyncTestFailures == 0u) ? "PASS" : "FAIL", (unsigned)EDD_AsyncTestFailures);
+
+  return (int)EDD_AsyncTestFailures;
+}
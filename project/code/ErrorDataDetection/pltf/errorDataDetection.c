@@ -1,6 +1,11 @@
 #include "errorDataDetection.h"
 #include "errorDataDetection_priv.h"
 
+#if(EDD_CRC8_CLMUL_AVAILABLE == 1u)
+#include <cpuid.h>
+#include <immintrin.h>
+#endif
+
 /**
  * @file errorDataDetection.c
  * @brief Error Data Detection module implementation.
@@ -9,20 +14,177 @@
  * This source file provides the implementation of the CRC-8 services exposed
  * by the module public API.
  *
- * The CRC computation is optimized through the use of a static precomputed table
- * stored in ROM/Flash memory. The main public services are:
+ * The CRC computation is optimized through the use of static precomputed tables
+ * stored in ROM/Flash memory (nibble table, byte table or slicing-by-N, see
+ * `EDD_CRC_MODE` in `errorDataDetection_cfg.h`). The main public services are:
  * - CRC computation on a complete buffer
  * - CRC verification against an expected CRC value
+ * - Batch CRC verification of many frames with interleaved computation
  * - CRC update byte-by-byte (streaming)
+ * - CRC streaming over chunks through a context (init / update / final)
+ * - Time-sliced background scan of registered memory regions
+ * - LIN classic and enhanced checksums (compute, verify, batch, streaming)
+ * - CRC protected RAM variables with round-robin verification
+ * - Asynchronous CRC-8 requests served by a software or peripheral driver
+ * - Optional CRC variants (CRC-8 SAE J1850, CRC-8H2F, CRC-16-CCITT, CRC-32,
+ *   CRC-32P4), each enabled separately in `errorDataDetection_cfg.h`
  *
  * This module is standalone and suitable for embedded systems with strict
- * performance requirements.
+ * performance requirements. On x86-64 host builds an additional CRC-8 kernel
+ * based on carry-less multiplication is selected at runtime (CPUID).
  */
 
 /* =============================
  *  Static Helpers Implementation
  * ============================= */
 
+/**
+ * @brief Software CRC-8 driver (default engine of the asynchronous API).
+ */
+static const EDD_Crc8DriverType EDD_Crc8SwDriver = {&EDD_Crc8SwStart};
+
+static const EDD_Crc8DriverType *EDD_Crc8ActiveDriver = &EDD_Crc8SwDriver; /**< Engine of EDD_CalcCrc8Async */
+static EDD_Crc8CallbackType EDD_Crc8AsyncCallback = NULL;                  /**< Callback of the request in progress */
+static volatile uint8_t EDD_Crc8AsyncBusy = 0u;                            /**< 1 while a request is in progress (cleared by the completion), see EDD_CRITICAL_SECTION_SUPPORT */
+
+#if(EDD_CRC8_CLMUL_AVAILABLE == 1u)
+/**
+ * @brief Cached CPUID result: -1 not queried yet, 0 not supported, 1 supported.
+ */
+static int8_t EDD_Crc8ClmulSupport = -1;
+
+/**
+ * @brief Load 16 bytes so that the first byte lands in the most significant lane.
+ */
+EDD_CLMUL_TARGET static inline __m128i EDD_Crc8ClmulLoad(const uint8_t *data, __m128i swap) {
+  return _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(const void *)data), swap);
+}
+
+/**
+ * @brief Multiply a 128-bit accumulator by x^n modulo P (congruent, not reduced).
+ *
+ * @param acc Accumulator.
+ * @param k   Fold constants: high qword = x^(n+64) mod P, low qword = x^n mod P.
+ */
+EDD_CLMUL_TARGET static inline __m128i EDD_Crc8ClmulFold(__m128i acc, __m128i k) {
+  return _mm_xor_si128(_mm_clmulepi64_si128(acc, k, 0x11), _mm_clmulepi64_si128(acc, k, 0x00));
+}
+
+/**
+ * @brief Report whether the CPU supports the CRC-8 folding kernel (private).
+ *
+ * @details
+ * Queries CPUID leaf 1 on first use (PCLMULQDQ and SSSE3 feature bits) and
+ * caches the answer. Concurrent first calls store the same value.
+ *
+ * @return 1 if the folding kernel can be used, 0 otherwise.
+ */
+static uint8_t EDD_Crc8ClmulIsSupported(void) {
+  unsigned int eax;
+  unsigned int ebx;
+  unsigned int ecx;
+  unsigned int edx;
+
+  if(EDD_Crc8ClmulSupport < 0) {
+    if((__get_cpuid(1u, &eax, &ebx, &ecx, &edx) != 0) && ((ecx & bit_PCLMUL) != 0u) && ((ecx & bit_SSSE3) != 0u)) {
+      EDD_Crc8ClmulSupport = 1;
+    } else {
+      EDD_Crc8ClmulSupport = 0;
+    }
+  }
+
+  return (EDD_Crc8ClmulSupport > 0) ? 1u : 0u;
+}
+
+/**
+ * @brief Compute CRC-8 with carry-less multiplication folding (private).
+ *
+ * @details
+ * The message is handled as a polynomial M(x) over GF(2), most significant bit
+ * of the first byte first (CRC-8/ATM is not reflected). The table engine returns
+ * `M(x) * x^8 mod P(x)`; any polynomial congruent to M(x) modulo P(x) therefore
+ * yields the same CRC.
+ *
+ * Four 128-bit accumulators are kept and, for every 64-byte block, each one
+ * (A = A_hi * x^64 + A_lo) is replaced by
+ * `A_hi * (x^576 mod P) XOR A_lo * (x^512 mod P) XOR next 16 bytes`.
+ * The constants have degree < 8, so every carry-less product fits in 72 bits and
+ * the accumulators never grow beyond 128 bits. The lanes are then merged with
+ * the 128-bit fold constants, the remaining full 16-byte blocks are folded one
+ * by one, and the 128-bit remainder is fed through the byte table, which
+ * performs the final reduction. The tail (< 16 bytes) continues with the table.
+ *
+ * @param crc    CRC accumulator to continue from (`EDD_CRC8_INIT` for a new message).
+ * @param data   Pointer to input buffer.
+ * @param length Size of input buffer in bytes.
+ *
+ * @return CRC-8 computed value.
+ */
+EDD_CLMUL_TARGET static uint8_t EDD_Crc8ComputeClmul(uint8_t crc, const uint8_t *data, uint32_t length) {
+  const __m128i swap = _mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+  const __m128i k128 = _mm_set_epi64x((long long)EDD_CRC8_CLMUL_X192, (long long)EDD_CRC8_CLMUL_X128);
+  const __m128i k512 = _mm_set_epi64x((long long)EDD_CRC8_CLMUL_X576, (long long)EDD_CRC8_CLMUL_X512);
+  uint8_t remainder[16];
+  uint32_t i = 0u;
+  uint32_t j;
+  __m128i acc0;
+  __m128i acc1;
+  __m128i acc2;
+  __m128i acc3;
+
+  if(length >= 16u) {
+    /* A running CRC c is equivalent to c XORed into the first message byte */
+    acc0 = _mm_xor_si128(EDD_Crc8ClmulLoad(data, swap), _mm_set_epi64x((long long)((uint64_t)crc << 56), 0));
+    crc = 0u;
+    i = 16u;
+
+    if(length >= 64u) {
+      acc1 = EDD_Crc8ClmulLoad(&data[16], swap);
+      acc2 = EDD_Crc8ClmulLoad(&data[32], swap);
+      acc3 = EDD_Crc8ClmulLoad(&data[48], swap);
+      i = 64u;
+
+      /* Four independent lanes hide the latency of the carry-less multiplier */
+      for(; (length - i) >= 64u; i += 64u) {
+        acc0 = _mm_xor_si128(EDD_Crc8ClmulFold(acc0, k512), EDD_Crc8ClmulLoad(&data[i], swap));
+        acc1 = _mm_xor_si128(EDD_Crc8ClmulFold(acc1, k512), EDD_Crc8ClmulLoad(&data[i + 16u], swap));
+        acc2 = _mm_xor_si128(EDD_Crc8ClmulFold(acc2, k512), EDD_Crc8ClmulLoad(&data[i + 32u], swap));
+        acc3 = _mm_xor_si128(EDD_Crc8ClmulFold(acc3, k512), EDD_Crc8ClmulLoad(&data[i + 48u], swap));
+      }
+
+      acc0 = _mm_xor_si128(EDD_Crc8ClmulFold(acc0, k128), acc1);
+      acc0 = _mm_xor_si128(EDD_Crc8ClmulFold(acc0, k128), acc2);
+      acc0 = _mm_xor_si128(EDD_Crc8ClmulFold(acc0, k128), acc3);
+    }
+
+    for(; (length - i) >= 16u; i += 16u) { acc0 = _mm_xor_si128(EDD_Crc8ClmulFold(acc0, k128), EDD_Crc8ClmulLoad(&data[i], swap)); }
+
+    /* Final reduction: CRC of the 128-bit remainder, most significant byte first */
+    _mm_storeu_si128((__m128i *)(void *)remainder, _mm_shuffle_epi8(acc0, swap));
+    for(j = 0u; j < 16u; j++) { crc = EDD_CRC8_BYTE_UPDATE(crc, remainder[j]); }
+  }
+
+  for(; i < length; i++) { crc = EDD_CRC8_BYTE_UPDATE(crc, data[i]); }
+
+  return crc;
+}
+#endif
+
+#if(EDD_CRC_MODE == EDD_CRC_MODE_NIBBLE)
+/**
+ * @brief Advance the CRC-8 register by four bits (private).
+ *
+ * @details
+ * The high nibble of the register selects the 16-entry table entry, which is
+ * XORed with the low nibble moved up. Two steps process one input byte.
+ *
+ * @param crc CRC register (already XORed with the input byte).
+ *
+ * @return CRC register after four bit steps.
+ */
+static uint8_t EDD_Crc8NibbleStep(uint8_t crc) { return (uint8_t)((uint8_t)(crc << 4) ^ EDD_Crc8NibbleTable[crc >> 4]); }
+#endif
+
 /**
  * @brief Compute CRC-8 over a data buffer (private).
  *
@@ -30,52 +192,794 @@
  * Performs an optimized CRC-8 computation using a lookup table.
  * It assumes input parameters have already been validated by the caller.
  *
+ * When `EDD_CRC_MODE` selects slicing-by-4 or -8 the bulk of the buffer is consumed
+ * N bytes at a time through the slicing tables; only the first lookup of each
+ * block depends on the running CRC. The remaining tail (< N bytes) is processed
+ * by the byte-serial loop.
+ *
+ * Buffers of at least `EDD_CRC8_CLMUL_MIN_LENGTH` bytes are dispatched to the
+ * carry-less multiplication folding kernel when it is compiled in and the CPU
+ * supports it (runtime CPUID check).
+ *
+ * The computation continues from `crc`, which allows a message to be processed
+ * in several chunks (see the `EDD_Crc8Ctx` streaming API).
+ *
+ * @param crc    CRC accumulator to continue from (`EDD_CRC8_INIT` for a new message).
  * @param data   Pointer to input buffer.
  * @param length Size of input buffer in bytes.
  *
  * @return CRC-8 computed value.
  */
-static uint8_t EDD_Crc8ComputeInternal(const uint8_t *data, uint8_t length) {
-  uint8_t crc = EDD_CRC8_INIT;
-  uint8_t i;
+static uint8_t EDD_Crc8ComputeInternal(uint8_t crc, const uint8_t *data, uint32_t length) {
+  uint32_t i = 0u;
+
+#if(EDD_CRC8_CLMUL_AVAILABLE == 1u)
+  if((length >= EDD_CRC8_CLMUL_MIN_LENGTH) && (EDD_Crc8ClmulIsSupported() != 0u)) { return EDD_Crc8ComputeClmul(crc, data, length); }
+#endif
+
+#if(EDD_CRC_MODE == EDD_CRC_MODE_SLICE8)
+  for(; (length - i) >= 8u; i += 8u) {
+    crc = (uint8_t)(EDD_Crc8SliceTable[6][crc ^ data[i]] ^ EDD_Crc8SliceTable[5][data[i + 1u]] ^ EDD_Crc8SliceTable[4][data[i + 2u]] ^ EDD_Crc8SliceTable[3][data[i + 3u]] ^
+                    EDD_Crc8SliceTable[2][data[i + 4u]] ^ EDD_Crc8SliceTable[1][data[i + 5u]] ^ EDD_Crc8SliceTable[0][data[i + 6u]] ^ EDD_Crc8Table[data[i + 7u]]);
+  }
+#elif(EDD_CRC_MODE == EDD_CRC_MODE_SLICE4)
+  for(; (length - i) >= 4u; i += 4u) {
+    crc = (uint8_t)(EDD_Crc8SliceTable[2][crc ^ data[i]] ^ EDD_Crc8SliceTable[1][data[i + 1u]] ^ EDD_Crc8SliceTable[0][data[i + 2u]] ^ EDD_Crc8Table[data[i + 3u]]);
+  }
+#endif
+
+  for(; i < length; i++) { crc = EDD_CRC8_BYTE_UPDATE(crc, data[i]); }
+
+  return crc;
+}
+
+/**
+ * @brief Compute the CRC-8 of several frames interleaved (private).
+ *
+ * @details
+ * One byte of every frame is consumed per iteration over the shortest frame
+ * length. Each frame has its own accumulator, so the table lookups of one
+ * iteration are independent and their latencies overlap. The remaining bytes
+ * of the longer frames are processed by @ref EDD_Crc8ComputeInternal.
+ *
+ * @param frames  `EDD_CRC8_BATCH_STREAMS` frame descriptors (already validated).
+ * @param crc_out Receives the computed CRC-8 values.
+ */
+static void EDD_Crc8ComputeInterleaved(const EDD_Crc8FrameType *frames, uint8_t *crc_out) {
+  const uint8_t *d0 = frames[0].data;
+  const uint8_t *d1 = frames[1].data;
+  const uint8_t *d2 = frames[2].data;
+  const uint8_t *d3 = frames[3].data;
+  uint8_t c0 = EDD_CRC8_INIT;
+  uint8_t c1 = EDD_CRC8_INIT;
+  uint8_t c2 = EDD_CRC8_INIT;
+  uint8_t c3 = EDD_CRC8_INIT;
+#if(EDD_CRC8_BATCH_STREAMS == 8u)
+  const uint8_t *d4 = frames[4].data;
+  const uint8_t *d5 = frames[5].data;
+  const uint8_t *d6 = frames[6].data;
+  const uint8_t *d7 = frames[7].data;
+  uint8_t c4 = EDD_CRC8_INIT;
+  uint8_t c5 = EDD_CRC8_INIT;
+  uint8_t c6 = EDD_CRC8_INIT;
+  uint8_t c7 = EDD_CRC8_INIT;
+#endif
+  uint32_t common = frames[0].length;
+  uint32_t i;
+  uint8_t s;
+
+  for(s = 1u; s < EDD_CRC8_BATCH_STREAMS; s++) {
+    if(frames[s].length < common) { common = frames[s].length; }
+  }
+
+  /* Independent accumulators: the table loads of one iteration overlap */
+  for(i = 0u; i < common; i++) {
+    c0 = EDD_CRC8_BYTE_UPDATE(c0, d0[i]);
+    c1 = EDD_CRC8_BYTE_UPDATE(c1, d1[i]);
+    c2 = EDD_CRC8_BYTE_UPDATE(c2, d2[i]);
+    c3 = EDD_CRC8_BYTE_UPDATE(c3, d3[i]);
+#if(EDD_CRC8_BATCH_STREAMS == 8u)
+    c4 = EDD_CRC8_BYTE_UPDATE(c4, d4[i]);
+    c5 = EDD_CRC8_BYTE_UPDATE(c5, d5[i]);
+    c6 = EDD_CRC8_BYTE_UPDATE(c6, d6[i]);
+    c7 = EDD_CRC8_BYTE_UPDATE(c7, d7[i]);
+#endif
+  }
+
+  crc_out[0] = c0;
+  crc_out[1] = c1;
+  crc_out[2] = c2;
+  crc_out[3] = c3;
+#if(EDD_CRC8_BATCH_STREAMS == 8u)
+  crc_out[4] = c4;
+  crc_out[5] = c5;
+  crc_out[6] = c6;
+  crc_out[7] = c7;
+#endif
+
+  for(s = 0u; s < EDD_CRC8_BATCH_STREAMS; s++) {
+    if(frames[s].length > common) { crc_out[s] = EDD_Crc8ComputeInternal(crc_out[s], &frames[s].data[common], frames[s].length - common); }
+  }
+}
+
+/**
+ * @brief Multiply two CRC-8 remainders modulo the CRC-8 polynomial (private).
+ *
+ * @details
+ * Shift-and-add multiplication in GF(2)[x]: for every set bit of `b` the
+ * current multiple of `a` is accumulated, and `a` is multiplied by x with the
+ * polynomial reduction applied on overflow of bit 7.
+ *
+ * @param a First factor.
+ * @param b Second factor.
+ *
+ * @return `a * b mod P`.
+ */
+static uint8_t EDD_Crc8GfMul(uint8_t a, uint8_t b) {
+  uint8_t product = 0u;
+  uint8_t bit;
+
+  for(bit = 0u; bit < 8u; bit++) {
+    if((b & 0x01u) != 0u) { product ^= a; }
+    b >>= 1;
+    a = ((a & 0x80u) != 0u) ? (uint8_t)((uint8_t)(a << 1) ^ EDD_CRC8_POLY) : (uint8_t)(a << 1);
+  }
+
+  return product;
+}
+
+/**
+ * @brief Advance a CRC-8 accumulator over `length` zero bytes (private).
+ *
+ * @details
+ * One zero byte multiplies the accumulator by x^8 mod P, which equals the
+ * polynomial constant `EDD_CRC8_POLY`. The factor x^(8 * length) is built by
+ * square-and-multiply over the bits of `length`, so a shift over 4 GB of zeros
+ * costs at most 32 squarings and 32 multiplications.
+ *
+ * @param crc    CRC accumulator.
+ * @param length Number of zero bytes.
+ *
+ * @return `crc * x^(8 * length) mod P`.
+ */
+static uint8_t EDD_Crc8ShiftZeros(uint8_t crc, uint32_t length) {
+  uint8_t power = EDD_CRC8_POLY; /* x^8 mod P */
 
-  for(i = 0u; i < length; i++) { crc = EDD_Crc8Table[crc ^ data[i]]; }
+  while(length != 0u) {
+    if((length & 0x01u) != 0u) { crc = EDD_Crc8GfMul(crc, power); }
+    power = EDD_Crc8GfMul(power, power);
+    length >>= 1;
+  }
 
   return crc;
 }
 
+static EDD_ReturnType EDD_Crc8SwStart(const uint8_t *data, uint32_t length, EDD_Crc8DoneType done) {
+  done(EDD_Crc8ComputeInternal(EDD_CRC8_INIT, data, length));
+
+  return EDD_OK;
+}
+
+static void EDD_Crc8AsyncDone(uint8_t crc) {
+  EDD_Crc8CallbackType callback = EDD_Crc8AsyncCallback;
+
+  /* Free the engine before the callback, so that it can chain the next request */
+  EDD_ENTER_CRITICAL();
+  EDD_Crc8AsyncBusy = 0u;
+  EDD_EXIT_CRITICAL();
+  callback(crc);
+}
+
+/**
+ * @brief Add a buffer to a LIN checksum accumulator (private).
+ *
+ * @details
+ * Four bytes are assembled into a word (alignment and endianness independent)
+ * and added to the 32-bit accumulator; the carry out is added back at once
+ * (end-around carry). The remaining 1..3 bytes are added the same way.
+ *
+ * @param sum    Accumulator to continue from.
+ * @param data   Pointer to input buffer.
+ * @param length Size of input buffer in bytes.
+ *
+ * @return Updated 32-bit accumulator.
+ */
+static uint32_t EDD_LinSumInternal(uint32_t sum, const uint8_t *data, uint32_t length) {
+  uint32_t word;
+  uint32_t i = 0u;
+
+  for(; (length - i) >= 4u; i += 4u) {
+    word = (uint32_t)data[i] | ((uint32_t)data[i + 1u] << 8) | ((uint32_t)data[i + 2u] << 16) | ((uint32_t)data[i + 3u] << 24);
+    sum += word;
+    sum += (sum < word) ? 1u : 0u;
+  }
+
+  for(; i < length; i++) {
+    sum += data[i];
+    sum += (sum < data[i]) ? 1u : 0u;
+  }
+
+  return sum;
+}
+
+/**
+ * @brief Fold a 32-bit LIN accumulator to the checksum byte (private).
+ *
+ * @param sum 32-bit ones' complement accumulator.
+ *
+ * @return Inverted 8-bit sum.
+ */
+static uint8_t EDD_LinFold(uint32_t sum) {
+  sum = (sum & 0xFFFFu) + (sum >> 16);
+  sum = (sum & 0xFFFFu) + (sum >> 16);
+  sum = (sum & 0xFFu) + (sum >> 8);
+  sum = (sum & 0xFFu) + (sum >> 8);
+
+  return (uint8_t)~sum;
+}
+
+#if(EDD_CRC8_SAE_J1850_SUPPORT == 1u) || (EDD_CRC8H2F_SUPPORT == 1u)
+/**
+ * @brief Compute an MSB-first CRC-8 over a given lookup table (private).
+ *
+ * @details
+ * Shared by the CRC-8 SAE J1850 and CRC-8H2F services; the caller provides
+ * the start value and applies the final XOR.
+ *
+ * @param table  256-entry lookup table of the CRC-8 variant.
+ * @param crc    CRC accumulator to continue from.
+ * @param data   Pointer to input buffer.
+ * @param length Size of input buffer in bytes.
+ *
+ * @return Updated CRC-8 accumulator.
+ */
+static uint8_t EDD_Crc8ComputeTable(const uint8_t table[256], uint8_t crc, const uint8_t *data, uint32_t length) {
+  uint32_t i;
+
+  for(i = 0u; i < length; i++) { crc = table[crc ^ data[i]]; }
+
+  return crc;
+}
+#endif
+
+#if(EDD_CRC16_SUPPORT == 1u)
+/**
+ * @brief Compute CRC-16-CCITT over a data buffer (private).
+ *
+ * @param crc    CRC accumulator to continue from.
+ * @param data   Pointer to input buffer.
+ * @param length Size of input buffer in bytes.
+ *
+ * @return Updated CRC-16 accumulator.
+ */
+static uint16_t EDD_Crc16ComputeInternal(uint16_t crc, const uint8_t *data, uint32_t length) {
+  uint32_t i;
+
+  for(i = 0u; i < length; i++) { crc = (uint16_t)((uint16_t)(crc << 8) ^ EDD_Crc16Table[(uint8_t)(crc >> 8) ^ data[i]]); }
+
+  return crc;
+}
+#endif
+
+#if(EDD_CRC32_SUPPORT == 1u) || (EDD_CRC32P4_SUPPORT == 1u)
+/**
+ * @brief Compute a reflected CRC-32 over a given lookup table (private).
+ *
+ * @details
+ * Shared by the CRC-32 and CRC-32P4 services; the caller provides the start
+ * value and applies the final XOR.
+ *
+ * @param table  256-entry lookup table of the CRC-32 variant.
+ * @param crc    CRC accumulator to continue from.
+ * @param data   Pointer to input buffer.
+ * @param length Size of input buffer in bytes.
+ *
+ * @return Updated CRC-32 accumulator.
+ */
+static uint32_t EDD_Crc32ComputeTable(const uint32_t table[256], uint32_t crc, const uint8_t *data, uint32_t length) {
+  uint32_t i;
+
+  for(i = 0u; i < length; i++) { crc = (crc >> 8) ^ table[(uint8_t)crc ^ data[i]]; }
+
+  return crc;
+}
+#endif
+
 /* =============================
  *  Public API Implementation
  * ============================= */
 
-EDD_ReturnType EDD_CalcCrc8(const uint8_t *data, uint8_t length, uint8_t *crc_out) {
+EDD_ReturnType EDD_CalcCrc8(const uint8_t *data, uint32_t length, uint8_t *crc_out) {
   if((data == NULL) || (crc_out == NULL)) { return EDD_NULL_PTR; }
 
   if(length == 0u) { return EDD_INVALID_LENGTH; }
 
-  *crc_out = EDD_Crc8ComputeInternal(data, length);
+  *crc_out = EDD_Crc8ComputeInternal(EDD_CRC8_INIT, data, length);
+
+  return EDD_OK;
+}
+
+EDD_ReturnType EDD_CalcCrc8Sg(const EDD_Crc8SegmentType *segments, uint16_t count, uint8_t *crc_out) {
+  uint8_t crc = EDD_CRC8_INIT;
+  uint8_t hasData = 0u;
+  uint16_t i;
+
+  if((segments == NULL) || (crc_out == NULL)) { return EDD_NULL_PTR; }
+
+  for(i = 0u; i < count; i++) {
+    if(segments[i].length > 0u) {
+      if(segments[i].data == NULL) { return EDD_NULL_PTR; }
+      hasData = 1u;
+    }
+  }
+
+  if(hasData == 0u) { return EDD_INVALID_LENGTH; }
+
+  /* The accumulator runs across segment boundaries: no assembly buffer needed */
+  for(i = 0u; i < count; i++) {
+    if(segments[i].length > 0u) { crc = EDD_Crc8ComputeInternal(crc, segments[i].data, segments[i].length); }
+  }
+
+  *crc_out = crc;
 
   return EDD_OK;
 }
 
-EDD_ReturnType EDD_VerifyCrc8(const uint8_t *data, uint8_t length, uint8_t expected_crc, uint8_t *result_out) {
+EDD_ReturnType EDD_VerifyCrc8(const uint8_t *data, uint32_t length, uint8_t expected_crc, uint8_t *result_out) {
   uint8_t computed;
 
   if((data == NULL) || (result_out == NULL)) { return EDD_NULL_PTR; }
 
   if(length == 0u) { return EDD_INVALID_LENGTH; }
 
-  computed = EDD_Crc8ComputeInternal(data, length);
+  computed = EDD_Crc8ComputeInternal(EDD_CRC8_INIT, data, length);
 
   *result_out = (computed == expected_crc) ? 1u : 0u;
 
   return EDD_OK;
 }
 
+EDD_ReturnType EDD_VerifyCrc8Batch(const EDD_Crc8FrameType *frames, uint16_t count, uint8_t *result_bitmap) {
+  uint8_t crc[EDD_CRC8_BATCH_STREAMS];
+  uint16_t i;
+  uint8_t s;
+
+  if((frames == NULL) || (result_bitmap == NULL)) { return EDD_NULL_PTR; }
+
+  for(i = 0u; i < count; i++) {
+    if(frames[i].data == NULL) { return EDD_NULL_PTR; }
+    if(frames[i].length == 0u) { return EDD_INVALID_LENGTH; }
+  }
+
+  for(i = 0u; i < (uint16_t)((count + 7u) / 8u); i++) { result_bitmap[i] = 0u; }
+
+  for(i = 0u; ((uint32_t)count - i) >= EDD_CRC8_BATCH_STREAMS; i += EDD_CRC8_BATCH_STREAMS) {
+    EDD_Crc8ComputeInterleaved(&frames[i], crc);
+
+    for(s = 0u; s < EDD_CRC8_BATCH_STREAMS; s++) {
+      if(crc[s] == frames[i + s].expectedCrc) { result_bitmap[(i + s) >> 3] |= (uint8_t)(1u << ((i + s) & 7u)); }
+    }
+  }
+
+  for(; i < count; i++) {
+    if(EDD_Crc8ComputeInternal(EDD_CRC8_INIT, frames[i].data, frames[i].length) == frames[i].expectedCrc) { result_bitmap[i >> 3] |= (uint8_t)(1u << (i & 7u)); }
+  }
+
+  return EDD_OK;
+}
+
 EDD_ReturnType EDD_Crc8Update(uint8_t *crc_in_out, uint8_t byte) {
   if(crc_in_out == NULL) { return EDD_NULL_PTR; }
 
-  *crc_in_out = EDD_Crc8Table[(*crc_in_out) ^ byte];
+  *crc_in_out = EDD_CRC8_BYTE_UPDATE(*crc_in_out, byte);
+
+  return EDD_OK;
+}
+
+EDD_ReturnType EDD_Crc8CtxInit(EDD_Crc8Ctx *ctx) {
+  if(ctx == NULL) { return EDD_NULL_PTR; }
+
+  ctx->crc = EDD_CRC8_INIT;
+
+  return EDD_OK;
+}
+
+EDD_ReturnType EDD_Crc8CtxUpdate(EDD_Crc8Ctx *ctx, const uint8_t *data, uint32_t length) {
+  if((ctx == NULL) || (data == NULL)) { return EDD_NULL_PTR; }
+
+  if(length > 0u) { ctx->crc = EDD_Crc8ComputeInternal(ctx->crc, data, length); }
+
+  return EDD_OK;
+}
+
+EDD_ReturnType EDD_Crc8CtxFinal(const EDD_Crc8Ctx *ctx, uint8_t *crc_out) {
+  if((ctx == NULL) || (crc_out == NULL)) { return EDD_NULL_PTR; }
+
+  *crc_out = ctx->crc;
+
+  return EDD_OK;
+}
+
+EDD_ReturnType EDD_Crc8Combine(uint8_t crcA, uint8_t crcB, uint32_t lengthB, uint8_t *crc_out) {
+  if(crc_out == NULL) { return EDD_NULL_PTR; }
+
+  /* Init and XOROut are 0x00: CRC(A || B) = CRC(A) * x^(8 * |B|) + CRC(B) */
+  *crc_out = (uint8_t)(EDD_Crc8ShiftZeros(crcA, lengthB) ^ crcB);
+
+  return EDD_OK;
+}
+
+EDD_ReturnType EDD_Crc8Patch(uint8_t oldCrc, uint32_t offset, const uint8_t *oldBytes, const uint8_t *newBytes, uint32_t length, uint32_t totalLength, uint8_t *crc_out) {
+  uint8_t delta = EDD_CRC8_INIT;
+  uint32_t i;
+
+  if((oldBytes == NULL) || (newBytes == NULL) || (crc_out == NULL)) { return EDD_NULL_PTR; }
+
+  if((length == 0u) || (length > totalLength) || (offset > (totalLength - length))) { return EDD_INVALID_LENGTH; }
+
+  /* CRC of the difference pattern; the zero bytes in front of it do not change it */
+  for(i = 0u; i < length; i++) { delta = EDD_CRC8_BYTE_UPDATE(delta, (uint8_t)(oldBytes[i] ^ newBytes[i])); }
+
+  /* Move the difference to its position: zero bytes behind the patched area */
+  *crc_out = (uint8_t)(oldCrc ^ EDD_Crc8ShiftZeros(delta, totalLength - offset - length));
+
+  return EDD_OK;
+}
+
+EDD_ReturnType EDD_GetCrc8ModeInfo(EDD_Crc8ModeInfoType *info) {
+  if(info == NULL) { return EDD_NULL_PTR; }
+
+  info->mode = (uint8_t)EDD_CRC_MODE;
+#if(EDD_CRC_MODE == EDD_CRC_MODE_NIBBLE)
+  info->tableBytes = (uint16_t)sizeof(EDD_Crc8NibbleTable);
+#elif(EDD_CRC_MODE == EDD_CRC_MODE_TABLE)
+  info->tableBytes = (uint16_t)sizeof(EDD_Crc8Table);
+#else
+  info->tableBytes = (uint16_t)(sizeof(EDD_Crc8Table) + sizeof(EDD_Crc8SliceTable));
+#endif
+  info->cyclesPerByte = (uint8_t)EDD_CRC8_NOMINAL_CYCLES_PER_BYTE;
+
+  return EDD_OK;
+}
+
+EDD_ReturnType EDD_ScanInit(EDD_ScanCtx *ctx, const EDD_ScanRegionType *regions, uint16_t count, uint32_t budget) {
+  uint16_t i;
+
+  if((ctx == NULL) || (regions == NULL)) { return EDD_NULL_PTR; }
+
+  if((count == 0u) || (budget == 0u)) { return EDD_INVALID_LENGTH; }
+
+  for(i = 0u; i < count; i++) {
+    if(regions[i].data == NULL) { return EDD_NULL_PTR; }
+    if(regions[i].length == 0u) { return EDD_INVALID_LENGTH; }
+  }
+
+  ctx->regions = regions;
+  ctx->regionCount = count;
+  ctx->budget = budget;
+  ctx->region = 0u;
+  ctx->offset = 0u;
+  ctx->crc = EDD_CRC8_INIT;
+  ctx->failedRegions = 0u;
+  ctx->firstFailed = 0u;
+  ctx->lastPassFailedRegions = 0u;
+  ctx->lastPassFirstFailed = 0u;
+  ctx->passCount = 0u;
+
+  return EDD_OK;
+}
+
+EDD_ReturnType EDD_ScanStep(EDD_ScanCtx *ctx, EDD_ScanResultType *result_out) {
+  const EDD_ScanRegionType *region;
+  uint32_t left;
+  uint32_t chunk;
+
+  if((ctx == NULL) || (result_out == NULL)) { return EDD_NULL_PTR; }
+
+  left = ctx->budget;
+  *result_out = EDD_SCAN_BUSY;
+
+  while(left > 0u) {
+    region = &ctx->regions[ctx->region];
+    chunk = region->length - ctx->offset;
+    if(chunk > left) { chunk = left; }
+
+    ctx->crc = EDD_Crc8ComputeInternal(ctx->crc, &region->data[ctx->offset], chunk);
+    ctx->offset += chunk;
+    left -= chunk;
+
+    if(ctx->offset == region->length) {
+      if(ctx->crc != region->expectedCrc) {
+        if(ctx->failedRegions == 0u) { ctx->firstFailed = ctx->region; }
+        ctx->failedRegions++;
+      }
+
+      ctx->region++;
+      ctx->offset = 0u;
+      ctx->crc = EDD_CRC8_INIT;
+
+      if(ctx->region == ctx->regionCount) {
+        /* End of pass: publish the verdict and restart, one verdict per step */
+        ctx->lastPassFailedRegions = ctx->failedRegions;
+        ctx->lastPassFirstFailed = ctx->firstFailed;
+        ctx->passCount++;
+        *result_out = (ctx->failedRegions == 0u) ? EDD_SCAN_PASS_OK : EDD_SCAN_PASS_FAILED;
+
+        ctx->region = 0u;
+        ctx->failedRegions = 0u;
+        ctx->firstFailed = 0u;
+        break;
+      }
+    }
+  }
+
+  return EDD_OK;
+}
+
+EDD_ReturnType EDD_ProtInit(EDD_ProtSetType *set, EDD_ProtVarType *vars, uint16_t count, uint16_t perTick) {
+  uint16_t i;
+
+  if((set == NULL) || (vars == NULL)) { return EDD_NULL_PTR; }
+
+  if((count == 0u) || (perTick == 0u)) { return EDD_INVALID_LENGTH; }
+
+  for(i = 0u; i < count; i++) {
+    if(vars[i].data == NULL) { return EDD_NULL_PTR; }
+    if(vars[i].length == 0u) { return EDD_INVALID_LENGTH; }
+  }
+
+  for(i = 0u; i < count; i++) { vars[i].crc = EDD_Crc8ComputeInternal(EDD_CRC8_INIT, vars[i].data, vars[i].length); }
+
+  set->vars = vars;
+  set->varCount = count;
+  set->perTick = (perTick < count) ? perTick : count;
+  set->next = 0u;
+  set->lastFailed = 0u;
+  set->firstFailed = 0u;
+  set->failCount = 0u;
+
+  return EDD_OK;
+}
+
+EDD_ReturnType EDD_ProtWrite(EDD_ProtVarType *var, uint16_t offset, const uint8_t *src, uint16_t length) {
+  uint16_t i;
+
+  if((var == NULL) || (var->data == NULL) || (src == NULL)) { return EDD_NULL_PTR; }
+
+  if((length == 0u) || (length > var->length) || (offset > (uint16_t)(var->length - length))) { return EDD_INVALID_LENGTH; }
+
+  /* Arguments are valid, the patch cannot fail */
+  (void)EDD_Crc8Patch(var->crc, offset, &var->data[offset], src, length, var->length, &var->crc);
+
+  for(i = 0u; i < length; i++) { var->data[offset + i] = src[i]; }
+
+  return EDD_OK;
+}
+
+EDD_ReturnType EDD_ProtVerifyStep(EDD_ProtSetType *set, uint16_t *failed_out) {
+  const EDD_ProtVarType *var;
+  uint16_t failed = 0u;
+  uint16_t i;
+
+  if((set == NULL) || (failed_out == NULL)) { return EDD_NULL_PTR; }
+
+  for(i = 0u; i < set->perTick; i++) {
+    var = &set->vars[set->next];
+    if(EDD_Crc8ComputeInternal(EDD_CRC8_INIT, var->data, var->length) != var->crc) {
+      if(failed == 0u) { set->firstFailed = set->next; }
+      failed++;
+    }
+
+    set->next++;
+    if(set->next == set->varCount) { set->next = 0u; }
+  }
+
+  set->lastFailed = failed;
+  set->failCount = ((UINT32_MAX - set->failCount) < failed) ? UINT32_MAX : (set->failCount + failed);
+  *failed_out = failed;
+
+  return EDD_OK;
+}
+
+EDD_ReturnType EDD_ProtGetWorstCase(const EDD_ProtSetType *set, EDD_ProtWorstCaseType *wc_out) {
+  uint16_t maxLength = 0u;
+  uint16_t i;
+
+  if((set == NULL) || (wc_out == NULL)) { return EDD_NULL_PTR; }
+
+  for(i = 0u; i < set->varCount; i++) {
+    if(set->vars[i].length > maxLength) { maxLength = set->vars[i].length; }
+  }
+
+  wc_out->detectionTicks = (uint16_t)(((uint32_t)set->varCount + set->perTick - 1u) / set->perTick);
+  wc_out->bytesPerTick = (uint32_t)set->perTick * maxLength;
+
+  return EDD_OK;
+}
+
+EDD_ReturnType EDD_CalcLinClassic(const uint8_t *data, uint32_t length, uint8_t *checksum_out) {
+  if((data == NULL) || (checksum_out == NULL)) { return EDD_NULL_PTR; }
+
+  if(length == 0u) { return EDD_INVALID_LENGTH; }
+
+  *checksum_out = EDD_LinFold(EDD_LinSumInternal(EDD_LIN_SUM_INIT, data, length));
+
+  return EDD_OK;
+}
+
+EDD_ReturnType EDD_CalcLinEnhanced(uint8_t pid, const uint8_t *data, uint32_t length, uint8_t *checksum_out) {
+  if((data == NULL) || (checksum_out == NULL)) { return EDD_NULL_PTR; }
+
+  if(length == 0u) { return EDD_INVALID_LENGTH; }
+
+  *checksum_out = EDD_LinFold(EDD_LinSumInternal(pid, data, length));
+
+  return EDD_OK;
+}
+
+EDD_ReturnType EDD_VerifyLinClassic(const uint8_t *data, uint32_t length, uint8_t expected, uint8_t *result_out) {
+  if((data == NULL) || (result_out == NULL)) { return EDD_NULL_PTR; }
+
+  if(length == 0u) { return EDD_INVALID_LENGTH; }
+
+  *result_out = (EDD_LinFold(EDD_LinSumInternal(EDD_LIN_SUM_INIT, data, length)) == expected) ? 1u : 0u;
+
+  return EDD_OK;
+}
+
+EDD_ReturnType EDD_VerifyLinEnhanced(uint8_t pid, const uint8_t *data, uint32_t length, uint8_t expected, uint8_t *result_out) {
+  if((data == NULL) || (result_out == NULL)) { return EDD_NULL_PTR; }
+
+  if(length == 0u) { return EDD_INVALID_LENGTH; }
+
+  *result_out = (EDD_LinFold(EDD_LinSumInternal(pid, data, length)) == expected) ? 1u : 0u;
+
+  return EDD_OK;
+}
+
+EDD_ReturnType EDD_VerifyLinBatch(const EDD_LinFrameType *frames, uint16_t count, uint8_t *result_bitmap) {
+  uint32_t sum;
+  uint16_t i;
+
+  if((frames == NULL) || (result_bitmap == NULL)) { return EDD_NULL_PTR; }
+
+  for(i = 0u; i < count; i++) {
+    if(frames[i].data == NULL) { return EDD_NULL_PTR; }
+    if(frames[i].length == 0u) { return EDD_INVALID_LENGTH; }
+  }
+
+  for(i = 0u; i < (uint16_t)((count + 7u) / 8u); i++) { result_bitmap[i] = 0u; }
+
+  for(i = 0u; i < count; i++) {
+    sum = (frames[i].model == EDD_LIN_ENHANCED) ? (uint32_t)frames[i].pid : EDD_LIN_SUM_INIT;
+    if(EDD_LinFold(EDD_LinSumInternal(sum, frames[i].data, frames[i].length)) == frames[i].expectedChecksum) { result_bitmap[i >> 3] |= (uint8_t)(1u << (i & 7u)); }
+  }
+
+  return EDD_OK;
+}
+
+EDD_ReturnType EDD_LinCtxInit(EDD_LinCtx *ctx, EDD_LinModelType model, uint8_t pid) {
+  if(ctx == NULL) { return EDD_NULL_PTR; }
+
+  ctx->sum = (model == EDD_LIN_ENHANCED) ? (uint32_t)pid : EDD_LIN_SUM_INIT;
+
+  return EDD_OK;
+}
+
+EDD_ReturnType EDD_LinCtxUpdate(EDD_LinCtx *ctx, const uint8_t *data, uint32_t length) {
+  if((ctx == NULL) || (data == NULL)) { return EDD_NULL_PTR; }
+
+  if(length > 0u) { ctx->sum = EDD_LinSumInternal(ctx->sum, data, length); }
+
+  return EDD_OK;
+}
+
+EDD_ReturnType EDD_LinCtxFinal(const EDD_LinCtx *ctx, uint8_t *checksum_out) {
+  if((ctx == NULL) || (checksum_out == NULL)) { return EDD_NULL_PTR; }
+
+  *checksum_out = EDD_LinFold(ctx->sum);
+
+  return EDD_OK;
+}
+
+EDD_ReturnType EDD_Crc8SetDriver(const EDD_Crc8DriverType *driver) {
+  EDD_ReturnType ret = EDD_BUSY;
+
+  EDD_ENTER_CRITICAL();
+  if(EDD_Crc8AsyncBusy == 0u) {
+    EDD_Crc8ActiveDriver = (driver != NULL) ? driver : &EDD_Crc8SwDriver;
+    ret = EDD_OK;
+  }
+  EDD_EXIT_CRITICAL();
+
+  return ret;
+}
+
+EDD_ReturnType EDD_CalcCrc8Async(const uint8_t *data, uint32_t length, EDD_Crc8CallbackType callback) {
+  EDD_ReturnType ret;
+  uint8_t busy;
+
+  if((data == NULL) || (callback == NULL)) { return EDD_NULL_PTR; }
+
+  if(length == 0u) { return EDD_INVALID_LENGTH; }
+
+  /* Test-and-set: of two concurrent callers only one claims the engine */
+  EDD_ENTER_CRITICAL();
+  busy = EDD_Crc8AsyncBusy;
+  EDD_Crc8AsyncBusy = 1u;
+  EDD_EXIT_CRITICAL();
+
+  if(busy != 0u) { return EDD_BUSY; }
+
+  EDD_Crc8AsyncCallback = callback;
+
+  /* The driver may complete (and call EDD_Crc8AsyncDone) before it returns */
+  ret = EDD_Crc8ActiveDriver->start(data, length, &EDD_Crc8AsyncDone);
+  if(ret != EDD_OK) {
+    EDD_ENTER_CRITICAL();
+    EDD_Crc8AsyncBusy = 0u;
+    EDD_EXIT_CRITICAL();
+  }
+
+  return ret;
+}
+
+#if(EDD_CRC8_SAE_J1850_SUPPORT == 1u)
+EDD_ReturnType EDD_CalcCrc8SaeJ1850(const uint8_t *data, uint32_t length, uint8_t *crc_out) {
+  if((data == NULL) || (crc_out == NULL)) { return EDD_NULL_PTR; }
+
+  if(length == 0u) { return EDD_INVALID_LENGTH; }
+
+  *crc_out = (uint8_t)(EDD_Crc8ComputeTable(EDD_Crc8SaeJ1850Table, EDD_CRC8_SAE_J1850_INIT, data, length) ^ EDD_CRC8_SAE_J1850_XOROUT);
+
+  return EDD_OK;
+}
+#endif
+
+#if(EDD_CRC8H2F_SUPPORT == 1u)
+EDD_ReturnType EDD_CalcCrc8H2F(const uint8_t *data, uint32_t length, uint8_t *crc_out) {
+  if((data == NULL) || (crc_out == NULL)) { return EDD_NULL_PTR; }
+
+  if(length == 0u) { return EDD_INVALID_LENGTH; }
+
+  *crc_out = (uint8_t)(EDD_Crc8ComputeTable(EDD_Crc8H2FTable, EDD_CRC8H2F_INIT, data, length) ^ EDD_CRC8H2F_XOROUT);
+
+  return EDD_OK;
+}
+#endif
+
+#if(EDD_CRC16_SUPPORT == 1u)
+EDD_ReturnType EDD_CalcCrc16(const uint8_t *data, uint32_t length, uint16_t *crc_out) {
+  if((data == NULL) || (crc_out == NULL)) { return EDD_NULL_PTR; }
+
+  if(length == 0u) { return EDD_INVALID_LENGTH; }
+
+  *crc_out = EDD_Crc16ComputeInternal(EDD_CRC16_INIT, data, length);
+
+  return EDD_OK;
+}
+#endif
+
+#if(EDD_CRC32_SUPPORT == 1u)
+EDD_ReturnType EDD_CalcCrc32(const uint8_t *data, uint32_t length, uint32_t *crc_out) {
+  if((data == NULL) || (crc_out == NULL)) { return EDD_NULL_PTR; }
+
+  if(length == 0u) { return EDD_INVALID_LENGTH; }
+
+  *crc_out = EDD_Crc32ComputeTable(EDD_Crc32Table, EDD_CRC32_INIT, data, length) ^ EDD_CRC32_XOROUT;
+
+  return EDD_OK;
+}
+#endif
+
+#if(EDD_CRC32P4_SUPPORT == 1u)
+EDD_ReturnType EDD_CalcCrc32P4(const uint8_t *data, uint32_t length, uint32_t *crc_out) {
+  if((data == NULL) || (crc_out == NULL)) { return EDD_NULL_PTR; }
+
+  if(length == 0u) { return EDD_INVALID_LENGTH; }
+
+  *crc_out = EDD_Crc32ComputeTable(EDD_Crc32P4Table, EDD_CRC32P4_INIT, data, length) ^ EDD_CRC32P4_XOROUT;
 
   return EDD_OK;
 }
+#endif
@@ -5,6 +5,7 @@
 extern "C" {
 #endif
 
+#include "errorDataDetection_cfg.h"
 #include <stddef.h>
 #include <stdint.h>
 
@@ -16,6 +17,9 @@ extern "C" {
  * This module provides CRC-8 computation and verification services for embedded
  * applications. The CRC is computed using a static lookup table (256 entries),
  * ensuring optimized runtime performance compared to bitwise CRC computation.
+ * The table layout is selected with `EDD_CRC_MODE`: a 16-entry nibble table for
+ * flash constrained parts, or additional slicing tables consuming 4 or 8 bytes
+ * per iteration, all with bit-identical results.
  *
  * The module is designed to be fully standalone:
  * - No dynamic memory allocation.
@@ -27,6 +31,21 @@ extern "C" {
  * - Init value: 0x00
  * - RefIn/RefOut: false
  * - XOROut: 0x00
+ *
+ * Further CRC variants (CRC-8 SAE J1850, CRC-8H2F, CRC-16-CCITT, CRC-32 and
+ * CRC-32P4) can be enabled individually in `errorDataDetection_cfg.h`. Their
+ * lookup tables are generated at compile time from the polynomial parameters;
+ * disabled variants cost neither code nor table space.
+ *
+ * Safety relevant RAM variables can be protected by a CRC-8 that writers update
+ * incrementally and a cyclic task checks round-robin (`EDD_Prot*`).
+ *
+ * Large buffers can also be handed to a CRC peripheral through a driver
+ * interface (@ref EDD_CalcCrc8Async); without driver the same request is served
+ * by the lookup table code.
+ *
+ * For LIN communication the module also provides the LIN 1.x classic and LIN 2.x
+ * enhanced checksums with the same service set (compute, verify, batch, streaming).
  */
 
 /* =============================
@@ -39,9 +58,223 @@ extern "C" {
 typedef enum {
   EDD_OK = 0,        /**< Operation completed successfully. */
   EDD_NULL_PTR,      /**< A required pointer argument was NULL. */
-  EDD_INVALID_LENGTH /**< Provided length was invalid (e.g. 0). */
+  EDD_INVALID_LENGTH, /**< Provided length was invalid (e.g. 0). */
+  EDD_BUSY,           /**< The CRC engine is still processing a previous request. */
+  EDD_INVALID_PARAM   /**< A configuration parameter was out of range. */
 } EDD_ReturnType;
 
+/* =============================
+ *  Types
+ * ============================= */
+
+/**
+ * @brief CRC-8 streaming context.
+ *
+ * @details
+ * Holds the running CRC accumulator of a message processed in several chunks.
+ * The content shall only be accessed through the `EDD_Crc8Ctx*` APIs.
+ */
+typedef struct {
+  uint8_t crc; /**< Running CRC-8 accumulator. */
+} EDD_Crc8Ctx;
+
+/**
+ * @brief Frame descriptor for batch CRC-8 verification.
+ */
+typedef struct {
+  const uint8_t *data;  /**< Frame buffer. */
+  uint32_t length;      /**< Frame length in bytes (> 0). */
+  uint8_t expectedCrc;  /**< CRC-8 the frame is verified against. */
+} EDD_Crc8FrameType;
+
+/**
+ * @brief One memory segment of a scattered message (see @ref EDD_CalcCrc8Sg).
+ */
+typedef struct {
+  const uint8_t *data; /**< Segment start (may be NULL if length is 0). */
+  uint32_t length;     /**< Segment length in bytes (0 = segment skipped). */
+} EDD_Crc8SegmentType;
+
+/**
+ * @brief Footprint and cost of the configured CRC-8 engine (see @ref EDD_GetCrc8ModeInfo).
+ */
+typedef struct {
+  uint8_t mode;          /**< Configured `EDD_CRC_MODE` value. */
+  uint16_t tableBytes;   /**< ROM used by the CRC-8 lookup tables in bytes. */
+  uint8_t cyclesPerByte; /**< Nominal CPU cycles per byte of the engine inner loop. */
+} EDD_Crc8ModeInfoType;
+
+/**
+ * @brief Memory region checked by the background scanner (see @ref EDD_ScanStep).
+ */
+typedef struct {
+  const uint8_t *data; /**< Region start (calibration block, code section, configuration table). */
+  uint32_t length;     /**< Region length in bytes (> 0). */
+  uint8_t expectedCrc; /**< Reference CRC-8 of the region. */
+} EDD_ScanRegionType;
+
+/**
+ * @brief Outcome of one background scanner step.
+ */
+typedef enum {
+  EDD_SCAN_BUSY = 0,   /**< Pass in progress, no verdict yet. */
+  EDD_SCAN_PASS_OK,    /**< Pass completed in this step, all regions matched. */
+  EDD_SCAN_PASS_FAILED /**< Pass completed in this step, at least one region mismatched. */
+} EDD_ScanResultType;
+
+/**
+ * @brief Background scanner context.
+ *
+ * @details
+ * Keeps the position and the partial CRC of a pass between two calls of
+ * @ref EDD_ScanStep. The position fields shall only be written by the
+ * `EDD_Scan*` APIs; the `lastPass*` fields and `passCount` may be read by the
+ * application after a step reported the end of a pass.
+ */
+typedef struct {
+  const EDD_ScanRegionType *regions; /**< Registered regions. */
+  uint16_t regionCount;              /**< Number of registered regions. */
+  uint32_t budget;                   /**< Maximum bytes processed per step. */
+  uint16_t region;                   /**< Region in progress. */
+  uint32_t offset;                   /**< Next byte to process in the region in progress. */
+  uint8_t crc;                       /**< Partial CRC-8 of the region in progress. */
+  uint16_t failedRegions;            /**< Mismatching regions of the pass in progress. */
+  uint16_t firstFailed;              /**< First mismatching region of the pass in progress. */
+  uint16_t lastPassFailedRegions;    /**< Mismatching regions of the last completed pass. */
+  uint16_t lastPassFirstFailed;      /**< First mismatching region of the last completed pass (valid if lastPassFailedRegions > 0). */
+  uint32_t passCount;                /**< Completed passes since EDD_ScanInit (wraps around). */
+} EDD_ScanCtx;
+
+/**
+ * @brief RAM variable protected by a CRC-8 (see @ref EDD_ProtWrite).
+ *
+ * @details
+ * The CRC-8 takes the role of a shadow copy at one byte per variable. Writes
+ * through @ref EDD_ProtWrite keep it up to date incrementally; reads access
+ * `data` directly and are checked later by @ref EDD_ProtVerifyStep.
+ */
+typedef struct {
+  uint8_t *data;   /**< Protected variable (e.g. a module context structure). */
+  uint16_t length; /**< Size of the variable in bytes (> 0). */
+  uint8_t crc;     /**< CRC-8 of the variable, maintained by the EDD_Prot* APIs. */
+} EDD_ProtVarType;
+
+/**
+ * @brief Set of protected variables checked round-robin.
+ *
+ * @details
+ * The position fields shall only be written by the `EDD_Prot*` APIs;
+ * `lastFailed`, `firstFailed` and `failCount` may be read by the application.
+ */
+typedef struct {
+  EDD_ProtVarType *vars; /**< Registered variables. */
+  uint16_t varCount;     /**< Number of registered variables. */
+  uint16_t perTick;      /**< Variables checked per EDD_ProtVerifyStep call. */
+  uint16_t next;         /**< Next variable to check. */
+  uint16_t lastFailed;   /**< Mismatching variables found by the last step. */
+  uint16_t firstFailed;  /**< First mismatching variable of the last step (valid if lastFailed > 0). */
+  uint32_t failCount;    /**< Mismatches found since EDD_ProtInit (saturates). */
+} EDD_ProtSetType;
+
+/**
+ * @brief Worst case figures of a protected variable set (see @ref EDD_ProtGetWorstCase).
+ */
+typedef struct {
+  uint16_t detectionTicks; /**< Steps between a corruption and its detection, at most. */
+  uint32_t bytesPerTick;   /**< Bytes checked by one step, at most. */
+} EDD_ProtWorstCaseType;
+
+/**
+ * @brief LIN checksum model.
+ */
+typedef enum {
+  EDD_LIN_CLASSIC = 0, /**< LIN 1.x classic checksum: data bytes only (also used for diagnostic frames 0x3C/0x3D). */
+  EDD_LIN_ENHANCED     /**< LIN 2.x enhanced checksum: protected identifier and data bytes. */
+} EDD_LinModelType;
+
+/**
+ * @brief Frame descriptor for batch LIN checksum verification.
+ */
+typedef struct {
+  const uint8_t *data;      /**< Frame data bytes. */
+  uint32_t length;          /**< Number of data bytes (> 0, 1..8 on the bus). */
+  uint8_t pid;              /**< Protected identifier (used by EDD_LIN_ENHANCED only). */
+  EDD_LinModelType model;   /**< Checksum model of the frame. */
+  uint8_t expectedChecksum; /**< Checksum byte the frame is verified against. */
+} EDD_LinFrameType;
+
+/**
+ * @brief LIN checksum streaming context.
+ *
+ * @details
+ * Holds the 32-bit carry-folded sum of the bytes processed so far. The content
+ * shall only be accessed through the `EDD_LinCtx*` APIs.
+ */
+typedef struct {
+  uint32_t sum; /**< Running ones' complement sum (not folded). */
+} EDD_LinCtx;
+
+/**
+ * @brief Completion callback of an asynchronous CRC-8 request (see @ref EDD_CalcCrc8Async).
+ *
+ * @details
+ * Called once per accepted request with the CRC-8 of the buffer, from the
+ * context that completes the request: inside @ref EDD_CalcCrc8Async for the
+ * software backend, from the CRC/DMA interrupt (or the emulator thread on the
+ * host) for a hardware backend.
+ */
+typedef void (*EDD_Crc8CallbackType)(uint8_t crc);
+
+/**
+ * @brief Completion hook handed by the module to a CRC-8 driver.
+ */
+typedef void (*EDD_Crc8DoneType)(uint8_t crc);
+
+/**
+ * @brief CRC-8 engine driver interface.
+ *
+ * @details
+ * A driver computes the CRC-8/ATM (poly 0x07, init 0x00, no reflection, no
+ * final XOR) of a buffer. `start` either returns `EDD_OK` and calls `done`
+ * exactly once when the result is available (before returning, or later from
+ * its interrupt), or returns an error without calling `done`.
+ */
+typedef struct {
+  EDD_ReturnType (*start)(const uint8_t *data, uint32_t length, EDD_Crc8DoneType done); /**< Start a computation. */
+} EDD_Crc8DriverType;
+
+/* =============================
+ *  Compile-time CRC-8
+ * ============================= */
+
+/**
+ * @brief CRC-8/ATM of one byte as an integer constant expression.
+ *
+ * @details
+ * The table entry `T[crc ^ byte]` is linear in its index, so it is written as the
+ * XOR of the entries of the single bits (`T[1 << b]` = 07, 0E, 1C, 38, 70, E0, C7, 89).
+ * The result can initialize enumeration constants and `const` objects, which lets
+ * the CRC of constant configuration data be stored next to the data without any
+ * run time work; the data can then be checked on demand with @ref EDD_VerifyCrc8.
+ *
+ * Longer data shall be chained through enumeration constants, one or two bytes
+ * per constant, to keep the macro expansion linear:
+ * @code
+ * enum { CFG_CRC_0 = EDD_CRC8_CT_U16(EDD_CRC8_CT_INIT, CFG_VALUE_A), CFG_CRC_1 = EDD_CRC8_CT_U16(CFG_CRC_0, CFG_VALUE_B) };
+ * const uint8_t Cfg_Crc = (uint8_t)CFG_CRC_1;
+ * @endcode
+ */
+#define EDD_CRC8_CT_BYTE(crc, byte)                                                                                                                                            \
+  ((((((crc) ^ (byte)) >> 0) & 1u) * 0x07u) ^ (((((crc) ^ (byte)) >> 1) & 1u) * 0x0Eu) ^ (((((crc) ^ (byte)) >> 2) & 1u) * 0x1Cu) ^                                           \
+   (((((crc) ^ (byte)) >> 3) & 1u) * 0x38u) ^ (((((crc) ^ (byte)) >> 4) & 1u) * 0x70u) ^ (((((crc) ^ (byte)) >> 5) & 1u) * 0xE0u) ^                                            \
+   (((((crc) ^ (byte)) >> 6) & 1u) * 0xC7u) ^ (((((crc) ^ (byte)) >> 7) & 1u) * 0x89u))
+
+/** @brief Compile-time CRC-8 of a 16-bit value stored little endian (low byte first). */
+#define EDD_CRC8_CT_U16(crc, value) EDD_CRC8_CT_BYTE(EDD_CRC8_CT_BYTE((crc), ((value) & 0xFFu)), (((value) >> 8) & 0xFFu))
+
+/** @brief Start value of a compile-time CRC-8 chain (same as the run time init value). */
+#define EDD_CRC8_CT_INIT (0x00u)
+
 /* =============================
  *  Public API
  * ============================= */
@@ -60,7 +293,9 @@ typedef enum {
  * - Validates the input pointers (`data`, `crc_out`).
  * - Validates that `length` is greater than zero.
  * - Initializes CRC accumulator with CRC init value (0x00).
- * - For each byte in the buffer:
+ * - If slicing-by-N is configured, for each block of N bytes:
+ *   - Updates CRC with `T(N-1)[crc XOR data[i]] XOR ... XOR T0[data[i+N-1]]`.
+ * - For each remaining byte in the buffer:
  *   - Computes table index as `crc XOR data[i]`.
  *   - Updates CRC with `table[index]`.
  * - Writes final CRC into `*crc_out`.
@@ -70,7 +305,7 @@ typedef enum {
  * | Interface  | In | Out | Data type / Signature        | Param | Data factor | Data offset | Data size | Data range     | Data unit |
  * |-----------|:--:|:---:|------------------------------|:-----:|------------:|------------:|----------:|----------------|----------|
  * | data      | X  |     | const uint8_t*               |   -   |      1      |      0      |  length  | [0,255]        | [-]      |
- * | length    | X  |     | uint8_t                       |   -   |      1      |      0      |     -    | [1..N]         | bytes    |
+ * | length    | X  |     | uint32_t                     |   -   |      1      |      0      |     -    | [1..2^32-1]    | bytes    |
  * | crc_out   | X  |  X  | uint8_t*                     |   -   |      1      |      0      |     1    | [0,255]        | [-]      |
  *
  * @par Activity diagram (PlantUML)
@@ -88,6 +323,10 @@ typedef enum {
  *   stop
  * endif
  * :crc = 0x00;
+ * while (length - i >= N) is (slicing-by-N)
+ *   :crc = T(N-1)[crc XOR data[i]] XOR ... XOR T0[data[i+N-1]];
+ *   :i = i + N;
+ * endwhile
  * while (i < length)
  *   :crc = Table[crc XOR data[i]];
  * endwhile
@@ -101,7 +340,66 @@ typedef enum {
  * - EDD_NULL_PTR if any input pointer is NULL.
  * - EDD_INVALID_LENGTH if length is 0.
  */
-EDD_ReturnType EDD_CalcCrc8(const uint8_t *data, uint8_t length, uint8_t *crc_out);
+EDD_ReturnType EDD_CalcCrc8(const uint8_t *data, uint32_t length, uint8_t *crc_out);
+
+/**
+ * @brief Compute CRC-8 over a message scattered across several memory segments.
+ *
+ * @details
+ * **Goal of the function**
+ *
+ * The purpose of this function is to compute the CRC-8 of a message whose parts
+ * live in different buffers (header fields, payload buffer, data ID) without
+ * first copying them into one contiguous buffer. The result equals
+ * @ref EDD_CalcCrc8 over the concatenation of the segments in list order.
+ *
+ * The processing logic:
+ * - Validates input pointers (`segments`, `crc_out`).
+ * - Validates every segment: a non-empty segment needs a data pointer.
+ * - Validates that at least one segment is non-empty.
+ * - Runs the CRC engine over each non-empty segment, continuing from the
+ *   accumulator of the previous segment (single pass, no copy).
+ * - Writes final CRC into `*crc_out`.
+ *
+ * @par Interface summary
+ *
+ * | Interface | In | Out | Data type / Signature        | Param | Data factor | Data offset | Data size | Data range | Data unit |
+ * |----------|:--:|:---:|------------------------------|:-----:|------------:|------------:|----------:|-----------|----------|
+ * | segments | X  |     | const EDD_Crc8SegmentType*   |   -   |      1      |      0      |   count  | -         | [-]      |
+ * | count    | X  |     | uint16_t                     |   -   |      1      |      0      |     -    | [0..65535]| [-]      |
+ * | crc_out  | X  |  X  | uint8_t*                     |   -   |      1      |      0      |     1    | [0,255]   | [-]      |
+ *
+ * @par Activity diagram (PlantUML)
+ *
+ * @startuml
+ * start
+ * if (segments == NULL OR crc_out == NULL) then (YES)
+ *   :return EDD_NULL_PTR;
+ *   stop
+ * endif
+ * if (a non-empty segment has data == NULL) then (YES)
+ *   :return EDD_NULL_PTR;
+ *   stop
+ * endif
+ * if (all segments empty) then (YES)
+ *   :return EDD_INVALID_LENGTH;
+ *   stop
+ * endif
+ * :crc = 0x00;
+ * while (next non-empty segment?) is (YES)
+ *   :crc = ComputeInternal(crc, segment.data, segment.length);
+ * endwhile (NO)
+ * :*crc_out = crc;
+ * :return EDD_OK;
+ * stop
+ * @enduml
+ *
+ * @return EDD_ReturnType
+ * - EDD_OK if CRC was computed successfully.
+ * - EDD_NULL_PTR if any input pointer (or the data pointer of a non-empty segment) is NULL.
+ * - EDD_INVALID_LENGTH if the segments contain no data.
+ */
+EDD_ReturnType EDD_CalcCrc8Sg(const EDD_Crc8SegmentType *segments, uint16_t count, uint8_t *crc_out);
 
 /**
  * @brief Verify that a buffer CRC matches an expected CRC.
@@ -127,7 +425,7 @@ EDD_ReturnType EDD_CalcCrc8(const uint8_t *data, uint8_t length, uint8_t *crc_ou
  * | Interface      | In | Out | Data type / Signature  | Param | Data factor | Data offset | Data size | Data range        | Data unit |
  * |---------------|:--:|:---:|------------------------|:-----:|------------:|------------:|----------:|-------------------|----------|
  * | data          | X  |     | const uint8_t*         |   -   |      1      |      0      |  length  | [0,255]           | [-]      |
- * | length        | X  |     | uint8_t                 |   -   |      1      |      0      |     -    | [1..N]            | bytes    |
+ * | length        | X  |     | uint32_t               |   -   |      1      |      0      |     -    | [1..2^32-1]       | bytes    |
  * | expected_crc  | X  |     | uint8_t                |   -   |      1      |      0      |     1    | [0,255]           | [-]      |
  * | result_out    | X  |  X  | uint8_t*               |   -   |      1      |      0      |     1    | {0,1}             | [-]      |
  *
@@ -160,7 +458,72 @@ EDD_ReturnType EDD_CalcCrc8(const uint8_t *data, uint8_t length, uint8_t *crc_ou
  * - EDD_NULL_PTR if any required pointer is NULL.
  * - EDD_INVALID_LENGTH if length is 0.
  */
-EDD_ReturnType EDD_VerifyCrc8(const uint8_t *data, uint8_t length, uint8_t expected_crc, uint8_t *result_out);
+EDD_ReturnType EDD_VerifyCrc8(const uint8_t *data, uint32_t length, uint8_t expected_crc, uint8_t *result_out);
+
+/**
+ * @brief Verify the CRC-8 of an array of frames in one call.
+ *
+ * @details
+ * **Goal of the function**
+ *
+ * The purpose of this function is to validate many (typically short) frames
+ * per call. Frames are processed in groups of `EDD_CRC8_BATCH_STREAMS`; within a
+ * group the CRC-8 computations are interleaved byte by byte, so the table
+ * lookups of the different frames overlap instead of serializing on the
+ * load-use latency of a single CRC chain.
+ *
+ * The processing logic:
+ * - Validates `frames` and `result_bitmap` pointers.
+ * - Validates every descriptor (`data` not NULL, `length` > 0) before any CRC is computed.
+ * - Clears the result bitmap (`(count + 7) / 8` bytes).
+ * - For each full group of `EDD_CRC8_BATCH_STREAMS` frames:
+ *   - Computes the CRCs of the group interleaved.
+ * - Computes the CRCs of the remaining frames one after the other.
+ * - Sets bit `i % 8` of `result_bitmap[i / 8]` when frame `i` matches its expected CRC.
+ *
+ * @par Interface summary
+ *
+ * | Interface      | In | Out | Data type / Signature     | Param | Data factor | Data offset | Data size        | Data range | Data unit |
+ * |---------------|:--:|:---:|---------------------------|:-----:|------------:|------------:|-----------------:|-----------|----------|
+ * | frames        | X  |     | const EDD_Crc8FrameType*  |   -   |      1      |      0      | count            | -         | [-]      |
+ * | count         | X  |     | uint16_t                  |   -   |      1      |      0      |     -            | [0..65535]| frames   |
+ * | result_bitmap | X  |  X  | uint8_t*                  |   -   |      1      |      0      | (count + 7) / 8  | [0,255]   | [-]      |
+ *
+ * @par Activity diagram (PlantUML)
+ *
+ * @startuml
+ * start
+ * if (frames == NULL OR result_bitmap == NULL) then (YES)
+ *   :return EDD_NULL_PTR;
+ *   stop
+ * endif
+ * while (for each frame)
+ *   if (data == NULL) then (YES)
+ *     :return EDD_NULL_PTR;
+ *     stop
+ *   elseif (length == 0) then (YES)
+ *     :return EDD_INVALID_LENGTH;
+ *     stop
+ *   endif
+ * endwhile
+ * :clear result_bitmap;
+ * while (full group of N frames left)
+ *   :compute N CRCs interleaved;
+ * endwhile
+ * while (frames left)
+ *   :compute CRC;
+ * endwhile
+ * :set bit i when CRC(i) == expectedCrc(i);
+ * :return EDD_OK;
+ * stop
+ * @enduml
+ *
+ * @return EDD_ReturnType
+ * - EDD_OK if all frames were verified (results in `result_bitmap`).
+ * - EDD_NULL_PTR if a required pointer (including a frame buffer) is NULL.
+ * - EDD_INVALID_LENGTH if a frame has length 0.
+ */
+EDD_ReturnType EDD_VerifyCrc8Batch(const EDD_Crc8FrameType *frames, uint16_t count, uint8_t *result_bitmap);
 
 /**
  * @brief Update CRC-8 accumulator with a new byte (streaming support).
@@ -170,6 +533,7 @@ EDD_ReturnType EDD_VerifyCrc8(const uint8_t *data, uint8_t length, uint8_t expec
  *
  * The purpose of this function is to allow incremental CRC computation for
  * streaming scenarios (e.g., CRC over a frame received byte-by-byte).
+ * Data received in chunks should be fed through @ref EDD_Crc8CtxUpdate instead.
  *
  * The processing logic:
  * - Validates input pointer (`crc_in_out`).
@@ -204,6 +568,1477 @@ EDD_ReturnType EDD_VerifyCrc8(const uint8_t *data, uint8_t length, uint8_t expec
  */
 EDD_ReturnType EDD_Crc8Update(uint8_t *crc_in_out, uint8_t byte);
 
+/**
+ * @brief Initialize a CRC-8 streaming context.
+ *
+ * @details
+ * **Goal of the function**
+ *
+ * The purpose of this function is to start a new CRC-8 computation over a
+ * message delivered in several chunks (e.g. DMA blocks of a LIN frame).
+ *
+ * The processing logic:
+ * - Validates input pointer (`ctx`).
+ * - Sets the context accumulator to the CRC init value (0x00).
+ *
+ * @par Interface summary
+ *
+ * | Interface | In | Out | Data type / Signature | Param | Data factor | Data offset | Data size | Data range | Data unit |
+ * |----------|:--:|:---:|-----------------------|:-----:|------------:|------------:|----------:|-----------|----------|
+ * | ctx      |    |  X  | EDD_Crc8Ctx*          |   -   |      1      |      0      |     1    | -         | [-]      |
+ *
+ * @par Activity diagram (PlantUML)
+ *
+ * @startuml
+ * start
+ * :Validate ctx pointer;
+ * if (ctx == NULL) then (YES)
+ *   :return EDD_NULL_PTR;
+ *   stop
+ * endif
+ * :ctx->crc = 0x00;
+ * :return EDD_OK;
+ * stop
+ * @enduml
+ *
+ * @return EDD_ReturnType
+ * - EDD_OK if the context was initialized.
+ * - EDD_NULL_PTR if ctx is NULL.
+ */
+EDD_ReturnType EDD_Crc8CtxInit(EDD_Crc8Ctx *ctx);
+
+/**
+ * @brief Feed a chunk of data into a CRC-8 streaming context.
+ *
+ * @details
+ * **Goal of the function**
+ *
+ * The purpose of this function is to continue a CRC-8 computation with a whole
+ * chunk of data in a single call. The chunk is processed by the same engine as
+ * @ref EDD_CalcCrc8 (table, slicing or folding kernel), so the per-byte call and
+ * pointer check overhead of @ref EDD_Crc8Update is avoided.
+ *
+ * The processing logic:
+ * - Validates input pointers (`ctx`, `data`).
+ * - If `length` is greater than zero, continues the CRC computation from
+ *   `ctx->crc` over the chunk and stores the result back into the context.
+ *   An empty chunk leaves the context unchanged.
+ *
+ * Feeding a message in any split yields the same CRC as @ref EDD_CalcCrc8 over
+ * the whole message.
+ *
+ * @par Interface summary
+ *
+ * | Interface | In | Out | Data type / Signature | Param | Data factor | Data offset | Data size | Data range     | Data unit |
+ * |----------|:--:|:---:|-----------------------|:-----:|------------:|------------:|----------:|----------------|----------|
+ * | ctx      | X  |  X  | EDD_Crc8Ctx*          |   -   |      1      |      0      |     1    | -              | [-]      |
+ * | data     | X  |     | const uint8_t*        |   -   |      1      |      0      |  length  | [0,255]        | [-]      |
+ * | length   | X  |     | uint32_t              |   -   |      1      |      0      |     -    | [0..2^32-1]    | bytes    |
+ *
+ * @par Activity diagram (PlantUML)
+ *
+ * @startuml
+ * start
+ * :Validate pointers;
+ * if (ctx == NULL OR data == NULL) then (YES)
+ *   :return EDD_NULL_PTR;
+ *   stop
+ * endif
+ * if (length > 0) then (YES)
+ *   :ctx->crc = ComputeInternal(ctx->crc, data, length);
+ * endif
+ * :return EDD_OK;
+ * stop
+ * @enduml
+ *
+ * @return EDD_ReturnType
+ * - EDD_OK if the chunk was processed.
+ * - EDD_NULL_PTR if any input pointer is NULL.
+ */
+EDD_ReturnType EDD_Crc8CtxUpdate(EDD_Crc8Ctx *ctx, const uint8_t *data, uint32_t length);
+
+/**
+ * @brief Read the CRC-8 of all data fed into a streaming context.
+ *
+ * @details
+ * **Goal of the function**
+ *
+ * The purpose of this function is to return the CRC-8 of the message fed so far.
+ * The context is not modified and can be updated further afterwards.
+ *
+ * The processing logic:
+ * - Validates input pointers (`ctx`, `crc_out`).
+ * - Writes the context accumulator into `*crc_out` (CRC-8/ATM has XOROut 0x00).
+ *
+ * @par Interface summary
+ *
+ * | Interface | In | Out | Data type / Signature | Param | Data factor | Data offset | Data size | Data range | Data unit |
+ * |----------|:--:|:---:|-----------------------|:-----:|------------:|------------:|----------:|-----------|----------|
+ * | ctx      | X  |     | const EDD_Crc8Ctx*    |   -   |      1      |      0      |     1    | -         | [-]      |
+ * | crc_out  | X  |  X  | uint8_t*              |   -   |      1      |      0      |     1    | [0,255]   | [-]      |
+ *
+ * @par Activity diagram (PlantUML)
+ *
+ * @startuml
+ * start
+ * :Validate pointers;
+ * if (ctx == NULL OR crc_out == NULL) then (YES)
+ *   :return EDD_NULL_PTR;
+ *   stop
+ * endif
+ * :*crc_out = ctx->crc;
+ * :return EDD_OK;
+ * stop
+ * @enduml
+ *
+ * @return EDD_ReturnType
+ * - EDD_OK if the CRC was written.
+ * - EDD_NULL_PTR if any input pointer is NULL.
+ */
+EDD_ReturnType EDD_Crc8CtxFinal(const EDD_Crc8Ctx *ctx, uint8_t *crc_out);
+
+/**
+ * @brief Combine the CRC-8 values of two consecutive blocks.
+ *
+ * @details
+ * **Goal of the function**
+ *
+ * The purpose of this function is to compute the CRC-8 of the concatenation
+ * A || B from the CRC-8 of A, the CRC-8 of B and the length of B, without
+ * accessing the data again. Blocks of a message can therefore be checksummed
+ * independently (in parallel on several cores, or out of order as segments
+ * arrive) and merged afterwards.
+ *
+ * The processing logic:
+ * - Validates the output pointer (`crc_out`).
+ * - Shifts `crcA` over `lengthB` zero bytes, i.e. multiplies it by
+ *   x^(8 * lengthB) mod P in O(log2(lengthB)) steps.
+ * - XORs the shifted value with `crcB` (CRC-8/ATM is linear, init and XOROut
+ *   are 0x00).
+ *
+ * Combining is associative: the CRC of A || B || C can be obtained as
+ * Combine(Combine(crcA, crcB, |B|), crcC, |C|) or as
+ * Combine(crcA, Combine(crcB, crcC, |C|), |B| + |C|).
+ *
+ * @par Interface summary
+ *
+ * | Interface | In | Out | Data type / Signature | Param | Data factor | Data offset | Data size | Data range     | Data unit |
+ * |----------|:--:|:---:|-----------------------|:-----:|------------:|------------:|----------:|----------------|----------|
+ * | crcA     | X  |     | uint8_t               |   -   |      1      |      0      |     1    | [0,255]        | [-]      |
+ * | crcB     | X  |     | uint8_t               |   -   |      1      |      0      |     1    | [0,255]        | [-]      |
+ * | lengthB  | X  |     | uint32_t              |   -   |      1      |      0      |     -    | [0..2^32-1]    | bytes    |
+ * | crc_out  | X  |  X  | uint8_t*              |   -   |      1      |      0      |     1    | [0,255]        | [-]      |
+ *
+ * @par Activity diagram (PlantUML)
+ *
+ * @startuml
+ * start
+ * if (crc_out == NULL) then (YES)
+ *   :return EDD_NULL_PTR;
+ *   stop
+ * endif
+ * :*crc_out = ShiftZeros(crcA, lengthB) XOR crcB;
+ * :return EDD_OK;
+ * stop
+ * @enduml
+ *
+ * @return EDD_ReturnType
+ * - EDD_OK if the combined CRC was written.
+ * - EDD_NULL_PTR if crc_out is NULL.
+ */
+EDD_ReturnType EDD_Crc8Combine(uint8_t crcA, uint8_t crcB, uint32_t lengthB, uint8_t *crc_out);
+
+/**
+ * @brief Update the CRC-8 of a message after some bytes were modified in place.
+ *
+ * @details
+ * **Goal of the function**
+ *
+ * The purpose of this function is to update the CRC-8 of a protected frame when
+ * a few bytes (alive counter, a routed signal) are rewritten, in time
+ * proportional to the number of changed bytes instead of the frame length.
+ *
+ * The processing logic:
+ * - Validates input pointers (`oldBytes`, `newBytes`, `crc_out`).
+ * - Validates the patched area: `length > 0` and
+ *   `offset + length <= totalLength`.
+ * - Computes the CRC-8 of the difference `oldBytes[i] ^ newBytes[i]`.
+ * - Shifts it over the `totalLength - offset - length` bytes that follow the
+ *   patched area (O(log2(n)), see @ref EDD_Crc8Combine).
+ * - XORs the result into `oldCrc` (CRC-8/ATM is linear, init and XOROut 0x00).
+ *
+ * `oldCrc` must be the CRC-8 of the whole unmodified message of `totalLength`
+ * bytes. The function does not access the message itself, so `newBytes` may
+ * point into the frame buffer after it was modified.
+ *
+ * @par Interface summary
+ *
+ * | Interface   | In | Out | Data type / Signature | Param | Data factor | Data offset | Data size | Data range     | Data unit |
+ * |------------|:--:|:---:|-----------------------|:-----:|------------:|------------:|----------:|----------------|----------|
+ * | oldCrc      | X  |     | uint8_t               |   -   |      1      |      0      |     1    | [0,255]        | [-]      |
+ * | offset      | X  |     | uint32_t              |   -   |      1      |      0      |     -    | [0..2^32-1]    | bytes    |
+ * | oldBytes    | X  |     | const uint8_t*        |   -   |      1      |      0      |  length  | [0,255]        | [-]      |
+ * | newBytes    | X  |     | const uint8_t*        |   -   |      1      |      0      |  length  | [0,255]        | [-]      |
+ * | length      | X  |     | uint32_t              |   -   |      1      |      0      |     -    | [1..2^32-1]    | bytes    |
+ * | totalLength | X  |     | uint32_t              |   -   |      1      |      0      |     -    | [1..2^32-1]    | bytes    |
+ * | crc_out     | X  |  X  | uint8_t*              |   -   |      1      |      0      |     1    | [0,255]        | [-]      |
+ *
+ * @par Activity diagram (PlantUML)
+ *
+ * @startuml
+ * start
+ * if (oldBytes == NULL OR newBytes == NULL OR crc_out == NULL) then (YES)
+ *   :return EDD_NULL_PTR;
+ *   stop
+ * endif
+ * if (length == 0 OR offset + length > totalLength) then (YES)
+ *   :return EDD_INVALID_LENGTH;
+ *   stop
+ * endif
+ * :delta = CRC8(oldBytes XOR newBytes);
+ * :delta = ShiftZeros(delta, totalLength - offset - length);
+ * :*crc_out = oldCrc XOR delta;
+ * :return EDD_OK;
+ * stop
+ * @enduml
+ *
+ * @return EDD_ReturnType
+ * - EDD_OK if the updated CRC was written.
+ * - EDD_NULL_PTR if any input pointer is NULL.
+ * - EDD_INVALID_LENGTH if the patched area is empty or exceeds the message.
+ */
+EDD_ReturnType EDD_Crc8Patch(uint8_t oldCrc, uint32_t offset, const uint8_t *oldBytes, const uint8_t *newBytes, uint32_t length, uint32_t totalLength, uint8_t *crc_out);
+
+/**
+ * @brief Report the table mode, footprint and nominal cost of the CRC-8 engine.
+ *
+ * @details
+ * **Goal of the function**
+ *
+ * The purpose of this function is to let integrators and test tools check which
+ * flash/speed trade-off (`EDD_CRC_MODE`) a build uses, without inspecting the
+ * map file.
+ *
+ * The processing logic:
+ * - Validates the output pointer (`info`).
+ * - Writes the configured mode, the size of the CRC-8 lookup tables compiled
+ *   into the module and the nominal cycles per byte of the mode:
+ *
+ * | Mode                  | tableBytes | cyclesPerByte |
+ * |-----------------------|-----------:|--------------:|
+ * | EDD_CRC_MODE_NIBBLE   |         16 |            12 |
+ * | EDD_CRC_MODE_TABLE    |        256 |             7 |
+ * | EDD_CRC_MODE_SLICE4   |       1024 |             4 |
+ * | EDD_CRC_MODE_SLICE8   |       2048 |             3 |
+ *
+ * The cycle figures are counted for an in-order 32-bit MCU with zero wait-state
+ * flash; they are meant to compare the modes, not to replace a measurement.
+ *
+ * @par Interface summary
+ *
+ * | Interface | In | Out | Data type / Signature  | Param | Data factor | Data offset | Data size | Data range | Data unit |
+ * |----------|:--:|:---:|------------------------|:-----:|------------:|------------:|----------:|-----------|----------|
+ * | info     |    |  X  | EDD_Crc8ModeInfoType*  |   -   |      1      |      0      |     1    | -         | [-]      |
+ *
+ * @par Activity diagram (PlantUML)
+ *
+ * @startuml
+ * start
+ * if (info == NULL) then (YES)
+ *   :return EDD_NULL_PTR;
+ *   stop
+ * endif
+ * :info->mode = EDD_CRC_MODE;
+ * :info->tableBytes = size of CRC-8 tables;
+ * :info->cyclesPerByte = nominal cost;
+ * :return EDD_OK;
+ * stop
+ * @enduml
+ *
+ * @return EDD_ReturnType
+ * - EDD_OK if the information was written.
+ * - EDD_NULL_PTR if info is NULL.
+ */
+EDD_ReturnType EDD_GetCrc8ModeInfo(EDD_Crc8ModeInfoType *info);
+
+/**
+ * @brief Initialize a time-sliced background scanner over a set of memory regions.
+ *
+ * @details
+ * **Goal of the function**
+ *
+ * The purpose of this function is to prepare a resumable integrity check of
+ * constant memory (calibration data, code sections, configuration tables)
+ * that a cyclic task runs in bounded slices through @ref EDD_ScanStep.
+ *
+ * The processing logic:
+ * - Validates input pointers (`ctx`, `regions`, every `regions[i].data`).
+ * - Validates `count > 0`, `budget > 0` and every `regions[i].length > 0`.
+ * - Stores the region list and the per-step byte budget in the context.
+ * - Positions the scanner at the start of the first region, clears the partial
+ *   CRC, the mismatch counters and the pass counter.
+ *
+ * The region list is referenced, not copied: it shall stay valid while the
+ * scanner is used. The budget bounds the run time of one step to about
+ * `budget * cyclesPerByte` (see @ref EDD_GetCrc8ModeInfo) plus a constant per
+ * region boundary; a full pass takes `ceil(total length / budget)` steps (plus
+ * at most one step where the pass ends early), which is the worst case
+ * detection latency in task periods.
+ *
+ * @par Interface summary
+ *
+ * | Interface | In | Out | Data type / Signature      | Param | Data factor | Data offset | Data size | Data range     | Data unit |
+ * |----------|:--:|:---:|----------------------------|:-----:|------------:|------------:|----------:|----------------|----------|
+ * | ctx      |    |  X  | EDD_ScanCtx*               |   -   |      1      |      0      |     1    | -              | [-]      |
+ * | regions  | X  |     | const EDD_ScanRegionType*  |   -   |      1      |      0      |  count   | -              | [-]      |
+ * | count    | X  |     | uint16_t                   |   -   |      1      |      0      |     1    | [1..65535]     | [-]      |
+ * | budget   | X  |     | uint32_t                   |   -   |      1      |      0      |     1    | [1..2^32-1]    | bytes    |
+ *
+ * @par Activity diagram (PlantUML)
+ *
+ * @startuml
+ * start
+ * if (ctx == NULL OR regions == NULL) then (YES)
+ *   :return EDD_NULL_PTR;
+ *   stop
+ * endif
+ * if (count == 0 OR budget == 0) then (YES)
+ *   :return EDD_INVALID_LENGTH;
+ *   stop
+ * endif
+ * while (for each region) is (next)
+ *   if (region.data == NULL) then (YES)
+ *     :return EDD_NULL_PTR;
+ *     stop
+ *   endif
+ *   if (region.length == 0) then (YES)
+ *     :return EDD_INVALID_LENGTH;
+ *     stop
+ *   endif
+ * endwhile
+ * :store regions, count, budget;
+ * :region = 0, offset = 0, crc = init;
+ * :clear mismatch counters and passCount;
+ * :return EDD_OK;
+ * stop
+ * @enduml
+ *
+ * @return EDD_ReturnType
+ * - EDD_OK if the scanner was initialized.
+ * - EDD_NULL_PTR if any pointer (including a region start) is NULL.
+ * - EDD_INVALID_LENGTH if count, budget or a region length is 0.
+ */
+EDD_ReturnType EDD_ScanInit(EDD_ScanCtx *ctx, const EDD_ScanRegionType *regions, uint16_t count, uint32_t budget);
+
+/**
+ * @brief Run one bounded slice of the background integrity scan.
+ *
+ * @details
+ * **Goal of the function**
+ *
+ * The purpose of this function is to advance the scan by at most `budget`
+ * bytes, so that it can be called from a cyclic task (e.g. the 10 ms task
+ * running `voltMonRun`) without exceeding the task slot. The partial CRC is
+ * kept in the context between calls.
+ *
+ * The processing logic:
+ * - Validates input pointers (`ctx`, `result_out`).
+ * - While budget is left:
+ *   - Processes `min(budget left, bytes left in region)` bytes of the region in
+ *     progress with the configured CRC-8 engine.
+ *   - At the end of a region compares the CRC with `expectedCrc`, counts a
+ *     mismatch, and moves to the next region with a fresh CRC.
+ *   - After the last region, publishes the pass outcome in `lastPass*`,
+ *     increments `passCount`, restarts at the first region and stops the step,
+ *     so every step reports at most one pass.
+ * - Writes `EDD_SCAN_BUSY`, `EDD_SCAN_PASS_OK` or `EDD_SCAN_PASS_FAILED` to
+ *   `*result_out`.
+ *
+ * A mismatch is reported only once the pass is complete, with the number and
+ * the first index of the mismatching regions.
+ *
+ * @par Interface summary
+ *
+ * | Interface  | In | Out | Data type / Signature | Param | Data factor | Data offset | Data size | Data range            | Data unit |
+ * |-----------|:--:|:---:|-----------------------|:-----:|------------:|------------:|----------:|-----------------------|----------|
+ * | ctx        | X  |  X  | EDD_ScanCtx*          |   -   |      1      |      0      |     1    | -                     | [-]      |
+ * | result_out |    |  X  | EDD_ScanResultType*   |   -   |      1      |      0      |     1    | EDD_SCAN_BUSY..FAILED | [-]      |
+ *
+ * @par Activity diagram (PlantUML)
+ *
+ * @startuml
+ * start
+ * if (ctx == NULL OR result_out == NULL) then (YES)
+ *   :return EDD_NULL_PTR;
+ *   stop
+ * endif
+ * :left = budget;
+ * :*result_out = EDD_SCAN_BUSY;
+ * while (left > 0) is (yes)
+ *   :chunk = min(left, region.length - offset);
+ *   :crc = ComputeInternal(crc, region.data + offset, chunk);
+ *   :offset += chunk; left -= chunk;
+ *   if (offset == region.length) then (region done)
+ *     if (crc != region.expectedCrc) then (YES)
+ *       :count mismatch;
+ *     endif
+ *     :next region, offset = 0, crc = init;
+ *     if (all regions done) then (pass done)
+ *       :publish lastPass*, passCount++;
+ *       :*result_out = PASS_OK or PASS_FAILED;
+ *       :restart at region 0;
+ *       break
+ *     endif
+ *   endif
+ * endwhile
+ * :return EDD_OK;
+ * stop
+ * @enduml
+ *
+ * @return EDD_ReturnType
+ * - EDD_OK if the step was executed.
+ * - EDD_NULL_PTR if ctx or result_out is NULL.
+ */
+EDD_ReturnType EDD_ScanStep(EDD_ScanCtx *ctx, EDD_ScanResultType *result_out);
+
+/**
+ * @brief Register a set of protected RAM variables and compute their CRCs.
+ *
+ * @details
+ * **Goal of the function**
+ *
+ * The purpose of this function is to put safety relevant RAM state (e.g.
+ * `VoltMon_Ctx` of the voltage monitor) under CRC protection without checking
+ * it on every access: writers keep the CRC up to date with
+ * @ref EDD_ProtWrite, a cyclic task checks `perTick` variables per call with
+ * @ref EDD_ProtVerifyStep.
+ *
+ * The processing logic:
+ * - Validates input pointers (`set`, `vars`, every `vars[i].data`).
+ * - Validates `count > 0`, `perTick > 0` and every `vars[i].length > 0`.
+ * - Computes the CRC-8 of every variable from its current content.
+ * - Stores the list, limits `perTick` to `count` and clears the position and
+ *   the mismatch counters.
+ *
+ * The variable list is referenced, not copied: it shall stay valid (in RAM,
+ * the CRCs are updated in place) while the set is used. Calling this function
+ * again re-synchronizes the CRCs, e.g. after the application restored a
+ * variable that was reported corrupted.
+ *
+ * Example (voltage monitor context, checked by the 10 ms task):
+ * @code
+ * static EDD_ProtVarType safetyVars[] = {{(uint8_t *)&VoltMon_Ctx, (uint16_t)sizeof(VoltMon_Ctx), 0u}};
+ * static EDD_ProtSetType safetySet;
+ *
+ * voltMonInit();
+ * (void)EDD_ProtInit(&safetySet, safetyVars, 1u, 1u);
+ * @endcode
+ *
+ * @par Interface summary
+ *
+ * | Interface | In | Out | Data type / Signature | Param | Data factor | Data offset | Data size | Data range | Data unit |
+ * |----------|:--:|:---:|-----------------------|:-----:|------------:|------------:|----------:|------------|----------|
+ * | set      |    |  X  | EDD_ProtSetType*      |   -   |      1      |      0      |     1    | -          | [-]      |
+ * | vars     | X  |  X  | EDD_ProtVarType*      |   -   |      1      |      0      |  count   | -          | [-]      |
+ * | count    | X  |     | uint16_t              |   -   |      1      |      0      |     1    | [1..65535] | [-]      |
+ * | perTick  | X  |     | uint16_t              |   -   |      1      |      0      |     1    | [1..65535] | [-]      |
+ *
+ * @par Activity diagram (PlantUML)
+ *
+ * @startuml
+ * start
+ * if (set == NULL OR vars == NULL) then (YES)
+ *   :return EDD_NULL_PTR;
+ *   stop
+ * endif
+ * if (count == 0 OR perTick == 0) then (YES)
+ *   :return EDD_INVALID_LENGTH;
+ *   stop
+ * endif
+ * while (for each variable) is (next)
+ *   if (var.data == NULL) then (YES)
+ *     :return EDD_NULL_PTR;
+ *     stop
+ *   endif
+ *   if (var.length == 0) then (YES)
+ *     :return EDD_INVALID_LENGTH;
+ *     stop
+ *   endif
+ * endwhile
+ * while (for each variable) is (next)
+ *   :var.crc = CRC8(var.data, var.length);
+ * endwhile
+ * :store vars, count, min(perTick, count);
+ * :next = 0, clear mismatch counters;
+ * :return EDD_OK;
+ * stop
+ * @enduml
+ *
+ * @return EDD_ReturnType
+ * - EDD_OK if the set was initialized.
+ * - EDD_NULL_PTR if any pointer (including a variable address) is NULL.
+ * - EDD_INVALID_LENGTH if count, perTick or a variable length is 0.
+ */
+EDD_ReturnType EDD_ProtInit(EDD_ProtSetType *set, EDD_ProtVarType *vars, uint16_t count, uint16_t perTick);
+
+/**
+ * @brief Write bytes of a protected variable and update its CRC incrementally.
+ *
+ * @details
+ * **Goal of the function**
+ *
+ * The purpose of this function is to keep the CRC of a protected variable
+ * valid across writes at a cost that depends on the number of written bytes,
+ * not on the size of the variable (see @ref EDD_Crc8Patch).
+ *
+ * The processing logic:
+ * - Validates input pointers (`var`, `var->data`, `src`).
+ * - Validates the written area: `length > 0` and
+ *   `offset + length <= var->length`.
+ * - Patches `var->crc` with the difference between the current and the new
+ *   bytes, then copies `src` into the variable.
+ *
+ * The update is linear: a corruption that happened before the write stays
+ * visible in the CRC and is still reported by @ref EDD_ProtVerifyStep.
+ * Writes and verify steps of the same set shall not preempt each other, and
+ * `src` shall not overlap the written area.
+ *
+ * @par Interface summary
+ *
+ * | Interface | In | Out | Data type / Signature | Param | Data factor | Data offset | Data size | Data range       | Data unit |
+ * |----------|:--:|:---:|-----------------------|:-----:|------------:|------------:|----------:|------------------|----------|
+ * | var      | X  |  X  | EDD_ProtVarType*      |   -   |      1      |      0      |     1    | -                | [-]      |
+ * | offset   | X  |     | uint16_t              |   -   |      1      |      0      |     1    | [0..length-1]    | bytes    |
+ * | src      | X  |     | const uint8_t*        |   -   |      1      |      0      |  length  | [0,255]          | [-]      |
+ * | length   | X  |     | uint16_t              |   -   |      1      |      0      |     1    | [1..var->length] | bytes    |
+ *
+ * @par Activity diagram (PlantUML)
+ *
+ * @startuml
+ * start
+ * if (var == NULL OR var.data == NULL OR src == NULL) then (YES)
+ *   :return EDD_NULL_PTR;
+ *   stop
+ * endif
+ * if (length == 0 OR offset + length > var.length) then (YES)
+ *   :return EDD_INVALID_LENGTH;
+ *   stop
+ * endif
+ * :var.crc = Patch(var.crc, offset, var.data + offset, src, length, var.length);
+ * :copy src to var.data + offset;
+ * :return EDD_OK;
+ * stop
+ * @enduml
+ *
+ * @return EDD_ReturnType
+ * - EDD_OK if the bytes were written.
+ * - EDD_NULL_PTR if any pointer is NULL.
+ * - EDD_INVALID_LENGTH if the written area is empty or exceeds the variable.
+ */
+EDD_ReturnType EDD_ProtWrite(EDD_ProtVarType *var, uint16_t offset, const uint8_t *src, uint16_t length);
+
+/**
+ * @brief Check the next protected variables of a set against their CRCs.
+ *
+ * @details
+ * **Goal of the function**
+ *
+ * The purpose of this function is to detect corrupted RAM variables with a
+ * bounded cost per call, so that it can run in a cyclic task.
+ *
+ * The processing logic:
+ * - Validates input pointers (`set`, `failed_out`).
+ * - Recomputes the CRC-8 of `perTick` variables starting at `next` (wrapping
+ *   around the list) and compares it with the stored CRC.
+ * - Stores the number and the first index of the mismatching variables in
+ *   `lastFailed` / `firstFailed`, adds them to `failCount`, advances `next`.
+ * - Writes the number of mismatching variables to `*failed_out`.
+ *
+ * A corrupted variable is reported at every check until the application
+ * restores it and calls @ref EDD_ProtInit again.
+ *
+ * @par Interface summary
+ *
+ * | Interface  | In | Out | Data type / Signature | Param | Data factor | Data offset | Data size | Data range   | Data unit |
+ * |-----------|:--:|:---:|-----------------------|:-----:|------------:|------------:|----------:|--------------|----------|
+ * | set        | X  |  X  | EDD_ProtSetType*      |   -   |      1      |      0      |     1    | -            | [-]      |
+ * | failed_out |    |  X  | uint16_t*             |   -   |      1      |      0      |     1    | [0..perTick] | [-]      |
+ *
+ * @par Activity diagram (PlantUML)
+ *
+ * @startuml
+ * start
+ * if (set == NULL OR failed_out == NULL) then (YES)
+ *   :return EDD_NULL_PTR;
+ *   stop
+ * endif
+ * :failed = 0;
+ * repeat
+ *   if (CRC8(vars[next]) != vars[next].crc) then (YES)
+ *     :record mismatch;
+ *   endif
+ *   :next = (next + 1) mod count;
+ * repeat while (perTick variables checked?) is (no)
+ * :lastFailed = failed, failCount += failed;
+ * :*failed_out = failed;
+ * :return EDD_OK;
+ * stop
+ * @enduml
+ *
+ * @return EDD_ReturnType
+ * - EDD_OK if the step was executed.
+ * - EDD_NULL_PTR if set or failed_out is NULL.
+ */
+EDD_ReturnType EDD_ProtVerifyStep(EDD_ProtSetType *set, uint16_t *failed_out);
+
+/**
+ * @brief Report the worst case detection time and step cost of a protected set.
+ *
+ * @details
+ * **Goal of the function**
+ *
+ * The purpose of this function is to provide the figures needed to show that
+ * the protection meets the fault detection time of the safety concept.
+ *
+ * The processing logic:
+ * - Validates input pointers (`set`, `wc_out`).
+ * - `detectionTicks = ceil(varCount / perTick)`: a variable corrupted just
+ *   after its check is checked again at the latest after this many steps.
+ *   Multiplied by the period of the calling task it gives the worst case
+ *   detection time (e.g. 1 variable, 1 per tick, 10 ms task: 10 ms).
+ * - `bytesPerTick = perTick * largest variable length` (upper bound of the
+ *   bytes one step checks); with `cyclesPerByte` of @ref EDD_GetCrc8ModeInfo
+ *   it bounds the run time of a step.
+ *
+ * @par Interface summary
+ *
+ * | Interface | In | Out | Data type / Signature   | Param | Data factor | Data offset | Data size | Data range | Data unit |
+ * |----------|:--:|:---:|-------------------------|:-----:|------------:|------------:|----------:|------------|----------|
+ * | set      | X  |     | const EDD_ProtSetType*  |   -   |      1      |      0      |     1    | -          | [-]      |
+ * | wc_out   |    |  X  | EDD_ProtWorstCaseType*  |   -   |      1      |      0      |     1    | -          | [-]      |
+ *
+ * @par Activity diagram (PlantUML)
+ *
+ * @startuml
+ * start
+ * if (set == NULL OR wc_out == NULL) then (YES)
+ *   :return EDD_NULL_PTR;
+ *   stop
+ * endif
+ * :detectionTicks = ceil(varCount / perTick);
+ * :bytesPerTick = perTick * max(var.length);
+ * :return EDD_OK;
+ * stop
+ * @enduml
+ *
+ * @return EDD_ReturnType
+ * - EDD_OK if the figures were written.
+ * - EDD_NULL_PTR if set or wc_out is NULL.
+ */
+EDD_ReturnType EDD_ProtGetWorstCase(const EDD_ProtSetType *set, EDD_ProtWorstCaseType *wc_out);
+
+/**
+ * @brief Compute the LIN 1.x classic checksum of a data buffer.
+ *
+ * @details
+ * **Goal of the function**
+ *
+ * The purpose of this function is to compute the LIN checksum over the data
+ * bytes only: the inverted 8-bit sum with carry (each carry out of bit 7 is
+ * added back to bit 0).
+ *
+ * The processing logic:
+ * - Validates the input pointers (`data`, `checksum_out`).
+ * - Validates that `length` is greater than zero.
+ * - Adds the data four bytes per iteration to a 32-bit end-around carry sum
+ *   (equivalent to the byte-wise add-with-carry, since 256 = 1 mod 255).
+ * - Folds the sum to 8 bits, inverts it and writes it into `*checksum_out`.
+ *
+ * @par Interface summary
+ *
+ * | Interface    | In | Out | Data type / Signature | Param | Data factor | Data offset | Data size | Data range  | Data unit |
+ * |-------------|:--:|:---:|-----------------------|:-----:|------------:|------------:|----------:|-------------|----------|
+ * | data         | X  |     | const uint8_t*        |   -   |      1      |      0      |  length  | [0,255]     | [-]      |
+ * | length       | X  |     | uint32_t              |   -   |      1      |      0      |     -    | [1..2^32-1] | bytes    |
+ * | checksum_out | X  |  X  | uint8_t*              |   -   |      1      |      0      |     1    | [0,255]     | [-]      |
+ *
+ * @par Activity diagram (PlantUML)
+ *
+ * @startuml
+ * start
+ * if (data == NULL OR checksum_out == NULL) then (YES)
+ *   :return EDD_NULL_PTR;
+ *   stop
+ * endif
+ * if (length == 0) then (YES)
+ *   :return EDD_INVALID_LENGTH;
+ *   stop
+ * endif
+ * :sum = 0;
+ * while (4 bytes left?) is (yes)
+ *   :sum = sum + word (end-around carry);
+ * endwhile (no)
+ * :add remaining bytes (end-around carry);
+ * :*checksum_out = NOT fold8(sum);
+ * :return EDD_OK;
+ * stop
+ * @enduml
+ *
+ * @return EDD_ReturnType
+ * - EDD_OK if the checksum was written.
+ * - EDD_NULL_PTR if data or checksum_out is NULL.
+ * - EDD_INVALID_LENGTH if length is 0.
+ */
+EDD_ReturnType EDD_CalcLinClassic(const uint8_t *data, uint32_t length, uint8_t *checksum_out);
+
+/**
+ * @brief Compute the LIN 2.x enhanced checksum of a frame.
+ *
+ * @details
+ * **Goal of the function**
+ *
+ * The purpose of this function is to compute the LIN checksum over the
+ * protected identifier and the data bytes, as used by all LIN 2.x frames
+ * except the diagnostic frames (0x3C/0x3D use @ref EDD_CalcLinClassic).
+ *
+ * The processing logic:
+ * - Validates the input pointers (`data`, `checksum_out`).
+ * - Validates that `length` is greater than zero.
+ * - Starts the carry-folded sum with `pid` and adds the data as in
+ *   @ref EDD_CalcLinClassic.
+ * - Folds, inverts and writes the checksum into `*checksum_out`.
+ *
+ * @par Interface summary
+ *
+ * | Interface    | In | Out | Data type / Signature | Param | Data factor | Data offset | Data size | Data range  | Data unit |
+ * |-------------|:--:|:---:|-----------------------|:-----:|------------:|------------:|----------:|-------------|----------|
+ * | pid          | X  |     | uint8_t               |   -   |      1      |      0      |     1    | [0,255]     | [-]      |
+ * | data         | X  |     | const uint8_t*        |   -   |      1      |      0      |  length  | [0,255]     | [-]      |
+ * | length       | X  |     | uint32_t              |   -   |      1      |      0      |     -    | [1..2^32-1] | bytes    |
+ * | checksum_out | X  |  X  | uint8_t*              |   -   |      1      |      0      |     1    | [0,255]     | [-]      |
+ *
+ * @par Activity diagram (PlantUML)
+ *
+ * @startuml
+ * start
+ * if (data == NULL OR checksum_out == NULL) then (YES)
+ *   :return EDD_NULL_PTR;
+ *   stop
+ * endif
+ * if (length == 0) then (YES)
+ *   :return EDD_INVALID_LENGTH;
+ *   stop
+ * endif
+ * :sum = pid;
+ * :sum = LinSum(sum, data, length);
+ * :*checksum_out = NOT fold8(sum);
+ * :return EDD_OK;
+ * stop
+ * @enduml
+ *
+ * @return EDD_ReturnType
+ * - EDD_OK if the checksum was written.
+ * - EDD_NULL_PTR if data or checksum_out is NULL.
+ * - EDD_INVALID_LENGTH if length is 0.
+ */
+EDD_ReturnType EDD_CalcLinEnhanced(uint8_t pid, const uint8_t *data, uint32_t length, uint8_t *checksum_out);
+
+/**
+ * @brief Verify the LIN classic checksum of a data buffer.
+ *
+ * @details
+ * **Goal of the function**
+ *
+ * The purpose of this function is to check a received LIN frame (classic
+ * model) against its checksum byte.
+ *
+ * The processing logic:
+ * - Validates the input pointers (`data`, `result_out`).
+ * - Validates that `length` is greater than zero.
+ * - Computes the classic checksum (see @ref EDD_CalcLinClassic).
+ * - Writes `*result_out = 1` if it equals `expected`, `0` otherwise.
+ *
+ * @par Interface summary
+ *
+ * | Interface  | In | Out | Data type / Signature | Param | Data factor | Data offset | Data size | Data range  | Data unit |
+ * |-----------|:--:|:---:|-----------------------|:-----:|------------:|------------:|----------:|-------------|----------|
+ * | data       | X  |     | const uint8_t*        |   -   |      1      |      0      |  length  | [0,255]     | [-]      |
+ * | length     | X  |     | uint32_t              |   -   |      1      |      0      |     -    | [1..2^32-1] | bytes    |
+ * | expected   | X  |     | uint8_t               |   -   |      1      |      0      |     1    | [0,255]     | [-]      |
+ * | result_out | X  |  X  | uint8_t*              |   -   |      1      |      0      |     1    | {0,1}       | [-]      |
+ *
+ * @par Activity diagram (PlantUML)
+ *
+ * @startuml
+ * start
+ * if (data == NULL OR result_out == NULL) then (YES)
+ *   :return EDD_NULL_PTR;
+ *   stop
+ * endif
+ * if (length == 0) then (YES)
+ *   :return EDD_INVALID_LENGTH;
+ *   stop
+ * endif
+ * :checksum = NOT fold8(LinSum(0, data, length));
+ * :*result_out = (checksum == expected);
+ * :return EDD_OK;
+ * stop
+ * @enduml
+ *
+ * @return EDD_ReturnType
+ * - EDD_OK if the verification was executed.
+ * - EDD_NULL_PTR if data or result_out is NULL.
+ * - EDD_INVALID_LENGTH if length is 0.
+ */
+EDD_ReturnType EDD_VerifyLinClassic(const uint8_t *data, uint32_t length, uint8_t expected, uint8_t *result_out);
+
+/**
+ * @brief Verify the LIN enhanced checksum of a frame.
+ *
+ * @details
+ * **Goal of the function**
+ *
+ * The purpose of this function is to check a received LIN 2.x frame against
+ * its checksum byte, including the protected identifier in the sum.
+ *
+ * The processing logic:
+ * - Validates the input pointers (`data`, `result_out`).
+ * - Validates that `length` is greater than zero.
+ * - Computes the enhanced checksum (see @ref EDD_CalcLinEnhanced).
+ * - Writes `*result_out = 1` if it equals `expected`, `0` otherwise.
+ *
+ * @par Interface summary
+ *
+ * | Interface  | In | Out | Data type / Signature | Param | Data factor | Data offset | Data size | Data range  | Data unit |
+ * |-----------|:--:|:---:|-----------------------|:-----:|------------:|------------:|----------:|-------------|----------|
+ * | pid        | X  |     | uint8_t               |   -   |      1      |      0      |     1    | [0,255]     | [-]      |
+ * | data       | X  |     | const uint8_t*        |   -   |      1      |      0      |  length  | [0,255]     | [-]      |
+ * | length     | X  |     | uint32_t              |   -   |      1      |      0      |     -    | [1..2^32-1] | bytes    |
+ * | expected   | X  |     | uint8_t               |   -   |      1      |      0      |     1    | [0,255]     | [-]      |
+ * | result_out | X  |  X  | uint8_t*              |   -   |      1      |      0      |     1    | {0,1}       | [-]      |
+ *
+ * @par Activity diagram (PlantUML)
+ *
+ * @startuml
+ * start
+ * if (data == NULL OR result_out == NULL) then (YES)
+ *   :return EDD_NULL_PTR;
+ *   stop
+ * endif
+ * if (length == 0) then (YES)
+ *   :return EDD_INVALID_LENGTH;
+ *   stop
+ * endif
+ * :checksum = NOT fold8(LinSum(pid, data, length));
+ * :*result_out = (checksum == expected);
+ * :return EDD_OK;
+ * stop
+ * @enduml
+ *
+ * @return EDD_ReturnType
+ * - EDD_OK if the verification was executed.
+ * - EDD_NULL_PTR if data or result_out is NULL.
+ * - EDD_INVALID_LENGTH if length is 0.
+ */
+EDD_ReturnType EDD_VerifyLinEnhanced(uint8_t pid, const uint8_t *data, uint32_t length, uint8_t expected, uint8_t *result_out);
+
+/**
+ * @brief Verify the LIN checksums of many frames in one call.
+ *
+ * @details
+ * **Goal of the function**
+ *
+ * The purpose of this function is to check large sets of LIN frames (bus log
+ * analysis, slave frame buffers) without one API call per frame. Classic and
+ * enhanced frames may be mixed in one batch.
+ *
+ * The processing logic:
+ * - Validates input pointers (`frames`, `result_bitmap`, every frame buffer).
+ * - Validates that every frame has `length > 0`.
+ * - Clears the `(count + 7) / 8` bytes of `result_bitmap`.
+ * - For each frame, starts the sum with `pid` (enhanced) or 0 (classic),
+ *   adds the data with the word-at-a-time kernel and sets bit `i` of
+ *   `result_bitmap` if the checksum equals `expectedChecksum`.
+ *
+ * @par Interface summary
+ *
+ * | Interface      | In | Out | Data type / Signature   | Param | Data factor | Data offset | Data size       | Data range  | Data unit |
+ * |---------------|:--:|:---:|-------------------------|:-----:|------------:|------------:|----------------:|-------------|----------|
+ * | frames         | X  |     | const EDD_LinFrameType* |   -   |      1      |      0      | count           | -           | [-]      |
+ * | count          | X  |     | uint16_t                |   -   |      1      |      0      | 1               | [0..65535]  | [-]      |
+ * | result_bitmap  | X  |  X  | uint8_t*                |   -   |      1      |      0      | (count + 7) / 8 | [0,255]     | [-]      |
+ *
+ * @par Activity diagram (PlantUML)
+ *
+ * @startuml
+ * start
+ * if (frames == NULL OR result_bitmap == NULL) then (YES)
+ *   :return EDD_NULL_PTR;
+ *   stop
+ * endif
+ * while (for each frame)
+ *   if (data == NULL) then (YES)
+ *     :return EDD_NULL_PTR;
+ *     stop
+ *   elseif (length == 0) then (YES)
+ *     :return EDD_INVALID_LENGTH;
+ *     stop
+ *   endif
+ * endwhile
+ * :clear result_bitmap;
+ * while (for each frame)
+ *   :sum = (model == ENHANCED) ? pid : 0;
+ *   :checksum = NOT fold8(LinSum(sum, data, length));
+ *   :set bit i when checksum == expectedChecksum;
+ * endwhile
+ * :return EDD_OK;
+ * stop
+ * @enduml
+ *
+ * @return EDD_ReturnType
+ * - EDD_OK if all frames were verified (results in `result_bitmap`).
+ * - EDD_NULL_PTR if a required pointer (including a frame buffer) is NULL.
+ * - EDD_INVALID_LENGTH if a frame has length 0.
+ */
+EDD_ReturnType EDD_VerifyLinBatch(const EDD_LinFrameType *frames, uint16_t count, uint8_t *result_bitmap);
+
+/**
+ * @brief Initialize a LIN checksum streaming context.
+ *
+ * @details
+ * **Goal of the function**
+ *
+ * The purpose of this function is to start a LIN checksum over data received
+ * in several parts (e.g. byte-wise UART reception of a slave response).
+ *
+ * The processing logic:
+ * - Validates the context pointer (`ctx`).
+ * - Sets the sum to `pid` for `EDD_LIN_ENHANCED`, to 0 for `EDD_LIN_CLASSIC`.
+ *
+ * @par Interface summary
+ *
+ * | Interface | In | Out | Data type / Signature | Param | Data factor | Data offset | Data size | Data range       | Data unit |
+ * |----------|:--:|:---:|-----------------------|:-----:|------------:|------------:|----------:|------------------|----------|
+ * | ctx      |    |  X  | EDD_LinCtx*           |   -   |      1      |      0      |     1    | -                | [-]      |
+ * | model    | X  |     | EDD_LinModelType      |   -   |      1      |      0      |     1    | CLASSIC/ENHANCED | [-]      |
+ * | pid      | X  |     | uint8_t               |   -   |      1      |      0      |     1    | [0,255]          | [-]      |
+ *
+ * @par Activity diagram (PlantUML)
+ *
+ * @startuml
+ * start
+ * if (ctx == NULL) then (YES)
+ *   :return EDD_NULL_PTR;
+ *   stop
+ * endif
+ * :ctx->sum = (model == ENHANCED) ? pid : 0;
+ * :return EDD_OK;
+ * stop
+ * @enduml
+ *
+ * @return EDD_ReturnType
+ * - EDD_OK if the context was initialized.
+ * - EDD_NULL_PTR if ctx is NULL.
+ */
+EDD_ReturnType EDD_LinCtxInit(EDD_LinCtx *ctx, EDD_LinModelType model, uint8_t pid);
+
+/**
+ * @brief Add a chunk of data to a LIN checksum streaming context.
+ *
+ * @details
+ * **Goal of the function**
+ *
+ * The purpose of this function is to continue a LIN checksum with the next
+ * part of the frame. Chunks of any length and alignment may be used; the
+ * result is the same as one call over the whole frame.
+ *
+ * The processing logic:
+ * - Validates input pointers (`ctx`, `data`).
+ * - Adds the chunk to `ctx->sum` with the word-at-a-time kernel; a chunk of
+ *   length 0 leaves the context unchanged.
+ *
+ * @par Interface summary
+ *
+ * | Interface | In | Out | Data type / Signature | Param | Data factor | Data offset | Data size | Data range  | Data unit |
+ * |----------|:--:|:---:|-----------------------|:-----:|------------:|------------:|----------:|-------------|----------|
+ * | ctx      | X  |  X  | EDD_LinCtx*           |   -   |      1      |      0      |     1    | -           | [-]      |
+ * | data     | X  |     | const uint8_t*        |   -   |      1      |      0      |  length  | [0,255]     | [-]      |
+ * | length   | X  |     | uint32_t              |   -   |      1      |      0      |     -    | [0..2^32-1] | bytes    |
+ *
+ * @par Activity diagram (PlantUML)
+ *
+ * @startuml
+ * start
+ * if (ctx == NULL OR data == NULL) then (YES)
+ *   :return EDD_NULL_PTR;
+ *   stop
+ * endif
+ * if (length > 0) then (YES)
+ *   :ctx->sum = LinSum(ctx->sum, data, length);
+ * endif
+ * :return EDD_OK;
+ * stop
+ * @enduml
+ *
+ * @return EDD_ReturnType
+ * - EDD_OK if the chunk was processed.
+ * - EDD_NULL_PTR if ctx or data is NULL.
+ */
+EDD_ReturnType EDD_LinCtxUpdate(EDD_LinCtx *ctx, const uint8_t *data, uint32_t length);
+
+/**
+ * @brief Read the LIN checksum of a streaming context.
+ *
+ * @details
+ * **Goal of the function**
+ *
+ * The purpose of this function is to obtain the checksum byte of the data fed
+ * into the context so far. The context is not modified.
+ *
+ * The processing logic:
+ * - Validates input pointers (`ctx`, `checksum_out`).
+ * - Folds `ctx->sum` to 8 bits, inverts it and writes it into `*checksum_out`.
+ *
+ * @par Interface summary
+ *
+ * | Interface    | In | Out | Data type / Signature | Param | Data factor | Data offset | Data size | Data range | Data unit |
+ * |-------------|:--:|:---:|-----------------------|:-----:|------------:|------------:|----------:|-----------|----------|
+ * | ctx          | X  |     | const EDD_LinCtx*     |   -   |      1      |      0      |     1    | -         | [-]      |
+ * | checksum_out | X  |  X  | uint8_t*              |   -   |      1      |      0      |     1    | [0,255]   | [-]      |
+ *
+ * @par Activity diagram (PlantUML)
+ *
+ * @startuml
+ * start
+ * if (ctx == NULL OR checksum_out == NULL) then (YES)
+ *   :return EDD_NULL_PTR;
+ *   stop
+ * endif
+ * :*checksum_out = NOT fold8(ctx->sum);
+ * :return EDD_OK;
+ * stop
+ * @enduml
+ *
+ * @return EDD_ReturnType
+ * - EDD_OK if the checksum was written.
+ * - EDD_NULL_PTR if ctx or checksum_out is NULL.
+ */
+EDD_ReturnType EDD_LinCtxFinal(const EDD_LinCtx *ctx, uint8_t *checksum_out);
+
+/**
+ * @brief Select the engine used by @ref EDD_CalcCrc8Async.
+ *
+ * @details
+ * **Goal of the function**
+ *
+ * The purpose of this function is to route asynchronous CRC-8 requests either
+ * to the software engine (the lookup table code of @ref EDD_CalcCrc8) or to a
+ * CRC peripheral driver, e.g. a hardware CRC unit fed by DMA.
+ *
+ * The processing logic:
+ * - Rejects the change with `EDD_BUSY` while a request is in progress.
+ * - Stores `driver`; `NULL` selects the built-in software driver, which
+ *   completes every request synchronously.
+ *
+ * The busy check and the change run inside the module critical section
+ * (see `EDD_CRITICAL_SECTION_SUPPORT`).
+ *
+ * @par Interface summary
+ *
+ * | Interface | In | Out | Data type / Signature      | Param | Data factor | Data offset | Data size | Data range | Data unit |
+ * |----------|:--:|:---:|----------------------------|:-----:|------------:|------------:|----------:|-----------|----------|
+ * | driver   | X  |     | const EDD_Crc8DriverType*  |   -   |      1      |      0      |     1    | NULL = SW  | [-]      |
+ *
+ * @par Activity diagram (PlantUML)
+ *
+ * @startuml
+ * start
+ * :enter critical section;
+ * if (request in progress) then (YES)
+ *   :exit critical section;
+ *   :return EDD_BUSY;
+ *   stop
+ * endif
+ * if (driver == NULL) then (YES)
+ *   :active driver = software driver;
+ * else (NO)
+ *   :active driver = driver;
+ * endif
+ * :exit critical section;
+ * :return EDD_OK;
+ * stop
+ * @enduml
+ *
+ * @return EDD_ReturnType
+ * - EDD_OK if the driver was selected.
+ * - EDD_BUSY if a request is in progress.
+ */
+EDD_ReturnType EDD_Crc8SetDriver(const EDD_Crc8DriverType *driver);
+
+/**
+ * @brief Request the CRC-8 of a buffer from the selected CRC engine.
+ *
+ * @details
+ * **Goal of the function**
+ *
+ * The purpose of this function is to let the application overlap the CRC-8
+ * computation of a large buffer with other work when a CRC peripheral is
+ * available. The result is delivered through `callback`.
+ *
+ * The processing logic:
+ * - Validates input pointers (`data`, `callback`) and `length > 0`.
+ * - Claims the engine with a test-and-set of its busy flag; rejects the
+ *   request with `EDD_BUSY` while a previous one is in progress (one request
+ *   at a time).
+ * - Stores `callback` and starts the active driver.
+ * - If the driver refuses the request, clears the busy state and returns its
+ *   error; the callback is not called.
+ * - On completion the module clears the busy state first and then calls
+ *   `callback(crc)`, so the callback may issue the next request.
+ *
+ * With the software driver the callback runs before this function returns.
+ * The buffer shall not be modified until the callback was called.
+ *
+ * Concurrent callers: with `EDD_CRITICAL_SECTION_SUPPORT` = 1u the busy flag
+ * is only accessed inside `EDD_EnterCritical()` / `EDD_ExitCritical()`, so of
+ * two concurrent requests exactly one is accepted. The driver and the callback
+ * run outside the critical section. With the default 0u the function takes a
+ * single caller (one task); only the completion may run in another context.
+ *
+ * @par Interface summary
+ *
+ * | Interface | In | Out | Data type / Signature  | Param | Data factor | Data offset | Data size | Data range  | Data unit |
+ * |----------|:--:|:---:|------------------------|:-----:|------------:|------------:|----------:|-------------|----------|
+ * | data     | X  |     | const uint8_t*         |   -   |      1      |      0      |  length  | [0,255]     | [-]      |
+ * | length   | X  |     | uint32_t               |   -   |      1      |      0      |     -    | [1..2^32-1] | bytes    |
+ * | callback | X  |     | EDD_Crc8CallbackType   |   -   |      -      |      -      |     -    | -           | [-]      |
+ *
+ * @par Activity diagram (PlantUML)
+ *
+ * @startuml
+ * start
+ * if (data == NULL OR callback == NULL) then (YES)
+ *   :return EDD_NULL_PTR;
+ *   stop
+ * endif
+ * if (length == 0) then (YES)
+ *   :return EDD_INVALID_LENGTH;
+ *   stop
+ * endif
+ * :enter critical section;
+ * :wasBusy = busy; busy = 1;
+ * :exit critical section;
+ * if (wasBusy) then (YES)
+ *   :return EDD_BUSY;
+ *   stop
+ * endif
+ * :store callback;
+ * :ret = driver->start(data, length, Done);
+ * if (ret != EDD_OK) then (YES)
+ *   :busy = 0 (in critical section);
+ * endif
+ * :return ret;
+ * stop
+ * @enduml
+ *
+ * @return EDD_ReturnType
+ * - EDD_OK if the request was accepted (the callback follows).
+ * - EDD_NULL_PTR if data or callback is NULL.
+ * - EDD_INVALID_LENGTH if length is 0.
+ * - EDD_BUSY if a request is in progress, or the error returned by the driver.
+ */
+EDD_ReturnType EDD_CalcCrc8Async(const uint8_t *data, uint32_t length, EDD_Crc8CallbackType callback);
+
+#if(EDD_CRC8_SAE_J1850_SUPPORT == 1u)
+/**
+ * @brief Compute CRC-8 SAE J1850 over a given data buffer.
+ *
+ * @details
+ * **Goal of the function**
+ *
+ * The purpose of this function is to compute the CRC-8 SAE J1850 checksum (poly 0x1D, init 0xFF, XOROut 0xFF, check 0x4B)
+ * over a memory buffer using a 256-entry lookup table generated at compile time
+ * from the polynomial. Available when `EDD_CRC8_SAE_J1850_SUPPORT` is enabled.
+ *
+ * The processing logic:
+ * - Validates the input pointers (`data`, `crc_out`).
+ * - Validates that `length` is greater than zero.
+ * - Initializes CRC accumulator with 0xFF.
+ * - For each byte in the buffer:
+ *   - Updates CRC with `Table[crc XOR data[i]]`.
+ * - Writes `crc XOR 0xFF` into `*crc_out`.
+ *
+ * @par Interface summary
+ *
+ * | Interface  | In | Out | Data type / Signature        | Param | Data factor | Data offset | Data size | Data range     | Data unit |
+ * |-----------|:--:|:---:|------------------------------|:-----:|------------:|------------:|----------:|----------------|----------|
+ * | data      | X  |     | const uint8_t*               |   -   |      1      |      0      |  length  | [0,255]        | [-]      |
+ * | length    | X  |     | uint32_t                     |   -   |      1      |      0      |     -    | [1..2^32-1]    | bytes    |
+ * | crc_out   | X  |  X  | uint8_t*                     |   -   |      1      |      0      |     1    | [0,255]        | [-]      |
+ *
+ * @par Activity diagram (PlantUML)
+ *
+ * @startuml
+ * start
+ * :Validate pointers;
+ * if (data == NULL OR crc_out == NULL) then (YES)
+ *   :return EDD_NULL_PTR;
+ *   stop
+ * endif
+ * :Validate length;
+ * if (length == 0) then (YES)
+ *   :return EDD_INVALID_LENGTH;
+ *   stop
+ * endif
+ * :crc = 0xFF;
+ * while (i < length)
+ *   :crc = TableJ1850[crc XOR data[i]];
+ * endwhile
+ * :*crc_out = crc XOR 0xFF;
+ * :return EDD_OK;
+ * stop
+ * @enduml
+ *
+ * @return EDD_ReturnType
+ * - EDD_OK if CRC was computed successfully.
+ * - EDD_NULL_PTR if any input pointer is NULL.
+ * - EDD_INVALID_LENGTH if length is 0.
+ */
+EDD_ReturnType EDD_CalcCrc8SaeJ1850(const uint8_t *data, uint32_t length, uint8_t *crc_out);
+#endif
+
+#if(EDD_CRC8H2F_SUPPORT == 1u)
+/**
+ * @brief Compute CRC-8H2F over a given data buffer.
+ *
+ * @details
+ * **Goal of the function**
+ *
+ * The purpose of this function is to compute the CRC-8H2F checksum (poly 0x2F, init 0xFF, XOROut 0xFF, check 0xDF)
+ * over a memory buffer using a 256-entry lookup table generated at compile time
+ * from the polynomial. Available when `EDD_CRC8H2F_SUPPORT` is enabled.
+ *
+ * The processing logic:
+ * - Validates the input pointers (`data`, `crc_out`).
+ * - Validates that `length` is greater than zero.
+ * - Initializes CRC accumulator with 0xFF.
+ * - For each byte in the buffer:
+ *   - Updates CRC with `Table[crc XOR data[i]]`.
+ * - Writes `crc XOR 0xFF` into `*crc_out`.
+ *
+ * @par Interface summary
+ *
+ * | Interface  | In | Out | Data type / Signature        | Param | Data factor | Data offset | Data size | Data range     | Data unit |
+ * |-----------|:--:|:---:|------------------------------|:-----:|------------:|------------:|----------:|----------------|----------|
+ * | data      | X  |     | const uint8_t*               |   -   |      1      |      0      |  length  | [0,255]        | [-]      |
+ * | length    | X  |     | uint32_t                     |   -   |      1      |      0      |     -    | [1..2^32-1]    | bytes    |
+ * | crc_out   | X  |  X  | uint8_t*                     |   -   |      1      |      0      |     1    | [0,255]        | [-]      |
+ *
+ * @par Activity diagram (PlantUML)
+ *
+ * @startuml
+ * start
+ * :Validate pointers;
+ * if (data == NULL OR crc_out == NULL) then (YES)
+ *   :return EDD_NULL_PTR;
+ *   stop
+ * endif
+ * :Validate length;
+ * if (length == 0) then (YES)
+ *   :return EDD_INVALID_LENGTH;
+ *   stop
+ * endif
+ * :crc = 0xFF;
+ * while (i < length)
+ *   :crc = TableH2F[crc XOR data[i]];
+ * endwhile
+ * :*crc_out = crc XOR 0xFF;
+ * :return EDD_OK;
+ * stop
+ * @enduml
+ *
+ * @return EDD_ReturnType
+ * - EDD_OK if CRC was computed successfully.
+ * - EDD_NULL_PTR if any input pointer is NULL.
+ * - EDD_INVALID_LENGTH if length is 0.
+ */
+EDD_ReturnType EDD_CalcCrc8H2F(const uint8_t *data, uint32_t length, uint8_t *crc_out);
+#endif
+
+#if(EDD_CRC16_SUPPORT == 1u)
+/**
+ * @brief Compute CRC-16-CCITT over a given data buffer.
+ *
+ * @details
+ * **Goal of the function**
+ *
+ * The purpose of this function is to compute the CRC-16-CCITT checksum (poly 0x1021, init 0xFFFF, not reflected, XOROut 0x0000, check 0x29B1)
+ * over a memory buffer using a 256-entry lookup table generated at compile time
+ * from the polynomial. Available when `EDD_CRC16_SUPPORT` is enabled.
+ *
+ * The processing logic:
+ * - Validates the input pointers (`data`, `crc_out`).
+ * - Validates that `length` is greater than zero.
+ * - Initializes CRC accumulator with 0xFFFF.
+ * - For each byte in the buffer:
+ *   - Updates CRC with `(crc << 8) XOR Table[(crc >> 8) XOR data[i]]`.
+ * - Writes `crc` into `*crc_out`.
+ *
+ * @par Interface summary
+ *
+ * | Interface  | In | Out | Data type / Signature        | Param | Data factor | Data offset | Data size | Data range     | Data unit |
+ * |-----------|:--:|:---:|------------------------------|:-----:|------------:|------------:|----------:|----------------|----------|
+ * | data      | X  |     | const uint8_t*               |   -   |      1      |      0      |  length  | [0,255]        | [-]      |
+ * | length    | X  |     | uint32_t                     |   -   |      1      |      0      |     -    | [1..2^32-1]    | bytes    |
+ * | crc_out   | X  |  X  | uint16_t*                    |   -   |      1      |      0      |     1    | [0,65535]      | [-]      |
+ *
+ * @par Activity diagram (PlantUML)
+ *
+ * @startuml
+ * start
+ * :Validate pointers;
+ * if (data == NULL OR crc_out == NULL) then (YES)
+ *   :return EDD_NULL_PTR;
+ *   stop
+ * endif
+ * :Validate length;
+ * if (length == 0) then (YES)
+ *   :return EDD_INVALID_LENGTH;
+ *   stop
+ * endif
+ * :crc = 0xFFFF;
+ * while (i < length)
+ *   :crc = (crc << 8) XOR Table16[(crc >> 8) XOR data[i]];
+ * endwhile
+ * :*crc_out = crc;
+ * :return EDD_OK;
+ * stop
+ * @enduml
+ *
+ * @return EDD_ReturnType
+ * - EDD_OK if CRC was computed successfully.
+ * - EDD_NULL_PTR if any input pointer is NULL.
+ * - EDD_INVALID_LENGTH if length is 0.
+ */
+EDD_ReturnType EDD_CalcCrc16(const uint8_t *data, uint32_t length, uint16_t *crc_out);
+#endif
+
+#if(EDD_CRC32_SUPPORT == 1u)
+/**
+ * @brief Compute CRC-32 over a given data buffer.
+ *
+ * @details
+ * **Goal of the function**
+ *
+ * The purpose of this function is to compute the CRC-32 checksum (IEEE 802.3, poly 0x04C11DB7 reflected, init and XOROut 0xFFFFFFFF, check 0xCBF43926)
+ * over a memory buffer using a 256-entry lookup table generated at compile time
+ * from the polynomial. Available when `EDD_CRC32_SUPPORT` is enabled.
+ *
+ * The processing logic:
+ * - Validates the input pointers (`data`, `crc_out`).
+ * - Validates that `length` is greater than zero.
+ * - Initializes CRC accumulator with 0xFFFFFFFF.
+ * - For each byte in the buffer:
+ *   - Updates CRC with `(crc >> 8) XOR Table[(crc XOR data[i]) AND 0xFF]`.
+ * - Writes `crc XOR 0xFFFFFFFF` into `*crc_out`.
+ *
+ * @par Interface summary
+ *
+ * | Interface  | In | Out | Data type / Signature        | Param | Data factor | Data offset | Data size | Data range     | Data unit |
+ * |-----------|:--:|:---:|------------------------------|:-----:|------------:|------------:|----------:|----------------|----------|
+ * | data      | X  |     | const uint8_t*               |   -   |      1      |      0      |  length  | [0,255]        | [-]      |
+ * | length    | X  |     | uint32_t                     |   -   |      1      |      0      |     -    | [1..2^32-1]    | bytes    |
+ * | crc_out   | X  |  X  | uint32_t*                    |   -   |      1      |      0      |     1    | [0,2^32-1]     | [-]      |
+ *
+ * @par Activity diagram (PlantUML)
+ *
+ * @startuml
+ * start
+ * :Validate pointers;
+ * if (data == NULL OR crc_out == NULL) then (YES)
+ *   :return EDD_NULL_PTR;
+ *   stop
+ * endif
+ * :Validate length;
+ * if (length == 0) then (YES)
+ *   :return EDD_INVALID_LENGTH;
+ *   stop
+ * endif
+ * :crc = 0xFFFFFFFF;
+ * while (i < length)
+ *   :crc = (crc >> 8) XOR Table32[(crc XOR data[i]) AND 0xFF];
+ * endwhile
+ * :*crc_out = crc XOR 0xFFFFFFFF;
+ * :return EDD_OK;
+ * stop
+ * @enduml
+ *
+ * @return EDD_ReturnType
+ * - EDD_OK if CRC was computed successfully.
+ * - EDD_NULL_PTR if any input pointer is NULL.
+ * - EDD_INVALID_LENGTH if length is 0.
+ */
+EDD_ReturnType EDD_CalcCrc32(const uint8_t *data, uint32_t length, uint32_t *crc_out);
+#endif
+
+#if(EDD_CRC32P4_SUPPORT == 1u)
+/**
+ * @brief Compute CRC-32P4 over a given data buffer.
+ *
+ * @details
+ * **Goal of the function**
+ *
+ * The purpose of this function is to compute the CRC-32P4 checksum (AUTOSAR E2E Profile 4, poly 0xF4ACFB13 reflected, init and XOROut 0xFFFFFFFF, check 0x1697D06A)
+ * over a memory buffer using a 256-entry lookup table generated at compile time
+ * from the polynomial. Available when `EDD_CRC32P4_SUPPORT` is enabled.
+ *
+ * The processing logic:
+ * - Validates the input pointers (`data`, `crc_out`).
+ * - Validates that `length` is greater than zero.
+ * - Initializes CRC accumulator with 0xFFFFFFFF.
+ * - For each byte in the buffer:
+ *   - Updates CRC with `(crc >> 8) XOR Table[(crc XOR data[i]) AND 0xFF]`.
+ * - Writes `crc XOR 0xFFFFFFFF` into `*crc_out`.
+ *
+ * @par Interface summary
+ *
+ * | Interface  | In | Out | Data type / Signature        | Param | Data factor | Data offset | Data size | Data range     | Data unit |
+ * |-----------|:--:|:---:|------------------------------|:-----:|------------:|------------:|----------:|----------------|----------|
+ * | data      | X  |     | const uint8_t*               |   -   |      1      |      0      |  length  | [0,255]        | [-]      |
+ * | length    | X  |     | uint32_t                     |   -   |      1      |      0      |     -    | [1..2^32-1]    | bytes    |
+ * | crc_out   | X  |  X  | uint32_t*                    |   -   |      1      |      0      |     1    | [0,2^32-1]     | [-]      |
+ *
+ * @par Activity diagram (PlantUML)
+ *
+ * @startuml
+ * start
+ * :Validate pointers;
+ * if (data == NULL OR crc_out == NULL) then (YES)
+ *   :return EDD_NULL_PTR;
+ *   stop
+ * endif
+ * :Validate length;
+ * if (length == 0) then (YES)
+ *   :return EDD_INVALID_LENGTH;
+ *   stop
+ * endif
+ * :crc = 0xFFFFFFFF;
+ * while (i < length)
+ *   :crc = (crc >> 8) XOR Table32P4[(crc XOR data[i]) AND 0xFF];
+ * endwhile
+ * :*crc_out = crc XOR 0xFFFFFFFF;
+ * :return EDD_OK;
+ * stop
+ * @enduml
+ *
+ * @return EDD_ReturnType
+ * - EDD_OK if CRC was computed successfully.
+ * - EDD_NULL_PTR if any input pointer is NULL.
+ * - EDD_INVALID_LENGTH if length is 0.
+ */
+EDD_ReturnType EDD_CalcCrc32P4(const uint8_t *data, uint32_t length, uint32_t *crc_out);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
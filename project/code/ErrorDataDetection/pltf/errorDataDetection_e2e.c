@@ -0,0 +1,144 @@
+#include "errorDataDetection_e2e.h"
+#include "errorDataDetection_e2e_priv.h"
+
+/**
+ * @file errorDataDetection_e2e.c
+ * @brief E2E protection layer implementation.
+ *
+ * @details
+ * Implements alive counter handling and CRC protection of PDUs on top of the
+ * CRC-8 services of the Error Data Detection module. The CRC is streamed over
+ * the frame buffer with the `EDD_Crc8Ctx` API, skipping the CRC byte, so PDUs
+ * are protected and checked in place.
+ */
+
+/* =============================
+ *  Static Helpers Implementation
+ * ============================= */
+
+/**
+ * @brief Check the PDU layout of an E2E configuration (private).
+ *
+ * @param config E2E configuration.
+ *
+ * @return 1 if the layout is valid, 0 otherwise.
+ */
+static uint8_t EDD_E2E_LayoutValid(const EDD_E2E_ConfigType *config) {
+  if((config->crcOffset >= config->dataLength) || (config->counterOffset >= config->dataLength)) { return 0u; }
+
+  return (config->crcOffset != config->counterOffset) ? 1u : 0u;
+}
+
+/**
+ * @brief Compute the CRC-8 over data ID and PDU without the CRC byte (private).
+ *
+ * @param config E2E configuration with a valid layout.
+ * @param data   PDU buffer.
+ *
+ * @return CRC-8 over data ID and PDU.
+ */
+static uint8_t EDD_E2E_ComputeCrc(const EDD_E2E_ConfigType *config, const uint8_t *data) {
+  EDD_Crc8Ctx ctx;
+  uint8_t dataIdBytes[2];
+  uint8_t crc;
+
+  dataIdBytes[0] = (uint8_t)(config->dataId & 0xFFu);
+  dataIdBytes[1] = (uint8_t)(config->dataId >> 8);
+
+  (void)EDD_Crc8CtxInit(&ctx);
+  (void)EDD_Crc8CtxUpdate(&ctx, dataIdBytes, 2u);
+  (void)EDD_Crc8CtxUpdate(&ctx, data, config->crcOffset);
+  (void)EDD_Crc8CtxUpdate(&ctx, &data[config->crcOffset + 1u], (uint32_t)config->dataLength - config->crcOffset - 1u);
+  (void)EDD_Crc8CtxFinal(&ctx, &crc);
+
+  return crc;
+}
+
+/* =============================
+ *  Public API Implementation
+ * ============================= */
+
+EDD_ReturnType EDD_E2E_ProtectInit(EDD_E2E_ProtectStateType *state) {
+  if(state == NULL) { return EDD_NULL_PTR; }
+
+  state->counter = 0u;
+
+  return EDD_OK;
+}
+
+EDD_ReturnType EDD_E2E_CheckInit(EDD_E2E_CheckStateType *state) {
+  if(state == NULL) { return EDD_NULL_PTR; }
+
+  state->lastCounter = 0u;
+  state->synchronized = 0u;
+  state->status = EDD_E2E_STATUS_ERROR;
+
+  return EDD_OK;
+}
+
+EDD_ReturnType EDD_E2E_Protect(const EDD_E2E_ConfigType *config, EDD_E2E_ProtectStateType *state, uint8_t *data) {
+  if((config == NULL) || (state == NULL) || (data == NULL)) { return EDD_NULL_PTR; }
+
+  if(EDD_E2E_LayoutValid(config) == 0u) { return EDD_INVALID_LENGTH; }
+
+  data[config->counterOffset] = (uint8_t)((data[config->counterOffset] & (uint8_t)~EDD_E2E_COUNTER_MASK) | (state->counter & EDD_E2E_COUNTER_MASK));
+  data[config->crcOffset] = EDD_E2E_ComputeCrc(config, data);
+
+  state->counter = (state->counter >= EDD_E2E_COUNTER_MAX) ? 0u : (uint8_t)(state->counter + 1u);
+
+  return EDD_OK;
+}
+
+EDD_ReturnType EDD_E2E_Check(const EDD_E2E_ConfigType *config, EDD_E2E_CheckStateType *state, const uint8_t *data) {
+  uint8_t counter;
+  uint8_t delta;
+
+  if((config == NULL) || (state == NULL) || (data == NULL)) { return EDD_NULL_PTR; }
+
+  if(EDD_E2E_LayoutValid(config) == 0u) { return EDD_INVALID_LENGTH; }
+
+  if((config->maxDeltaCounter == 0u) || (config->maxDeltaCounter > EDD_E2E_COUNTER_MAX)) { return EDD_INVALID_PARAM; }
+
+  counter = data[config->counterOffset] & EDD_E2E_COUNTER_MASK;
+
+  if((counter > EDD_E2E_COUNTER_MAX) || (EDD_E2E_ComputeCrc(config, data) != data[config->crcOffset])) {
+    state->status = EDD_E2E_STATUS_ERROR;
+    return EDD_OK;
+  }
+
+  if(state->synchronized == 0u) {
+    state->synchronized = 1u;
+    state->status = EDD_E2E_STATUS_OK;
+  } else {
+    delta = (counter >= state->lastCounter) ? (uint8_t)(counter - state->lastCounter) : (uint8_t)((counter + EDD_E2E_COUNTER_MAX + 1u) - state->lastCounter);
+
+    if(delta == 0u) {
+      state->status = EDD_E2E_STATUS_REPEATED;
+    } else if(delta <= config->maxDeltaCounter) {
+      state->status = EDD_E2E_STATUS_OK;
+    } else {
+      state->status = EDD_E2E_STATUS_WRONG_SEQUENCE;
+    }
+  }
+
+  state->lastCounter = counter;
+
+  return EDD_OK;
+}
+
+EDD_ReturnType EDD_E2E_CheckBatch(const EDD_E2E_CheckJobType *jobs, uint16_t count) {
+  uint16_t i;
+
+  if(jobs == NULL) { return EDD_NULL_PTR; }
+
+  /* Reject the batch before any receiver state is touched */
+  for(i = 0u; i < count; i++) {
+    if((jobs[i].config == NULL) || (jobs[i].state == NULL) || (jobs[i].data == NULL)) { return EDD_NULL_PTR; }
+    if(EDD_E2E_LayoutValid(jobs[i].config) == 0u) { return EDD_INVALID_LENGTH; }
+    if((jobs[i].config->maxDeltaCounter == 0u) || (jobs[i].config->maxDeltaCounter > EDD_E2E_COUNTER_MAX)) { return EDD_INVALID_PARAM; }
+  }
+
+  for(i = 0u; i < count; i++) { (void)EDD_E2E_Check(jobs[i].config, jobs[i].state, jobs[i].data); }
+
+  return EDD_OK;
+}
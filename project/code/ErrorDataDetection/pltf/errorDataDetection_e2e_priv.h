@@ -0,0 +1,40 @@
+#ifndef ERRORDATADETECTION_E2E_PRIV_H
+#define ERRORDATADETECTION_E2E_PRIV_H
+
+#include "errorDataDetection_e2e.h"
+#include <stdint.h>
+
+/**
+ * @file errorDataDetection_e2e_priv.h
+ * @brief Private declarations for the E2E protection layer.
+ *
+ * @warning
+ * This header shall not be included by external modules.
+ */
+
+#define EDD_E2E_COUNTER_MASK (0x0Fu) /**< Counter nibble inside the counter byte */
+
+/**
+ * @brief Check that the PDU layout of a configuration is usable.
+ *
+ * @param config E2E configuration (not NULL).
+ *
+ * @return 1 if CRC and counter offsets are distinct and inside the PDU, 0 otherwise.
+ */
+static uint8_t EDD_E2E_LayoutValid(const EDD_E2E_ConfigType *config);
+
+/**
+ * @brief Compute the E2E CRC of a PDU in place.
+ *
+ * @details
+ * Streams the data ID (low byte first) and every PDU byte except the CRC byte
+ * through the CRC-8 context API; the PDU is not copied.
+ *
+ * @param config E2E configuration with a valid layout.
+ * @param data   PDU buffer (`config->dataLength` bytes).
+ *
+ * @return CRC-8 over data ID and PDU.
+ */
+static uint8_t EDD_E2E_ComputeCrc(const EDD_E2E_ConfigType *config, const uint8_t *data);
+
+#endif /* ERRORDATADETECTION_E2E_PRIV_H */
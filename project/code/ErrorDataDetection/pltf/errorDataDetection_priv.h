@@ -1,6 +1,7 @@
 #ifndef ERRORDATADETECTION_PRIV_H
 #define ERRORDATADETECTION_PRIV_H
 
+#include "errorDataDetection_cfg.h"
 #include <stdint.h>
 
 /**
@@ -9,8 +10,8 @@
  *
  * @details
  * This header is intended for internal module usage only.
- * It declares private constants, the CRC-8 lookup table, and internal static
- * helper functions used by `errorDataDetection.c`.
+ * It declares private constants, the compile-time generated CRC lookup tables,
+ * and internal static helper functions used by `errorDataDetection.c`.
  *
  * @warning
  * This header shall not be included by external modules.
@@ -19,7 +20,111 @@
 /* CRC-8 parameters (CRC-8/ATM) */
 #define EDD_CRC8_POLY (0x07u) /**< CRC polynomial: x^8 + x^2 + x + 1 */
 #define EDD_CRC8_INIT (0x00u) /**< CRC initial value */
+#define EDD_LIN_SUM_INIT (0x00u) /**< LIN classic checksum accumulator initial value */
 
+/* CRC-16 parameters (CRC-16-CCITT-FALSE) */
+#define EDD_CRC16_POLY (0x1021u) /**< CRC polynomial: x^16 + x^12 + x^5 + 1 */
+#define EDD_CRC16_INIT (0xFFFFu) /**< CRC initial value */
+
+/* CRC-8 SAE J1850 parameters */
+#define EDD_CRC8_SAE_J1850_POLY (0x1Du)   /**< CRC polynomial: x^8 + x^4 + x^3 + x^2 + 1 */
+#define EDD_CRC8_SAE_J1850_INIT (0xFFu)   /**< CRC initial value */
+#define EDD_CRC8_SAE_J1850_XOROUT (0xFFu) /**< Final XOR value */
+
+/* CRC-8H2F parameters */
+#define EDD_CRC8H2F_POLY (0x2Fu)   /**< CRC polynomial: x^8 + x^5 + x^3 + x^2 + x + 1 */
+#define EDD_CRC8H2F_INIT (0xFFu)   /**< CRC initial value */
+#define EDD_CRC8H2F_XOROUT (0xFFu) /**< Final XOR value */
+
+/* CRC-32 parameters (IEEE 802.3, reflected) */
+#define EDD_CRC32_POLY (0xEDB88320uL)   /**< Reflected form of polynomial 0x04C11DB7 */
+#define EDD_CRC32_INIT (0xFFFFFFFFuL)   /**< CRC initial value */
+#define EDD_CRC32_XOROUT (0xFFFFFFFFuL) /**< Final XOR value */
+
+/* CRC-32P4 parameters (AUTOSAR E2E Profile 4, reflected) */
+#define EDD_CRC32P4_POLY (0xC8DF352FuL)   /**< Reflected form of polynomial 0xF4ACFB13 */
+#define EDD_CRC32P4_INIT (0xFFFFFFFFuL)   /**< CRC initial value */
+#define EDD_CRC32P4_XOROUT (0xFFFFFFFFuL) /**< Final XOR value */
+
+#if(EDD_CRC_MODE != EDD_CRC_MODE_NIBBLE) && (EDD_CRC_MODE != EDD_CRC_MODE_TABLE) && (EDD_CRC_MODE != EDD_CRC_MODE_SLICE4) && (EDD_CRC_MODE != EDD_CRC_MODE_SLICE8)
+#error "EDD_CRC_MODE shall be EDD_CRC_MODE_NIBBLE, EDD_CRC_MODE_TABLE, EDD_CRC_MODE_SLICE4 or EDD_CRC_MODE_SLICE8"
+#endif
+
+#if(EDD_CRC8_BATCH_STREAMS != 4u) && (EDD_CRC8_BATCH_STREAMS != 8u)
+#error "EDD_CRC8_BATCH_STREAMS shall be 4u or 8u"
+#endif
+
+/*==============================================================================
+ * Compile-time lookup table generation
+ *============================================================================*/
+
+/*
+ * Every lookup table of this module is generated by the preprocessor/compiler
+ * from the polynomial, so no hand-computed table has to be maintained. Each
+ * table entry is the CRC register after shifting one index byte through eight
+ * single-bit steps; the bit steps are branch-free so that the resulting
+ * expressions are integer constant expressions.
+ */
+
+/** @brief One MSB-first shift of an 8-bit CRC register. */
+#define EDD_CRC8_BIT_STEP(c, poly) ((((c) << 1) ^ ((((c) >> 7) & 1u) * (poly))) & 0xFFu)
+
+/** @brief One MSB-first shift of a 16-bit CRC register. */
+#define EDD_CRC16_BIT_STEP(c, poly) ((((c) << 1) ^ ((((c) >> 15) & 1u) * (poly))) & 0xFFFFu)
+
+/** @brief One LSB-first (reflected) shift of a 32-bit CRC register. */
+#define EDD_CRC32_BIT_STEP(c, poly) (((c) >> 1) ^ (((c) & 1u) * (poly)))
+
+/** @brief Apply a bit step eight times (one input byte). */
+#define EDD_CRC_BYTE_STEP(step, c, poly) step(step(step(step(step(step(step(step((c), poly), poly), poly), poly), poly), poly), poly), poly)
+
+/** @brief Table entry of an MSB-first CRC-8: the index is the register content. */
+#define EDD_CRC8_TABLE_ENTRY(i, poly) EDD_CRC_BYTE_STEP(EDD_CRC8_BIT_STEP, (i), poly)
+
+/** @brief Table entry of an MSB-first CRC-8 advanced by 4 bits: the index is the high nibble. */
+#define EDD_CRC8_NIBBLE_ENTRY(i, poly) EDD_CRC8_BIT_STEP(EDD_CRC8_BIT_STEP(EDD_CRC8_BIT_STEP(EDD_CRC8_BIT_STEP(((i) << 4), poly), poly), poly), poly)
+
+/** @brief Table entry of an MSB-first CRC-16: the index enters the high byte. */
+#define EDD_CRC16_TABLE_ENTRY(i, poly) EDD_CRC_BYTE_STEP(EDD_CRC16_BIT_STEP, ((i) << 8), poly)
+
+/** @brief Table entry of a reflected CRC-32: the index enters the low byte. */
+#define EDD_CRC32_TABLE_ENTRY(i, poly) EDD_CRC_BYTE_STEP(EDD_CRC32_BIT_STEP, (uint32_t)(i), poly)
+
+/** @brief Build the literal `0x<h><l>u` used as table index. */
+#define EDD_CRC_TABLE_INDEX(h, l) 0x##h##l##u
+
+/** @brief Generate the 16 entries `0x<h>0`..`0x<h>F` of a 256-entry table. */
+#define EDD_CRC_TABLE_ROW(gen, poly, h)                                                                                                                                         \
+  gen(EDD_CRC_TABLE_INDEX(h, 0), poly), gen(EDD_CRC_TABLE_INDEX(h, 1), poly), gen(EDD_CRC_TABLE_INDEX(h, 2), poly), gen(EDD_CRC_TABLE_INDEX(h, 3), poly),                   \
+      gen(EDD_CRC_TABLE_INDEX(h, 4), poly), gen(EDD_CRC_TABLE_INDEX(h, 5), poly), gen(EDD_CRC_TABLE_INDEX(h, 6), poly), gen(EDD_CRC_TABLE_INDEX(h, 7), poly),               \
+      gen(EDD_CRC_TABLE_INDEX(h, 8), poly), gen(EDD_CRC_TABLE_INDEX(h, 9), poly), gen(EDD_CRC_TABLE_INDEX(h, A), poly), gen(EDD_CRC_TABLE_INDEX(h, B), poly),               \
+      gen(EDD_CRC_TABLE_INDEX(h, C), poly), gen(EDD_CRC_TABLE_INDEX(h, D), poly), gen(EDD_CRC_TABLE_INDEX(h, E), poly), gen(EDD_CRC_TABLE_INDEX(h, F), poly)
+
+/** @brief Generate the initializer list of a 256-entry table with `gen(index, poly)`. */
+#define EDD_CRC_TABLE_256(gen, poly)                                                                                                                                            \
+  EDD_CRC_TABLE_ROW(gen, poly, 0), EDD_CRC_TABLE_ROW(gen, poly, 1), EDD_CRC_TABLE_ROW(gen, poly, 2), EDD_CRC_TABLE_ROW(gen, poly, 3), EDD_CRC_TABLE_ROW(gen, poly, 4),      \
+      EDD_CRC_TABLE_ROW(gen, poly, 5), EDD_CRC_TABLE_ROW(gen, poly, 6), EDD_CRC_TABLE_ROW(gen, poly, 7), EDD_CRC_TABLE_ROW(gen, poly, 8), EDD_CRC_TABLE_ROW(gen, poly, 9),  \
+      EDD_CRC_TABLE_ROW(gen, poly, A), EDD_CRC_TABLE_ROW(gen, poly, B), EDD_CRC_TABLE_ROW(gen, poly, C), EDD_CRC_TABLE_ROW(gen, poly, D), EDD_CRC_TABLE_ROW(gen, poly, E),  \
+      EDD_CRC_TABLE_ROW(gen, poly, F)
+
+#if(EDD_CRC_MODE == EDD_CRC_MODE_NIBBLE)
+/**
+ * @brief CRC-8 nibble lookup table for polynomial 0x07.
+ *
+ * @details
+ * Entry `n` is the CRC register obtained by shifting the nibble `n` (placed in
+ * the high half of the register) through four single-bit steps. One input byte
+ * is processed with two lookups (see @ref EDD_Crc8NibbleStep).
+ *
+ * Memory:
+ * - Size: 16 bytes
+ * - Storage: static const (intended to stay in ROM/FLASH)
+ */
+static const uint8_t EDD_Crc8NibbleTable[16] = {EDD_CRC_TABLE_ROW(EDD_CRC8_NIBBLE_ENTRY, EDD_CRC8_POLY, 0)};
+
+/** @brief Advance the CRC-8 register over one input byte (nibble table mode). */
+#define EDD_CRC8_BYTE_UPDATE(crc, byte) EDD_Crc8NibbleStep(EDD_Crc8NibbleStep((uint8_t)((crc) ^ (byte))))
+#else
 /**
  * @brief CRC-8 lookup table for polynomial 0x07.
  *
@@ -32,28 +137,321 @@
  * - Size: 256 bytes
  * - Storage: static const (intended to stay in ROM/FLASH)
  */
-static const uint8_t EDD_Crc8Table[256] = {
-    0x00, 0x07, 0x0E, 0x09, 0x1C, 0x1B, 0x12, 0x15, 0x38, 0x3F, 0x36, 0x31, 0x24, 0x23, 0x2A, 0x2D, 0x70, 0x77, 0x7E, 0x79, 0x6C, 0x6B, 0x62, 0x65, 0x48, 0x4F, 0x46, 0x41, 0x54, 0x53, 0x5A, 0x5D,
-    0xE0, 0xE7, 0xEE, 0xE9, 0xFC, 0xFB, 0xF2, 0xF5, 0xD8, 0xDF, 0xD6, 0xD1, 0xC4, 0xC3, 0xCA, 0xCD, 0x90, 0x97, 0x9E, 0x99, 0x8C, 0x8B, 0x82, 0x85, 0xA8, 0xAF, 0xA6, 0xA1, 0xB4, 0xB3, 0xBA, 0xBD,
-    0xC7, 0xC0, 0xC9, 0xCE, 0xDB, 0xDC, 0xD5, 0xD2, 0xFF, 0xF8, 0xF1, 0xF6, 0xE3, 0xE4, 0xED, 0xEA, 0xB7, 0xB0, 0xB9, 0xBE, 0xAB, 0xAC, 0xA5, 0xA2, 0x8F, 0x88, 0x81, 0x86, 0x93, 0x94, 0x9D, 0x9A,
-    0x27, 0x20, 0x29, 0x2E, 0x3B, 0x3C, 0x35, 0x32, 0x1F, 0x18, 0x11, 0x16, 0x03, 0x04, 0x0D, 0x0A, 0x57, 0x50, 0x59, 0x5E, 0x4B, 0x4C, 0x45, 0x42, 0x6F, 0x68, 0x61, 0x66, 0x73, 0x74, 0x7D, 0x7A,
-    0x89, 0x8E, 0x87, 0x80, 0x95, 0x92, 0x9B, 0x9C, 0xB1, 0xB6, 0xBF, 0xB8, 0xAD, 0xAA, 0xA3, 0xA4, 0xF9, 0xFE, 0xF7, 0xF0, 0xE5, 0xE2, 0xEB, 0xEC, 0xC1, 0xC6, 0xCF, 0xC8, 0xDD, 0xDA, 0xD3, 0xD4,
-    0x69, 0x6E, 0x67, 0x60, 0x75, 0x72, 0x7B, 0x7C, 0x51, 0x56, 0x5F, 0x58, 0x4D, 0x4A, 0x43, 0x44, 0x19, 0x1E, 0x17, 0x10, 0x05, 0x02, 0x0B, 0x0C, 0x21, 0x26, 0x2F, 0x28, 0x3D, 0x3A, 0x33, 0x34,
-    0x4E, 0x49, 0x40, 0x47, 0x52, 0x55, 0x5C, 0x5B, 0x76, 0x71, 0x78, 0x7F, 0x6A, 0x6D, 0x64, 0x63, 0x3E, 0x39, 0x30, 0x37, 0x22, 0x25, 0x2C, 0x2B, 0x06, 0x01, 0x08, 0x0F, 0x1A, 0x1D, 0x14, 0x13,
-    0xAE, 0xA9, 0xA0, 0xA7, 0xB2, 0xB5, 0xBC, 0xBB, 0x96, 0x91, 0x98, 0x9F, 0x8A, 0x8D, 0x84, 0x83, 0xDE, 0xD9, 0xD0, 0xD7, 0xC2, 0xC5, 0xCC, 0xCB, 0xE6, 0xE1, 0xE8, 0xEF, 0xFA, 0xFD, 0xF4, 0xF3};
+static const uint8_t EDD_Crc8Table[256] = {EDD_CRC_TABLE_256(EDD_CRC8_TABLE_ENTRY, EDD_CRC8_POLY)};
+
+/** @brief Advance the CRC-8 register over one input byte (byte table). */
+#define EDD_CRC8_BYTE_UPDATE(crc, byte) EDD_Crc8Table[(uint8_t)((crc) ^ (byte))]
+#endif
+
+/*
+ * Nominal cost of the CRC-8 engine in CPU cycles per byte for the selected
+ * mode, counted on an in-order 32-bit MCU with zero wait-state flash (loads,
+ * shifts, XORs and loop overhead of the inner loop). Reported by
+ * EDD_GetCrc8ModeInfo().
+ */
+#if(EDD_CRC_MODE == EDD_CRC_MODE_NIBBLE)
+#define EDD_CRC8_NOMINAL_CYCLES_PER_BYTE (12u) /**< Two dependent nibble lookups per byte */
+#elif(EDD_CRC_MODE == EDD_CRC_MODE_TABLE)
+#define EDD_CRC8_NOMINAL_CYCLES_PER_BYTE (7u) /**< One dependent lookup per byte */
+#elif(EDD_CRC_MODE == EDD_CRC_MODE_SLICE4)
+#define EDD_CRC8_NOMINAL_CYCLES_PER_BYTE (4u) /**< One dependent lookup per 4 bytes */
+#else
+#define EDD_CRC8_NOMINAL_CYCLES_PER_BYTE (3u) /**< One dependent lookup per 8 bytes */
+#endif
+
+#if(EDD_CRC_MODE == EDD_CRC_MODE_SLICE4) || (EDD_CRC_MODE == EDD_CRC_MODE_SLICE8)
+/*
+ * Slicing tables are linear in the index: T<k>[x] is the XOR of T<k>[1 << b]
+ * over the bits b set in x. The eight basis values of each table are chained
+ * as enumeration constants (T<k>[1 << b] = T0[T<k-1>[1 << b]]), which keeps
+ * the generated expressions small.
+ */
+#define EDD_CRC8_SLICE_BASIS_0(b) EDD_CRC8_SLICE_K0_##b = EDD_CRC8_TABLE_ENTRY(1u << b, EDD_CRC8_POLY)
+#define EDD_CRC8_SLICE_BASIS_K(k, prev, b) EDD_CRC8_SLICE_K##k##_##b = EDD_CRC8_TABLE_ENTRY(EDD_CRC8_SLICE_K##prev##_##b, EDD_CRC8_POLY)
+#define EDD_CRC8_SLICE_BASIS(k, prev)                                                                                                                                           \
+  EDD_CRC8_SLICE_BASIS_K(k, prev, 0), EDD_CRC8_SLICE_BASIS_K(k, prev, 1), EDD_CRC8_SLICE_BASIS_K(k, prev, 2), EDD_CRC8_SLICE_BASIS_K(k, prev, 3),                          \
+      EDD_CRC8_SLICE_BASIS_K(k, prev, 4), EDD_CRC8_SLICE_BASIS_K(k, prev, 5), EDD_CRC8_SLICE_BASIS_K(k, prev, 6), EDD_CRC8_SLICE_BASIS_K(k, prev, 7)
+
+/** @brief Basis values T<k>[1 << b] of the slicing tables (k = 0 is @ref EDD_Crc8Table). */
+enum {
+  EDD_CRC8_SLICE_BASIS_0(0),
+  EDD_CRC8_SLICE_BASIS_0(1),
+  EDD_CRC8_SLICE_BASIS_0(2),
+  EDD_CRC8_SLICE_BASIS_0(3),
+  EDD_CRC8_SLICE_BASIS_0(4),
+  EDD_CRC8_SLICE_BASIS_0(5),
+  EDD_CRC8_SLICE_BASIS_0(6),
+  EDD_CRC8_SLICE_BASIS_0(7),
+  EDD_CRC8_SLICE_BASIS(1, 0),
+  EDD_CRC8_SLICE_BASIS(2, 1),
+  EDD_CRC8_SLICE_BASIS(3, 2),
+  EDD_CRC8_SLICE_BASIS(4, 3),
+  EDD_CRC8_SLICE_BASIS(5, 4),
+  EDD_CRC8_SLICE_BASIS(6, 5),
+  EDD_CRC8_SLICE_BASIS(7, 6)
+};
+
+/** @brief Table entry of slicing table T<k>, combined from its basis values. */
+#define EDD_CRC8_SLICE_ENTRY(i, k)                                                                                                                                              \
+  ((((i) & 0x01u) != 0u ? (uint32_t)EDD_CRC8_SLICE_K##k##_0 : 0u) ^ (((i) & 0x02u) != 0u ? (uint32_t)EDD_CRC8_SLICE_K##k##_1 : 0u) ^                                       \
+   (((i) & 0x04u) != 0u ? (uint32_t)EDD_CRC8_SLICE_K##k##_2 : 0u) ^ (((i) & 0x08u) != 0u ? (uint32_t)EDD_CRC8_SLICE_K##k##_3 : 0u) ^                                       \
+   (((i) & 0x10u) != 0u ? (uint32_t)EDD_CRC8_SLICE_K##k##_4 : 0u) ^ (((i) & 0x20u) != 0u ? (uint32_t)EDD_CRC8_SLICE_K##k##_5 : 0u) ^                                       \
+   (((i) & 0x40u) != 0u ? (uint32_t)EDD_CRC8_SLICE_K##k##_6 : 0u) ^ (((i) & 0x80u) != 0u ? (uint32_t)EDD_CRC8_SLICE_K##k##_7 : 0u))
+
+/**
+ * @brief Additional CRC-8 lookup tables for the slicing-by-N engine.
+ *
+ * @details
+ * Row `k - 1` holds table T<sub>k</sub>, i.e. the CRC-8 obtained by feeding the
+ * index byte followed by `k` zero bytes (T<sub>k</sub>[x] = T<sub>0</sub>[T<sub>k-1</sub>[x]],
+ * with T<sub>0</sub> = @ref EDD_Crc8Table). Because the CRC is linear, a block of N
+ * bytes `d0..dN-1` updates the accumulator as:
+ * `crc = T(N-1)[crc ^ d0] ^ T(N-2)[d1] ^ ... ^ T0[dN-1]`.
+ *
+ * Memory:
+ * - Size: (EDD_CRC_MODE - 1) x 256 bytes
+ * - Storage: static const (intended to stay in ROM/FLASH)
+ */
+static const uint8_t EDD_Crc8SliceTable[EDD_CRC_MODE - 1u][256] = {
+    {EDD_CRC_TABLE_256(EDD_CRC8_SLICE_ENTRY, 1)},
+    {EDD_CRC_TABLE_256(EDD_CRC8_SLICE_ENTRY, 2)},
+    {EDD_CRC_TABLE_256(EDD_CRC8_SLICE_ENTRY, 3)},
+#if(EDD_CRC_MODE == EDD_CRC_MODE_SLICE8)
+    {EDD_CRC_TABLE_256(EDD_CRC8_SLICE_ENTRY, 4)},
+    {EDD_CRC_TABLE_256(EDD_CRC8_SLICE_ENTRY, 5)},
+    {EDD_CRC_TABLE_256(EDD_CRC8_SLICE_ENTRY, 6)},
+    {EDD_CRC_TABLE_256(EDD_CRC8_SLICE_ENTRY, 7)},
+#endif
+};
+#endif
+
+#if(EDD_CRC8_SAE_J1850_SUPPORT == 1u)
+/**
+ * @brief CRC-8 SAE J1850 lookup table (polynomial 0x1D), 256 bytes ROM.
+ */
+static const uint8_t EDD_Crc8SaeJ1850Table[256] = {EDD_CRC_TABLE_256(EDD_CRC8_TABLE_ENTRY, EDD_CRC8_SAE_J1850_POLY)};
+#endif
+
+#if(EDD_CRC8H2F_SUPPORT == 1u)
+/**
+ * @brief CRC-8H2F lookup table (polynomial 0x2F), 256 bytes ROM.
+ */
+static const uint8_t EDD_Crc8H2FTable[256] = {EDD_CRC_TABLE_256(EDD_CRC8_TABLE_ENTRY, EDD_CRC8H2F_POLY)};
+#endif
+
+#if(EDD_CRC16_SUPPORT == 1u)
+/**
+ * @brief CRC-16-CCITT lookup table (polynomial 0x1021), 512 bytes ROM.
+ */
+static const uint16_t EDD_Crc16Table[256] = {EDD_CRC_TABLE_256(EDD_CRC16_TABLE_ENTRY, EDD_CRC16_POLY)};
+#endif
+
+#if(EDD_CRC32_SUPPORT == 1u)
+/**
+ * @brief CRC-32 lookup table (reflected polynomial 0xEDB88320), 1024 bytes ROM.
+ */
+static const uint32_t EDD_Crc32Table[256] = {EDD_CRC_TABLE_256(EDD_CRC32_TABLE_ENTRY, EDD_CRC32_POLY)};
+#endif
+
+#if(EDD_CRC32P4_SUPPORT == 1u)
+/**
+ * @brief CRC-32P4 lookup table (reflected polynomial 0xC8DF352F), 1024 bytes ROM.
+ */
+static const uint32_t EDD_Crc32P4Table[256] = {EDD_CRC_TABLE_256(EDD_CRC32_TABLE_ENTRY, EDD_CRC32P4_POLY)};
+#endif
+
+#if(EDD_CRC8_CLMUL_SUPPORT == 1u) && defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define EDD_CRC8_CLMUL_AVAILABLE (1u) /**< Folding kernel compiled in (x86-64 GCC/Clang) */
+#else
+#define EDD_CRC8_CLMUL_AVAILABLE (0u) /**< Folding kernel not available on this build */
+#endif
+
+#if(EDD_CRC8_CLMUL_AVAILABLE == 1u)
+/* Folding constants x^n mod P for P = 0x107 (see EDD_Crc8ComputeClmul) */
+#define EDD_CRC8_CLMUL_X128 (0x02u) /**< x^128 mod P: fold low qword by 128 bits */
+#define EDD_CRC8_CLMUL_X192 (0x26u) /**< x^192 mod P: fold high qword by 128 bits */
+#define EDD_CRC8_CLMUL_X512 (0x10u) /**< x^512 mod P: fold low qword by 512 bits */
+#define EDD_CRC8_CLMUL_X576 (0x37u) /**< x^576 mod P: fold high qword by 512 bits */
+
+/** Code generation attribute of the folding kernel functions (PCLMULQDQ + SSSE3) */
+#define EDD_CLMUL_TARGET __attribute__((target("pclmul,ssse3")))
+
+/**
+ * @brief Report whether the CPU supports the CRC-8 folding kernel.
+ *
+ * @details
+ * Queries CPUID once (PCLMULQDQ and SSSE3 feature bits) and caches the result.
+ *
+ * @return 1 if @ref EDD_Crc8ComputeClmul can be used, 0 otherwise.
+ */
+static uint8_t EDD_Crc8ClmulIsSupported(void);
+
+/**
+ * @brief CRC-8 computation using carry-less multiplication folding.
+ *
+ * @details
+ * Shall only be called when @ref EDD_Crc8ClmulIsSupported returned 1.
+ * Produces the same value as the table engine for any length.
+ *
+ * @param crc    CRC accumulator to continue from.
+ * @param data   Pointer to input data buffer.
+ * @param length Number of bytes in the buffer.
+ *
+ * @return Computed CRC-8 value.
+ */
+static uint8_t EDD_Crc8ComputeClmul(uint8_t crc, const uint8_t *data, uint32_t length);
+#endif
 
 /**
  * @brief Internal CRC-8 computation routine.
  *
  * @details
  * This function is intended for internal use only and provides the CRC-8
- * calculation using the lookup table.
+ * calculation using the lookup table(s) selected by `EDD_CRC_MODE`.
  *
+ * @param crc    CRC accumulator to continue from (`EDD_CRC8_INIT` for a new message).
  * @param data   Pointer to input data buffer.
  * @param length Number of bytes in the buffer.
  *
  * @return Computed CRC-8 value.
  */
-static uint8_t EDD_Crc8ComputeInternal(const uint8_t *data, uint8_t length);
+static uint8_t EDD_Crc8ComputeInternal(uint8_t crc, const uint8_t *data, uint32_t length);
+
+#if(EDD_CRC_MODE == EDD_CRC_MODE_NIBBLE)
+/**
+ * @brief Advance the CRC-8 register by four bits through the nibble table.
+ *
+ * @param crc CRC register.
+ *
+ * @return `(crc << 4) ^ EDD_Crc8NibbleTable[crc >> 4]`.
+ */
+static uint8_t EDD_Crc8NibbleStep(uint8_t crc);
+#endif
+
+/**
+ * @brief Interleaved CRC-8 computation of `EDD_CRC8_BATCH_STREAMS` frames.
+ *
+ * @details
+ * Processes the common prefix length of all frames one byte per frame per
+ * iteration (independent dependency chains), then finishes every frame with
+ * @ref EDD_Crc8ComputeInternal.
+ *
+ * @param frames  `EDD_CRC8_BATCH_STREAMS` validated frame descriptors.
+ * @param crc_out Receives the `EDD_CRC8_BATCH_STREAMS` computed CRC-8 values.
+ */
+static void EDD_Crc8ComputeInterleaved(const EDD_Crc8FrameType *frames, uint8_t *crc_out);
+
+/**
+ * @brief Multiply two CRC-8 remainders in GF(2)[x] modulo the CRC-8 polynomial.
+ *
+ * @param a First factor (polynomial of degree < 8).
+ * @param b Second factor (polynomial of degree < 8).
+ *
+ * @return `a * b mod P` with P = x^8 + x^2 + x + 1.
+ */
+static uint8_t EDD_Crc8GfMul(uint8_t a, uint8_t b);
+
+/**
+ * @brief Advance a CRC-8 accumulator over a run of zero bytes.
+ *
+ * @details
+ * Returns `crc * x^(8 * length) mod P`, i.e. the accumulator obtained by feeding
+ * `length` zero bytes into the table engine, in O(log2(length)) multiplications
+ * (square-and-multiply on x^8 mod P) instead of `length` table lookups.
+ *
+ * @param crc    CRC accumulator.
+ * @param length Number of zero bytes.
+ *
+ * @return Shifted CRC-8 accumulator.
+ */
+static uint8_t EDD_Crc8ShiftZeros(uint8_t crc, uint32_t length);
+
+/**
+ * @brief Software CRC-8 driver: computes with the lookup table engine and completes at once.
+ *
+ * @param data   Pointer to input data buffer.
+ * @param length Number of bytes in the buffer (> 0).
+ * @param done   Completion hook, called before returning.
+ *
+ * @return EDD_OK.
+ */
+static EDD_ReturnType EDD_Crc8SwStart(const uint8_t *data, uint32_t length, EDD_Crc8DoneType done);
+
+/**
+ * @brief Completion hook of asynchronous CRC-8 requests.
+ *
+ * @details
+ * Clears the busy state and forwards the result to the stored callback.
+ *
+ * @param crc CRC-8 of the request buffer.
+ */
+static void EDD_Crc8AsyncDone(uint8_t crc);
+
+/**
+ * @brief Add a buffer to a LIN checksum accumulator, four bytes per iteration.
+ *
+ * @details
+ * The accumulator is a 32-bit ones' complement (end-around carry) sum. As
+ * 256 = 1 (mod 255), every byte of a 32-bit word has the same weight after
+ * folding, so whole words are added with one carry fold each instead of one
+ * add-with-carry per byte. The byte order inside the word does not matter.
+ *
+ * @param sum    Accumulator to continue from (`EDD_LIN_SUM_INIT` or the PID).
+ * @param data   Pointer to input data buffer.
+ * @param length Number of bytes in the buffer.
+ *
+ * @return Updated 32-bit accumulator.
+ */
+static uint32_t EDD_LinSumInternal(uint32_t sum, const uint8_t *data, uint32_t length);
+
+/**
+ * @brief Fold a 32-bit LIN accumulator to the 8-bit checksum.
+ *
+ * @param sum 32-bit ones' complement accumulator.
+ *
+ * @return Inverted 8-bit carry-folded sum (the LIN checksum byte).
+ */
+static uint8_t EDD_LinFold(uint32_t sum);
+
+#if(EDD_CRC8_SAE_J1850_SUPPORT == 1u) || (EDD_CRC8H2F_SUPPORT == 1u)
+/**
+ * @brief Byte-serial MSB-first CRC-8 computation over a given lookup table.
+ *
+ * @param table  256-entry lookup table of the CRC-8 variant.
+ * @param crc    CRC accumulator to continue from (variant init value for a new message).
+ * @param data   Pointer to input data buffer.
+ * @param length Number of bytes in the buffer.
+ *
+ * @return Updated CRC-8 accumulator (final XOR not applied).
+ */
+static uint8_t EDD_Crc8ComputeTable(const uint8_t table[256], uint8_t crc, const uint8_t *data, uint32_t length);
+#endif
+
+#if(EDD_CRC16_SUPPORT == 1u)
+/**
+ * @brief Byte-serial CRC-16-CCITT computation.
+ *
+ * @param crc    CRC accumulator to continue from (`EDD_CRC16_INIT` for a new message).
+ * @param data   Pointer to input data buffer.
+ * @param length Number of bytes in the buffer.
+ *
+ * @return Updated CRC-16 accumulator.
+ */
+static uint16_t EDD_Crc16ComputeInternal(uint16_t crc, const uint8_t *data, uint32_t length);
+#endif
+
+#if(EDD_CRC32_SUPPORT == 1u) || (EDD_CRC32P4_SUPPORT == 1u)
+/**
+ * @brief Byte-serial reflected CRC-32 computation over a given lookup table.
+ *
+ * @param table  256-entry lookup table of the CRC-32 variant.
+ * @param crc    CRC accumulator to continue from (variant init value for a new message).
+ * @param data   Pointer to input data buffer.
+ * @param length Number of bytes in the buffer.
+ *
+ * @return Updated CRC-32 accumulator (final XOR not applied).
+ */
+static uint32_t EDD_Crc32ComputeTable(const uint32_t table[256], uint32_t crc, const uint8_t *data, uint32_t length);
+#endif
 
 #endif /* ERRORDATADETECTION_PRIV_H */
@@ -0,0 +1,80 @@
+#include "EDD_CalcCrc8Async.h"
+
+/* Bitwise stand-in for the CRC-8 engine used by the software driver */
+uint8_t EDD_Crc8ComputeInternal(uint8_t crc, const uint8_t *data, uint32_t length) {
+  uint32_t i;
+  uint8_t bit;
+
+  for(i = 0u; i < length; i++) {
+    crc ^= data[i];
+    for(bit = 0u; bit < 8u; bit++) { crc = ((crc & 0x80u) != 0u) ? (uint8_t)((uint8_t)(crc << 1) ^ EDD_CRC8_POLY) : (uint8_t)(crc << 1); }
+  }
+
+  return crc;
+}
+
+EDD_ReturnType EDD_Crc8SwStart(const uint8_t *data, uint32_t length, EDD_Crc8DoneType done) {
+  done(EDD_Crc8ComputeInternal(EDD_CRC8_INIT, data, length));
+
+  return EDD_OK;
+}
+
+static const EDD_Crc8DriverType EDD_Crc8SwDriver = {&EDD_Crc8SwStart};
+
+const EDD_Crc8DriverType *EDD_Crc8ActiveDriver = &EDD_Crc8SwDriver;
+static EDD_Crc8CallbackType EDD_Crc8AsyncCallback = NULL;
+volatile uint8_t EDD_Crc8AsyncBusy = 0u;
+
+void EDD_Crc8AsyncDone(uint8_t crc) {
+  EDD_Crc8CallbackType callback = EDD_Crc8AsyncCallback;
+
+  /* Free the engine before the callback, so that it can chain the next request */
+  EDD_ENTER_CRITICAL();
+  EDD_Crc8AsyncBusy = 0u;
+  EDD_EXIT_CRITICAL();
+  callback(crc);
+}
+
+EDD_ReturnType EDD_Crc8SetDriver(const EDD_Crc8DriverType *driver) {
+  EDD_ReturnType ret = EDD_BUSY;
+
+  EDD_ENTER_CRITICAL();
+  if(EDD_Crc8AsyncBusy == 0u) {
+    EDD_Crc8ActiveDriver = (driver != NULL) ? driver : &EDD_Crc8SwDriver;
+    ret = EDD_OK;
+  }
+  EDD_EXIT_CRITICAL();
+
+  return ret;
+}
+
+/* FUNCTION TO TEST */
+
+EDD_ReturnType EDD_CalcCrc8Async(const uint8_t *data, uint32_t length, EDD_Crc8CallbackType callback) {
+  EDD_ReturnType ret;
+  uint8_t busy;
+
+  if((data == NULL) || (callback == NULL)) { return EDD_NULL_PTR; }
+
+  if(length == 0u) { return EDD_INVALID_LENGTH; }
+
+  /* Test-and-set: of two concurrent callers only one claims the engine */
+  EDD_ENTER_CRITICAL();
+  busy = EDD_Crc8AsyncBusy;
+  EDD_Crc8AsyncBusy = 1u;
+  EDD_EXIT_CRITICAL();
+
+  if(busy != 0u) { return EDD_BUSY; }
+
+  EDD_Crc8AsyncCallback = callback;
+
+  /* The driver may complete (and call EDD_Crc8AsyncDone) before it returns */
+  ret = EDD_Crc8ActiveDriver->start(data, length, &EDD_Crc8AsyncDone);
+  if(ret != EDD_OK) {
+    EDD_ENTER_CRITICAL();
+    EDD_Crc8AsyncBusy = 0u;
+    EDD_EXIT_CRITICAL();
+  }
+
+  return ret;
+}
@@ -0,0 +1,24 @@
+#ifndef EDD_CalcCrc8Async_H
+#define EDD_CalcCrc8Async_H
+
+/* Busy flag accessed through the integration critical section (provided by the test) */
+#define EDD_CRITICAL_SECTION_SUPPORT (1u)
+
+#include "errorDataDetection.h"
+#include "errorDataDetection_priv.h"
+#include <stdint.h>
+
+extern const EDD_Crc8DriverType *EDD_Crc8ActiveDriver;
+extern volatile uint8_t EDD_Crc8AsyncBusy;
+
+uint8_t EDD_Crc8ComputeInternal(uint8_t crc, const uint8_t *data, uint32_t length);
+
+EDD_ReturnType EDD_Crc8SwStart(const uint8_t *data, uint32_t length, EDD_Crc8DoneType done);
+
+void EDD_Crc8AsyncDone(uint8_t crc);
+
+EDD_ReturnType EDD_Crc8SetDriver(const EDD_Crc8DriverType *driver);
+
+EDD_ReturnType EDD_CalcCrc8Async(const uint8_t *data, uint32_t length, EDD_Crc8CallbackType callback);
+
+#endif
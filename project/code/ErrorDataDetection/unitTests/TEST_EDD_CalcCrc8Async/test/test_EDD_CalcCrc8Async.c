@@ -0,0 +1,192 @@
+#include "EDD_CalcCrc8Async.h"
+#include "unity.h"
+
+/**
+ * @file test_EDD_CalcCrc8Async.c
+ * @brief Unit tests for EDD_CalcCrc8Async function
+ * @details Checks the argument checks, the busy state, deferred completion by a driver, driver errors, chaining from the callback
+ *          and the critical section around the busy flag
+ */
+
+static const uint8_t data[9] = {'1', '2', '3', '4', '5', '6', '7', '8', '9'};
+
+static uint32_t callbackCount;
+static uint8_t callbackCrc;
+
+/* Fake peripheral: keeps the request until the test raises its "interrupt" */
+static uint32_t fakeStartCount;
+static EDD_ReturnType fakeStartReturn;
+static const uint8_t *fakeData;
+static uint32_t fakeLength;
+static EDD_Crc8DoneType fakeDone;
+
+/* Integration critical section: counts the sections and fails on nesting */
+static uint32_t criticalCount;
+static uint8_t criticalDepth;
+
+void EDD_EnterCritical(void) {
+  TEST_ASSERT_EQUAL_UINT8(0u, criticalDepth);
+  criticalDepth++;
+  criticalCount++;
+}
+
+void EDD_ExitCritical(void) {
+  TEST_ASSERT_EQUAL_UINT8(1u, criticalDepth);
+  criticalDepth--;
+}
+
+static EDD_ReturnType fakeStart(const uint8_t *d, uint32_t length, EDD_Crc8DoneType done) {
+  /* The engine is claimed before, the driver runs outside the critical section */
+  TEST_ASSERT_EQUAL_UINT8(1u, EDD_Crc8AsyncBusy);
+  TEST_ASSERT_EQUAL_UINT8(0u, criticalDepth);
+  fakeStartCount++;
+  fakeData = d;
+  fakeLength = length;
+  fakeDone = done;
+  return fakeStartReturn;
+}
+
+static const EDD_Crc8DriverType fakeDriver = {&fakeStart};
+
+static void fakeInterrupt(void) { fakeDone(EDD_Crc8ComputeInternal(0x00u, fakeData, fakeLength)); }
+
+static void callback(uint8_t crc) {
+  TEST_ASSERT_EQUAL_UINT8(0u, criticalDepth);
+  callbackCount++;
+  callbackCrc = crc;
+}
+
+static void chainingCallback(uint8_t crc) {
+  callbackCrc = crc;
+  TEST_ASSERT_EQUAL(EDD_OK, EDD_CalcCrc8Async(&data[5], 4u, callback));
+}
+
+/* Setup and teardown functions */
+void setUp(void) {
+  EDD_Crc8AsyncBusy = 0u;
+  (void)EDD_Crc8SetDriver(NULL);
+  callbackCount = 0u;
+  callbackCrc = 0u;
+  fakeStartCount = 0u;
+  fakeStartReturn = EDD_OK;
+  fakeDone = NULL;
+  criticalCount = 0u;
+  criticalDepth = 0u;
+}
+
+void tearDown(void) { /* Teardown code if needed */ }
+
+/**
+ * @test Test invalid arguments
+ * @brief Verify EDD_NULL_PTR / EDD_INVALID_LENGTH without starting the driver or calling back
+ */
+void test_EDD_CalcCrc8Async_InvalidArguments(void) {
+  TEST_ASSERT_EQUAL(EDD_OK, EDD_Crc8SetDriver(&fakeDriver));
+
+  TEST_ASSERT_EQUAL(EDD_NULL_PTR, EDD_CalcCrc8Async(NULL, 9u, callback));
+  TEST_ASSERT_EQUAL(EDD_NULL_PTR, EDD_CalcCrc8Async(data, 9u, NULL));
+  TEST_ASSERT_EQUAL(EDD_INVALID_LENGTH, EDD_CalcCrc8Async(data, 0u, callback));
+
+  TEST_ASSERT_EQUAL_UINT32(0u, fakeStartCount);
+  TEST_ASSERT_EQUAL_UINT8(0u, EDD_Crc8AsyncBusy);
+}
+
+/**
+ * @test Test the software driver
+ * @brief Verify that the default driver calls back with the check value before returning
+ */
+void test_EDD_CalcCrc8Async_SoftwareDriverCompletesImmediately(void) {
+  TEST_ASSERT_EQUAL(EDD_OK, EDD_CalcCrc8Async(data, 9u, callback));
+
+  TEST_ASSERT_EQUAL_UINT32(1u, callbackCount);
+  TEST_ASSERT_EQUAL_HEX8(0xF4u, callbackCrc);
+  TEST_ASSERT_EQUAL_UINT8(0u, EDD_Crc8AsyncBusy);
+}
+
+/**
+ * @test Test a deferred completion
+ * @brief Verify busy state until the driver completes, EDD_BUSY for a second request and a driver change, and the callback result
+ */
+void test_EDD_CalcCrc8Async_DeferredCompletion(void) {
+  TEST_ASSERT_EQUAL(EDD_OK, EDD_Crc8SetDriver(&fakeDriver));
+
+  TEST_ASSERT_EQUAL(EDD_OK, EDD_CalcCrc8Async(data, 9u, callback));
+  TEST_ASSERT_EQUAL_UINT32(1u, fakeStartCount);
+  TEST_ASSERT_EQUAL_PTR(data, fakeData);
+  TEST_ASSERT_EQUAL_UINT32(9u, fakeLength);
+  TEST_ASSERT_EQUAL_UINT32(0u, callbackCount);
+
+  TEST_ASSERT_EQUAL(EDD_BUSY, EDD_CalcCrc8Async(data, 4u, callback));
+  TEST_ASSERT_EQUAL(EDD_BUSY, EDD_Crc8SetDriver(NULL));
+  TEST_ASSERT_EQUAL_UINT32(1u, fakeStartCount);
+
+  fakeInterrupt();
+  TEST_ASSERT_EQUAL_UINT32(1u, callbackCount);
+  TEST_ASSERT_EQUAL_HEX8(0xF4u, callbackCrc);
+  TEST_ASSERT_EQUAL_UINT8(0u, EDD_Crc8AsyncBusy);
+  TEST_ASSERT_EQUAL(EDD_OK, EDD_Crc8SetDriver(NULL));
+}
+
+/**
+ * @test Test a driver error
+ * @brief Verify that a refused request returns the driver error, frees the engine and never calls back
+ */
+void test_EDD_CalcCrc8Async_DriverError(void) {
+  TEST_ASSERT_EQUAL(EDD_OK, EDD_Crc8SetDriver(&fakeDriver));
+  fakeStartReturn = EDD_BUSY;
+
+  TEST_ASSERT_EQUAL(EDD_BUSY, EDD_CalcCrc8Async(data, 9u, callback));
+  TEST_ASSERT_EQUAL_UINT8(0u, EDD_Crc8AsyncBusy);
+  TEST_ASSERT_EQUAL_UINT32(0u, callbackCount);
+
+  fakeStartReturn = EDD_OK;
+  TEST_ASSERT_EQUAL(EDD_OK, EDD_CalcCrc8Async(data, 9u, callback));
+  TEST_ASSERT_EQUAL_UINT32(2u, fakeStartCount);
+}
+
+/**
+ * @test Test chaining from the callback
+ * @brief Verify that the callback can start the next request (the engine is free when it runs)
+ */
+void test_EDD_CalcCrc8Async_ChainFromCallback(void) {
+  TEST_ASSERT_EQUAL(EDD_OK, EDD_Crc8SetDriver(&fakeDriver));
+
+  TEST_ASSERT_EQUAL(EDD_OK, EDD_CalcCrc8Async(data, 5u, chainingCallback));
+  fakeInterrupt();
+  TEST_ASSERT_EQUAL_HEX8(EDD_Crc8ComputeInternal(0x00u, data, 5u), callbackCrc);
+  TEST_ASSERT_EQUAL_UINT32(2u, fakeStartCount);
+  TEST_ASSERT_EQUAL_PTR(&data[5], fakeData);
+  TEST_ASSERT_EQUAL_UINT8(1u, EDD_Crc8AsyncBusy);
+
+  fakeInterrupt();
+  TEST_ASSERT_EQUAL_UINT32(1u, callbackCount);
+  TEST_ASSERT_EQUAL_HEX8(EDD_Crc8ComputeInternal(0x00u, &data[5], 4u), callbackCrc);
+  TEST_ASSERT_EQUAL_UINT8(0u, EDD_Crc8AsyncBusy);
+}
+
+/**
+ * @test Test the critical section
+ * @brief Verify that claiming, rejecting, releasing and the driver change each take one critical section
+ */
+void test_EDD_CalcCrc8Async_CriticalSection(void) {
+  TEST_ASSERT_EQUAL(EDD_OK, EDD_Crc8SetDriver(&fakeDriver));
+  TEST_ASSERT_EQUAL_UINT32(1u, criticalCount);
+
+  TEST_ASSERT_EQUAL(EDD_OK, EDD_CalcCrc8Async(data, 9u, callback));
+  TEST_ASSERT_EQUAL_UINT32(2u, criticalCount);
+
+  /* A second caller sees the claimed engine */
+  TEST_ASSERT_EQUAL(EDD_BUSY, EDD_CalcCrc8Async(data, 4u, callback));
+  TEST_ASSERT_EQUAL_UINT32(3u, criticalCount);
+  TEST_ASSERT_EQUAL_UINT8(1u, EDD_Crc8AsyncBusy);
+
+  fakeInterrupt();
+  TEST_ASSERT_EQUAL_UINT32(4u, criticalCount);
+  TEST_ASSERT_EQUAL_UINT8(0u, criticalDepth);
+
+  /* Software driver: the completion inside the request takes its own, not nested, section */
+  TEST_ASSERT_EQUAL(EDD_OK, EDD_Crc8SetDriver(NULL));
+  TEST_ASSERT_EQUAL(EDD_OK, EDD_CalcCrc8Async(data, 9u, callback));
+  TEST_ASSERT_EQUAL_UINT32(7u, criticalCount);
+  TEST_ASSERT_EQUAL_UINT32(2u, callbackCount);
+}
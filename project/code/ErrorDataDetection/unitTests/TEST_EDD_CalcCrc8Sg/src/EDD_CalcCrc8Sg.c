@@ -0,0 +1,30 @@
+#include "EDD_CalcCrc8Sg.h"
+#include "errorDataDetection_priv.h"
+
+/* FUNCTION TO TEST */
+
+EDD_ReturnType EDD_CalcCrc8Sg(const EDD_Crc8SegmentType *segments, uint16_t count, uint8_t *crc_out) {
+  uint8_t crc = EDD_CRC8_INIT;
+  uint8_t hasData = 0u;
+  uint16_t i;
+
+  if((segments == NULL) || (crc_out == NULL)) { return EDD_NULL_PTR; }
+
+  for(i = 0u; i < count; i++) {
+    if(segments[i].length > 0u) {
+      if(segments[i].data == NULL) { return EDD_NULL_PTR; }
+      hasData = 1u;
+    }
+  }
+
+  if(hasData == 0u) { return EDD_INVALID_LENGTH; }
+
+  /* The accumulator runs across segment boundaries: no assembly buffer needed */
+  for(i = 0u; i < count; i++) {
+    if(segments[i].length > 0u) { crc = EDD_Crc8ComputeInternal(crc, segments[i].data, segments[i].length); }
+  }
+
+  *crc_out = crc;
+
+  return EDD_OK;
+}
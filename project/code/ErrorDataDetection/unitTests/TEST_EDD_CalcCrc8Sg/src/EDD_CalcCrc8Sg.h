@@ -0,0 +1,9 @@
+#ifndef EDD_CalcCrc8Sg_H
+#define EDD_CalcCrc8Sg_H
+
+#include "errorDataDetection.h"
+#include <stdint.h>
+
+EDD_ReturnType EDD_CalcCrc8Sg(const EDD_Crc8SegmentType *segments, uint16_t count, uint8_t *crc_out);
+
+#endif
\ No newline at end of file
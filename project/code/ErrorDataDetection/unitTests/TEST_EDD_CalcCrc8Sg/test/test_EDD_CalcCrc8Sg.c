@@ -0,0 +1,87 @@
+#include "EDD_CalcCrc8Sg.h"
+#include "mock_errorDataDetection_priv.h"
+#include "unity.h"
+
+/**
+ * @file test_EDD_CalcCrc8Sg.c
+ * @brief Unit tests for EDD_CalcCrc8Sg function
+ * @details Tests the scatter-gather CRC-8 computation including segment validation and accumulator chaining
+ */
+
+/* Setup and teardown functions */
+void setUp(void) { /* Setup code if needed */ }
+
+void tearDown(void) { /* Teardown code if needed */ }
+
+/* =============================
+ *  Test Cases
+ * ============================= */
+
+/**
+ * @brief Test: NULL segment list or output pointer should return EDD_NULL_PTR
+ */
+void test_EDD_CalcCrc8Sg_NullPointers(void) {
+  uint8_t data[] = {0x01};
+  EDD_Crc8SegmentType segments[1] = {{data, 1u}};
+  uint8_t crc = 0x5A;
+
+  TEST_ASSERT_EQUAL(EDD_NULL_PTR, EDD_CalcCrc8Sg(NULL, 1u, &crc));
+  TEST_ASSERT_EQUAL(EDD_NULL_PTR, EDD_CalcCrc8Sg(segments, 1u, NULL));
+  TEST_ASSERT_EQUAL_HEX8(0x5A, crc);
+}
+
+/**
+ * @brief Test: Non-empty segment with NULL data should return EDD_NULL_PTR before any computation
+ */
+void test_EDD_CalcCrc8Sg_NullSegmentData(void) {
+  uint8_t data[] = {0x01, 0x02};
+  EDD_Crc8SegmentType segments[2] = {{data, 2u}, {NULL, 3u}};
+  uint8_t crc = 0x5A;
+
+  TEST_ASSERT_EQUAL(EDD_NULL_PTR, EDD_CalcCrc8Sg(segments, 2u, &crc));
+  TEST_ASSERT_EQUAL_HEX8(0x5A, crc);
+}
+
+/**
+ * @brief Test: No segment or only empty segments should return EDD_INVALID_LENGTH
+ */
+void test_EDD_CalcCrc8Sg_NoData(void) {
+  EDD_Crc8SegmentType segments[2] = {{NULL, 0u}, {NULL, 0u}};
+  uint8_t crc = 0x5A;
+
+  TEST_ASSERT_EQUAL(EDD_INVALID_LENGTH, EDD_CalcCrc8Sg(segments, 0u, &crc));
+  TEST_ASSERT_EQUAL(EDD_INVALID_LENGTH, EDD_CalcCrc8Sg(segments, 2u, &crc));
+  TEST_ASSERT_EQUAL_HEX8(0x5A, crc);
+}
+
+/**
+ * @brief Test: Single segment behaves like EDD_CalcCrc8
+ */
+void test_EDD_CalcCrc8Sg_SingleSegment(void) {
+  uint8_t data[] = {0x10, 0x20, 0x30};
+  EDD_Crc8SegmentType segments[1] = {{data, 3u}};
+  uint8_t crc = 0u;
+
+  EDD_Crc8ComputeInternal_ExpectAndReturn(EDD_CRC8_INIT, data, 3, 0x3C);
+
+  TEST_ASSERT_EQUAL(EDD_OK, EDD_CalcCrc8Sg(segments, 1u, &crc));
+  TEST_ASSERT_EQUAL_HEX8(0x3C, crc);
+}
+
+/**
+ * @brief Test: Segments are chained through the accumulator, empty segments are skipped
+ */
+void test_EDD_CalcCrc8Sg_ChainedSegments(void) {
+  uint8_t dataId[] = {0x34, 0x12};
+  uint8_t header[] = {0xA0, 0xA1, 0xA2};
+  uint8_t payload[] = {0x01, 0x02, 0x03, 0x04, 0x05};
+  EDD_Crc8SegmentType segments[4] = {{dataId, 2u}, {NULL, 0u}, {header, 3u}, {payload, 5u}};
+  uint8_t crc = 0u;
+
+  EDD_Crc8ComputeInternal_ExpectAndReturn(EDD_CRC8_INIT, dataId, 2, 0x11);
+  EDD_Crc8ComputeInternal_ExpectAndReturn(0x11, header, 3, 0x22);
+  EDD_Crc8ComputeInternal_ExpectAndReturn(0x22, payload, 5, 0x33);
+
+  TEST_ASSERT_EQUAL(EDD_OK, EDD_CalcCrc8Sg(segments, 4u, &crc));
+  TEST_ASSERT_EQUAL_HEX8(0x33, crc);
+}
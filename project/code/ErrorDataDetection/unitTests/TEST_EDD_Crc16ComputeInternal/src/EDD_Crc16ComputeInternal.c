@@ -0,0 +1,11 @@
+#include "EDD_Crc16ComputeInternal.h"
+
+/* FUNCTION TO TEST */
+
+uint16_t EDD_Crc16ComputeInternal(uint16_t crc, const uint8_t *data, uint32_t length) {
+  uint32_t i;
+
+  for(i = 0u; i < length; i++) { crc = (uint16_t)((uint16_t)(crc << 8) ^ EDD_Crc16Table[(uint8_t)(crc >> 8) ^ data[i]]); }
+
+  return crc;
+}
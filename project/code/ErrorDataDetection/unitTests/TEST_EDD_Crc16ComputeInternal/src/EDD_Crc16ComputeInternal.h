@@ -0,0 +1,9 @@
+#ifndef EDD_Crc16ComputeInternal_H
+#define EDD_Crc16ComputeInternal_H
+
+#include "errorDataDetection_priv.h"
+#include <stdint.h>
+
+uint16_t EDD_Crc16ComputeInternal(uint16_t crc, const uint8_t *data, uint32_t length);
+
+#endif
@@ -0,0 +1,55 @@
+#include "EDD_Crc16ComputeInternal.h"
+#include "unity.h"
+
+/**
+ * @file test_EDD_Crc16ComputeInternal.c
+ * @brief Unit tests for EDD_Crc16ComputeInternal function
+ * @details Checks the compile-time generated CRC-16-CCITT table against published check values
+ */
+
+/* Setup and teardown functions */
+void setUp(void) { /* Setup code if needed */ }
+
+void tearDown(void) { /* Teardown code if needed */ }
+
+/**
+ * @test Test generated table entries
+ * @brief Verify that entry 1 equals the polynomial and entry 0 is zero
+ */
+void test_EDD_Crc16ComputeInternal_GeneratedEntries(void) {
+  TEST_ASSERT_EQUAL_HEX16(0x0000, EDD_Crc16Table[0]);
+  TEST_ASSERT_EQUAL_HEX16(EDD_CRC16_POLY, EDD_Crc16Table[1]);
+  TEST_ASSERT_EQUAL_HEX16(0x1EF0, EDD_Crc16Table[255]);
+}
+
+/**
+ * @test Test with empty buffer
+ * @brief Verify that the start value is returned unchanged
+ */
+void test_EDD_Crc16ComputeInternal_EmptyBuffer(void) {
+  uint8_t data[] = {0x00};
+
+  TEST_ASSERT_EQUAL_HEX16(EDD_CRC16_INIT, EDD_Crc16ComputeInternal(EDD_CRC16_INIT, data, 0));
+}
+
+/**
+ * @test Test check value
+ * @brief Verify CRC of "123456789" is 0x29B1
+ */
+void test_EDD_Crc16ComputeInternal_CheckValue(void) {
+  const uint8_t data[] = {'1', '2', '3', '4', '5', '6', '7', '8', '9'};
+
+  TEST_ASSERT_EQUAL_HEX16(0x29B1, EDD_Crc16ComputeInternal(EDD_CRC16_INIT, data, 9u));
+}
+
+/**
+ * @test Test AUTOSAR reference data
+ * @brief Verify CRC of 00 00 00 00 is 0x84C0 and of F2 01 83 is 0xD374
+ */
+void test_EDD_Crc16ComputeInternal_Reference(void) {
+  const uint8_t zeros[] = {0x00, 0x00, 0x00, 0x00};
+  const uint8_t data[] = {0xF2, 0x01, 0x83};
+
+  TEST_ASSERT_EQUAL_HEX16(0x84C0, EDD_Crc16ComputeInternal(EDD_CRC16_INIT, zeros, 4u));
+  TEST_ASSERT_EQUAL_HEX16(0xD374, EDD_Crc16ComputeInternal(EDD_CRC16_INIT, data, 3u));
+}
@@ -0,0 +1,11 @@
+#include "EDD_Crc32ComputeTable.h"
+
+/* FUNCTION TO TEST */
+
+uint32_t EDD_Crc32ComputeTable(const uint32_t table[256], uint32_t crc, const uint8_t *data, uint32_t length) {
+  uint32_t i;
+
+  for(i = 0u; i < length; i++) { crc = (crc >> 8) ^ table[(uint8_t)crc ^ data[i]]; }
+
+  return crc;
+}
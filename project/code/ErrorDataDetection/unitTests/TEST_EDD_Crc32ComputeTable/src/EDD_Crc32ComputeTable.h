@@ -0,0 +1,9 @@
+#ifndef EDD_Crc32ComputeTable_H
+#define EDD_Crc32ComputeTable_H
+
+#include "errorDataDetection_priv.h"
+#include <stdint.h>
+
+uint32_t EDD_Crc32ComputeTable(const uint32_t table[256], uint32_t crc, const uint8_t *data, uint32_t length);
+
+#endif
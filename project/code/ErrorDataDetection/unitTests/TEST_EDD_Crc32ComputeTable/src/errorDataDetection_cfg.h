@@ -0,0 +1,164 @@
+#ifndef ERRORDATADETECTION_CFG_H
+#define ERRORDATADETECTION_CFG_H
+
+/**
+ * @file errorDataDetection_cfg.h
+ * @brief Build-time configuration of the Error Data Detection module.
+ *
+ * @details
+ * This header collects the project-specific switches used by the Error Data
+ * Detection platform code. Every switch can be overridden from the build
+ * system (e.g. `-DEDD_CRC_MODE=EDD_CRC_MODE_SLICE8`) so that host tools and ECU
+ * variants can select a different trade-off without editing the platform files.
+ *
+ * @note
+ * No application logic shall be implemented in this file.
+ * This file must only contain configuration data and interfaces.
+ */
+
+/*==============================================================================
+ * CRC-8 engine configuration
+ *============================================================================*/
+
+#define EDD_CRC_MODE_NIBBLE (0u) /**< 16-entry nibble table, two lookups per byte (16 bytes ROM) */
+#define EDD_CRC_MODE_TABLE (1u)  /**< 256-entry byte table, one lookup per byte (256 bytes ROM) */
+#define EDD_CRC_MODE_SLICE4 (4u) /**< Slicing-by-4, four 256-entry tables (1024 bytes ROM) */
+#define EDD_CRC_MODE_SLICE8 (8u) /**< Slicing-by-8, eight 256-entry tables (2048 bytes ROM) */
+
+/**
+ * @brief Lookup table layout of the CRC-8 engine (flash size vs speed).
+ *
+ * @details
+ * Supported values:
+ * - `EDD_CRC_MODE_NIBBLE`: the register is advanced 4 bits at a time through a
+ *   16-entry table. Smallest footprint, for LIN slaves with very little flash.
+ * - `EDD_CRC_MODE_TABLE`: byte-serial loop over the 256-entry table.
+ * - `EDD_CRC_MODE_SLICE4`: slicing-by-4, three additional 256-entry tables.
+ * - `EDD_CRC_MODE_SLICE8`: slicing-by-8, seven additional 256-entry tables.
+ *
+ * With slicing-by-N only one table lookup per N bytes depends on the previous
+ * CRC value; the remaining N-1 lookups are independent and can be executed in
+ * parallel by the CPU. The result is bit-identical for every setting; the
+ * footprint and nominal cost of the selected mode are reported at runtime by
+ * `EDD_GetCrc8ModeInfo()`.
+ *
+ * The mode applies to the CRC-8/ATM engine; the optional CRC variants below
+ * always use one 256-entry table.
+ *
+ * Typical value: `EDD_CRC_MODE_TABLE` on ECUs, `EDD_CRC_MODE_SLICE8` on host tools.
+ */
+#ifndef EDD_CRC_MODE
+#define EDD_CRC_MODE (EDD_CRC_MODE_TABLE)
+#endif
+
+/**
+ * @brief Enable the carry-less multiplication (PCLMULQDQ) CRC-8 folding kernel.
+ *
+ * @details
+ * The kernel folds 64 bytes per iteration with carry-less multiplications and
+ * reduces the result to the same CRC-8/ATM value produced by the table engine.
+ * It is only compiled for x86-64 targets built with GCC/Clang and is selected
+ * at runtime through CPUID; on CPUs without PCLMULQDQ/SSSE3 (and on every other
+ * architecture) the table engine stays in use.
+ *
+ * Supported values: `0u` (disabled), `1u` (enabled when available).
+ */
+#ifndef EDD_CRC8_CLMUL_SUPPORT
+#define EDD_CRC8_CLMUL_SUPPORT (1u)
+#endif
+
+/**
+ * @brief Minimum buffer length in bytes for which the folding kernel is used.
+ *
+ * @details
+ * Shorter buffers are processed by the table engine, whose fixed cost is lower
+ * than the final reduction of the folding kernel.
+ *
+ * Typical value: 128 bytes.
+ */
+#ifndef EDD_CRC8_CLMUL_MIN_LENGTH
+#define EDD_CRC8_CLMUL_MIN_LENGTH (128u)
+#endif
+
+/**
+ * @brief Number of frames processed side by side by `EDD_VerifyCrc8Batch()`.
+ *
+ * @details
+ * The batch service runs this many independent CRC-8 computations in one loop,
+ * one byte of each frame per iteration. The table lookups of different frames
+ * do not depend on each other, so their load latencies overlap instead of
+ * forming a single dependency chain.
+ *
+ * Supported values: `4u` or `8u`.
+ */
+#ifndef EDD_CRC8_BATCH_STREAMS
+#define EDD_CRC8_BATCH_STREAMS (4u)
+#endif
+
+/*==============================================================================
+ * Additional CRC variants
+ *============================================================================*/
+
+/**
+ * @brief Enable CRC-8 SAE J1850 (poly 0x1D, init 0xFF, XOROut 0xFF).
+ *
+ * @details
+ * Adds `EDD_CalcCrc8SaeJ1850()` and its 256-byte lookup table. The table is
+ * generated at compile time from the polynomial; when the variant is disabled
+ * neither code nor table is compiled.
+ *
+ * Supported values: `0u` (disabled), `1u` (enabled).
+ */
+#ifndef EDD_CRC8_SAE_J1850_SUPPORT
+#define EDD_CRC8_SAE_J1850_SUPPORT (0u)
+#endif
+
+/**
+ * @brief Enable CRC-8H2F (poly 0x2F, init 0xFF, XOROut 0xFF).
+ *
+ * @details
+ * Adds `EDD_CalcCrc8H2F()` and its 256-byte lookup table (compile-time generated).
+ *
+ * Supported values: `0u` (disabled), `1u` (enabled).
+ */
+#ifndef EDD_CRC8H2F_SUPPORT
+#define EDD_CRC8H2F_SUPPORT (0u)
+#endif
+
+/**
+ * @brief Enable CRC-16-CCITT (poly 0x1021, init 0xFFFF, XOROut 0x0000).
+ *
+ * @details
+ * Adds `EDD_CalcCrc16()` and its 512-byte lookup table (compile-time generated).
+ *
+ * Supported values: `0u` (disabled), `1u` (enabled).
+ */
+#ifndef EDD_CRC16_SUPPORT
+#define EDD_CRC16_SUPPORT (0u)
+#endif
+
+/**
+ * @brief Enable CRC-32 (IEEE 802.3, reflected poly 0x04C11DB7, init/XOROut 0xFFFFFFFF).
+ *
+ * @details
+ * Adds `EDD_CalcCrc32()` and its 1024-byte lookup table (compile-time generated).
+ *
+ * Supported values: `0u` (disabled), `1u` (enabled).
+ */
+#ifndef EDD_CRC32_SUPPORT
+#define EDD_CRC32_SUPPORT (1u)
+#endif
+
+/**
+ * @brief Enable CRC-32P4 (reflected poly 0xF4ACFB13, init/XOROut 0xFFFFFFFF).
+ *
+ * @details
+ * Adds `EDD_CalcCrc32P4()` and its 1024-byte lookup table (compile-time generated).
+ *
+ * Supported values: `0u` (disabled), `1u` (enabled).
+ */
+#ifndef EDD_CRC32P4_SUPPORT
+#define EDD_CRC32P4_SUPPORT (1u)
+#endif
+
+#endif /* ERRORDATADETECTION_CFG_H */
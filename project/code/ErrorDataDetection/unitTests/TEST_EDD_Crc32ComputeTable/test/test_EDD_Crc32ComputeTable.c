@@ -0,0 +1,79 @@
+#include "EDD_Crc32ComputeTable.h"
+#include "unity.h"
+
+/**
+ * @file test_EDD_Crc32ComputeTable.c
+ * @brief Unit tests for EDD_Crc32ComputeTable function
+ * @details Checks the compile-time generated CRC-32 and CRC-32P4 tables against published check values
+ */
+
+/* Setup and teardown functions */
+void setUp(void) { /* Setup code if needed */ }
+
+void tearDown(void) { /* Teardown code if needed */ }
+
+/**
+ * @test Test generated table entries
+ * @brief Verify well-known entries of the reflected tables
+ */
+void test_EDD_Crc32ComputeTable_GeneratedEntries(void) {
+  TEST_ASSERT_EQUAL_HEX32(0x00000000uL, EDD_Crc32Table[0]);
+  TEST_ASSERT_EQUAL_HEX32(0x77073096uL, EDD_Crc32Table[1]);
+  TEST_ASSERT_EQUAL_HEX32(EDD_CRC32_POLY, EDD_Crc32Table[128]);
+  TEST_ASSERT_EQUAL_HEX32(0x00000000uL, EDD_Crc32P4Table[0]);
+  TEST_ASSERT_EQUAL_HEX32(EDD_CRC32P4_POLY, EDD_Crc32P4Table[128]);
+}
+
+/**
+ * @test Test with empty buffer
+ * @brief Verify that the start value is returned unchanged
+ */
+void test_EDD_Crc32ComputeTable_EmptyBuffer(void) {
+  uint8_t data[] = {0x00};
+
+  TEST_ASSERT_EQUAL_HEX32(EDD_CRC32_INIT, EDD_Crc32ComputeTable(EDD_Crc32Table, EDD_CRC32_INIT, data, 0));
+}
+
+/**
+ * @test Test CRC-32 check value
+ * @brief Verify CRC of "123456789" is 0xCBF43926
+ */
+void test_EDD_Crc32ComputeTable_Crc32CheckValue(void) {
+  const uint8_t data[] = {'1', '2', '3', '4', '5', '6', '7', '8', '9'};
+
+  TEST_ASSERT_EQUAL_HEX32(0xCBF43926uL, EDD_Crc32ComputeTable(EDD_Crc32Table, EDD_CRC32_INIT, data, 9u) ^ EDD_CRC32_XOROUT);
+}
+
+/**
+ * @test Test CRC-32 on AUTOSAR reference data
+ * @brief Verify CRC of 00 00 00 00 is 0x2144DF1C and of F2 01 83 is 0x24AB9D77
+ */
+void test_EDD_Crc32ComputeTable_Crc32Reference(void) {
+  const uint8_t zeros[] = {0x00, 0x00, 0x00, 0x00};
+  const uint8_t data[] = {0xF2, 0x01, 0x83};
+
+  TEST_ASSERT_EQUAL_HEX32(0x2144DF1CuL, EDD_Crc32ComputeTable(EDD_Crc32Table, EDD_CRC32_INIT, zeros, 4u) ^ EDD_CRC32_XOROUT);
+  TEST_ASSERT_EQUAL_HEX32(0x24AB9D77uL, EDD_Crc32ComputeTable(EDD_Crc32Table, EDD_CRC32_INIT, data, 3u) ^ EDD_CRC32_XOROUT);
+}
+
+/**
+ * @test Test CRC-32P4 check value
+ * @brief Verify CRC of "123456789" is 0x1697D06A
+ */
+void test_EDD_Crc32ComputeTable_Crc32P4CheckValue(void) {
+  const uint8_t data[] = {'1', '2', '3', '4', '5', '6', '7', '8', '9'};
+
+  TEST_ASSERT_EQUAL_HEX32(0x1697D06AuL, EDD_Crc32ComputeTable(EDD_Crc32P4Table, EDD_CRC32P4_INIT, data, 9u) ^ EDD_CRC32P4_XOROUT);
+}
+
+/**
+ * @test Test CRC-32P4 on AUTOSAR reference data
+ * @brief Verify CRC of 00 00 00 00 is 0x6FB32240 and of F2 01 83 is 0x4F721A25
+ */
+void test_EDD_Crc32ComputeTable_Crc32P4Reference(void) {
+  const uint8_t zeros[] = {0x00, 0x00, 0x00, 0x00};
+  const uint8_t data[] = {0xF2, 0x01, 0x83};
+
+  TEST_ASSERT_EQUAL_HEX32(0x6FB32240uL, EDD_Crc32ComputeTable(EDD_Crc32P4Table, EDD_CRC32P4_INIT, zeros, 4u) ^ EDD_CRC32P4_XOROUT);
+  TEST_ASSERT_EQUAL_HEX32(0x4F721A25uL, EDD_Crc32ComputeTable(EDD_Crc32P4Table, EDD_CRC32P4_INIT, data, 3u) ^ EDD_CRC32P4_XOROUT);
+}
@@ -0,0 +1,38 @@
+#include "EDD_Crc8Combine.h"
+
+/* Zero-byte shift used by the function under test */
+uint8_t EDD_Crc8GfMul(uint8_t a, uint8_t b) {
+  uint8_t product = 0u;
+  uint8_t bit;
+
+  for(bit = 0u; bit < 8u; bit++) {
+    if((b & 0x01u) != 0u) { product ^= a; }
+    b >>= 1;
+    a = ((a & 0x80u) != 0u) ? (uint8_t)((uint8_t)(a << 1) ^ EDD_CRC8_POLY) : (uint8_t)(a << 1);
+  }
+
+  return product;
+}
+
+uint8_t EDD_Crc8ShiftZeros(uint8_t crc, uint32_t length) {
+  uint8_t power = EDD_CRC8_POLY; /* x^8 mod P */
+
+  while(length != 0u) {
+    if((length & 0x01u) != 0u) { crc = EDD_Crc8GfMul(crc, power); }
+    power = EDD_Crc8GfMul(power, power);
+    length >>= 1;
+  }
+
+  return crc;
+}
+
+/* FUNCTION TO TEST */
+
+EDD_ReturnType EDD_Crc8Combine(uint8_t crcA, uint8_t crcB, uint32_t lengthB, uint8_t *crc_out) {
+  if(crc_out == NULL) { return EDD_NULL_PTR; }
+
+  /* Init and XOROut are 0x00: CRC(A || B) = CRC(A) * x^(8 * |B|) + CRC(B) */
+  *crc_out = (uint8_t)(EDD_Crc8ShiftZeros(crcA, lengthB) ^ crcB);
+
+  return EDD_OK;
+}
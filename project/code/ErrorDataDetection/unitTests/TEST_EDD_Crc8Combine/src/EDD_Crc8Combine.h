@@ -0,0 +1,14 @@
+#ifndef EDD_Crc8Combine_H
+#define EDD_Crc8Combine_H
+
+#include "errorDataDetection.h"
+#include "errorDataDetection_priv.h"
+#include <stdint.h>
+
+uint8_t EDD_Crc8GfMul(uint8_t a, uint8_t b);
+
+uint8_t EDD_Crc8ShiftZeros(uint8_t crc, uint32_t length);
+
+EDD_ReturnType EDD_Crc8Combine(uint8_t crcA, uint8_t crcB, uint32_t lengthB, uint8_t *crc_out);
+
+#endif
@@ -0,0 +1,114 @@
+#include "EDD_Crc8Combine.h"
+#include "unity.h"
+
+/**
+ * @file test_EDD_Crc8Combine.c
+ * @brief Unit tests for EDD_Crc8Combine function
+ * @details Checks that combining the CRCs of two blocks gives the CRC of their concatenation
+ */
+
+static uint8_t testData[600];
+
+/* Setup and teardown functions */
+void setUp(void) {
+  uint32_t i;
+
+  for(i = 0u; i < sizeof(testData); i++) { testData[i] = (uint8_t)((i * 37u) ^ (i >> 3)); }
+}
+
+void tearDown(void) { /* Teardown code if needed */ }
+
+/**
+ * @brief Helper: bitwise CRC-8/ATM reference
+ */
+static uint8_t referenceCrc8(const uint8_t *data, uint32_t length) {
+  uint8_t crc = 0x00u;
+  uint32_t i;
+  uint8_t bit;
+
+  for(i = 0u; i < length; i++) {
+    crc ^= data[i];
+    for(bit = 0u; bit < 8u; bit++) { crc = ((crc & 0x80u) != 0u) ? (uint8_t)((uint8_t)(crc << 1) ^ 0x07u) : (uint8_t)(crc << 1); }
+  }
+
+  return crc;
+}
+
+/**
+ * @test Test NULL output pointer
+ * @brief Verify that function returns EDD_NULL_PTR when crc_out is NULL
+ */
+void test_EDD_Crc8Combine_NullOutput(void) { TEST_ASSERT_EQUAL(EDD_NULL_PTR, EDD_Crc8Combine(0x12u, 0x34u, 5u, NULL)); }
+
+/**
+ * @test Test check value split
+ * @brief Verify that "12345" and "6789" combine to the check value 0xF4
+ */
+void test_EDD_Crc8Combine_CheckValue(void) {
+  const uint8_t check[] = {'1', '2', '3', '4', '5', '6', '7', '8', '9'};
+  uint8_t crc = 0u;
+
+  TEST_ASSERT_EQUAL(EDD_OK, EDD_Crc8Combine(referenceCrc8(check, 5u), referenceCrc8(&check[5], 4u), 4u, &crc));
+  TEST_ASSERT_EQUAL_HEX8(0xF4, crc);
+}
+
+/**
+ * @test Test every split point
+ * @brief Verify the combined CRC against the CRC of the whole buffer for all splits
+ */
+void test_EDD_Crc8Combine_AllSplits(void) {
+  const uint8_t expected = referenceCrc8(testData, sizeof(testData));
+  uint32_t split;
+  uint8_t crc;
+
+  for(split = 0u; split <= sizeof(testData); split++) {
+    crc = 0u;
+    TEST_ASSERT_EQUAL(EDD_OK, EDD_Crc8Combine(referenceCrc8(testData, split), referenceCrc8(&testData[split], sizeof(testData) - split), sizeof(testData) - split, &crc));
+    TEST_ASSERT_EQUAL_HEX8(expected, crc);
+  }
+}
+
+/**
+ * @test Test empty second block
+ * @brief Verify that combining with an empty block returns the first CRC unchanged
+ */
+void test_EDD_Crc8Combine_EmptySecondBlock(void) {
+  uint8_t crc = 0u;
+
+  TEST_ASSERT_EQUAL(EDD_OK, EDD_Crc8Combine(0xA5u, 0x00u, 0u, &crc));
+  TEST_ASSERT_EQUAL_HEX8(0xA5, crc);
+}
+
+/**
+ * @test Test large second block length
+ * @brief Verify the zero-byte shift over the maximum length against step-wise shifts
+ */
+void test_EDD_Crc8Combine_MaxLength(void) {
+  uint8_t stepped = 0u;
+  uint8_t crc = 0u;
+
+  /* 0xFFFFFFFF zero bytes = 0x80000000 zero bytes followed by 0x7FFFFFFF zero bytes */
+  TEST_ASSERT_EQUAL(EDD_OK, EDD_Crc8Combine(0x5Au, 0x00u, 0x80000000uL, &stepped));
+  TEST_ASSERT_EQUAL(EDD_OK, EDD_Crc8Combine(stepped, 0x00u, 0x7FFFFFFFuL, &stepped));
+  TEST_ASSERT_EQUAL(EDD_OK, EDD_Crc8Combine(0x5Au, 0x00u, 0xFFFFFFFFuL, &crc));
+  TEST_ASSERT_EQUAL_HEX8(stepped, crc);
+}
+
+/**
+ * @test Test associativity
+ * @brief Verify that three blocks combine to the same CRC in either grouping
+ */
+void test_EDD_Crc8Combine_Associative(void) {
+  const uint8_t crcA = referenceCrc8(testData, 100u);
+  const uint8_t crcB = referenceCrc8(&testData[100], 250u);
+  const uint8_t crcC = referenceCrc8(&testData[350], 250u);
+  uint8_t left = 0u;
+  uint8_t right = 0u;
+
+  TEST_ASSERT_EQUAL(EDD_OK, EDD_Crc8Combine(crcA, crcB, 250u, &left));
+  TEST_ASSERT_EQUAL(EDD_OK, EDD_Crc8Combine(left, crcC, 250u, &left));
+  TEST_ASSERT_EQUAL(EDD_OK, EDD_Crc8Combine(crcB, crcC, 250u, &right));
+  TEST_ASSERT_EQUAL(EDD_OK, EDD_Crc8Combine(crcA, right, 500u, &right));
+  TEST_ASSERT_EQUAL_HEX8(left, right);
+  TEST_ASSERT_EQUAL_HEX8(referenceCrc8(testData, sizeof(testData)), left);
+}
@@ -0,0 +1,104 @@
+#pragma GCC target("pclmul,ssse3")
+
+#include "EDD_Crc8ComputeClmul.h"
+#include <cpuid.h>
+#include <immintrin.h>
+
+/**
+ * @brief Cached CPUID result: -1 not queried yet, 0 not supported, 1 supported.
+ */
+static int8_t EDD_Crc8ClmulSupport = -1;
+
+/**
+ * @brief Load 16 bytes so that the first byte lands in the most significant lane.
+ */
+EDD_CLMUL_TARGET static inline __m128i EDD_Crc8ClmulLoad(const uint8_t *data, __m128i swap) {
+  return _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(const void *)data), swap);
+}
+
+/**
+ * @brief Multiply a 128-bit accumulator by x^n modulo P (congruent, not reduced).
+ *
+ * @param acc Accumulator.
+ * @param k   Fold constants: high qword = x^(n+64) mod P, low qword = x^n mod P.
+ */
+EDD_CLMUL_TARGET static inline __m128i EDD_Crc8ClmulFold(__m128i acc, __m128i k) {
+  return _mm_xor_si128(_mm_clmulepi64_si128(acc, k, 0x11), _mm_clmulepi64_si128(acc, k, 0x00));
+}
+
+/**
+ * @brief Report whether the CPU supports the CRC-8 folding kernel (private).
+ *
+ * @details
+ * Queries CPUID leaf 1 on first use (PCLMULQDQ and SSSE3 feature bits) and
+ * caches the answer. Concurrent first calls store the same value.
+ *
+ * @return 1 if the folding kernel can be used, 0 otherwise.
+ */
+uint8_t EDD_Crc8ClmulIsSupported(void) {
+  unsigned int eax;
+  unsigned int ebx;
+  unsigned int ecx;
+  unsigned int edx;
+
+  if(EDD_Crc8ClmulSupport < 0) {
+    if((__get_cpuid(1u, &eax, &ebx, &ecx, &edx) != 0) && ((ecx & bit_PCLMUL) != 0u) && ((ecx & bit_SSSE3) != 0u)) {
+      EDD_Crc8ClmulSupport = 1;
+    } else {
+      EDD_Crc8ClmulSupport = 0;
+    }
+  }
+
+  return (EDD_Crc8ClmulSupport > 0) ? 1u : 0u;
+}
+
+/* FUNCTION TO TEST */
+
+EDD_CLMUL_TARGET uint8_t EDD_Crc8ComputeClmul(uint8_t crc, const uint8_t *data, uint32_t length) {
+  const __m128i swap = _mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+  const __m128i k128 = _mm_set_epi64x((long long)EDD_CRC8_CLMUL_X192, (long long)EDD_CRC8_CLMUL_X128);
+  const __m128i k512 = _mm_set_epi64x((long long)EDD_CRC8_CLMUL_X576, (long long)EDD_CRC8_CLMUL_X512);
+  uint8_t remainder[16];
+  uint32_t i = 0u;
+  uint32_t j;
+  __m128i acc0;
+  __m128i acc1;
+  __m128i acc2;
+  __m128i acc3;
+
+  if(length >= 16u) {
+    /* A running CRC c is equivalent to c XORed into the first message byte */
+    acc0 = _mm_xor_si128(EDD_Crc8ClmulLoad(data, swap), _mm_set_epi64x((long long)((uint64_t)crc << 56), 0));
+    crc = 0u;
+    i = 16u;
+
+    if(length >= 64u) {
+      acc1 = EDD_Crc8ClmulLoad(&data[16], swap);
+      acc2 = EDD_Crc8ClmulLoad(&data[32], swap);
+      acc3 = EDD_Crc8ClmulLoad(&data[48], swap);
+      i = 64u;
+
+      /* Four independent lanes hide the latency of the carry-less multiplier */
+      for(; (length - i) >= 64u; i += 64u) {
+        acc0 = _mm_xor_si128(EDD_Crc8ClmulFold(acc0, k512), EDD_Crc8ClmulLoad(&data[i], swap));
+        acc1 = _mm_xor_si128(EDD_Crc8ClmulFold(acc1, k512), EDD_Crc8ClmulLoad(&data[i + 16u], swap));
+        acc2 = _mm_xor_si128(EDD_Crc8ClmulFold(acc2, k512), EDD_Crc8ClmulLoad(&data[i + 32u], swap));
+        acc3 = _mm_xor_si128(EDD_Crc8ClmulFold(acc3, k512), EDD_Crc8ClmulLoad(&data[i + 48u], swap));
+      }
+
+      acc0 = _mm_xor_si128(EDD_Crc8ClmulFold(acc0, k128), acc1);
+      acc0 = _mm_xor_si128(EDD_Crc8ClmulFold(acc0, k128), acc2);
+      acc0 = _mm_xor_si128(EDD_Crc8ClmulFold(acc0, k128), acc3);
+    }
+
+    for(; (length - i) >= 16u; i += 16u) { acc0 = _mm_xor_si128(EDD_Crc8ClmulFold(acc0, k128), EDD_Crc8ClmulLoad(&data[i], swap)); }
+
+    /* Final reduction: CRC of the 128-bit remainder, most significant byte first */
+    _mm_storeu_si128((__m128i *)(void *)remainder, _mm_shuffle_epi8(acc0, swap));
+    for(j = 0u; j < 16u; j++) { crc = EDD_CRC8_BYTE_UPDATE(crc, remainder[j]); }
+  }
+
+  for(; i < length; i++) { crc = EDD_CRC8_BYTE_UPDATE(crc, data[i]); }
+
+  return crc;
+}
@@ -0,0 +1,13 @@
+
+
+#ifndef EDD_Crc8ComputeClmul_H
+#define EDD_Crc8ComputeClmul_H
+
+#include "errorDataDetection_priv.h"
+#include <stdint.h>
+
+uint8_t EDD_Crc8ClmulIsSupported(void);
+
+uint8_t EDD_Crc8ComputeClmul(uint8_t crc, const uint8_t *data, uint32_t length);
+
+#endif
\ No newline at end of file
@@ -0,0 +1,281 @@
+#ifndef ERRORDATADETECTION_PRIV_H
+#define ERRORDATADETECTION_PRIV_H
+
+#include "errorDataDetection_cfg.h"
+#include <stdint.h>
+
+/**
+ * @file errorDataDetection_priv.h
+ * @brief Private declarations for the Error Data Detection module.
+ *
+ * @details
+ * This header is intended for internal module usage only.
+ * It declares private constants, the compile-time generated CRC lookup tables,
+ * and internal static helper functions used by `errorDataDetection.c`.
+ *
+ * @warning
+ * This header shall not be included by external modules.
+ */
+
+/* CRC-8 parameters (CRC-8/ATM) */
+#define EDD_CRC8_POLY (0x07u) /**< CRC polynomial: x^8 + x^2 + x + 1 */
+#define EDD_CRC8_INIT (0x00u) /**< CRC initial value */
+#define EDD_LIN_SUM_INIT (0x00u) /**< LIN classic checksum accumulator initial value */
+
+/* CRC-16 parameters (CRC-16-CCITT-FALSE) */
+#define EDD_CRC16_POLY (0x1021u) /**< CRC polynomial: x^16 + x^12 + x^5 + 1 */
+#define EDD_CRC16_INIT (0xFFFFu) /**< CRC initial value */
+
+/* CRC-8 SAE J1850 parameters */
+#define EDD_CRC8_SAE_J1850_POLY (0x1Du)   /**< CRC polynomial: x^8 + x^4 + x^3 + x^2 + 1 */
+#define EDD_CRC8_SAE_J1850_INIT (0xFFu)   /**< CRC initial value */
+#define EDD_CRC8_SAE_J1850_XOROUT (0xFFu) /**< Final XOR value */
+
+/* CRC-8H2F parameters */
+#define EDD_CRC8H2F_POLY (0x2Fu)   /**< CRC polynomial: x^8 + x^5 + x^3 + x^2 + x + 1 */
+#define EDD_CRC8H2F_INIT (0xFFu)   /**< CRC initial value */
+#define EDD_CRC8H2F_XOROUT (0xFFu) /**< Final XOR value */
+
+/* CRC-32 parameters (IEEE 802.3, reflected) */
+#define EDD_CRC32_POLY (0xEDB88320uL)   /**< Reflected form of polynomial 0x04C11DB7 */
+#define EDD_CRC32_INIT (0xFFFFFFFFuL)   /**< CRC initial value */
+#define EDD_CRC32_XOROUT (0xFFFFFFFFuL) /**< Final XOR value */
+
+/* CRC-32P4 parameters (AUTOSAR E2E Profile 4, reflected) */
+#define EDD_CRC32P4_POLY (0xC8DF352FuL)   /**< Reflected form of polynomial 0xF4ACFB13 */
+#define EDD_CRC32P4_INIT (0xFFFFFFFFuL)   /**< CRC initial value */
+#define EDD_CRC32P4_XOROUT (0xFFFFFFFFuL) /**< Final XOR value */
+
+#if(EDD_CRC_MODE != EDD_CRC_MODE_NIBBLE) && (EDD_CRC_MODE != EDD_CRC_MODE_TABLE) && (EDD_CRC_MODE != EDD_CRC_MODE_SLICE4) && (EDD_CRC_MODE != EDD_CRC_MODE_SLICE8)
+#error "EDD_CRC_MODE shall be EDD_CRC_MODE_NIBBLE, EDD_CRC_MODE_TABLE, EDD_CRC_MODE_SLICE4 or EDD_CRC_MODE_SLICE8"
+#endif
+
+#if(EDD_CRC8_BATCH_STREAMS != 4u) && (EDD_CRC8_BATCH_STREAMS != 8u)
+#error "EDD_CRC8_BATCH_STREAMS shall be 4u or 8u"
+#endif
+
+/*==============================================================================
+ * Compile-time lookup table generation
+ *============================================================================*/
+
+/*
+ * Every lookup table of this module is generated by the preprocessor/compiler
+ * from the polynomial, so no hand-computed table has to be maintained. Each
+ * table entry is the CRC register after shifting one index byte through eight
+ * single-bit steps; the bit steps are branch-free so that the resulting
+ * expressions are integer constant expressions.
+ */
+
+/** @brief One MSB-first shift of an 8-bit CRC register. */
+#define EDD_CRC8_BIT_STEP(c, poly) ((((c) << 1) ^ ((((c) >> 7) & 1u) * (poly))) & 0xFFu)
+
+/** @brief One MSB-first shift of a 16-bit CRC register. */
+#define EDD_CRC16_BIT_STEP(c, poly) ((((c) << 1) ^ ((((c) >> 15) & 1u) * (poly))) & 0xFFFFu)
+
+/** @brief One LSB-first (reflected) shift of a 32-bit CRC register. */
+#define EDD_CRC32_BIT_STEP(c, poly) (((c) >> 1) ^ (((c) & 1u) * (poly)))
+
+/** @brief Apply a bit step eight times (one input byte). */
+#define EDD_CRC_BYTE_STEP(step, c, poly) step(step(step(step(step(step(step(step((c), poly), poly), poly), poly), poly), poly), poly), poly)
+
+/** @brief Table entry of an MSB-first CRC-8: the index is the register content. */
+#define EDD_CRC8_TABLE_ENTRY(i, poly) EDD_CRC_BYTE_STEP(EDD_CRC8_BIT_STEP, (i), poly)
+
+/** @brief Table entry of an MSB-first CRC-8 advanced by 4 bits: the index is the high nibble. */
+#define EDD_CRC8_NIBBLE_ENTRY(i, poly) EDD_CRC8_BIT_STEP(EDD_CRC8_BIT_STEP(EDD_CRC8_BIT_STEP(EDD_CRC8_BIT_STEP(((i) << 4), poly), poly), poly), poly)
+
+/** @brief Table entry of an MSB-first CRC-16: the index enters the high byte. */
+#define EDD_CRC16_TABLE_ENTRY(i, poly) EDD_CRC_BYTE_STEP(EDD_CRC16_BIT_STEP, ((i) << 8), poly)
+
+/** @brief Table entry of a reflected CRC-32: the index enters the low byte. */
+#define EDD_CRC32_TABLE_ENTRY(i, poly) EDD_CRC_BYTE_STEP(EDD_CRC32_BIT_STEP, (uint32_t)(i), poly)
+
+/** @brief Build the literal `0x<h><l>u` used as table index. */
+#define EDD_CRC_TABLE_INDEX(h, l) 0x##h##l##u
+
+/** @brief Generate the 16 entries `0x<h>0`..`0x<h>F` of a 256-entry table. */
+#define EDD_CRC_TABLE_ROW(gen, poly, h)                                                                                                                                         \
+  gen(EDD_CRC_TABLE_INDEX(h, 0), poly), gen(EDD_CRC_TABLE_INDEX(h, 1), poly), gen(EDD_CRC_TABLE_INDEX(h, 2), poly), gen(EDD_CRC_TABLE_INDEX(h, 3), poly),                   \
+      gen(EDD_CRC_TABLE_INDEX(h, 4), poly), gen(EDD_CRC_TABLE_INDEX(h, 5), poly), gen(EDD_CRC_TABLE_INDEX(h, 6), poly), gen(EDD_CRC_TABLE_INDEX(h, 7), poly),               \
+      gen(EDD_CRC_TABLE_INDEX(h, 8), poly), gen(EDD_CRC_TABLE_INDEX(h, 9), poly), gen(EDD_CRC_TABLE_INDEX(h, A), poly), gen(EDD_CRC_TABLE_INDEX(h, B), poly),               \
+      gen(EDD_CRC_TABLE_INDEX(h, C), poly), gen(EDD_CRC_TABLE_INDEX(h, D), poly), gen(EDD_CRC_TABLE_INDEX(h, E), poly), gen(EDD_CRC_TABLE_INDEX(h, F), poly)
+
+/** @brief Generate the initializer list of a 256-entry table with `gen(index, poly)`. */
+#define EDD_CRC_TABLE_256(gen, poly)                                                                                                                                            \
+  EDD_CRC_TABLE_ROW(gen, poly, 0), EDD_CRC_TABLE_ROW(gen, poly, 1), EDD_CRC_TABLE_ROW(gen, poly, 2), EDD_CRC_TABLE_ROW(gen, poly, 3), EDD_CRC_TABLE_ROW(gen, poly, 4),      \
+      EDD_CRC_TABLE_ROW(gen, poly, 5), EDD_CRC_TABLE_ROW(gen, poly, 6), EDD_CRC_TABLE_ROW(gen, poly, 7), EDD_CRC_TABLE_ROW(gen, poly, 8), EDD_CRC_TABLE_ROW(gen, poly, 9),  \
+      EDD_CRC_TABLE_ROW(gen, poly, A), EDD_CRC_TABLE_ROW(gen, poly, B), EDD_CRC_TABLE_ROW(gen, poly, C), EDD_CRC_TABLE_ROW(gen, poly, D), EDD_CRC_TABLE_ROW(gen, poly, E),  \
+      EDD_CRC_TABLE_ROW(gen, poly, F)
+
+#if(EDD_CRC_MODE == EDD_CRC_MODE_NIBBLE)
+/**
+ * @brief CRC-8 nibble lookup table for polynomial 0x07.
+ *
+ * @details
+ * Entry `n` is the CRC register obtained by shifting the nibble `n` (placed in
+ * the high half of the register) through four single-bit steps. One input byte
+ * is processed with two lookups (see @ref EDD_Crc8NibbleStep).
+ *
+ * Memory:
+ * - Size: 16 bytes
+ * - Storage: static const (intended to stay in ROM/FLASH)
+ */
+static const uint8_t EDD_Crc8NibbleTable[16] = {EDD_CRC_TABLE_ROW(EDD_CRC8_NIBBLE_ENTRY, EDD_CRC8_POLY, 0)};
+
+/** @brief Advance the CRC-8 register over one input byte (nibble table mode). */
+#define EDD_CRC8_BYTE_UPDATE(crc, byte) EDD_Crc8NibbleStep(EDD_Crc8NibbleStep((uint8_t)((crc) ^ (byte))))
+#else
+/**
+ * @brief CRC-8 lookup table for polynomial 0x07.
+ *
+ * @details
+ * This table is precomputed to allow CRC computation in O(N) time with
+ * minimal CPU load. It maps intermediate CRC values combined with the next
+ * input byte to the next CRC accumulator value.
+ *
+ * Memory:
+ * - Size: 256 bytes
+ * - Storage: static const (intended to stay in ROM/FLASH)
+ */
+static const uint8_t EDD_Crc8Table[256] = {EDD_CRC_TABLE_256(EDD_CRC8_TABLE_ENTRY, EDD_CRC8_POLY)};
+
+/** @brief Advance the CRC-8 register over one input byte (byte table). */
+#define EDD_CRC8_BYTE_UPDATE(crc, byte) EDD_Crc8Table[(uint8_t)((crc) ^ (byte))]
+#endif
+
+/*
+ * Nominal cost of the CRC-8 engine in CPU cycles per byte for the selected
+ * mode, counted on an in-order 32-bit MCU with zero wait-state flash (loads,
+ * shifts, XORs and loop overhead of the inner loop). Reported by
+ * EDD_GetCrc8ModeInfo().
+ */
+#if(EDD_CRC_MODE == EDD_CRC_MODE_NIBBLE)
+#define EDD_CRC8_NOMINAL_CYCLES_PER_BYTE (12u) /**< Two dependent nibble lookups per byte */
+#elif(EDD_CRC_MODE == EDD_CRC_MODE_TABLE)
+#define EDD_CRC8_NOMINAL_CYCLES_PER_BYTE (7u) /**< One dependent lookup per byte */
+#elif(EDD_CRC_MODE == EDD_CRC_MODE_SLICE4)
+#define EDD_CRC8_NOMINAL_CYCLES_PER_BYTE (4u) /**< One dependent lookup per 4 bytes */
+#else
+#define EDD_CRC8_NOMINAL_CYCLES_PER_BYTE (3u) /**< One dependent lookup per 8 bytes */
+#endif
+
+#if(EDD_CRC_MODE == EDD_CRC_MODE_SLICE4) || (EDD_CRC_MODE == EDD_CRC_MODE_SLICE8)
+/*
+ * Slicing tables are linear in the index: T<k>[x] is the XOR of T<k>[1 << b]
+ * over the bits b set in x. The eight basis values of each table are chained
+ * as enumeration constants (T<k>[1 << b] = T0[T<k-1>[1 << b]]), which keeps
+ * the generated expressions small.
+ */
+#define EDD_CRC8_SLICE_BASIS_0(b) EDD_CRC8_SLICE_K0_##b = EDD_CRC8_TABLE_ENTRY(1u << b, EDD_CRC8_POLY)
+#define EDD_CRC8_SLICE_BASIS_K(k, prev, b) EDD_CRC8_SLICE_K##k##_##b = EDD_CRC8_TABLE_ENTRY(EDD_CRC8_SLICE_K##prev##_##b, EDD_CRC8_POLY)
+#define EDD_CRC8_SLICE_BASIS(k, prev)                                                                                                                                           \
+  EDD_CRC8_SLICE_BASIS_K(k, prev, 0), EDD_CRC8_SLICE_BASIS_K(k, prev, 1), EDD_CRC8_SLICE_BASIS_K(k, prev, 2), EDD_CRC8_SLICE_BASIS_K(k, prev, 3),                          \
+      EDD_CRC8_SLICE_BASIS_K(k, prev, 4), EDD_CRC8_SLICE_BASIS_K(k, prev, 5), EDD_CRC8_SLICE_BASIS_K(k, prev, 6), EDD_CRC8_SLICE_BASIS_K(k, prev, 7)
+
+/** @brief Basis values T<k>[1 << b] of the slicing tables (k = 0 is @ref EDD_Crc8Table). */
+enum {
+  EDD_CRC8_SLICE_BASIS_0(0),
+  EDD_CRC8_SLICE_BASIS_0(1),
+  EDD_CRC8_SLICE_BASIS_0(2),
+  EDD_CRC8_SLICE_BASIS_0(3),
+  EDD_CRC8_SLICE_BASIS_0(4),
+  EDD_CRC8_SLICE_BASIS_0(5),
+  EDD_CRC8_SLICE_BASIS_0(6),
+  EDD_CRC8_SLICE_BASIS_0(7),
+  EDD_CRC8_SLICE_BASIS(1, 0),
+  EDD_CRC8_SLICE_BASIS(2, 1),
+  EDD_CRC8_SLICE_BASIS(3, 2),
+  EDD_CRC8_SLICE_BASIS(4, 3),
+  EDD_CRC8_SLICE_BASIS(5, 4),
+  EDD_CRC8_SLICE_BASIS(6, 5),
+  EDD_CRC8_SLICE_BASIS(7, 6)
+};
+
+/** @brief Table entry of slicing table T<k>, combined from its basis values. */
+#define EDD_CRC8_SLICE_ENTRY(i, k)                                                                                                                                              \
+  ((((i) & 0x01u) != 0u ? (uint32_t)EDD_CRC8_SLICE_K##k##_0 : 0u) ^ (((i) & 0x02u) != 0u ? (uint32_t)EDD_CRC8_SLICE_K##k##_1 : 0u) ^                                       \
+   (((i) & 0x04u) != 0u ? (uint32_t)EDD_CRC8_SLICE_K##k##_2 : 0u) ^ (((i) & 0x08u) != 0u ? (uint32_t)EDD_CRC8_SLICE_K##k##_3 : 0u) ^                                       \
+   (((i) & 0x10u) != 0u ? (uint32_t)EDD_CRC8_SLICE_K##k##_4 : 0u) ^ (((i) & 0x20u) != 0u ? (uint32_t)EDD_CRC8_SLICE_K##k##_5 : 0u) ^                                       \
+   (((i) & 0x40u) != 0u ? (uint32_t)EDD_CRC8_SLICE_K##k##_6 : 0u) ^ (((i) & 0x80u) != 0u ? (uint32_t)EDD_CRC8_SLICE_K##k##_7 : 0u))
+
+/**
+ * @brief Additional CRC-8 lookup tables for the slicing-by-N engine.
+ *
+ * @details
+ * Row `k - 1` holds table T<sub>k</sub>, i.e. the CRC-8 obtained by feeding the
+ * index byte followed by `k` zero bytes (T<sub>k</sub>[x] = T<sub>0</sub>[T<sub>k-1</sub>[x]],
+ * with T<sub>0</sub> = @ref EDD_Crc8Table). Because the CRC is linear, a block of N
+ * bytes `d0..dN-1` updates the accumulator as:
+ * `crc = T(N-1)[crc ^ d0] ^ T(N-2)[d1] ^ ... ^ T0[dN-1]`.
+ *
+ * Memory:
+ * - Size: (EDD_CRC_MODE - 1) x 256 bytes
+ * - Storage: static const (intended to stay in ROM/FLASH)
+ */
+static const uint8_t EDD_Crc8SliceTable[EDD_CRC_MODE - 1u][256] = {
+    {EDD_CRC_TABLE_256(EDD_CRC8_SLICE_ENTRY, 1)},
+    {EDD_CRC_TABLE_256(EDD_CRC8_SLICE_ENTRY, 2)},
+    {EDD_CRC_TABLE_256(EDD_CRC8_SLICE_ENTRY, 3)},
+#if(EDD_CRC_MODE == EDD_CRC_MODE_SLICE8)
+    {EDD_CRC_TABLE_256(EDD_CRC8_SLICE_ENTRY, 4)},
+    {EDD_CRC_TABLE_256(EDD_CRC8_SLICE_ENTRY, 5)},
+    {EDD_CRC_TABLE_256(EDD_CRC8_SLICE_ENTRY, 6)},
+    {EDD_CRC_TABLE_256(EDD_CRC8_SLICE_ENTRY, 7)},
+#endif
+};
+#endif
+
+#if(EDD_CRC8_SAE_J1850_SUPPORT == 1u)
+/**
+ * @brief CRC-8 SAE J1850 lookup table (polynomial 0x1D), 256 bytes ROM.
+ */
+static const uint8_t EDD_Crc8SaeJ1850Table[256] = {EDD_CRC_TABLE_256(EDD_CRC8_TABLE_ENTRY, EDD_CRC8_SAE_J1850_POLY)};
+#endif
+
+#if(EDD_CRC8H2F_SUPPORT == 1u)
+/**
+ * @brief CRC-8H2F lookup table (polynomial 0x2F), 256 bytes ROM.
+ */
+static const uint8_t EDD_Crc8H2FTable[256] = {EDD_CRC_TABLE_256(EDD_CRC8_TABLE_ENTRY, EDD_CRC8H2F_POLY)};
+#endif
+
+#if(EDD_CRC16_SUPPORT == 1u)
+/**
+ * @brief CRC-16-CCITT lookup table (polynomial 0x1021), 512 bytes ROM.
+ */
+static const uint16_t EDD_Crc16Table[256] = {EDD_CRC_TABLE_256(EDD_CRC16_TABLE_ENTRY, EDD_CRC16_POLY)};
+#endif
+
+#if(EDD_CRC32_SUPPORT == 1u)
+/**
+ * @brief CRC-32 lookup table (reflected polynomial 0xEDB88320), 1024 bytes ROM.
+ */
+static const uint32_t EDD_Crc32Table[256] = {EDD_CRC_TABLE_256(EDD_CRC32_TABLE_ENTRY, EDD_CRC32_POLY)};
+#endif
+
+#if(EDD_CRC32P4_SUPPORT == 1u)
+/**
+ * @brief CRC-32P4 lookup table (reflected polynomial 0xC8DF352F), 1024 bytes ROM.
+ */
+static const uint32_t EDD_Crc32P4Table[256] = {EDD_CRC_TABLE_256(EDD_CRC32_TABLE_ENTRY, EDD_CRC32P4_POLY)};
+#endif
+
+#if(EDD_CRC8_CLMUL_SUPPORT == 1u) && defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define EDD_CRC8_CLMUL_AVAILABLE (1u) /**< Folding kernel compiled in (x86-64 GCC/Clang) */
+#else
+#define EDD_CRC8_CLMUL_AVAILABLE (0u) /**< Folding kernel not available on this build */
+#endif
+
+#if(EDD_CRC8_CLMUL_AVAILABLE == 1u)
+/* Folding constants x^n mod P for P = 0x107 (see EDD_Crc8ComputeClmul) */
+#define EDD_CRC8_CLMUL_X128 (0x02u) /**< x^128 mod P: fold low qword by 128 bits */
+#define EDD_CRC8_CLMUL_X192 (0x26u) /**< x^192 mod P: fold high qword by 128 bits */
+#define EDD_CRC8_CLMUL_X512 (0x10u) /**< x^512 mod P: fold low qword by 512 bits */
+#define EDD_CRC8_CLMUL_X576 (0x37u) /**< x^576 mod P: fold high qword by 512 bits */
+
+/** Code generation attribute of the folding kernel functions (PCLMULQDQ + SSSE3) */
+#define EDD_CLMUL_TARGET __attribute__((target("pclmul,ssse3")))
+
+#endif
+
+#endif /* ERRORDATADETECTION_PRIV_H */
@@ -0,0 +1,118 @@
+#include "EDD_Crc8ComputeClmul.h"
+#include "unity.h"
+#include <string.h>
+
+/**
+ * @file test_EDD_Crc8ComputeClmul.c
+ * @brief Unit tests for EDD_Crc8ComputeClmul function
+ * @details Cross-checks the carry-less multiplication folding kernel against a bitwise CRC-8/ATM
+ */
+
+/* Setup and teardown functions */
+void setUp(void) {
+  if(EDD_Crc8ClmulIsSupported() == 0u) { TEST_IGNORE_MESSAGE("CPU without PCLMULQDQ/SSSE3"); }
+}
+
+void tearDown(void) { /* Teardown code if needed */ }
+
+/**
+ * @brief Bitwise CRC-8/ATM reference.
+ */
+static uint8_t referenceCrc8(const uint8_t *data, uint32_t length) {
+  uint8_t crc = EDD_CRC8_INIT;
+  uint32_t i;
+  uint8_t bit;
+
+  for(i = 0u; i < length; i++) {
+    crc ^= data[i];
+    for(bit = 0u; bit < 8u; bit++) { crc = ((crc & 0x80u) != 0u) ? (uint8_t)((crc << 1) ^ EDD_CRC8_POLY) : (uint8_t)(crc << 1); }
+  }
+
+  return crc;
+}
+
+static uint8_t testData[4096];
+
+static void fillTestData(void) {
+  uint32_t i;
+  uint32_t seed = 0x12345678u;
+
+  for(i = 0u; i < sizeof(testData); i++) {
+    seed = (seed * 1103515245u) + 12345u;
+    testData[i] = (uint8_t)(seed >> 16);
+  }
+}
+
+/**
+ * @test Test below one 16-byte block
+ * @brief Verify that short buffers are handled by the table tail only
+ */
+void test_EDD_Crc8ComputeClmul_ShortBuffer(void) {
+  const uint8_t data[] = {'1', '2', '3', '4', '5', '6', '7', '8', '9'};
+
+  TEST_ASSERT_EQUAL_HEX8(0xF4, EDD_Crc8ComputeClmul(EDD_CRC8_INIT, data, 9u));
+}
+
+/**
+ * @test Test single 16-byte block folding
+ * @brief Verify lengths between 16 and 63 bytes (single accumulator path)
+ */
+void test_EDD_Crc8ComputeClmul_SingleLane(void) {
+  uint32_t length;
+
+  fillTestData();
+
+  for(length = 16u; length < 64u; length++) { TEST_ASSERT_EQUAL_HEX8(referenceCrc8(testData, length), EDD_Crc8ComputeClmul(EDD_CRC8_INIT, testData, length)); }
+}
+
+/**
+ * @test Test four-lane folding
+ * @brief Verify every length up to 4 KiB, covering lane merge, 16-byte folds and tail
+ */
+void test_EDD_Crc8ComputeClmul_FourLanes(void) {
+  uint32_t length;
+
+  fillTestData();
+
+  for(length = 64u; length <= sizeof(testData); length++) { TEST_ASSERT_EQUAL_HEX8(referenceCrc8(testData, length), EDD_Crc8ComputeClmul(EDD_CRC8_INIT, testData, length)); }
+}
+
+/**
+ * @test Test unaligned input
+ * @brief Verify the kernel does not rely on 16-byte aligned buffers
+ */
+void test_EDD_Crc8ComputeClmul_UnalignedInput(void) {
+  uint32_t offset;
+
+  fillTestData();
+
+  for(offset = 1u; offset < 16u; offset++) { TEST_ASSERT_EQUAL_HEX8(referenceCrc8(&testData[offset], 1000u), EDD_Crc8ComputeClmul(EDD_CRC8_INIT, &testData[offset], 1000u)); }
+}
+
+/**
+ * @test Test all-zero and all-one buffers
+ * @brief Verify the reduction for degenerate input patterns
+ */
+void test_EDD_Crc8ComputeClmul_UniformPatterns(void) {
+  memset(testData, 0x00, sizeof(testData));
+  TEST_ASSERT_EQUAL_HEX8(0x00, EDD_Crc8ComputeClmul(EDD_CRC8_INIT, testData, 256u));
+
+  memset(testData, 0xFF, sizeof(testData));
+  TEST_ASSERT_EQUAL_HEX8(referenceCrc8(testData, 300u), EDD_Crc8ComputeClmul(EDD_CRC8_INIT, testData, 300u));
+}
+
+/**
+ * @test Test continuation from a running CRC
+ * @brief Verify the running CRC is injected into the first folded block
+ */
+void test_EDD_Crc8ComputeClmul_ContinueFromCrc(void) {
+  uint8_t crc;
+  uint32_t split;
+
+  fillTestData();
+
+  for(split = 1u; split < 200u; split++) {
+    crc = referenceCrc8(testData, split);
+    TEST_ASSERT_EQUAL_HEX8(referenceCrc8(testData, 1500u), EDD_Crc8ComputeClmul(crc, &testData[split], 1500u - split));
+  }
+}
@@ -0,0 +1,69 @@
+#include "EDD_Crc8ComputeInterleaved.h"
+
+/* Byte-serial reference for the tail processing of the function under test */
+uint8_t EDD_Crc8ComputeInternal(uint8_t crc, const uint8_t *data, uint32_t length) {
+  uint32_t i;
+
+  for(i = 0u; i < length; i++) { crc = EDD_Crc8Table[crc ^ data[i]]; }
+
+  return crc;
+}
+
+/* FUNCTION TO TEST */
+
+void EDD_Crc8ComputeInterleaved(const EDD_Crc8FrameType *frames, uint8_t *crc_out) {
+  const uint8_t *d0 = frames[0].data;
+  const uint8_t *d1 = frames[1].data;
+  const uint8_t *d2 = frames[2].data;
+  const uint8_t *d3 = frames[3].data;
+  uint8_t c0 = EDD_CRC8_INIT;
+  uint8_t c1 = EDD_CRC8_INIT;
+  uint8_t c2 = EDD_CRC8_INIT;
+  uint8_t c3 = EDD_CRC8_INIT;
+#if(EDD_CRC8_BATCH_STREAMS == 8u)
+  const uint8_t *d4 = frames[4].data;
+  const uint8_t *d5 = frames[5].data;
+  const uint8_t *d6 = frames[6].data;
+  const uint8_t *d7 = frames[7].data;
+  uint8_t c4 = EDD_CRC8_INIT;
+  uint8_t c5 = EDD_CRC8_INIT;
+  uint8_t c6 = EDD_CRC8_INIT;
+  uint8_t c7 = EDD_CRC8_INIT;
+#endif
+  uint32_t common = frames[0].length;
+  uint32_t i;
+  uint8_t s;
+
+  for(s = 1u; s < EDD_CRC8_BATCH_STREAMS; s++) {
+    if(frames[s].length < common) { common = frames[s].length; }
+  }
+
+  /* Independent accumulators: the table loads of one iteration overlap */
+  for(i = 0u; i < common; i++) {
+    c0 = EDD_CRC8_BYTE_UPDATE(c0, d0[i]);
+    c1 = EDD_CRC8_BYTE_UPDATE(c1, d1[i]);
+    c2 = EDD_CRC8_BYTE_UPDATE(c2, d2[i]);
+    c3 = EDD_CRC8_BYTE_UPDATE(c3, d3[i]);
+#if(EDD_CRC8_BATCH_STREAMS == 8u)
+    c4 = EDD_CRC8_BYTE_UPDATE(c4, d4[i]);
+    c5 = EDD_CRC8_BYTE_UPDATE(c5, d5[i]);
+    c6 = EDD_CRC8_BYTE_UPDATE(c6, d6[i]);
+    c7 = EDD_CRC8_BYTE_UPDATE(c7, d7[i]);
+#endif
+  }
+
+  crc_out[0] = c0;
+  crc_out[1] = c1;
+  crc_out[2] = c2;
+  crc_out[3] = c3;
+#if(EDD_CRC8_BATCH_STREAMS == 8u)
+  crc_out[4] = c4;
+  crc_out[5] = c5;
+  crc_out[6] = c6;
+  crc_out[7] = c7;
+#endif
+
+  for(s = 0u; s < EDD_CRC8_BATCH_STREAMS; s++) {
+    if(frames[s].length > common) { crc_out[s] = EDD_Crc8ComputeInternal(crc_out[s], &frames[s].data[common], frames[s].length - common); }
+  }
+}
@@ -0,0 +1,12 @@
+#ifndef EDD_Crc8ComputeInterleaved_H
+#define EDD_Crc8ComputeInterleaved_H
+
+#include "errorDataDetection.h"
+#include "errorDataDetection_priv.h"
+#include <stdint.h>
+
+uint8_t EDD_Crc8ComputeInternal(uint8_t crc, const uint8_t *data, uint32_t length);
+
+void EDD_Crc8ComputeInterleaved(const EDD_Crc8FrameType *frames, uint8_t *crc_out);
+
+#endif
@@ -0,0 +1,77 @@
+#include "EDD_Crc8ComputeInterleaved.h"
+#include "unity.h"
+
+/**
+ * @file test_EDD_Crc8ComputeInterleaved.c
+ * @brief Unit tests for EDD_Crc8ComputeInterleaved function
+ * @details Checks that the interleaved streams give the same CRC as separate computations
+ */
+
+static uint8_t testData[EDD_CRC8_BATCH_STREAMS][64];
+static EDD_Crc8FrameType testFrames[EDD_CRC8_BATCH_STREAMS];
+
+/* Setup and teardown functions */
+void setUp(void) {
+  uint8_t s;
+  uint8_t i;
+
+  for(s = 0u; s < EDD_CRC8_BATCH_STREAMS; s++) {
+    for(i = 0u; i < 64u; i++) { testData[s][i] = (uint8_t)((s * 31u) + (i * 7u) + 1u); }
+    testFrames[s].data = testData[s];
+    testFrames[s].length = 8u;
+    testFrames[s].expectedCrc = 0u;
+  }
+}
+
+void tearDown(void) { /* Teardown code if needed */ }
+
+/**
+ * @brief Helper: compare every stream result with a separate computation
+ */
+static void assertStreamsMatchReference(void) {
+  uint8_t crc[EDD_CRC8_BATCH_STREAMS];
+  uint8_t s;
+
+  EDD_Crc8ComputeInterleaved(testFrames, crc);
+
+  for(s = 0u; s < EDD_CRC8_BATCH_STREAMS; s++) { TEST_ASSERT_EQUAL_HEX8(EDD_Crc8ComputeInternal(EDD_CRC8_INIT, testFrames[s].data, testFrames[s].length), crc[s]); }
+}
+
+/**
+ * @test Test equal frame lengths
+ * @brief Verify the typical case of 8-byte frames
+ */
+void test_EDD_Crc8ComputeInterleaved_EqualLengths(void) { assertStreamsMatchReference(); }
+
+/**
+ * @test Test check value on every stream
+ * @brief Verify CRC of "123456789" is 0xF4 on each interleaved stream
+ */
+void test_EDD_Crc8ComputeInterleaved_CheckValue(void) {
+  const uint8_t check[] = {'1', '2', '3', '4', '5', '6', '7', '8', '9'};
+  uint8_t crc[EDD_CRC8_BATCH_STREAMS];
+  uint8_t s;
+
+  for(s = 0u; s < EDD_CRC8_BATCH_STREAMS; s++) {
+    testFrames[s].data = check;
+    testFrames[s].length = 9u;
+  }
+
+  EDD_Crc8ComputeInterleaved(testFrames, crc);
+
+  for(s = 0u; s < EDD_CRC8_BATCH_STREAMS; s++) { TEST_ASSERT_EQUAL_HEX8(0xF4, crc[s]); }
+}
+
+/**
+ * @test Test different frame lengths
+ * @brief Verify that the tails beyond the shortest frame are processed
+ */
+void test_EDD_Crc8ComputeInterleaved_DifferentLengths(void) {
+  uint8_t s;
+
+  for(s = 0u; s < EDD_CRC8_BATCH_STREAMS; s++) { testFrames[s].length = 1u + (s * 9u); }
+  assertStreamsMatchReference();
+
+  for(s = 0u; s < EDD_CRC8_BATCH_STREAMS; s++) { testFrames[s].length = 64u - (s * 5u); }
+  assertStreamsMatchReference();
+}
@@ -2,11 +2,25 @@
 
 /* FUNCTION TO TEST */
 
-uint8_t EDD_Crc8ComputeInternal(const uint8_t *data, uint8_t length) {
-  uint8_t crc = EDD_CRC8_INIT;
-  uint8_t i;
+uint8_t EDD_Crc8ComputeInternal(uint8_t crc, const uint8_t *data, uint32_t length) {
+  uint32_t i = 0u;
 
-  for(i = 0u; i < length; i++) { crc = EDD_Crc8Table[crc ^ data[i]]; }
+#if(EDD_CRC8_CLMUL_AVAILABLE == 1u)
+  if((length >= EDD_CRC8_CLMUL_MIN_LENGTH) && (EDD_Crc8ClmulIsSupported() != 0u)) { return EDD_Crc8ComputeClmul(crc, data, length); }
+#endif
+
+#if(EDD_CRC_MODE == EDD_CRC_MODE_SLICE8)
+  for(; (length - i) >= 8u; i += 8u) {
+    crc = (uint8_t)(EDD_Crc8SliceTable[6][crc ^ data[i]] ^ EDD_Crc8SliceTable[5][data[i + 1u]] ^ EDD_Crc8SliceTable[4][data[i + 2u]] ^ EDD_Crc8SliceTable[3][data[i + 3u]] ^
+                    EDD_Crc8SliceTable[2][data[i + 4u]] ^ EDD_Crc8SliceTable[1][data[i + 5u]] ^ EDD_Crc8SliceTable[0][data[i + 6u]] ^ EDD_Crc8Table[data[i + 7u]]);
+  }
+#elif(EDD_CRC_MODE == EDD_CRC_MODE_SLICE4)
+  for(; (length - i) >= 4u; i += 4u) {
+    crc = (uint8_t)(EDD_Crc8SliceTable[2][crc ^ data[i]] ^ EDD_Crc8SliceTable[1][data[i + 1u]] ^ EDD_Crc8SliceTable[0][data[i + 2u]] ^ EDD_Crc8Table[data[i + 3u]]);
+  }
+#endif
+
+  for(; i < length; i++) { crc = EDD_CRC8_BYTE_UPDATE(crc, data[i]); }
 
   return crc;
 }
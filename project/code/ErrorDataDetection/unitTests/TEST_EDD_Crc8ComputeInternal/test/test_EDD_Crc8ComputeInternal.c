@@ -21,7 +21,7 @@ void test_EDD_Crc8ComputeInternal_EmptyData(void) {
   uint8_t data[] = {};
   uint8_t expected = EDD_CRC8_INIT;
 
-  uint8_t result = EDD_Crc8ComputeInternal(data, 0);
+  uint8_t result = EDD_Crc8ComputeInternal(EDD_CRC8_INIT, data, 0);
 
   TEST_ASSERT_EQUAL_UINT8(expected, result);
 }
@@ -35,7 +35,7 @@ void test_EDD_Crc8ComputeInternal_SingleByte(void) {
   /* Expected: Initial CRC (0x00) XOR with data[0] (0x00) = index 0 in table = 0x00 */
   uint8_t expected = 0x00;
 
-  uint8_t result = EDD_Crc8ComputeInternal(data, 1);
+  uint8_t result = EDD_Crc8ComputeInternal(EDD_CRC8_INIT, data, 1);
 
   TEST_ASSERT_EQUAL_UINT8(expected, result);
 }
@@ -49,7 +49,7 @@ void test_EDD_Crc8ComputeInternal_SingleByteNonZero(void) {
   /* Expected: Initial CRC (0x00) XOR with data[0] (0x01) = index 1 in table = 0x07 */
   uint8_t expected = 0x07;
 
-  uint8_t result = EDD_Crc8ComputeInternal(data, 1);
+  uint8_t result = EDD_Crc8ComputeInternal(EDD_CRC8_INIT, data, 1);
 
   TEST_ASSERT_EQUAL_UINT8(expected, result);
 }
@@ -66,7 +66,7 @@ void test_EDD_Crc8ComputeInternal_TwoBytes(void) {
    */
   uint8_t expected = 0x00;
 
-  uint8_t result = EDD_Crc8ComputeInternal(data, 2);
+  uint8_t result = EDD_Crc8ComputeInternal(EDD_CRC8_INIT, data, 2);
 
   TEST_ASSERT_EQUAL_UINT8(expected, result);
 }
@@ -79,7 +79,7 @@ void test_EDD_Crc8ComputeInternal_AllZeros(void) {
   uint8_t data[] = {0x00, 0x00, 0x00, 0x00};
   uint8_t expected = 0x00;
 
-  uint8_t result = EDD_Crc8ComputeInternal(data, 4);
+  uint8_t result = EDD_Crc8ComputeInternal(EDD_CRC8_INIT, data, 4);
 
   TEST_ASSERT_EQUAL_UINT8(expected, result);
 }
@@ -91,7 +91,7 @@ void test_EDD_Crc8ComputeInternal_AllZeros(void) {
 void test_EDD_Crc8ComputeInternal_AlternatingPattern(void) {
   uint8_t data[] = {0xAA, 0x55, 0xAA, 0x55};
 
-  uint8_t result = EDD_Crc8ComputeInternal(data, 4);
+  uint8_t result = EDD_Crc8ComputeInternal(EDD_CRC8_INIT, data, 4);
 
   /* Verify the result is within valid range (0-255) */
   TEST_ASSERT_LESS_OR_EQUAL_UINT8(255, result);
@@ -105,7 +105,7 @@ void test_EDD_Crc8ComputeInternal_LongData(void) {
   uint8_t data[] = {0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F,
                     0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F};
 
-  uint8_t result = EDD_Crc8ComputeInternal(data, 32);
+  uint8_t result = EDD_Crc8ComputeInternal(EDD_CRC8_INIT, data, 32);
 
   /* Verify the result is a valid CRC (0-255) */
   TEST_ASSERT_LESS_OR_EQUAL_UINT8(255, result);
@@ -118,7 +118,7 @@ void test_EDD_Crc8ComputeInternal_LongData(void) {
 void test_EDD_Crc8ComputeInternal_ReturnValueRange(void) {
   uint8_t data[] = {0xDE, 0xAD, 0xBE, 0xEF};
 
-  uint8_t result = EDD_Crc8ComputeInternal(data, 4);
+  uint8_t result = EDD_Crc8ComputeInternal(EDD_CRC8_INIT, data, 4);
 
   /* Result should always be in valid uint8_t range (0-255) */
   TEST_ASSERT_LESS_OR_EQUAL_UINT8(255, result);
@@ -132,8 +132,8 @@ void test_EDD_Crc8ComputeInternal_ReturnValueRange(void) {
 void test_EDD_Crc8ComputeInternal_Consistency(void) {
   uint8_t data[] = {0x12, 0x34, 0x56, 0x78};
 
-  uint8_t result1 = EDD_Crc8ComputeInternal(data, 4);
-  uint8_t result2 = EDD_Crc8ComputeInternal(data, 4);
+  uint8_t result1 = EDD_Crc8ComputeInternal(EDD_CRC8_INIT, data, 4);
+  uint8_t result2 = EDD_Crc8ComputeInternal(EDD_CRC8_INIT, data, 4);
 
   TEST_ASSERT_EQUAL_UINT8(result1, result2);
 }
@@ -145,9 +145,9 @@ void test_EDD_Crc8ComputeInternal_Consistency(void) {
 void test_EDD_Crc8ComputeInternal_DifferentLengths(void) {
   uint8_t data[] = {0x01, 0x02, 0x03, 0x04};
 
-  uint8_t result_len1 = EDD_Crc8ComputeInternal(data, 1);
-  uint8_t result_len2 = EDD_Crc8ComputeInternal(data, 2);
-  uint8_t result_len4 = EDD_Crc8ComputeInternal(data, 4);
+  uint8_t result_len1 = EDD_Crc8ComputeInternal(EDD_CRC8_INIT, data, 1);
+  uint8_t result_len2 = EDD_Crc8ComputeInternal(EDD_CRC8_INIT, data, 2);
+  uint8_t result_len4 = EDD_Crc8ComputeInternal(EDD_CRC8_INIT, data, 4);
 
   /* Results should be different when processing different lengths */
   TEST_ASSERT_NOT_EQUAL(result_len1, result_len2);
@@ -161,7 +161,7 @@ void test_EDD_Crc8ComputeInternal_DifferentLengths(void) {
 void test_EDD_Crc8ComputeInternal_BoundaryValue(void) {
   uint8_t data[] = {0x80};
 
-  uint8_t result = EDD_Crc8ComputeInternal(data, 1);
+  uint8_t result = EDD_Crc8ComputeInternal(EDD_CRC8_INIT, data, 1);
 
   /* Verify result is valid */
   TEST_ASSERT_LESS_OR_EQUAL_UINT8(255, result);
@@ -174,8 +174,82 @@ void test_EDD_Crc8ComputeInternal_BoundaryValue(void) {
 void test_EDD_Crc8ComputeInternal_PotentialOverflowValues(void) {
   uint8_t data[] = {0xFF, 0xFE, 0xFD};
 
-  uint8_t result = EDD_Crc8ComputeInternal(data, 3);
+  uint8_t result = EDD_Crc8ComputeInternal(EDD_CRC8_INIT, data, 3);
 
   /* Should not overflow (result should be <= 255) */
   TEST_ASSERT_LESS_OR_EQUAL_UINT8(255, result);
 }
+
+/**
+ * @brief Bitwise CRC-8/ATM reference used to cross-check the table engines.
+ */
+static uint8_t referenceCrc8(const uint8_t *data, uint32_t length) {
+  uint8_t crc = EDD_CRC8_INIT;
+  uint32_t i;
+  uint8_t bit;
+
+  for(i = 0u; i < length; i++) {
+    crc ^= data[i];
+    for(bit = 0u; bit < 8u; bit++) { crc = ((crc & 0x80u) != 0u) ? (uint8_t)((crc << 1) ^ EDD_CRC8_POLY) : (uint8_t)(crc << 1); }
+  }
+
+  return crc;
+}
+
+/**
+ * @test Test with the standard check string
+ * @brief Verify CRC-8/ATM of "123456789" equals the catalogue check value 0xF4
+ */
+void test_EDD_Crc8ComputeInternal_CheckValue(void) {
+  const uint8_t data[] = {'1', '2', '3', '4', '5', '6', '7', '8', '9'};
+
+  uint8_t result = EDD_Crc8ComputeInternal(EDD_CRC8_INIT, data, 9u);
+
+  TEST_ASSERT_EQUAL_HEX8(0xF4, result);
+}
+
+/**
+ * @test Test every length around the slicing block size
+ * @brief Verify the sliced blocks and the byte-serial tail give the bitwise result
+ */
+void test_EDD_Crc8ComputeInternal_SlicingBlockBoundaries(void) {
+  uint8_t data[40];
+  uint32_t length;
+  uint32_t i;
+
+  for(i = 0u; i < sizeof(data); i++) { data[i] = (uint8_t)((i * 37u) + 11u); }
+
+  for(length = 1u; length <= sizeof(data); length++) { TEST_ASSERT_EQUAL_HEX8(referenceCrc8(data, length), EDD_Crc8ComputeInternal(EDD_CRC8_INIT, data, length)); }
+}
+
+/**
+ * @test Test with a buffer longer than 255 bytes
+ * @brief Verify the 32-bit length is honoured (no truncation to 8 bits)
+ */
+void test_EDD_Crc8ComputeInternal_LengthAbove255(void) {
+  static uint8_t data[1027];
+  uint32_t i;
+
+  for(i = 0u; i < sizeof(data); i++) { data[i] = (uint8_t)(i ^ (i >> 8)); }
+
+  TEST_ASSERT_EQUAL_HEX8(referenceCrc8(data, sizeof(data)), EDD_Crc8ComputeInternal(EDD_CRC8_INIT, data, (uint32_t)sizeof(data)));
+}
+
+/**
+ * @test Test continuation from a running CRC
+ * @brief Verify that splitting a buffer at any position gives the same CRC as one call
+ */
+void test_EDD_Crc8ComputeInternal_ContinueFromCrc(void) {
+  uint8_t data[40];
+  uint8_t crc;
+  uint32_t split;
+  uint32_t i;
+
+  for(i = 0u; i < sizeof(data); i++) { data[i] = (uint8_t)((i * 53u) + 7u); }
+
+  for(split = 1u; split < sizeof(data); split++) {
+    crc = EDD_Crc8ComputeInternal(EDD_CRC8_INIT, data, split);
+    crc = EDD_Crc8ComputeInternal(crc, &data[split], (uint32_t)sizeof(data) - split);
+    TEST_ASSERT_EQUAL_HEX8(referenceCrc8(data, sizeof(data)), crc);
+  }
+}
@@ -0,0 +1,11 @@
+#include "EDD_Crc8ComputeTable.h"
+
+/* FUNCTION TO TEST */
+
+uint8_t EDD_Crc8ComputeTable(const uint8_t table[256], uint8_t crc, const uint8_t *data, uint32_t length) {
+  uint32_t i;
+
+  for(i = 0u; i < length; i++) { crc = table[crc ^ data[i]]; }
+
+  return crc;
+}
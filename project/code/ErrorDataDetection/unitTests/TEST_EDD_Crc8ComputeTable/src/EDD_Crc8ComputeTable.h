@@ -0,0 +1,9 @@
+#ifndef EDD_Crc8ComputeTable_H
+#define EDD_Crc8ComputeTable_H
+
+#include "errorDataDetection_priv.h"
+#include <stdint.h>
+
+uint8_t EDD_Crc8ComputeTable(const uint8_t table[256], uint8_t crc, const uint8_t *data, uint32_t length);
+
+#endif
@@ -0,0 +1,80 @@
+#include "EDD_Crc8ComputeTable.h"
+#include "unity.h"
+
+/**
+ * @file test_EDD_Crc8ComputeTable.c
+ * @brief Unit tests for EDD_Crc8ComputeTable function
+ * @details Checks the compile-time generated CRC-8 SAE J1850 and CRC-8H2F tables against published check values
+ */
+
+/* Setup and teardown functions */
+void setUp(void) { /* Setup code if needed */ }
+
+void tearDown(void) { /* Teardown code if needed */ }
+
+/**
+ * @test Test generated table entries
+ * @brief Verify that entry 1 equals the polynomial and entry 0 is zero
+ */
+void test_EDD_Crc8ComputeTable_GeneratedEntries(void) {
+  TEST_ASSERT_EQUAL_HEX8(0x00, EDD_Crc8SaeJ1850Table[0]);
+  TEST_ASSERT_EQUAL_HEX8(EDD_CRC8_SAE_J1850_POLY, EDD_Crc8SaeJ1850Table[1]);
+  TEST_ASSERT_EQUAL_HEX8(0x00, EDD_Crc8H2FTable[0]);
+  TEST_ASSERT_EQUAL_HEX8(EDD_CRC8H2F_POLY, EDD_Crc8H2FTable[1]);
+}
+
+/**
+ * @test Test with empty buffer
+ * @brief Verify that the start value is returned unchanged
+ */
+void test_EDD_Crc8ComputeTable_EmptyBuffer(void) {
+  uint8_t data[] = {0x00};
+
+  TEST_ASSERT_EQUAL_HEX8(0xA5, EDD_Crc8ComputeTable(EDD_Crc8SaeJ1850Table, 0xA5, data, 0));
+}
+
+/**
+ * @test Test CRC-8 SAE J1850 check value
+ * @brief Verify CRC of "123456789" is 0x4B
+ */
+void test_EDD_Crc8ComputeTable_SaeJ1850CheckValue(void) {
+  const uint8_t data[] = {'1', '2', '3', '4', '5', '6', '7', '8', '9'};
+  uint8_t crc = EDD_Crc8ComputeTable(EDD_Crc8SaeJ1850Table, EDD_CRC8_SAE_J1850_INIT, data, 9u);
+
+  TEST_ASSERT_EQUAL_HEX8(0x4B, crc ^ EDD_CRC8_SAE_J1850_XOROUT);
+}
+
+/**
+ * @test Test CRC-8 SAE J1850 on AUTOSAR reference data
+ * @brief Verify CRC of 00 00 00 00 is 0x59 and of F2 01 83 is 0x37
+ */
+void test_EDD_Crc8ComputeTable_SaeJ1850Reference(void) {
+  const uint8_t zeros[] = {0x00, 0x00, 0x00, 0x00};
+  const uint8_t data[] = {0xF2, 0x01, 0x83};
+
+  TEST_ASSERT_EQUAL_HEX8(0x59, EDD_Crc8ComputeTable(EDD_Crc8SaeJ1850Table, EDD_CRC8_SAE_J1850_INIT, zeros, 4u) ^ EDD_CRC8_SAE_J1850_XOROUT);
+  TEST_ASSERT_EQUAL_HEX8(0x37, EDD_Crc8ComputeTable(EDD_Crc8SaeJ1850Table, EDD_CRC8_SAE_J1850_INIT, data, 3u) ^ EDD_CRC8_SAE_J1850_XOROUT);
+}
+
+/**
+ * @test Test CRC-8H2F check value
+ * @brief Verify CRC of "123456789" is 0xDF
+ */
+void test_EDD_Crc8ComputeTable_H2FCheckValue(void) {
+  const uint8_t data[] = {'1', '2', '3', '4', '5', '6', '7', '8', '9'};
+  uint8_t crc = EDD_Crc8ComputeTable(EDD_Crc8H2FTable, EDD_CRC8H2F_INIT, data, 9u);
+
+  TEST_ASSERT_EQUAL_HEX8(0xDF, crc ^ EDD_CRC8H2F_XOROUT);
+}
+
+/**
+ * @test Test CRC-8H2F on AUTOSAR reference data
+ * @brief Verify CRC of 00 00 00 00 is 0x12 and of F2 01 83 is 0xC2
+ */
+void test_EDD_Crc8ComputeTable_H2FReference(void) {
+  const uint8_t zeros[] = {0x00, 0x00, 0x00, 0x00};
+  const uint8_t data[] = {0xF2, 0x01, 0x83};
+
+  TEST_ASSERT_EQUAL_HEX8(0x12, EDD_Crc8ComputeTable(EDD_Crc8H2FTable, EDD_CRC8H2F_INIT, zeros, 4u) ^ EDD_CRC8H2F_XOROUT);
+  TEST_ASSERT_EQUAL_HEX8(0xC2, EDD_Crc8ComputeTable(EDD_Crc8H2FTable, EDD_CRC8H2F_INIT, data, 3u) ^ EDD_CRC8H2F_XOROUT);
+}
@@ -0,0 +1,12 @@
+#include "EDD_Crc8CtxUpdate.h"
+#include "errorDataDetection_priv.h"
+
+/* FUNCTION TO TEST */
+
+EDD_ReturnType EDD_Crc8CtxUpdate(EDD_Crc8Ctx *ctx, const uint8_t *data, uint32_t length) {
+  if((ctx == NULL) || (data == NULL)) { return EDD_NULL_PTR; }
+
+  if(length > 0u) { ctx->crc = EDD_Crc8ComputeInternal(ctx->crc, data, length); }
+
+  return EDD_OK;
+}
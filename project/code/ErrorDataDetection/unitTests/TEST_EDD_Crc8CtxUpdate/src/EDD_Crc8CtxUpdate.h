@@ -0,0 +1,9 @@
+#ifndef EDD_Crc8CtxUpdate_H
+#define EDD_Crc8CtxUpdate_H
+
+#include "errorDataDetection.h"
+#include <stdint.h>
+
+EDD_ReturnType EDD_Crc8CtxUpdate(EDD_Crc8Ctx *ctx, const uint8_t *data, uint32_t length);
+
+#endif
\ No newline at end of file
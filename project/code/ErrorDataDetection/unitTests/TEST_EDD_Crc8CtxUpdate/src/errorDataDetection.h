@@ -0,0 +1,684 @@
+#ifndef ERRORDATADETECTION_H
+#define ERRORDATADETECTION_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "errorDataDetection_cfg.h"
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @file errorDataDetection.h
+ * @brief Error Data Detection module public interface.
+ *
+ * @details
+ * This module provides CRC-8 computation and verification services for embedded
+ * applications. The CRC is computed using a static lookup table (256 entries),
+ * ensuring optimized runtime performance compared to bitwise CRC computation.
+ * Optionally (see `EDD_CRC8_SLICING_FACTOR`) the engine consumes 4 or 8 bytes per
+ * iteration through additional slicing tables, with bit-identical results.
+ *
+ * The module is designed to be fully standalone:
+ * - No dynamic memory allocation.
+ * - No dependency on external drivers or OS.
+ * - Suitable for use in safety-related modules and runtime constrained ECU environments.
+ *
+ * The CRC implementation follows the CRC-8/ATM standard:
+ * - Polynomial: 0x07
+ * - Init value: 0x00
+ * - RefIn/RefOut: false
+ * - XOROut: 0x00
+ *
+ * Further CRC variants (CRC-8 SAE J1850, CRC-8H2F, CRC-16-CCITT, CRC-32 and
+ * CRC-32P4) can be enabled individually in `errorDataDetection_cfg.h`. Their
+ * lookup tables are generated at compile time from the polynomial parameters;
+ * disabled variants cost neither code nor table space.
+ */
+
+/* =============================
+ *  Error Codes
+ * ============================= */
+
+/**
+ * @brief Return values used by Error Data Detection APIs.
+ */
+typedef enum {
+  EDD_OK = 0,        /**< Operation completed successfully. */
+  EDD_NULL_PTR,      /**< A required pointer argument was NULL. */
+  EDD_INVALID_LENGTH /**< Provided length was invalid (e.g. 0). */
+} EDD_ReturnType;
+
+/* =============================
+ *  Types
+ * ============================= */
+
+/**
+ * @brief CRC-8 streaming context.
+ *
+ * @details
+ * Holds the running CRC accumulator of a message processed in several chunks.
+ * The content shall only be accessed through the `EDD_Crc8Ctx*` APIs.
+ */
+typedef struct {
+  uint8_t crc; /**< Running CRC-8 accumulator. */
+} EDD_Crc8Ctx;
+
+/**
+ * @brief Frame descriptor for batch CRC-8 verification.
+ */
+typedef struct {
+  const uint8_t *data;  /**< Frame buffer. */
+  uint32_t length;      /**< Frame length in bytes (> 0). */
+  uint8_t expectedCrc;  /**< CRC-8 the frame is verified against. */
+} EDD_Crc8FrameType;
+
+/* =============================
+ *  Public API
+ * ============================= */
+
+/**
+ * @brief Compute CRC-8 (lookup table based) over a given data buffer.
+ *
+ * @details
+ * **Goal of the function**
+ *
+ * The purpose of this function is to compute an 8-bit CRC over a memory buffer
+ * using a precomputed lookup table (static 256-byte table). The lookup table
+ * approach reduces CPU cycles compared to polynomial bitwise computation.
+ *
+ * The processing logic:
+ * - Validates the input pointers (`data`, `crc_out`).
+ * - Validates that `length` is greater than zero.
+ * - Initializes CRC accumulator with CRC init value (0x00).
+ * - If slicing-by-N is configured, for each block of N bytes:
+ *   - Updates CRC with `T(N-1)[crc XOR data[i]] XOR ... XOR T0[data[i+N-1]]`.
+ * - For each remaining byte in the buffer:
+ *   - Computes table index as `crc XOR data[i]`.
+ *   - Updates CRC with `table[index]`.
+ * - Writes final CRC into `*crc_out`.
+ *
+ * @par Interface summary
+ *
+ * | Interface  | In | Out | Data type / Signature        | Param | Data factor | Data offset | Data size | Data range     | Data unit |
+ * |-----------|:--:|:---:|------------------------------|:-----:|------------:|------------:|----------:|----------------|----------|
+ * | data      | X  |     | const uint8_t*               |   -   |      1      |      0      |  length  | [0,255]        | [-]      |
+ * | length    | X  |     | uint32_t                     |   -   |      1      |      0      |     -    | [1..2^32-1]    | bytes    |
+ * | crc_out   | X  |  X  | uint8_t*                     |   -   |      1      |      0      |     1    | [0,255]        | [-]      |
+ *
+ * @par Activity diagram (PlantUML)
+ *
+ * @startuml
+ * start
+ * :Validate pointers;
+ * if (data == NULL OR crc_out == NULL) then (YES)
+ *   :return EDD_NULL_PTR;
+ *   stop
+ * endif
+ * :Validate length;
+ * if (length == 0) then (YES)
+ *   :return EDD_INVALID_LENGTH;
+ *   stop
+ * endif
+ * :crc = 0x00;
+ * while (length - i >= N) is (slicing-by-N)
+ *   :crc = T(N-1)[crc XOR data[i]] XOR ... XOR T0[data[i+N-1]];
+ *   :i = i + N;
+ * endwhile
+ * while (i < length)
+ *   :crc = Table[crc XOR data[i]];
+ * endwhile
+ * :*crc_out = crc;
+ * :return EDD_OK;
+ * stop
+ * @enduml
+ *
+ * @return EDD_ReturnType
+ * - EDD_OK if CRC was computed successfully.
+ * - EDD_NULL_PTR if any input pointer is NULL.
+ * - EDD_INVALID_LENGTH if length is 0.
+ */
+EDD_ReturnType EDD_CalcCrc8(const uint8_t *data, uint32_t length, uint8_t *crc_out);
+
+/**
+ * @brief Verify that a buffer CRC matches an expected CRC.
+ *
+ * @details
+ * **Goal of the function**
+ *
+ * The purpose of this function is to validate integrity of a received buffer
+ * by computing the CRC-8 over the buffer and comparing it against the provided
+ * `expected_crc`.
+ *
+ * The processing logic:
+ * - Validates pointer arguments (`data`, `result_out`).
+ * - Validates that `length` is greater than zero.
+ * - Computes CRC-8 over the buffer (table based).
+ * - Compares computed CRC with `expected_crc`.
+ * - Writes the verification result:
+ *   - `*result_out = 1` if CRC matches.
+ *   - `*result_out = 0` otherwise.
+ *
+ * @par Interface summary
+ *
+ * | Interface      | In | Out | Data type / Signature  | Param | Data factor | Data offset | Data size | Data range        | Data unit |
+ * |---------------|:--:|:---:|------------------------|:-----:|------------:|------------:|----------:|-------------------|----------|
+ * | data          | X  |     | const uint8_t*         |   -   |      1      |      0      |  length  | [0,255]           | [-]      |
+ * | length        | X  |     | uint32_t               |   -   |      1      |      0      |     -    | [1..2^32-1]       | bytes    |
+ * | expected_crc  | X  |     | uint8_t                |   -   |      1      |      0      |     1    | [0,255]           | [-]      |
+ * | result_out    | X  |  X  | uint8_t*               |   -   |      1      |      0      |     1    | {0,1}             | [-]      |
+ *
+ * @par Activity diagram (PlantUML)
+ *
+ * @startuml
+ * start
+ * :Validate pointers;
+ * if (data == NULL OR result_out == NULL) then (YES)
+ *   :return EDD_NULL_PTR;
+ *   stop
+ * endif
+ * :Validate length;
+ * if (length == 0) then (YES)
+ *   :return EDD_INVALID_LENGTH;
+ *   stop
+ * endif
+ * :computed = CalcCrc8(data, length);
+ * if (computed == expected_crc) then (YES)
+ *   :*result_out = 1;
+ * else (NO)
+ *   :*result_out = 0;
+ * endif
+ * :return EDD_OK;
+ * stop
+ * @enduml
+ *
+ * @return EDD_ReturnType
+ * - EDD_OK if verification executed successfully.
+ * - EDD_NULL_PTR if any required pointer is NULL.
+ * - EDD_INVALID_LENGTH if length is 0.
+ */
+EDD_ReturnType EDD_VerifyCrc8(const uint8_t *data, uint32_t length, uint8_t expected_crc, uint8_t *result_out);
+
+/**
+ * @brief Verify the CRC-8 of an array of frames in one call.
+ *
+ * @details
+ * **Goal of the function**
+ *
+ * The purpose of this function is to validate many (typically short) frames
+ * per call. Frames are processed in groups of `EDD_CRC8_BATCH_STREAMS`; within a
+ * group the CRC-8 computations are interleaved byte by byte, so the table
+ * lookups of the different frames overlap instead of serializing on the
+ * load-use latency of a single CRC chain.
+ *
+ * The processing logic:
+ * - Validates `frames` and `result_bitmap` pointers.
+ * - Validates every descriptor (`data` not NULL, `length` > 0) before any CRC is computed.
+ * - Clears the result bitmap (`(count + 7) / 8` bytes).
+ * - For each full group of `EDD_CRC8_BATCH_STREAMS` frames:
+ *   - Computes the CRCs of the group interleaved.
+ * - Computes the CRCs of the remaining frames one after the other.
+ * - Sets bit `i % 8` of `result_bitmap[i / 8]` when frame `i` matches its expected CRC.
+ *
+ * @par Interface summary
+ *
+ * | Interface      | In | Out | Data type / Signature     | Param | Data factor | Data offset | Data size        | Data range | Data unit |
+ * |---------------|:--:|:---:|---------------------------|:-----:|------------:|------------:|-----------------:|-----------|----------|
+ * | frames        | X  |     | const EDD_Crc8FrameType*  |   -   |      1      |      0      | count            | -         | [-]      |
+ * | count         | X  |     | uint16_t                  |   -   |      1      |      0      |     -            | [0..65535]| frames   |
+ * | result_bitmap | X  |  X  | uint8_t*                  |   -   |      1      |      0      | (count + 7) / 8  | [0,255]   | [-]      |
+ *
+ * @par Activity diagram (PlantUML)
+ *
+ * @startuml
+ * start
+ * if (frames == NULL OR result_bitmap == NULL) then (YES)
+ *   :return EDD_NULL_PTR;
+ *   stop
+ * endif
+ * while (for each frame)
+ *   if (data == NULL) then (YES)
+ *     :return EDD_NULL_PTR;
+ *     stop
+ *   elseif (length == 0) then (YES)
+ *     :return EDD_INVALID_LENGTH;
+ *     stop
+ *   endif
+ * endwhile
+ * :clear result_bitmap;
+ * while (full group of N frames left)
+ *   :compute N CRCs interleaved;
+ * endwhile
+ * while (frames left)
+ *   :compute CRC;
+ * endwhile
+ * :set bit i when CRC(i) == expectedCrc(i);
+ * :return EDD_OK;
+ * stop
+ * @enduml
+ *
+ * @return EDD_ReturnType
+ * - EDD_OK if all frames were verified (results in `result_bitmap`).
+ * - EDD_NULL_PTR if a required pointer (including a frame buffer) is NULL.
+ * - EDD_INVALID_LENGTH if a frame has length 0.
+ */
+EDD_ReturnType EDD_VerifyCrc8Batch(const EDD_Crc8FrameType *frames, uint16_t count, uint8_t *result_bitmap);
+
+/**
+ * @brief Update CRC-8 accumulator with a new byte (streaming support).
+ *
+ * @details
+ * **Goal of the function**
+ *
+ * The purpose of this function is to allow incremental CRC computation for
+ * streaming scenarios (e.g., CRC over a frame received byte-by-byte).
+ * Data received in chunks should be fed through @ref EDD_Crc8CtxUpdate instead.
+ *
+ * The processing logic:
+ * - Validates input pointer (`crc_in_out`).
+ * - Computes table index as `(*crc_in_out) XOR byte`.
+ * - Updates CRC accumulator with `table[index]`.
+ *
+ * @par Interface summary
+ *
+ * | Interface     | In | Out | Data type / Signature | Param | Data factor | Data offset | Data size | Data range | Data unit |
+ * |--------------|:--:|:---:|-----------------------|:-----:|------------:|------------:|----------:|-----------|----------|
+ * | crc_in_out   | X  |  X  | uint8_t*              |   -   |      1      |      0      |     1    | [0,255]   | [-]      |
+ * | byte         | X  |     | uint8_t               |   -   |      1      |      0      |     1    | [0,255]   | [-]      |
+ *
+ * @par Activity diagram (PlantUML)
+ *
+ * @startuml
+ * start
+ * :Validate crc_in_out pointer;
+ * if (crc_in_out == NULL) then (YES)
+ *   :return EDD_NULL_PTR;
+ *   stop
+ * endif
+ * :idx = (*crc_in_out) XOR byte;
+ * :*crc_in_out = Table[idx];
+ * :return EDD_OK;
+ * stop
+ * @enduml
+ *
+ * @return EDD_ReturnType
+ * - EDD_OK if update executed successfully.
+ * - EDD_NULL_PTR if crc_in_out is NULL.
+ */
+EDD_ReturnType EDD_Crc8Update(uint8_t *crc_in_out, uint8_t byte);
+
+/**
+ * @brief Initialize a CRC-8 streaming context.
+ *
+ * @details
+ * **Goal of the function**
+ *
+ * The purpose of this function is to start a new CRC-8 computation over a
+ * message delivered in several chunks (e.g. DMA blocks of a LIN frame).
+ *
+ * The processing logic:
+ * - Validates input pointer (`ctx`).
+ * - Sets the context accumulator to the CRC init value (0x00).
+ *
+ * @par Interface summary
+ *
+ * | Interface | In | Out | Data type / Signature | Param | Data factor | Data offset | Data size | Data range | Data unit |
+ * |----------|:--:|:---:|-----------------------|:-----:|------------:|------------:|----------:|-----------|----------|
+ * | ctx      |    |  X  | EDD_Crc8Ctx*          |   -   |      1      |      0      |     1    | -         | [-]      |
+ *
+ * @par Activity diagram (PlantUML)
+ *
+ * @startuml
+ * start
+ * :Validate ctx pointer;
+ * if (ctx == NULL) then (YES)
+ *   :return EDD_NULL_PTR;
+ *   stop
+ * endif
+ * :ctx->crc = 0x00;
+ * :return EDD_OK;
+ * stop
+ * @enduml
+ *
+ * @return EDD_ReturnType
+ * - EDD_OK if the context was initialized.
+ * - EDD_NULL_PTR if ctx is NULL.
+ */
+EDD_ReturnType EDD_Crc8CtxInit(EDD_Crc8Ctx *ctx);
+
+/**
+ * @brief Read the CRC-8 of all data fed into a streaming context.
+ *
+ * @details
+ * **Goal of the function**
+ *
+ * The purpose of this function is to return the CRC-8 of the message fed so far.
+ * The context is not modified and can be updated further afterwards.
+ *
+ * The processing logic:
+ * - Validates input pointers (`ctx`, `crc_out`).
+ * - Writes the context accumulator into `*crc_out` (CRC-8/ATM has XOROut 0x00).
+ *
+ * @par Interface summary
+ *
+ * | Interface | In | Out | Data type / Signature | Param | Data factor | Data offset | Data size | Data range | Data unit |
+ * |----------|:--:|:---:|-----------------------|:-----:|------------:|------------:|----------:|-----------|----------|
+ * | ctx      | X  |     | const EDD_Crc8Ctx*    |   -   |      1      |      0      |     1    | -         | [-]      |
+ * | crc_out  | X  |  X  | uint8_t*              |   -   |      1      |      0      |     1    | [0,255]   | [-]      |
+ *
+ * @par Activity diagram (PlantUML)
+ *
+ * @startuml
+ * start
+ * :Validate pointers;
+ * if (ctx == NULL OR crc_out == NULL) then (YES)
+ *   :return EDD_NULL_PTR;
+ *   stop
+ * endif
+ * :*crc_out = ctx->crc;
+ * :return EDD_OK;
+ * stop
+ * @enduml
+ *
+ * @return EDD_ReturnType
+ * - EDD_OK if the CRC was written.
+ * - EDD_NULL_PTR if any input pointer is NULL.
+ */
+EDD_ReturnType EDD_Crc8CtxFinal(const EDD_Crc8Ctx *ctx, uint8_t *crc_out);
+
+#if(EDD_CRC8_SAE_J1850_SUPPORT == 1u)
+/**
+ * @brief Compute CRC-8 SAE J1850 over a given data buffer.
+ *
+ * @details
+ * **Goal of the function**
+ *
+ * The purpose of this function is to compute the CRC-8 SAE J1850 checksum (poly 0x1D, init 0xFF, XOROut 0xFF, check 0x4B)
+ * over a memory buffer using a 256-entry lookup table generated at compile time
+ * from the polynomial. Available when `EDD_CRC8_SAE_J1850_SUPPORT` is enabled.
+ *
+ * The processing logic:
+ * - Validates the input pointers (`data`, `crc_out`).
+ * - Validates that `length` is greater than zero.
+ * - Initializes CRC accumulator with 0xFF.
+ * - For each byte in the buffer:
+ *   - Updates CRC with `Table[crc XOR data[i]]`.
+ * - Writes `crc XOR 0xFF` into `*crc_out`.
+ *
+ * @par Interface summary
+ *
+ * | Interface  | In | Out | Data type / Signature        | Param | Data factor | Data offset | Data size | Data range     | Data unit |
+ * |-----------|:--:|:---:|------------------------------|:-----:|------------:|------------:|----------:|----------------|----------|
+ * | data      | X  |     | const uint8_t*               |   -   |      1      |      0      |  length  | [0,255]        | [-]      |
+ * | length    | X  |     | uint32_t                     |   -   |      1      |      0      |     -    | [1..2^32-1]    | bytes    |
+ * | crc_out   | X  |  X  | uint8_t*                     |   -   |      1      |      0      |     1    | [0,255]        | [-]      |
+ *
+ * @par Activity diagram (PlantUML)
+ *
+ * @startuml
+ * start
+ * :Validate pointers;
+ * if (data == NULL OR crc_out == NULL) then (YES)
+ *   :return EDD_NULL_PTR;
+ *   stop
+ * endif
+ * :Validate length;
+ * if (length == 0) then (YES)
+ *   :return EDD_INVALID_LENGTH;
+ *   stop
+ * endif
+ * :crc = 0xFF;
+ * while (i < length)
+ *   :crc = TableJ1850[crc XOR data[i]];
+ * endwhile
+ * :*crc_out = crc XOR 0xFF;
+ * :return EDD_OK;
+ * stop
+ * @enduml
+ *
+ * @return EDD_ReturnType
+ * - EDD_OK if CRC was computed successfully.
+ * - EDD_NULL_PTR if any input pointer is NULL.
+ * - EDD_INVALID_LENGTH if length is 0.
+ */
+EDD_ReturnType EDD_CalcCrc8SaeJ1850(const uint8_t *data, uint32_t length, uint8_t *crc_out);
+#endif
+
+#if(EDD_CRC8H2F_SUPPORT == 1u)
+/**
+ * @brief Compute CRC-8H2F over a given data buffer.
+ *
+ * @details
+ * **Goal of the function**
+ *
+ * The purpose of this function is to compute the CRC-8H2F checksum (poly 0x2F, init 0xFF, XOROut 0xFF, check 0xDF)
+ * over a memory buffer using a 256-entry lookup table generated at compile time
+ * from the polynomial. Available when `EDD_CRC8H2F_SUPPORT` is enabled.
+ *
+ * The processing logic:
+ * - Validates the input pointers (`data`, `crc_out`).
+ * - Validates that `length` is greater than zero.
+ * - Initializes CRC accumulator with 0xFF.
+ * - For each byte in the buffer:
+ *   - Updates CRC with `Table[crc XOR data[i]]`.
+ * - Writes `crc XOR 0xFF` into `*crc_out`.
+ *
+ * @par Interface summary
+ *
+ * | Interface  | In | Out | Data type / Signature        | Param | Data factor | Data offset | Data size | Data range     | Data unit |
+ * |-----------|:--:|:---:|------------------------------|:-----:|------------:|------------:|----------:|----------------|----------|
+ * | data      | X  |     | const uint8_t*               |   -   |      1      |      0      |  length  | [0,255]        | [-]      |
+ * | length    | X  |     | uint32_t                     |   -   |      1      |      0      |     -    | [1..2^32-1]    | bytes    |
+ * | crc_out   | X  |  X  | uint8_t*                     |   -   |      1      |      0      |     1    | [0,255]        | [-]      |
+ *
+ * @par Activity diagram (PlantUML)
+ *
+ * @startuml
+ * start
+ * :Validate pointers;
+ * if (data == NULL OR crc_out == NULL) then (YES)
+ *   :return EDD_NULL_PTR;
+ *   stop
+ * endif
+ * :Validate length;
+ * if (length == 0) then (YES)
+ *   :return EDD_INVALID_LENGTH;
+ *   stop
+ * endif
+ * :crc = 0xFF;
+ * while (i < length)
+ *   :crc = TableH2F[crc XOR data[i]];
+ * endwhile
+ * :*crc_out = crc XOR 0xFF;
+ * :return EDD_OK;
+ * stop
+ * @enduml
+ *
+ * @return EDD_ReturnType
+ * - EDD_OK if CRC was computed successfully.
+ * - EDD_NULL_PTR if any input pointer is NULL.
+ * - EDD_INVALID_LENGTH if length is 0.
+ */
+EDD_ReturnType EDD_CalcCrc8H2F(const uint8_t *data, uint32_t length, uint8_t *crc_out);
+#endif
+
+#if(EDD_CRC16_SUPPORT == 1u)
+/**
+ * @brief Compute CRC-16-CCITT over a given data buffer.
+ *
+ * @details
+ * **Goal of the function**
+ *
+ * The purpose of this function is to compute the CRC-16-CCITT checksum (poly 0x1021, init 0xFFFF, not reflected, XOROut 0x0000, check 0x29B1)
+ * over a memory buffer using a 256-entry lookup table generated at compile time
+ * from the polynomial. Available when `EDD_CRC16_SUPPORT` is enabled.
+ *
+ * The processing logic:
+ * - Validates the input pointers (`data`, `crc_out`).
+ * - Validates that `length` is greater than zero.
+ * - Initializes CRC accumulator with 0xFFFF.
+ * - For each byte in the buffer:
+ *   - Updates CRC with `(crc << 8) XOR Table[(crc >> 8) XOR data[i]]`.
+ * - Writes `crc` into `*crc_out`.
+ *
+ * @par Interface summary
+ *
+ * | Interface  | In | Out | Data type / Signature        | Param | Data factor | Data offset | Data size | Data range     | Data unit |
+ * |-----------|:--:|:---:|------------------------------|:-----:|------------:|------------:|----------:|----------------|----------|
+ * | data      | X  |     | const uint8_t*               |   -   |      1      |      0      |  length  | [0,255]        | [-]      |
+ * | length    | X  |     | uint32_t                     |   -   |      1      |      0      |     -    | [1..2^32-1]    | bytes    |
+ * | crc_out   | X  |  X  | uint16_t*                    |   -   |      1      |      0      |     1    | [0,65535]      | [-]      |
+ *
+ * @par Activity diagram (PlantUML)
+ *
+ * @startuml
+ * start
+ * :Validate pointers;
+ * if (data == NULL OR crc_out == NULL) then (YES)
+ *   :return EDD_NULL_PTR;
+ *   stop
+ * endif
+ * :Validate length;
+ * if (length == 0) then (YES)
+ *   :return EDD_INVALID_LENGTH;
+ *   stop
+ * endif
+ * :crc = 0xFFFF;
+ * while (i < length)
+ *   :crc = (crc << 8) XOR Table16[(crc >> 8) XOR data[i]];
+ * endwhile
+ * :*crc_out = crc;
+ * :return EDD_OK;
+ * stop
+ * @enduml
+ *
+ * @return EDD_ReturnType
+ * - EDD_OK if CRC was computed successfully.
+ * - EDD_NULL_PTR if any input pointer is NULL.
+ * - EDD_INVALID_LENGTH if length is 0.
+ */
+EDD_ReturnType EDD_CalcCrc16(const uint8_t *data, uint32_t length, uint16_t *crc_out);
+#endif
+
+#if(EDD_CRC32_SUPPORT == 1u)
+/**
+ * @brief Compute CRC-32 over a given data buffer.
+ *
+ * @details
+ * **Goal of the function**
+ *
+ * The purpose of this function is to compute the CRC-32 checksum (IEEE 802.3, poly 0x04C11DB7 reflected, init and XOROut 0xFFFFFFFF, check 0xCBF43926)
+ * over a memory buffer using a 256-entry lookup table generated at compile time
+ * from the polynomial. Available when `EDD_CRC32_SUPPORT` is enabled.
+ *
+ * The processing logic:
+ * - Validates the input pointers (`data`, `crc_out`).
+ * - Validates that `length` is greater than zero.
+ * - Initializes CRC accumulator with 0xFFFFFFFF.
+ * - For each byte in the buffer:
+ *   - Updates CRC with `(crc >> 8) XOR Table[(crc XOR data[i]) AND 0xFF]`.
+ * - Writes `crc XOR 0xFFFFFFFF` into `*crc_out`.
+ *
+ * @par Interface summary
+ *
+ * | Interface  | In | Out | Data type / Signature        | Param | Data factor | Data offset | Data size | Data range     | Data unit |
+ * |-----------|:--:|:---:|------------------------------|:-----:|------------:|------------:|----------:|----------------|----------|
+ * | data      | X  |     | const uint8_t*               |   -   |      1      |      0      |  length  | [0,255]        | [-]      |
+ * | length    | X  |     | uint32_t                     |   -   |      1      |      0      |     -    | [1..2^32-1]    | bytes    |
+ * | crc_out   | X  |  X  | uint32_t*                    |   -   |      1      |      0      |     1    | [0,2^32-1]     | [-]      |
+ *
+ * @par Activity diagram (PlantUML)
+ *
+ * @startuml
+ * start
+ * :Validate pointers;
+ * if (data == NULL OR crc_out == NULL) then (YES)
+ *   :return EDD_NULL_PTR;
+ *   stop
+ * endif
+ * :Validate length;
+ * if (length == 0) then (YES)
+ *   :return EDD_INVALID_LENGTH;
+ *   stop
+ * endif
+ * :crc = 0xFFFFFFFF;
+ * while (i < length)
+ *   :crc = (crc >> 8) XOR Table32[(crc XOR data[i]) AND 0xFF];
+ * endwhile
+ * :*crc_out = crc XOR 0xFFFFFFFF;
+ * :return EDD_OK;
+ * stop
+ * @enduml
+ *
+ * @return EDD_ReturnType
+ * - EDD_OK if CRC was computed successfully.
+ * - EDD_NULL_PTR if any input pointer is NULL.
+ * - EDD_INVALID_LENGTH if length is 0.
+ */
+EDD_ReturnType EDD_CalcCrc32(const uint8_t *data, uint32_t length, uint32_t *crc_out);
+#endif
+
+#if(EDD_CRC32P4_SUPPORT == 1u)
+/**
+ * @brief Compute CRC-32P4 over a given data buffer.
+ *
+ * @details
+ * **Goal of the function**
+ *
+ * The purpose of this function is to compute the CRC-32P4 checksum (AUTOSAR E2E Profile 4, poly 0xF4ACFB13 reflected, init and XOROut 0xFFFFFFFF, check 0x1697D06A)
+ * over a memory buffer using a 256-entry lookup table generated at compile time
+ * from the polynomial. Available when `EDD_CRC32P4_SUPPORT` is enabled.
+ *
+ * The processing logic:
+ * - Validates the input pointers (`data`, `crc_out`).
+ * - Validates that `length` is greater than zero.
+ * - Initializes CRC accumulator with 0xFFFFFFFF.
+ * - For each byte in the buffer:
+ *   - Updates CRC with `(crc >> 8) XOR Table[(crc XOR data[i]) AND 0xFF]`.
+ * - Writes `crc XOR 0xFFFFFFFF` into `*crc_out`.
+ *
+ * @par Interface summary
+ *
+ * | Interface  | In | Out | Data type / Signature        | Param | Data factor | Data offset | Data size | Data range     | Data unit |
+ * |-----------|:--:|:---:|------------------------------|:-----:|------------:|------------:|----------:|----------------|----------|
+ * | data      | X  |     | const uint8_t*               |   -   |      1      |      0      |  length  | [0,255]        | [-]      |
+ * | length    | X  |     | uint32_t                     |   -   |      1      |      0      |     -    | [1..2^32-1]    | bytes    |
+ * | crc_out   | X  |  X  | uint32_t*                    |   -   |      1      |      0      |     1    | [0,2^32-1]     | [-]      |
+ *
+ * @par Activity diagram (PlantUML)
+ *
+ * @startuml
+ * start
+ * :Validate pointers;
+ * if (data == NULL OR crc_out == NULL) then (YES)
+ *   :return EDD_NULL_PTR;
+ *   stop
+ * endif
+ * :Validate length;
+ * if (length == 0) then (YES)
+ *   :return EDD_INVALID_LENGTH;
+ *   stop
+ * endif
+ * :crc = 0xFFFFFFFF;
+ * while (i < length)
+ *   :crc = (crc >> 8) XOR Table32P4[(crc XOR data[i]) AND 0xFF];
+ * endwhile
+ * :*crc_out = crc XOR 0xFFFFFFFF;
+ * :return EDD_OK;
+ * stop
+ * @enduml
+ *
+ * @return EDD_ReturnType
+ * - EDD_OK if CRC was computed successfully.
+ * - EDD_NULL_PTR if any input pointer is NULL.
+ * - EDD_INVALID_LENGTH if length is 0.
+ */
+EDD_ReturnType EDD_CalcCrc32P4(const uint8_t *data, uint32_t length, uint32_t *crc_out);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ERRORDATADETECTION_H */
@@ -0,0 +1,109 @@
+#include "EDD_Crc8CtxUpdate.h"
+#include "mock_errorDataDetection_priv.h"
+#include "unity.h"
+
+/**
+ * @file test_EDD_Crc8CtxUpdate.c
+ * @brief Unit tests for EDD_Crc8CtxUpdate function
+ * @details Tests the chunked CRC-8 streaming update including error handling and accumulator chaining
+ */
+
+/* Setup and teardown functions */
+void setUp(void) { /* Setup code if needed */ }
+
+void tearDown(void) { /* Teardown code if needed */ }
+
+/* =============================
+ *  Test Cases
+ * ============================= */
+
+/**
+ * @brief Test: NULL context pointer should return EDD_NULL_PTR
+ */
+void test_EDD_Crc8CtxUpdate_NullContextPointer(void) {
+  uint8_t data[] = {0x01, 0x02, 0x03};
+  EDD_ReturnType ret;
+
+  ret = EDD_Crc8CtxUpdate(NULL, data, 3);
+
+  TEST_ASSERT_EQUAL(EDD_NULL_PTR, ret);
+}
+
+/**
+ * @brief Test: NULL data pointer should return EDD_NULL_PTR and keep the accumulator
+ */
+void test_EDD_Crc8CtxUpdate_NullDataPointer(void) {
+  EDD_Crc8Ctx ctx = {0x5A};
+  EDD_ReturnType ret;
+
+  ret = EDD_Crc8CtxUpdate(&ctx, NULL, 3);
+
+  TEST_ASSERT_EQUAL(EDD_NULL_PTR, ret);
+  TEST_ASSERT_EQUAL_HEX8(0x5A, ctx.crc);
+}
+
+/**
+ * @brief Test: Empty chunk should return EDD_OK without touching the accumulator
+ */
+void test_EDD_Crc8CtxUpdate_ZeroLength(void) {
+  uint8_t data[] = {0x01};
+  EDD_Crc8Ctx ctx = {0x5A};
+  EDD_ReturnType ret;
+
+  ret = EDD_Crc8CtxUpdate(&ctx, data, 0);
+
+  TEST_ASSERT_EQUAL(EDD_OK, ret);
+  TEST_ASSERT_EQUAL_HEX8(0x5A, ctx.crc);
+}
+
+/**
+ * @brief Test: First chunk continues from the init value and stores the result
+ */
+void test_EDD_Crc8CtxUpdate_FirstChunk(void) {
+  uint8_t data[] = {0x01, 0x02, 0x03, 0x04};
+  EDD_Crc8Ctx ctx = {EDD_CRC8_INIT};
+  EDD_ReturnType ret;
+
+  EDD_Crc8ComputeInternal_ExpectAndReturn(EDD_CRC8_INIT, data, 4, 0xA5);
+
+  ret = EDD_Crc8CtxUpdate(&ctx, data, 4);
+
+  TEST_ASSERT_EQUAL(EDD_OK, ret);
+  TEST_ASSERT_EQUAL_HEX8(0xA5, ctx.crc);
+}
+
+/**
+ * @brief Test: Consecutive chunks are chained through the context accumulator
+ */
+void test_EDD_Crc8CtxUpdate_ChainedChunks(void) {
+  uint8_t data[] = {0x10, 0x20, 0x30, 0x40, 0x50, 0x60};
+  EDD_Crc8Ctx ctx = {EDD_CRC8_INIT};
+  EDD_ReturnType ret;
+
+  EDD_Crc8ComputeInternal_ExpectAndReturn(EDD_CRC8_INIT, data, 2, 0x3C);
+  EDD_Crc8ComputeInternal_ExpectAndReturn(0x3C, &data[2], 4, 0xC3);
+
+  ret = EDD_Crc8CtxUpdate(&ctx, data, 2);
+  TEST_ASSERT_EQUAL(EDD_OK, ret);
+
+  ret = EDD_Crc8CtxUpdate(&ctx, &data[2], 4);
+  TEST_ASSERT_EQUAL(EDD_OK, ret);
+
+  TEST_ASSERT_EQUAL_HEX8(0xC3, ctx.crc);
+}
+
+/**
+ * @brief Test: Large DMA-sized chunk is passed in a single call
+ */
+void test_EDD_Crc8CtxUpdate_LargeChunk(void) {
+  static uint8_t data[1024];
+  EDD_Crc8Ctx ctx = {0x11};
+  EDD_ReturnType ret;
+
+  EDD_Crc8ComputeInternal_ExpectAndReturn(0x11, data, 1024, 0x22);
+
+  ret = EDD_Crc8CtxUpdate(&ctx, data, 1024);
+
+  TEST_ASSERT_EQUAL(EDD_OK, ret);
+  TEST_ASSERT_EQUAL_HEX8(0x22, ctx.crc);
+}
@@ -0,0 +1,5 @@
+#include "EDD_Crc8NibbleStep.h"
+
+/* FUNCTION TO TEST */
+
+uint8_t EDD_Crc8NibbleStep(uint8_t crc) { return (uint8_t)((uint8_t)(crc << 4) ^ EDD_Crc8NibbleTable[crc >> 4]); }
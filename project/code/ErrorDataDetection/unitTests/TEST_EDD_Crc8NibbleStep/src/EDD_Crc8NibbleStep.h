@@ -0,0 +1,10 @@
+#ifndef EDD_Crc8NibbleStep_H
+#define EDD_Crc8NibbleStep_H
+
+#include "errorDataDetection.h"
+#include "errorDataDetection_priv.h"
+#include <stdint.h>
+
+uint8_t EDD_Crc8NibbleStep(uint8_t crc);
+
+#endif
@@ -0,0 +1,59 @@
+#include "EDD_Crc8NibbleStep.h"
+#include "unity.h"
+
+/**
+ * @file test_EDD_Crc8NibbleStep.c
+ * @brief Unit tests for EDD_Crc8NibbleStep function
+ * @details Checks that the nibble table mode gives the same CRC as the bitwise definition
+ */
+
+/* Setup and teardown functions */
+void setUp(void) { /* Setup code if needed */ }
+
+void tearDown(void) { /* Teardown code if needed */ }
+
+/**
+ * @brief Helper: advance the CRC-8/ATM register by one bit
+ */
+static uint8_t referenceBitStep(uint8_t crc) { return ((crc & 0x80u) != 0u) ? (uint8_t)((uint8_t)(crc << 1) ^ 0x07u) : (uint8_t)(crc << 1); }
+
+/**
+ * @test Test one nibble step for every register value
+ * @brief Verify that one step equals four single-bit steps
+ */
+void test_EDD_Crc8NibbleStep_AllRegisterValues(void) {
+  uint16_t value;
+  uint8_t expected;
+  uint8_t bit;
+
+  for(value = 0u; value < 256u; value++) {
+    expected = (uint8_t)value;
+    for(bit = 0u; bit < 4u; bit++) { expected = referenceBitStep(expected); }
+    TEST_ASSERT_EQUAL_HEX8(expected, EDD_Crc8NibbleStep((uint8_t)value));
+  }
+}
+
+/**
+ * @test Test the nibble table content
+ * @brief Verify generated table entries combined with the low nibble
+ */
+void test_EDD_Crc8NibbleStep_TableEntries(void) {
+  TEST_ASSERT_EQUAL_HEX8(0x00, EDD_Crc8NibbleStep(0x00u));
+  TEST_ASSERT_EQUAL_HEX8(0x07, EDD_Crc8NibbleStep(0x10u));
+  TEST_ASSERT_EQUAL_HEX8(0x0E, EDD_Crc8NibbleStep(0x20u));
+  TEST_ASSERT_EQUAL_HEX8(0xF7, EDD_Crc8NibbleStep(0x1Fu));
+}
+
+/**
+ * @test Test the byte update of the nibble mode
+ * @brief Verify CRC of "123456789" is 0xF4 with two nibble steps per byte
+ */
+void test_EDD_Crc8NibbleStep_CheckValue(void) {
+  const uint8_t check[] = {'1', '2', '3', '4', '5', '6', '7', '8', '9'};
+  uint8_t crc = EDD_CRC8_INIT;
+  uint8_t i;
+
+  for(i = 0u; i < sizeof(check); i++) { crc = EDD_CRC8_BYTE_UPDATE(crc, check[i]); }
+
+  TEST_ASSERT_EQUAL_HEX8(0xF4, crc);
+}
@@ -0,0 +1,14 @@
+#ifndef EDD_Crc8Patch_H
+#define EDD_Crc8Patch_H
+
+#include "errorDataDetection.h"
+#include "errorDataDetection_priv.h"
+#include <stdint.h>
+
+uint8_t EDD_Crc8GfMul(uint8_t a, uint8_t b);
+
+uint8_t EDD_Crc8ShiftZeros(uint8_t crc, uint32_t length);
+
+EDD_ReturnType EDD_Crc8Patch(uint8_t oldCrc, uint32_t offset, const uint8_t *oldBytes, const uint8_t *newBytes, uint32_t length, uint32_t totalLength, uint8_t *crc_out);
+
+#endif
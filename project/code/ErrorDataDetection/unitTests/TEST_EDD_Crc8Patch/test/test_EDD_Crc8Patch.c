@@ -0,0 +1,125 @@
+#include "EDD_Crc8Patch.h"
+#include "unity.h"
+
+/**
+ * @file test_EDD_Crc8Patch.c
+ * @brief Unit tests for EDD_Crc8Patch function
+ * @details Checks that patching the CRC gives the CRC of the modified message
+ */
+
+static uint8_t testFrame[64];
+
+/* Setup and teardown functions */
+void setUp(void) {
+  uint8_t i;
+
+  for(i = 0u; i < sizeof(testFrame); i++) { testFrame[i] = (uint8_t)((i * 29u) + 3u); }
+}
+
+void tearDown(void) { /* Teardown code if needed */ }
+
+/**
+ * @brief Helper: bitwise CRC-8/ATM reference
+ */
+static uint8_t referenceCrc8(const uint8_t *data, uint32_t length) {
+  uint8_t crc = 0x00u;
+  uint32_t i;
+  uint8_t bit;
+
+  for(i = 0u; i < length; i++) {
+    crc ^= data[i];
+    for(bit = 0u; bit < 8u; bit++) { crc = ((crc & 0x80u) != 0u) ? (uint8_t)((uint8_t)(crc << 1) ^ 0x07u) : (uint8_t)(crc << 1); }
+  }
+
+  return crc;
+}
+
+/**
+ * @test Test NULL pointers
+ * @brief Verify that function returns EDD_NULL_PTR for every NULL pointer argument
+ */
+void test_EDD_Crc8Patch_NullPointers(void) {
+  const uint8_t bytes[1] = {0u};
+  uint8_t crc;
+
+  TEST_ASSERT_EQUAL(EDD_NULL_PTR, EDD_Crc8Patch(0u, 0u, NULL, bytes, 1u, 8u, &crc));
+  TEST_ASSERT_EQUAL(EDD_NULL_PTR, EDD_Crc8Patch(0u, 0u, bytes, NULL, 1u, 8u, &crc));
+  TEST_ASSERT_EQUAL(EDD_NULL_PTR, EDD_Crc8Patch(0u, 0u, bytes, bytes, 1u, 8u, NULL));
+}
+
+/**
+ * @test Test invalid patched area
+ * @brief Verify EDD_INVALID_LENGTH for empty patches and patches beyond the message
+ */
+void test_EDD_Crc8Patch_InvalidArea(void) {
+  const uint8_t bytes[2] = {0u, 0u};
+  uint8_t crc = 0x5Au;
+
+  TEST_ASSERT_EQUAL(EDD_INVALID_LENGTH, EDD_Crc8Patch(0u, 0u, bytes, bytes, 0u, 8u, &crc));
+  TEST_ASSERT_EQUAL(EDD_INVALID_LENGTH, EDD_Crc8Patch(0u, 7u, bytes, bytes, 2u, 8u, &crc));
+  TEST_ASSERT_EQUAL(EDD_INVALID_LENGTH, EDD_Crc8Patch(0u, 0xFFFFFFFFuL, bytes, bytes, 2u, 8u, &crc));
+  TEST_ASSERT_EQUAL(EDD_INVALID_LENGTH, EDD_Crc8Patch(0u, 0u, bytes, bytes, 2u, 1u, &crc));
+  TEST_ASSERT_EQUAL_HEX8(0x5A, crc);
+}
+
+/**
+ * @test Test single byte patch at every offset
+ * @brief Verify the patched CRC against a full recomputation for each position
+ */
+void test_EDD_Crc8Patch_SingleByteEveryOffset(void) {
+  uint8_t oldByte;
+  uint8_t oldCrc;
+  uint8_t crc;
+  uint32_t offset;
+
+  for(offset = 0u; offset < sizeof(testFrame); offset++) {
+    oldCrc = referenceCrc8(testFrame, sizeof(testFrame));
+    oldByte = testFrame[offset];
+    testFrame[offset] = (uint8_t)(oldByte + 0x41u);
+
+    TEST_ASSERT_EQUAL(EDD_OK, EDD_Crc8Patch(oldCrc, offset, &oldByte, &testFrame[offset], 1u, sizeof(testFrame), &crc));
+    TEST_ASSERT_EQUAL_HEX8(referenceCrc8(testFrame, sizeof(testFrame)), crc);
+  }
+}
+
+/**
+ * @test Test multi-byte patch
+ * @brief Verify an alive counter and a 2-byte signal patched in two calls
+ */
+void test_EDD_Crc8Patch_CounterAndSignal(void) {
+  const uint8_t oldCounter = testFrame[1];
+  const uint8_t oldSignal[2] = {testFrame[10], testFrame[11]};
+  uint8_t crc = referenceCrc8(testFrame, sizeof(testFrame));
+
+  testFrame[1] = (uint8_t)((oldCounter & 0xF0u) | ((oldCounter + 1u) & 0x0Fu));
+  testFrame[10] = 0xBEu;
+  testFrame[11] = 0xEFu;
+
+  TEST_ASSERT_EQUAL(EDD_OK, EDD_Crc8Patch(crc, 1u, &oldCounter, &testFrame[1], 1u, sizeof(testFrame), &crc));
+  TEST_ASSERT_EQUAL(EDD_OK, EDD_Crc8Patch(crc, 10u, oldSignal, &testFrame[10], 2u, sizeof(testFrame), &crc));
+  TEST_ASSERT_EQUAL_HEX8(referenceCrc8(testFrame, sizeof(testFrame)), crc);
+}
+
+/**
+ * @test Test unchanged bytes
+ * @brief Verify that patching identical bytes keeps the CRC
+ */
+void test_EDD_Crc8Patch_NoChange(void) {
+  uint8_t crc = 0u;
+
+  TEST_ASSERT_EQUAL(EDD_OK, EDD_Crc8Patch(0xC3u, 0u, testFrame, testFrame, sizeof(testFrame), sizeof(testFrame), &crc));
+  TEST_ASSERT_EQUAL_HEX8(0xC3, crc);
+}
+
+/**
+ * @test Test patch of the last byte
+ * @brief Verify the patch without zero-byte shift (area at the end of the message)
+ */
+void test_EDD_Crc8Patch_LastByte(void) {
+  const uint8_t check[] = {'1', '2', '3', '4', '5', '6', '7', '8', '9'};
+  const uint8_t patched[] = {'1', '2', '3', '4', '5', '6', '7', '8', '0'};
+  uint8_t crc = 0u;
+
+  TEST_ASSERT_EQUAL(EDD_OK, EDD_Crc8Patch(0xF4u, 8u, &check[8], &patched[8], 1u, 9u, &crc));
+  TEST_ASSERT_EQUAL_HEX8(referenceCrc8(patched, 9u), crc);
+}
@@ -0,0 +1,41 @@
+#include "EDD_E2E_Check.h"
+#include "errorDataDetection_e2e_priv.h"
+
+/* FUNCTION TO TEST */
+
+EDD_ReturnType EDD_E2E_Check(const EDD_E2E_ConfigType *config, EDD_E2E_CheckStateType *state, const uint8_t *data) {
+  uint8_t counter;
+  uint8_t delta;
+
+  if((config == NULL) || (state == NULL) || (data == NULL)) { return EDD_NULL_PTR; }
+
+  if(EDD_E2E_LayoutValid(config) == 0u) { return EDD_INVALID_LENGTH; }
+
+  if((config->maxDeltaCounter == 0u) || (config->maxDeltaCounter > EDD_E2E_COUNTER_MAX)) { return EDD_INVALID_PARAM; }
+
+  counter = data[config->counterOffset] & EDD_E2E_COUNTER_MASK;
+
+  if((counter > EDD_E2E_COUNTER_MAX) || (EDD_E2E_ComputeCrc(config, data) != data[config->crcOffset])) {
+    state->status = EDD_E2E_STATUS_ERROR;
+    return EDD_OK;
+  }
+
+  if(state->synchronized == 0u) {
+    state->synchronized = 1u;
+    state->status = EDD_E2E_STATUS_OK;
+  } else {
+    delta = (counter >= state->lastCounter) ? (uint8_t)(counter - state->lastCounter) : (uint8_t)((counter + EDD_E2E_COUNTER_MAX + 1u) - state->lastCounter);
+
+    if(delta == 0u) {
+      state->status = EDD_E2E_STATUS_REPEATED;
+    } else if(delta <= config->maxDeltaCounter) {
+      state->status = EDD_E2E_STATUS_OK;
+    } else {
+      state->status = EDD_E2E_STATUS_WRONG_SEQUENCE;
+    }
+  }
+
+  state->lastCounter = counter;
+
+  return EDD_OK;
+}
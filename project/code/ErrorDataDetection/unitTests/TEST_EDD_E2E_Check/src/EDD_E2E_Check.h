@@ -0,0 +1,9 @@
+#ifndef EDD_E2E_Check_H
+#define EDD_E2E_Check_H
+
+#include "errorDataDetection_e2e.h"
+#include <stdint.h>
+
+EDD_ReturnType EDD_E2E_Check(const EDD_E2E_ConfigType *config, EDD_E2E_CheckStateType *state, const uint8_t *data);
+
+#endif
@@ -0,0 +1,160 @@
+#include "EDD_E2E_Check.h"
+#include "mock_errorDataDetection_e2e_priv.h"
+#include "unity.h"
+
+/**
+ * @file test_EDD_E2E_Check.c
+ * @brief Unit tests for EDD_E2E_Check function
+ * @details Tests argument checks, CRC rejection and the alive counter state machine
+ */
+
+static const EDD_E2E_ConfigType testConfig = {0x1234u, 8u, 0u, 1u, 2u};
+static EDD_E2E_CheckStateType testState;
+static uint8_t testPdu[8];
+
+/* Setup and teardown functions */
+void setUp(void) {
+  uint8_t i;
+
+  testState.lastCounter = 0u;
+  testState.synchronized = 0u;
+  testState.status = EDD_E2E_STATUS_ERROR;
+
+  for(i = 0u; i < 8u; i++) { testPdu[i] = (uint8_t)(0x10u * i); }
+}
+
+void tearDown(void) { /* Teardown code if needed */ }
+
+/**
+ * @brief Helper: check a PDU carrying `counter` whose CRC byte is correct
+ */
+static void checkValidPdu(uint8_t counter) {
+  EDD_ReturnType ret;
+
+  testPdu[1] = (uint8_t)(0xA0u | counter);
+  testPdu[0] = 0x5Au;
+
+  EDD_E2E_LayoutValid_ExpectAndReturn(&testConfig, 1u);
+  EDD_E2E_ComputeCrc_ExpectAndReturn(&testConfig, testPdu, 0x5Au);
+
+  ret = EDD_E2E_Check(&testConfig, &testState, testPdu);
+
+  TEST_ASSERT_EQUAL(EDD_OK, ret);
+}
+
+/* =============================
+ *  Test Cases
+ * ============================= */
+
+/**
+ * @brief Test: NULL pointers should return EDD_NULL_PTR
+ */
+void test_EDD_E2E_Check_NullPointers(void) {
+  TEST_ASSERT_EQUAL(EDD_NULL_PTR, EDD_E2E_Check(NULL, &testState, testPdu));
+  TEST_ASSERT_EQUAL(EDD_NULL_PTR, EDD_E2E_Check(&testConfig, NULL, testPdu));
+  TEST_ASSERT_EQUAL(EDD_NULL_PTR, EDD_E2E_Check(&testConfig, &testState, NULL));
+}
+
+/**
+ * @brief Test: Invalid layout should return EDD_INVALID_LENGTH and keep the state
+ */
+void test_EDD_E2E_Check_InvalidLayout(void) {
+  EDD_E2E_LayoutValid_ExpectAndReturn(&testConfig, 0u);
+
+  TEST_ASSERT_EQUAL(EDD_INVALID_LENGTH, EDD_E2E_Check(&testConfig, &testState, testPdu));
+  TEST_ASSERT_EQUAL(0u, testState.synchronized);
+}
+
+/**
+ * @brief Test: First valid PDU synchronizes the receiver with status OK
+ */
+void test_EDD_E2E_Check_FirstPduSynchronizes(void) {
+  checkValidPdu(7u);
+
+  TEST_ASSERT_EQUAL(EDD_E2E_STATUS_OK, testState.status);
+  TEST_ASSERT_EQUAL(1u, testState.synchronized);
+  TEST_ASSERT_EQUAL(7u, testState.lastCounter);
+}
+
+/**
+ * @brief Test: CRC mismatch gives status ERROR and does not synchronize
+ */
+void test_EDD_E2E_Check_CrcMismatch(void) {
+  testPdu[0] = 0x5Au;
+  testPdu[1] = 0xA3u;
+
+  EDD_E2E_LayoutValid_ExpectAndReturn(&testConfig, 1u);
+  EDD_E2E_ComputeCrc_ExpectAndReturn(&testConfig, testPdu, 0x5Bu);
+
+  TEST_ASSERT_EQUAL(EDD_OK, EDD_E2E_Check(&testConfig, &testState, testPdu));
+  TEST_ASSERT_EQUAL(EDD_E2E_STATUS_ERROR, testState.status);
+  TEST_ASSERT_EQUAL(0u, testState.synchronized);
+}
+
+/**
+ * @brief Test: Counter value 15 is invalid and gives status ERROR without CRC computation
+ */
+void test_EDD_E2E_Check_InvalidCounter(void) {
+  testPdu[1] = 0x0Fu;
+
+  EDD_E2E_LayoutValid_ExpectAndReturn(&testConfig, 1u);
+
+  TEST_ASSERT_EQUAL(EDD_OK, EDD_E2E_Check(&testConfig, &testState, testPdu));
+  TEST_ASSERT_EQUAL(EDD_E2E_STATUS_ERROR, testState.status);
+}
+
+/**
+ * @brief Test: Same counter twice gives status REPEATED
+ */
+void test_EDD_E2E_Check_Repeated(void) {
+  checkValidPdu(3u);
+  checkValidPdu(3u);
+
+  TEST_ASSERT_EQUAL(EDD_E2E_STATUS_REPEATED, testState.status);
+}
+
+/**
+ * @brief Test: Counter jumps up to maxDeltaCounter give status OK, including the wrap 14 -> 0
+ */
+void test_EDD_E2E_Check_AcceptedDelta(void) {
+  checkValidPdu(12u);
+  checkValidPdu(14u);
+  TEST_ASSERT_EQUAL(EDD_E2E_STATUS_OK, testState.status);
+
+  checkValidPdu(0u);
+  TEST_ASSERT_EQUAL(EDD_E2E_STATUS_OK, testState.status);
+
+  checkValidPdu(2u);
+  TEST_ASSERT_EQUAL(EDD_E2E_STATUS_OK, testState.status);
+}
+
+/**
+ * @brief Test: Counter jump above maxDeltaCounter gives WRONG_SEQUENCE and resynchronizes
+ */
+void test_EDD_E2E_Check_WrongSequence(void) {
+  checkValidPdu(13u);
+  checkValidPdu(2u);
+
+  TEST_ASSERT_EQUAL(EDD_E2E_STATUS_WRONG_SEQUENCE, testState.status);
+  TEST_ASSERT_EQUAL(2u, testState.lastCounter);
+
+  checkValidPdu(3u);
+  TEST_ASSERT_EQUAL(EDD_E2E_STATUS_OK, testState.status);
+}
+
+/**
+ * @brief Test: maxDeltaCounter 0 or above the counter range returns EDD_INVALID_PARAM and keeps the state
+ */
+void test_EDD_E2E_Check_InvalidMaxDelta(void) {
+  const EDD_E2E_ConfigType zeroDelta = {0x1234u, 8u, 0u, 1u, 0u};
+  const EDD_E2E_ConfigType wideDelta = {0x1234u, 8u, 0u, 1u, 15u};
+
+  EDD_E2E_LayoutValid_ExpectAndReturn(&zeroDelta, 1u);
+  TEST_ASSERT_EQUAL(EDD_INVALID_PARAM, EDD_E2E_Check(&zeroDelta, &testState, testPdu));
+
+  EDD_E2E_LayoutValid_ExpectAndReturn(&wideDelta, 1u);
+  TEST_ASSERT_EQUAL(EDD_INVALID_PARAM, EDD_E2E_Check(&wideDelta, &testState, testPdu));
+
+  TEST_ASSERT_EQUAL(0u, testState.synchronized);
+  TEST_ASSERT_EQUAL(EDD_E2E_STATUS_ERROR, testState.status);
+}
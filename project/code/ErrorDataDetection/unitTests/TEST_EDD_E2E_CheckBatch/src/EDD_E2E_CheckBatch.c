@@ -0,0 +1,68 @@
+#include "EDD_E2E_CheckBatch.h"
+#include "errorDataDetection_e2e_priv.h"
+
+EDD_ReturnType EDD_E2E_CheckInit(EDD_E2E_CheckStateType *state) {
+  if(state == NULL) { return EDD_NULL_PTR; }
+
+  state->lastCounter = 0u;
+  state->synchronized = 0u;
+  state->status = EDD_E2E_STATUS_ERROR;
+
+  return EDD_OK;
+}
+
+EDD_ReturnType EDD_E2E_Check(const EDD_E2E_ConfigType *config, EDD_E2E_CheckStateType *state, const uint8_t *data) {
+  uint8_t counter;
+  uint8_t delta;
+
+  if((config == NULL) || (state == NULL) || (data == NULL)) { return EDD_NULL_PTR; }
+
+  if(EDD_E2E_LayoutValid(config) == 0u) { return EDD_INVALID_LENGTH; }
+
+  if((config->maxDeltaCounter == 0u) || (config->maxDeltaCounter > EDD_E2E_COUNTER_MAX)) { return EDD_INVALID_PARAM; }
+
+  counter = data[config->counterOffset] & EDD_E2E_COUNTER_MASK;
+
+  if((counter > EDD_E2E_COUNTER_MAX) || (EDD_E2E_ComputeCrc(config, data) != data[config->crcOffset])) {
+    state->status = EDD_E2E_STATUS_ERROR;
+    return EDD_OK;
+  }
+
+  if(state->synchronized == 0u) {
+    state->synchronized = 1u;
+    state->status = EDD_E2E_STATUS_OK;
+  } else {
+    delta = (counter >= state->lastCounter) ? (uint8_t)(counter - state->lastCounter) : (uint8_t)((counter + EDD_E2E_COUNTER_MAX + 1u) - state->lastCounter);
+
+    if(delta == 0u) {
+      state->status = EDD_E2E_STATUS_REPEATED;
+    } else if(delta <= config->maxDeltaCounter) {
+      state->status = EDD_E2E_STATUS_OK;
+    } else {
+      state->status = EDD_E2E_STATUS_WRONG_SEQUENCE;
+    }
+  }
+
+  state->lastCounter = counter;
+
+  return EDD_OK;
+}
+
+/* FUNCTION TO TEST */
+
+EDD_ReturnType EDD_E2E_CheckBatch(const EDD_E2E_CheckJobType *jobs, uint16_t count) {
+  uint16_t i;
+
+  if(jobs == NULL) { return EDD_NULL_PTR; }
+
+  /* Reject the batch before any receiver state is touched */
+  for(i = 0u; i < count; i++) {
+    if((jobs[i].config == NULL) || (jobs[i].state == NULL) || (jobs[i].data == NULL)) { return EDD_NULL_PTR; }
+    if(EDD_E2E_LayoutValid(jobs[i].config) == 0u) { return EDD_INVALID_LENGTH; }
+    if((jobs[i].config->maxDeltaCounter == 0u) || (jobs[i].config->maxDeltaCounter > EDD_E2E_COUNTER_MAX)) { return EDD_INVALID_PARAM; }
+  }
+
+  for(i = 0u; i < count; i++) { (void)EDD_E2E_Check(jobs[i].config, jobs[i].state, jobs[i].data); }
+
+  return EDD_OK;
+}
@@ -0,0 +1,9 @@
+#ifndef EDD_E2E_CheckBatch_H
+#define EDD_E2E_CheckBatch_H
+
+#include "errorDataDetection_e2e.h"
+#include <stdint.h>
+
+EDD_ReturnType EDD_E2E_CheckBatch(const EDD_E2E_CheckJobType *jobs, uint16_t count);
+
+#endif
@@ -0,0 +1,179 @@
+#include "EDD_E2E_CheckBatch.h"
+#include "mock_errorDataDetection_e2e_priv.h"
+#include "unity.h"
+
+/**
+ * @file test_EDD_E2E_CheckBatch.c
+ * @brief Unit tests for EDD_E2E_CheckBatch function
+ * @details Tests the up-front validation of the jobs and the per-PDU status of a mixed batch.
+ *          The PDU layout check is stubbed by the real rule and the CRC by an additive checksum.
+ */
+
+#define TEST_JOBS (6u)
+
+static const EDD_E2E_ConfigType configA = {0x1234u, 4u, 0u, 1u, 1u};
+static const EDD_E2E_ConfigType configB = {0x4321u, 4u, 3u, 2u, 2u};
+static EDD_E2E_CheckStateType stateA;
+static EDD_E2E_CheckStateType stateB;
+static uint8_t testPdu[TEST_JOBS][4];
+static EDD_E2E_CheckJobType testJobs[TEST_JOBS];
+
+/* =============================
+ *  E2E helper stubs
+ * ============================= */
+
+static uint8_t layoutValidCallback(const EDD_E2E_ConfigType *config, int cmock_num_calls) {
+  (void)cmock_num_calls;
+
+  if((config->crcOffset >= config->dataLength) || (config->counterOffset >= config->dataLength)) { return 0u; }
+
+  return (config->crcOffset != config->counterOffset) ? 1u : 0u;
+}
+
+static uint8_t computeCrcCallback(const EDD_E2E_ConfigType *config, const uint8_t *data, int cmock_num_calls) {
+  uint8_t crc = (uint8_t)((config->dataId & 0xFFu) + (config->dataId >> 8));
+  uint16_t i;
+  (void)cmock_num_calls;
+
+  for(i = 0u; i < config->dataLength; i++) {
+    if(i != config->crcOffset) { crc = (uint8_t)(crc + data[i]); }
+  }
+
+  return crc;
+}
+
+/**
+ * @brief Helper: fill job `idx` with a PDU of `config` carrying `counter` and a correct CRC
+ */
+static void setJob(uint8_t idx, const EDD_E2E_ConfigType *config, EDD_E2E_CheckStateType *state, uint8_t counter) {
+  testPdu[idx][0] = 0x00u;
+  testPdu[idx][1] = (uint8_t)(0x30u + idx);
+  testPdu[idx][2] = 0x00u;
+  testPdu[idx][3] = 0x00u;
+  testPdu[idx][config->counterOffset] = counter;
+  testPdu[idx][config->crcOffset] = computeCrcCallback(config, testPdu[idx], 0);
+
+  testJobs[idx].config = config;
+  testJobs[idx].state = state;
+  testJobs[idx].data = testPdu[idx];
+}
+
+/* Setup and teardown functions */
+void setUp(void) {
+  EDD_E2E_LayoutValid_StubWithCallback(layoutValidCallback);
+  EDD_E2E_ComputeCrc_StubWithCallback(computeCrcCallback);
+
+  (void)EDD_E2E_CheckInit(&stateA);
+  (void)EDD_E2E_CheckInit(&stateB);
+}
+
+void tearDown(void) { /* Teardown code if needed */ }
+
+/* =============================
+ *  Test Cases
+ * ============================= */
+
+/**
+ * @brief Test: NULL job array returns EDD_NULL_PTR, an empty batch is accepted
+ */
+void test_EDD_E2E_CheckBatch_NullAndEmpty(void) {
+  TEST_ASSERT_EQUAL(EDD_NULL_PTR, EDD_E2E_CheckBatch(NULL, 1u));
+  TEST_ASSERT_EQUAL(EDD_OK, EDD_E2E_CheckBatch(testJobs, 0u));
+}
+
+/**
+ * @brief Test: two interleaved streams give OK, REPEATED and WRONG_SEQUENCE in job order
+ */
+void test_EDD_E2E_CheckBatch_MixedStatus(void) {
+  EDD_E2E_CheckStateType results[TEST_JOBS];
+  uint8_t i;
+
+  setJob(0u, &configA, &stateA, 3u);  /* A: first PDU, synchronizes */
+  setJob(1u, &configB, &stateB, 14u); /* B: first PDU, synchronizes */
+  setJob(2u, &configA, &stateA, 3u);  /* A: same counter */
+  setJob(3u, &configB, &stateB, 1u);  /* B: 14 -> 1 is a delta of 2 */
+  setJob(4u, &configA, &stateA, 5u);  /* A: delta 2 above maxDeltaCounter 1 */
+  setJob(5u, &configA, &stateA, 6u);  /* A: resynchronized on 5 */
+
+  /* Each job's status is read back right after its own check */
+  for(i = 0u; i < TEST_JOBS; i++) {
+    TEST_ASSERT_EQUAL(EDD_OK, EDD_E2E_CheckBatch(&testJobs[i], 1u));
+    results[i] = *testJobs[i].state;
+  }
+
+  TEST_ASSERT_EQUAL(EDD_E2E_STATUS_OK, results[0].status);
+  TEST_ASSERT_EQUAL(EDD_E2E_STATUS_OK, results[1].status);
+  TEST_ASSERT_EQUAL(EDD_E2E_STATUS_REPEATED, results[2].status);
+  TEST_ASSERT_EQUAL(EDD_E2E_STATUS_OK, results[3].status);
+  TEST_ASSERT_EQUAL(EDD_E2E_STATUS_WRONG_SEQUENCE, results[4].status);
+  TEST_ASSERT_EQUAL(EDD_E2E_STATUS_OK, results[5].status);
+}
+
+/**
+ * @brief Test: one call over the whole mixed batch leaves each stream in its last status
+ */
+void test_EDD_E2E_CheckBatch_MixedStatusOneCall(void) {
+  setJob(0u, &configA, &stateA, 3u);
+  setJob(1u, &configB, &stateB, 14u);
+  setJob(2u, &configA, &stateA, 4u);
+  setJob(3u, &configB, &stateB, 14u); /* B: same counter */
+  setJob(4u, &configA, &stateA, 7u);  /* A: delta 3 above maxDeltaCounter 1 */
+
+  TEST_ASSERT_EQUAL(EDD_OK, EDD_E2E_CheckBatch(testJobs, 5u));
+
+  TEST_ASSERT_EQUAL(EDD_E2E_STATUS_WRONG_SEQUENCE, stateA.status);
+  TEST_ASSERT_EQUAL(7u, stateA.lastCounter);
+  TEST_ASSERT_EQUAL(EDD_E2E_STATUS_REPEATED, stateB.status);
+  TEST_ASSERT_EQUAL(14u, stateB.lastCounter);
+}
+
+/**
+ * @brief Test: a PDU with a CRC error does not stop the batch
+ */
+void test_EDD_E2E_CheckBatch_CrcErrorDoesNotStop(void) {
+  setJob(0u, &configA, &stateA, 3u);
+  setJob(1u, &configB, &stateB, 2u);
+  testPdu[0][2] ^= 0x01u;
+
+  TEST_ASSERT_EQUAL(EDD_OK, EDD_E2E_CheckBatch(testJobs, 2u));
+
+  TEST_ASSERT_EQUAL(EDD_E2E_STATUS_ERROR, stateA.status);
+  TEST_ASSERT_EQUAL(0u, stateA.synchronized);
+  TEST_ASSERT_EQUAL(EDD_E2E_STATUS_OK, stateB.status);
+  TEST_ASSERT_EQUAL(2u, stateB.lastCounter);
+}
+
+/**
+ * @brief Test: a NULL pointer in the last job rejects the batch before any job is checked
+ */
+void test_EDD_E2E_CheckBatch_NullInLastJob_NothingChecked(void) {
+  setJob(0u, &configA, &stateA, 3u);
+  setJob(1u, &configB, &stateB, 2u);
+  setJob(2u, &configA, &stateA, 4u);
+  testJobs[2].data = NULL;
+
+  TEST_ASSERT_EQUAL(EDD_NULL_PTR, EDD_E2E_CheckBatch(testJobs, 3u));
+
+  TEST_ASSERT_EQUAL(0u, stateA.synchronized);
+  TEST_ASSERT_EQUAL(0u, stateB.synchronized);
+}
+
+/**
+ * @brief Test: an invalid layout or maxDeltaCounter in a later job rejects the batch before any job is checked
+ */
+void test_EDD_E2E_CheckBatch_InvalidLaterJob_NothingChecked(void) {
+  const EDD_E2E_ConfigType badLayout = {0x1234u, 4u, 1u, 1u, 1u};
+  const EDD_E2E_ConfigType badDelta = {0x1234u, 4u, 0u, 1u, 15u};
+
+  setJob(0u, &configA, &stateA, 3u);
+  setJob(1u, &configB, &stateB, 2u);
+  testJobs[1].config = &badLayout;
+  TEST_ASSERT_EQUAL(EDD_INVALID_LENGTH, EDD_E2E_CheckBatch(testJobs, 2u));
+
+  testJobs[1].config = &badDelta;
+  TEST_ASSERT_EQUAL(EDD_INVALID_PARAM, EDD_E2E_CheckBatch(testJobs, 2u));
+
+  TEST_ASSERT_EQUAL(0u, stateA.synchronized);
+  TEST_ASSERT_EQUAL(EDD_E2E_STATUS_ERROR, stateA.status);
+  TEST_ASSERT_EQUAL(0u, stateB.synchronized);
+}
@@ -0,0 +1,292 @@
+#ifndef ERRORDATADETECTION_E2E_H
+#define ERRORDATADETECTION_E2E_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "errorDataDetection.h"
+#include <stdint.h>
+
+/**
+ * @file errorDataDetection_e2e.h
+ * @brief End-to-end (E2E) protection layer of the Error Data Detection module.
+ *
+ * @details
+ * This layer protects PDUs exchanged between ECUs against corruption, loss,
+ * repetition and wrong ordering, in the spirit of AUTOSAR E2E Profile 1/2.
+ * Each protected PDU carries:
+ * - a 4-bit alive counter (values 0..14) in the low nibble of a counter byte,
+ * - a CRC-8 byte (CRC-8/ATM, see @ref EDD_CalcCrc8).
+ *
+ * The CRC covers the 16-bit data ID (low byte first, never transmitted) followed
+ * by every PDU byte except the CRC byte itself. A receiver configured with a
+ * different data ID therefore sees a CRC error (masquerade protection).
+ *
+ * All services work in place on the frame buffer: the CRC is streamed over
+ * the PDU around the CRC byte (@ref EDD_Crc8CtxUpdate) and no copy is made.
+ *
+ * Configuration and state objects are owned by the caller; the layer keeps no
+ * internal state, so any number of PDUs can be protected in parallel.
+ */
+
+/* =============================
+ *  Constants
+ * ============================= */
+
+#define EDD_E2E_COUNTER_MAX (14u) /**< Highest alive counter value; the counter wraps to 0 afterwards */
+
+/* =============================
+ *  Types
+ * ============================= */
+
+/**
+ * @brief Static configuration of one protected PDU.
+ */
+typedef struct {
+  uint16_t dataId;         /**< Implicit data ID mixed into the CRC (not transmitted). */
+  uint16_t dataLength;     /**< PDU length in bytes, including CRC and counter bytes. */
+  uint16_t crcOffset;      /**< Byte offset of the CRC inside the PDU. */
+  uint16_t counterOffset;  /**< Byte offset of the alive counter (low nibble) inside the PDU. */
+  uint8_t maxDeltaCounter; /**< Highest accepted counter jump between two receptions (1..14). */
+} EDD_E2E_ConfigType;
+
+/**
+ * @brief Sender state of one protected PDU.
+ */
+typedef struct {
+  uint8_t counter; /**< Counter written into the next protected PDU (0..14). */
+} EDD_E2E_ProtectStateType;
+
+/**
+ * @brief Result of the check of one received PDU.
+ */
+typedef enum {
+  EDD_E2E_STATUS_OK = 0,         /**< CRC correct, counter advanced within the accepted delta (or first reception). */
+  EDD_E2E_STATUS_REPEATED,       /**< CRC correct, counter identical to the previous reception. */
+  EDD_E2E_STATUS_WRONG_SEQUENCE, /**< CRC correct, counter jump larger than maxDeltaCounter. */
+  EDD_E2E_STATUS_ERROR           /**< CRC mismatch or invalid counter value. */
+} EDD_E2E_CheckStatusType;
+
+/**
+ * @brief Receiver state of one protected PDU.
+ */
+typedef struct {
+  uint8_t lastCounter;            /**< Counter of the last PDU with a correct CRC. */
+  uint8_t synchronized;           /**< 0 until the first PDU with a correct CRC was received. */
+  EDD_E2E_CheckStatusType status; /**< Result of the last check. */
+} EDD_E2E_CheckStateType;
+
+/**
+ * @brief One entry of a batch check (see @ref EDD_E2E_CheckBatch).
+ */
+typedef struct {
+  const EDD_E2E_ConfigType *config; /**< Configuration of the PDU. */
+  EDD_E2E_CheckStateType *state;    /**< Receiver state of the PDU. */
+  const uint8_t *data;              /**< Received PDU (config->dataLength bytes). */
+} EDD_E2E_CheckJobType;
+
+/* =============================
+ *  Public API
+ * ============================= */
+
+/**
+ * @brief Initialize an E2E sender state.
+ *
+ * @param state Sender state to initialize (counter = 0).
+ *
+ * @return EDD_ReturnType
+ * - EDD_OK if the state was initialized.
+ * - EDD_NULL_PTR if state is NULL.
+ */
+EDD_ReturnType EDD_E2E_ProtectInit(EDD_E2E_ProtectStateType *state);
+
+/**
+ * @brief Initialize an E2E receiver state.
+ *
+ * @param state Receiver state to initialize (not synchronized, status ERROR).
+ *
+ * @return EDD_ReturnType
+ * - EDD_OK if the state was initialized.
+ * - EDD_NULL_PTR if state is NULL.
+ */
+EDD_ReturnType EDD_E2E_CheckInit(EDD_E2E_CheckStateType *state);
+
+/**
+ * @brief Protect a PDU in place (write alive counter and CRC).
+ *
+ * @details
+ * **Goal of the function**
+ *
+ * The purpose of this function is to prepare a PDU for transmission: the
+ * current alive counter is written into the low nibble of the counter byte
+ * (the high nibble is preserved), the CRC over data ID and PDU is computed and
+ * written into the CRC byte, and the sender counter is advanced.
+ *
+ * The processing logic:
+ * - Validates pointer arguments (`config`, `state`, `data`).
+ * - Validates the PDU layout (`dataLength`, offsets).
+ * - Writes `state->counter` into the counter nibble.
+ * - Computes CRC-8 over data ID and PDU (CRC byte skipped), writes it.
+ * - Increments `state->counter` (wraps from 14 to 0).
+ *
+ * @par Interface summary
+ *
+ * | Interface | In | Out | Data type / Signature        | Param | Data factor | Data offset | Data size  | Data range | Data unit |
+ * |----------|:--:|:---:|------------------------------|:-----:|------------:|------------:|-----------:|-----------|----------|
+ * | config   | X  |     | const EDD_E2E_ConfigType*    |   -   |      1      |      0      |     1      | -         | [-]      |
+ * | state    | X  |  X  | EDD_E2E_ProtectStateType*    |   -   |      1      |      0      |     1      | -         | [-]      |
+ * | data     | X  |  X  | uint8_t*                     |   -   |      1      |      0      | dataLength | [0,255]   | [-]      |
+ *
+ * @par Activity diagram (PlantUML)
+ *
+ * @startuml
+ * start
+ * if (config == NULL OR state == NULL OR data == NULL) then (YES)
+ *   :return EDD_NULL_PTR;
+ *   stop
+ * endif
+ * if (layout invalid) then (YES)
+ *   :return EDD_INVALID_LENGTH;
+ *   stop
+ * endif
+ * :data[counterOffset] = (high nibble) | counter;
+ * :data[crcOffset] = CRC8(dataId, data without CRC byte);
+ * :counter = (counter + 1) mod 15;
+ * :return EDD_OK;
+ * stop
+ * @enduml
+ *
+ * @return EDD_ReturnType
+ * - EDD_OK if the PDU was protected.
+ * - EDD_NULL_PTR if any pointer is NULL.
+ * - EDD_INVALID_LENGTH if the configured PDU layout is invalid.
+ */
+EDD_ReturnType EDD_E2E_Protect(const EDD_E2E_ConfigType *config, EDD_E2E_ProtectStateType *state, uint8_t *data);
+
+/**
+ * @brief Check a received PDU in place and update the receiver state.
+ *
+ * @details
+ * **Goal of the function**
+ *
+ * The purpose of this function is to validate a received PDU and classify it
+ * against the previously received one.
+ *
+ * The processing logic:
+ * - Validates pointer arguments (`config`, `state`, `data`).
+ * - Validates the PDU layout (`dataLength`, offsets).
+ * - Validates `maxDeltaCounter` (1..14).
+ * - Recomputes CRC-8 over data ID and PDU (CRC byte skipped).
+ * - If the CRC differs or the counter is above 14: status ERROR, state kept.
+ * - Otherwise, with `delta = (counter - lastCounter) mod 15`:
+ *   - first valid PDU after init: OK (synchronization),
+ *   - `delta == 0`: REPEATED,
+ *   - `1 <= delta <= maxDeltaCounter`: OK,
+ *   - else: WRONG_SEQUENCE (the receiver resynchronizes on this counter).
+ * - Stores the status in `state->status`.
+ *
+ * @par Interface summary
+ *
+ * | Interface | In | Out | Data type / Signature        | Param | Data factor | Data offset | Data size  | Data range | Data unit |
+ * |----------|:--:|:---:|------------------------------|:-----:|------------:|------------:|-----------:|-----------|----------|
+ * | config   | X  |     | const EDD_E2E_ConfigType*    |   -   |      1      |      0      |     1      | -         | [-]      |
+ * | state    | X  |  X  | EDD_E2E_CheckStateType*      |   -   |      1      |      0      |     1      | -         | [-]      |
+ * | data     | X  |     | const uint8_t*               |   -   |      1      |      0      | dataLength | [0,255]   | [-]      |
+ *
+ * @par Activity diagram (PlantUML)
+ *
+ * @startuml
+ * start
+ * if (config == NULL OR state == NULL OR data == NULL) then (YES)
+ *   :return EDD_NULL_PTR;
+ *   stop
+ * endif
+ * if (layout invalid) then (YES)
+ *   :return EDD_INVALID_LENGTH;
+ *   stop
+ * endif
+ * if (maxDeltaCounter == 0 OR maxDeltaCounter > 14) then (YES)
+ *   :return EDD_INVALID_PARAM;
+ *   stop
+ * endif
+ * if (CRC mismatch OR counter > 14) then (YES)
+ *   :status = ERROR;
+ * elseif (not synchronized) then (YES)
+ *   :status = OK;
+ * elseif (delta == 0) then (YES)
+ *   :status = REPEATED;
+ * elseif (delta <= maxDeltaCounter) then (YES)
+ *   :status = OK;
+ * else (NO)
+ *   :status = WRONG_SEQUENCE;
+ * endif
+ * :return EDD_OK;
+ * stop
+ * @enduml
+ *
+ * @return EDD_ReturnType
+ * - EDD_OK if the check was executed (result in `state->status`).
+ * - EDD_NULL_PTR if any pointer is NULL.
+ * - EDD_INVALID_LENGTH if the configured PDU layout is invalid.
+ * - EDD_INVALID_PARAM if `maxDeltaCounter` is 0 or above 14.
+ */
+EDD_ReturnType EDD_E2E_Check(const EDD_E2E_ConfigType *config, EDD_E2E_CheckStateType *state, const uint8_t *data);
+
+/**
+ * @brief Check an array of received PDUs in one call.
+ *
+ * @details
+ * Runs @ref EDD_E2E_Check for every job in order. Jobs may share a receiver
+ * state (consecutive PDUs of the same stream) or use different ones. The
+ * per-PDU result is available in `jobs[i].state->status`; processing does not
+ * stop on a PDU with status ERROR.
+ *
+ * The batch is all or nothing: the arguments of every job are validated
+ * before the first PDU is checked. If any job is invalid the error is
+ * returned and no receiver state is modified, so no stream is left half
+ * updated. A caller that needs the failing index checks the jobs one by one
+ * with @ref EDD_E2E_Check.
+ *
+ * @par Activity diagram (PlantUML)
+ *
+ * @startuml
+ * start
+ * if (jobs == NULL) then (YES)
+ *   :return EDD_NULL_PTR;
+ *   stop
+ * endif
+ * repeat :next job;
+ *   if (config, state or data NULL) then (YES)
+ *     :return EDD_NULL_PTR;
+ *     stop
+ *   elseif (layout invalid) then (YES)
+ *     :return EDD_INVALID_LENGTH;
+ *     stop
+ *   elseif (maxDeltaCounter == 0 OR maxDeltaCounter > 14) then (YES)
+ *     :return EDD_INVALID_PARAM;
+ *     stop
+ *   endif
+ * repeat while (more jobs?)
+ * repeat :EDD_E2E_Check(job);
+ * repeat while (more jobs?)
+ * :return EDD_OK;
+ * stop
+ * @enduml
+ *
+ * @param jobs  Array of check jobs.
+ * @param count Number of jobs.
+ *
+ * @return EDD_ReturnType
+ * - EDD_OK if every job was checked.
+ * - EDD_NULL_PTR if `jobs` or a pointer inside a job is NULL (no job checked).
+ * - EDD_INVALID_LENGTH if a job has an invalid layout (no job checked).
+ * - EDD_INVALID_PARAM if a job has an invalid `maxDeltaCounter` (no job checked).
+ */
+EDD_ReturnType EDD_E2E_CheckBatch(const EDD_E2E_CheckJobType *jobs, uint16_t count);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ERRORDATADETECTION_E2E_H */
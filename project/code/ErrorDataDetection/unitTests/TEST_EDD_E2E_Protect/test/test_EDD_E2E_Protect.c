@@ -0,0 +1,215 @@
+#include "EDD_E2E_Protect.h"
+#include "mock_errorDataDetection.h"
+#include "unity.h"
+
+/**
+ * @file test_EDD_E2E_Protect.c
+ * @brief Unit tests for EDD_E2E_Protect function
+ * @details Tests the counter handling, the bytes covered by the CRC and a Protect -> Check round trip.
+ *          The CRC-8 context API is stubbed by a bitwise CRC-8/ATM that also records the streamed bytes.
+ */
+
+static const EDD_E2E_ConfigType testConfig = {0x1234u, 8u, 3u, 1u, 1u};
+static EDD_E2E_ProtectStateType testState;
+static uint8_t testPdu[8];
+
+/* Bytes streamed through EDD_Crc8CtxUpdate since the last EDD_Crc8CtxInit */
+static uint8_t testStream[16];
+static uint32_t testStreamLen;
+
+/* =============================
+ *  CRC-8 context stubs
+ * ============================= */
+
+static EDD_ReturnType ctxInitCallback(EDD_Crc8Ctx *ctx, int cmock_num_calls) {
+  (void)cmock_num_calls;
+
+  ctx->crc = 0x00u;
+  testStreamLen = 0u;
+
+  return EDD_OK;
+}
+
+static EDD_ReturnType ctxUpdateCallback(EDD_Crc8Ctx *ctx, const uint8_t *data, uint32_t length, int cmock_num_calls) {
+  uint32_t i;
+  uint8_t bit;
+  (void)cmock_num_calls;
+
+  for(i = 0u; i < length; i++) {
+    if(testStreamLen < sizeof(testStream)) { testStream[testStreamLen] = data[i]; }
+    testStreamLen++;
+    ctx->crc ^= data[i];
+    for(bit = 0u; bit < 8u; bit++) { ctx->crc = (uint8_t)(((ctx->crc & 0x80u) != 0u) ? ((ctx->crc << 1) ^ 0x07u) : (ctx->crc << 1)); }
+  }
+
+  return EDD_OK;
+}
+
+static EDD_ReturnType ctxFinalCallback(const EDD_Crc8Ctx *ctx, uint8_t *crc_out, int cmock_num_calls) {
+  (void)cmock_num_calls;
+
+  *crc_out = ctx->crc;
+
+  return EDD_OK;
+}
+
+/**
+ * @brief Helper: CRC-8/ATM of a buffer, reference for the expected CRC byte
+ */
+static uint8_t refCrc8(const uint8_t *data, uint32_t length) {
+  EDD_Crc8Ctx ctx;
+
+  ctx.crc = 0x00u;
+  (void)ctxUpdateCallback(&ctx, data, length, 0);
+
+  return ctx.crc;
+}
+
+/* Setup and teardown functions */
+void setUp(void) {
+  uint8_t i;
+
+  EDD_Crc8CtxInit_StubWithCallback(ctxInitCallback);
+  EDD_Crc8CtxUpdate_StubWithCallback(ctxUpdateCallback);
+  EDD_Crc8CtxFinal_StubWithCallback(ctxFinalCallback);
+
+  testState.counter = 0u;
+  testStreamLen = 0u;
+  for(i = 0u; i < 8u; i++) { testPdu[i] = (uint8_t)(0x11u * i); }
+}
+
+void tearDown(void) { /* Teardown code if needed */ }
+
+/* =============================
+ *  Test Cases
+ * ============================= */
+
+/**
+ * @brief Test: NULL pointers should return EDD_NULL_PTR
+ */
+void test_EDD_E2E_Protect_NullPointers(void) {
+  TEST_ASSERT_EQUAL(EDD_NULL_PTR, EDD_E2E_Protect(NULL, &testState, testPdu));
+  TEST_ASSERT_EQUAL(EDD_NULL_PTR, EDD_E2E_Protect(&testConfig, NULL, testPdu));
+  TEST_ASSERT_EQUAL(EDD_NULL_PTR, EDD_E2E_Protect(&testConfig, &testState, NULL));
+}
+
+/**
+ * @brief Test: CRC byte on the counter byte or outside the PDU returns EDD_INVALID_LENGTH, PDU and counter kept
+ */
+void test_EDD_E2E_Protect_InvalidLayout(void) {
+  const EDD_E2E_ConfigType sameOffset = {0x1234u, 8u, 1u, 1u, 1u};
+  const EDD_E2E_ConfigType crcOutside = {0x1234u, 8u, 8u, 1u, 1u};
+
+  TEST_ASSERT_EQUAL(EDD_INVALID_LENGTH, EDD_E2E_Protect(&sameOffset, &testState, testPdu));
+  TEST_ASSERT_EQUAL(EDD_INVALID_LENGTH, EDD_E2E_Protect(&crcOutside, &testState, testPdu));
+
+  TEST_ASSERT_EQUAL_HEX8(0x11u, testPdu[1]);
+  TEST_ASSERT_EQUAL_HEX8(0x33u, testPdu[3]);
+  TEST_ASSERT_EQUAL(0u, testState.counter);
+}
+
+/**
+ * @brief Test: counter written into the low nibble, high nibble kept, sender counter advanced
+ */
+void test_EDD_E2E_Protect_WritesCounterNibble(void) {
+  testPdu[1] = 0xA5u;
+  testState.counter = 9u;
+
+  TEST_ASSERT_EQUAL(EDD_OK, EDD_E2E_Protect(&testConfig, &testState, testPdu));
+
+  TEST_ASSERT_EQUAL_HEX8(0xA9u, testPdu[1]);
+  TEST_ASSERT_EQUAL(10u, testState.counter);
+}
+
+/**
+ * @brief Test: the counter wraps from 14 to 0 and the PDU carries 14 then 0
+ */
+void test_EDD_E2E_Protect_CounterWraps(void) {
+  testState.counter = 14u;
+
+  TEST_ASSERT_EQUAL(EDD_OK, EDD_E2E_Protect(&testConfig, &testState, testPdu));
+  TEST_ASSERT_EQUAL_HEX8(0x1Eu, testPdu[1]);
+  TEST_ASSERT_EQUAL(0u, testState.counter);
+
+  TEST_ASSERT_EQUAL(EDD_OK, EDD_E2E_Protect(&testConfig, &testState, testPdu));
+  TEST_ASSERT_EQUAL_HEX8(0x10u, testPdu[1]);
+  TEST_ASSERT_EQUAL(1u, testState.counter);
+}
+
+/**
+ * @brief Test: the CRC covers data ID and every PDU byte except the CRC byte
+ */
+void test_EDD_E2E_Protect_CrcByteSkipped(void) {
+  const uint8_t expectedStream[9] = {0x34u, 0x12u, 0x00u, 0x10u, 0x22u, 0x44u, 0x55u, 0x66u, 0x77u};
+  uint8_t crc;
+
+  TEST_ASSERT_EQUAL(EDD_OK, EDD_E2E_Protect(&testConfig, &testState, testPdu));
+
+  TEST_ASSERT_EQUAL_UINT32(sizeof(expectedStream), testStreamLen);
+  TEST_ASSERT_EQUAL_HEX8_ARRAY(expectedStream, testStream, sizeof(expectedStream));
+  TEST_ASSERT_EQUAL_HEX8(refCrc8(expectedStream, sizeof(expectedStream)), testPdu[3]);
+
+  /* The old CRC byte does not change the new CRC */
+  crc = testPdu[3];
+  testState.counter = 0u;
+  testPdu[3] = (uint8_t)~crc;
+  TEST_ASSERT_EQUAL(EDD_OK, EDD_E2E_Protect(&testConfig, &testState, testPdu));
+  TEST_ASSERT_EQUAL_HEX8(crc, testPdu[3]);
+}
+
+/**
+ * @brief Test: the data ID enters the CRC low byte first, a byte-swapped data ID gives another CRC
+ */
+void test_EDD_E2E_Protect_DataIdByteOrder(void) {
+  const EDD_E2E_ConfigType swappedId = {0x3412u, 8u, 3u, 1u, 1u};
+  uint8_t crc;
+
+  TEST_ASSERT_EQUAL(EDD_OK, EDD_E2E_Protect(&testConfig, &testState, testPdu));
+  TEST_ASSERT_EQUAL_HEX8(0x34u, testStream[0]);
+  TEST_ASSERT_EQUAL_HEX8(0x12u, testStream[1]);
+  crc = testPdu[3];
+
+  testState.counter = 0u;
+  TEST_ASSERT_EQUAL(EDD_OK, EDD_E2E_Protect(&swappedId, &testState, testPdu));
+  TEST_ASSERT_EQUAL_HEX8(0x12u, testStream[0]);
+  TEST_ASSERT_EQUAL_HEX8(0x34u, testStream[1]);
+  TEST_ASSERT_NOT_EQUAL(crc, testPdu[3]);
+}
+
+/**
+ * @brief Test: PDUs protected across the counter wrap pass EDD_E2E_Check, a corrupted one does not
+ */
+void test_EDD_E2E_Protect_RoundTrip(void) {
+  EDD_E2E_CheckStateType rxState;
+  uint8_t i;
+
+  TEST_ASSERT_EQUAL(EDD_OK, EDD_E2E_ProtectInit(&testState));
+  TEST_ASSERT_EQUAL(EDD_OK, EDD_E2E_CheckInit(&rxState));
+
+  for(i = 0u; i < 17u; i++) {
+    testPdu[5] = i;
+    TEST_ASSERT_EQUAL(EDD_OK, EDD_E2E_Protect(&testConfig, &testState, testPdu));
+    TEST_ASSERT_EQUAL(EDD_OK, EDD_E2E_Check(&testConfig, &rxState, testPdu));
+    TEST_ASSERT_EQUAL(EDD_E2E_STATUS_OK, rxState.status);
+    TEST_ASSERT_EQUAL(i % 15u, rxState.lastCounter);
+  }
+
+  TEST_ASSERT_EQUAL(EDD_OK, EDD_E2E_Protect(&testConfig, &testState, testPdu));
+  testPdu[6] ^= 0x01u;
+  TEST_ASSERT_EQUAL(EDD_OK, EDD_E2E_Check(&testConfig, &rxState, testPdu));
+  TEST_ASSERT_EQUAL(EDD_E2E_STATUS_ERROR, rxState.status);
+}
+
+/**
+ * @brief Test: a receiver with another data ID rejects the PDU (masquerade)
+ */
+void test_EDD_E2E_Protect_OtherDataIdRejected(void) {
+  const EDD_E2E_ConfigType otherId = {0x1235u, 8u, 3u, 1u, 1u};
+  EDD_E2E_CheckStateType rxState;
+
+  TEST_ASSERT_EQUAL(EDD_OK, EDD_E2E_CheckInit(&rxState));
+  TEST_ASSERT_EQUAL(EDD_OK, EDD_E2E_Protect(&testConfig, &testState, testPdu));
+
+  TEST_ASSERT_EQUAL(EDD_OK, EDD_E2E_Check(&otherId, &rxState, testPdu));
+  TEST_ASSERT_EQUAL(EDD_E2E_STATUS_ERROR, rxState.status);
+}
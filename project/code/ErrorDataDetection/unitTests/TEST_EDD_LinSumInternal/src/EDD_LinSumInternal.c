@@ -0,0 +1,31 @@
+#include "EDD_LinSumInternal.h"
+
+/* Checksum fold used to compare the accumulator with the byte-wise reference */
+uint8_t EDD_LinFold(uint32_t sum) {
+  sum = (sum & 0xFFFFu) + (sum >> 16);
+  sum = (sum & 0xFFFFu) + (sum >> 16);
+  sum = (sum & 0xFFu) + (sum >> 8);
+  sum = (sum & 0xFFu) + (sum >> 8);
+
+  return (uint8_t)~sum;
+}
+
+/* FUNCTION TO TEST */
+
+uint32_t EDD_LinSumInternal(uint32_t sum, const uint8_t *data, uint32_t length) {
+  uint32_t word;
+  uint32_t i = 0u;
+
+  for(; (length - i) >= 4u; i += 4u) {
+    word = (uint32_t)data[i] | ((uint32_t)data[i + 1u] << 8) | ((uint32_t)data[i + 2u] << 16) | ((uint32_t)data[i + 3u] << 24);
+    sum += word;
+    sum += (sum < word) ? 1u : 0u;
+  }
+
+  for(; i < length; i++) {
+    sum += data[i];
+    sum += (sum < data[i]) ? 1u : 0u;
+  }
+
+  return sum;
+}
@@ -0,0 +1,12 @@
+#ifndef EDD_LinSumInternal_H
+#define EDD_LinSumInternal_H
+
+#include "errorDataDetection.h"
+#include "errorDataDetection_priv.h"
+#include <stdint.h>
+
+uint8_t EDD_LinFold(uint32_t sum);
+
+uint32_t EDD_LinSumInternal(uint32_t sum, const uint8_t *data, uint32_t length);
+
+#endif
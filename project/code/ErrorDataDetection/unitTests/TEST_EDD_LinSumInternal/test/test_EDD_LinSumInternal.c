@@ -0,0 +1,94 @@
+#include "EDD_LinSumInternal.h"
+#include "unity.h"
+
+/**
+ * @file test_EDD_LinSumInternal.c
+ * @brief Unit tests for EDD_LinSumInternal function
+ * @details Checks that the word-at-a-time carry-folded sum equals the byte-wise LIN add-with-carry
+ */
+
+static uint8_t testData[300];
+
+/* Setup and teardown functions */
+void setUp(void) {
+  uint32_t seed = 0x2468ACE1u;
+  uint16_t i;
+
+  for(i = 0u; i < sizeof(testData); i++) {
+    seed = (seed * 1103515245u) + 12345u;
+    testData[i] = (uint8_t)(seed >> 16);
+  }
+}
+
+void tearDown(void) { /* Teardown code if needed */ }
+
+/**
+ * @brief Helper: LIN checksum as specified (8-bit add, carry added back, inverted)
+ */
+static uint8_t referenceLinChecksum(uint8_t start, const uint8_t *data, uint32_t length) {
+  uint16_t sum = start;
+  uint32_t i;
+
+  for(i = 0u; i < length; i++) {
+    sum = (uint16_t)(sum + data[i]);
+    if(sum >= 256u) { sum = (uint16_t)(sum - 255u); }
+  }
+
+  return (uint8_t)~sum;
+}
+
+/**
+ * @test Test every length and alignment on random data
+ * @brief Verify the folded sum against the byte-wise reference for lengths 0..64 at offsets 0..3
+ */
+void test_EDD_LinSumInternal_AllLengthsAndAlignments(void) {
+  uint32_t length;
+  uint32_t offset;
+
+  for(offset = 0u; offset < 4u; offset++) {
+    for(length = 0u; length <= 64u; length++) {
+      TEST_ASSERT_EQUAL_HEX8(referenceLinChecksum(0u, &testData[offset], length), EDD_LinFold(EDD_LinSumInternal(0u, &testData[offset], length)));
+    }
+  }
+}
+
+/**
+ * @test Test carries out of the 32-bit accumulator
+ * @brief Verify all-0xFF data (a carry on every word) and the 0x00 / 0xFF sum corner cases
+ */
+void test_EDD_LinSumInternal_CarryCornerCases(void) {
+  uint8_t ones[256];
+  uint8_t zeros[8] = {0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u};
+  const uint8_t multiple[2] = {0x80u, 0x7Fu}; /* sum 0xFF: checksum 0x00 */
+  uint16_t i;
+
+  for(i = 0u; i < sizeof(ones); i++) { ones[i] = 0xFFu; }
+
+  TEST_ASSERT_EQUAL_HEX8(referenceLinChecksum(0u, ones, sizeof(ones)), EDD_LinFold(EDD_LinSumInternal(0u, ones, sizeof(ones))));
+  TEST_ASSERT_EQUAL_HEX8(0xFF, EDD_LinFold(EDD_LinSumInternal(0u, zeros, sizeof(zeros))));
+  TEST_ASSERT_EQUAL_HEX8(0x00, EDD_LinFold(EDD_LinSumInternal(0u, multiple, sizeof(multiple))));
+  TEST_ASSERT_EQUAL_HEX8(0x00, EDD_LinFold(EDD_LinSumInternal(0u, ones, 8u)));
+}
+
+/**
+ * @test Test continuation from a start value
+ * @brief Verify that the PID start value and chunked calls give the one-shot result
+ */
+void test_EDD_LinSumInternal_ChunkedWithStartValue(void) {
+  uint32_t split;
+  uint32_t sum;
+
+  for(split = 0u; split <= 13u; split++) {
+    sum = EDD_LinSumInternal(0xC1u, testData, split);
+    sum = EDD_LinSumInternal(sum, &testData[split], 13u - split);
+    TEST_ASSERT_EQUAL_HEX8(referenceLinChecksum(0xC1u, testData, 13u), EDD_LinFold(sum));
+  }
+}
+
+/**
+ * @test Test a long buffer
+ * @brief Verify the result over 300 bytes (many accumulator wraps)
+ */
+void test_EDD_LinSumInternal_LongBuffer(void) {
+  TEST_ASSERT_EQUAL_HEX8(referenceLinChecksum(0u, testData, sizeof(testData)), EDD_LinFold(EDD_LinSumInternal(0u, testData, sizeof(testData))));
+}
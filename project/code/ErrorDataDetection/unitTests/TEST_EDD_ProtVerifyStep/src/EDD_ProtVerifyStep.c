@@ -0,0 +1,82 @@
+#include "EDD_ProtVerifyStep.h"
+
+/* Bitwise stand-in for the CRC-8 engine used by the function under test */
+uint8_t EDD_Crc8ComputeInternal(uint8_t crc, const uint8_t *data, uint32_t length) {
+  uint32_t i;
+  uint8_t bit;
+
+  for(i = 0u; i < length; i++) {
+    crc ^= data[i];
+    for(bit = 0u; bit < 8u; bit++) { crc = ((crc & 0x80u) != 0u) ? (uint8_t)((uint8_t)(crc << 1) ^ EDD_CRC8_POLY) : (uint8_t)(crc << 1); }
+  }
+
+  return crc;
+}
+
+EDD_ReturnType EDD_ProtInit(EDD_ProtSetType *set, EDD_ProtVarType *vars, uint16_t count, uint16_t perTick) {
+  uint16_t i;
+
+  if((set == NULL) || (vars == NULL)) { return EDD_NULL_PTR; }
+
+  if((count == 0u) || (perTick == 0u)) { return EDD_INVALID_LENGTH; }
+
+  for(i = 0u; i < count; i++) {
+    if(vars[i].data == NULL) { return EDD_NULL_PTR; }
+    if(vars[i].length == 0u) { return EDD_INVALID_LENGTH; }
+  }
+
+  for(i = 0u; i < count; i++) { vars[i].crc = EDD_Crc8ComputeInternal(EDD_CRC8_INIT, vars[i].data, vars[i].length); }
+
+  set->vars = vars;
+  set->varCount = count;
+  set->perTick = (perTick < count) ? perTick : count;
+  set->next = 0u;
+  set->lastFailed = 0u;
+  set->firstFailed = 0u;
+  set->failCount = 0u;
+
+  return EDD_OK;
+}
+
+EDD_ReturnType EDD_ProtGetWorstCase(const EDD_ProtSetType *set, EDD_ProtWorstCaseType *wc_out) {
+  uint16_t maxLength = 0u;
+  uint16_t i;
+
+  if((set == NULL) || (wc_out == NULL)) { return EDD_NULL_PTR; }
+
+  for(i = 0u; i < set->varCount; i++) {
+    if(set->vars[i].length > maxLength) { maxLength = set->vars[i].length; }
+  }
+
+  wc_out->detectionTicks = (uint16_t)(((uint32_t)set->varCount + set->perTick - 1u) / set->perTick);
+  wc_out->bytesPerTick = (uint32_t)set->perTick * maxLength;
+
+  return EDD_OK;
+}
+
+/* FUNCTION TO TEST */
+
+EDD_ReturnType EDD_ProtVerifyStep(EDD_ProtSetType *set, uint16_t *failed_out) {
+  const EDD_ProtVarType *var;
+  uint16_t failed = 0u;
+  uint16_t i;
+
+  if((set == NULL) || (failed_out == NULL)) { return EDD_NULL_PTR; }
+
+  for(i = 0u; i < set->perTick; i++) {
+    var = &set->vars[set->next];
+    if(EDD_Crc8ComputeInternal(EDD_CRC8_INIT, var->data, var->length) != var->crc) {
+      if(failed == 0u) { set->firstFailed = set->next; }
+      failed++;
+    }
+
+    set->next++;
+    if(set->next == set->varCount) { set->next = 0u; }
+  }
+
+  set->lastFailed = failed;
+  set->failCount = ((UINT32_MAX - set->failCount) < failed) ? UINT32_MAX : (set->failCount + failed);
+  *failed_out = failed;
+
+  return EDD_OK;
+}
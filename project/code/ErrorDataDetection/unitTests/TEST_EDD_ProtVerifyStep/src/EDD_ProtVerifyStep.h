@@ -0,0 +1,16 @@
+#ifndef EDD_ProtVerifyStep_H
+#define EDD_ProtVerifyStep_H
+
+#include "errorDataDetection.h"
+#include "errorDataDetection_priv.h"
+#include <stdint.h>
+
+uint8_t EDD_Crc8ComputeInternal(uint8_t crc, const uint8_t *data, uint32_t length);
+
+EDD_ReturnType EDD_ProtInit(EDD_ProtSetType *set, EDD_ProtVarType *vars, uint16_t count, uint16_t perTick);
+
+EDD_ReturnType EDD_ProtGetWorstCase(const EDD_ProtSetType *set, EDD_ProtWorstCaseType *wc_out);
+
+EDD_ReturnType EDD_ProtVerifyStep(EDD_ProtSetType *set, uint16_t *failed_out);
+
+#endif
@@ -0,0 +1,179 @@
+#include "EDD_ProtVerifyStep.h"
+#include "unity.h"
+
+/**
+ * @file test_EDD_ProtVerifyStep.c
+ * @brief Unit tests for EDD_ProtVerifyStep function
+ * @details Checks the round-robin order, the number of variables per step, mismatch reporting and the worst case detection figures
+ */
+
+static uint8_t varA[12];
+static uint8_t varB[4];
+static uint8_t varC[1];
+static uint8_t varD[30];
+static uint8_t varE[2];
+static EDD_ProtVarType vars[5];
+static EDD_ProtSetType set;
+
+/* Setup and teardown functions */
+void setUp(void) {
+  uint8_t i;
+
+  for(i = 0u; i < sizeof(varA); i++) { varA[i] = (uint8_t)(i + 1u); }
+  for(i = 0u; i < sizeof(varB); i++) { varB[i] = (uint8_t)(0x40u + i); }
+  varC[0] = 0x5Au;
+  for(i = 0u; i < sizeof(varD); i++) { varD[i] = (uint8_t)(i * 3u); }
+  varE[0] = 0xFFu;
+  varE[1] = 0x00u;
+
+  vars[0].data = varA;
+  vars[0].length = (uint16_t)sizeof(varA);
+  vars[1].data = varB;
+  vars[1].length = (uint16_t)sizeof(varB);
+  vars[2].data = varC;
+  vars[2].length = (uint16_t)sizeof(varC);
+  vars[3].data = varD;
+  vars[3].length = (uint16_t)sizeof(varD);
+  vars[4].data = varE;
+  vars[4].length = (uint16_t)sizeof(varE);
+}
+
+void tearDown(void) { /* Teardown code if needed */ }
+
+/**
+ * @test Test NULL pointers
+ * @brief Verify that function returns EDD_NULL_PTR for every NULL pointer argument
+ */
+void test_EDD_ProtVerifyStep_NullPointers(void) {
+  uint16_t failed;
+
+  TEST_ASSERT_EQUAL(EDD_OK, EDD_ProtInit(&set, vars, 5u, 2u));
+
+  TEST_ASSERT_EQUAL(EDD_NULL_PTR, EDD_ProtVerifyStep(NULL, &failed));
+  TEST_ASSERT_EQUAL(EDD_NULL_PTR, EDD_ProtVerifyStep(&set, NULL));
+  TEST_ASSERT_EQUAL_UINT16(0u, set.next);
+}
+
+/**
+ * @test Test an intact set
+ * @brief Verify no mismatch and the round-robin position (perTick per step, wrapping around)
+ */
+void test_EDD_ProtVerifyStep_RoundRobin(void) {
+  uint16_t failed = 0xFFFFu;
+
+  TEST_ASSERT_EQUAL(EDD_OK, EDD_ProtInit(&set, vars, 5u, 2u));
+
+  TEST_ASSERT_EQUAL(EDD_OK, EDD_ProtVerifyStep(&set, &failed));
+  TEST_ASSERT_EQUAL_UINT16(0u, failed);
+  TEST_ASSERT_EQUAL_UINT16(2u, set.next);
+  TEST_ASSERT_EQUAL(EDD_OK, EDD_ProtVerifyStep(&set, &failed));
+  TEST_ASSERT_EQUAL_UINT16(4u, set.next);
+  TEST_ASSERT_EQUAL(EDD_OK, EDD_ProtVerifyStep(&set, &failed));
+  TEST_ASSERT_EQUAL_UINT16(1u, set.next);
+  TEST_ASSERT_EQUAL_UINT16(0u, failed);
+  TEST_ASSERT_EQUAL_UINT32(0u, set.failCount);
+}
+
+/**
+ * @test Test a corrupted variable
+ * @brief Verify that the mismatch is reported by the step that checks the variable, and by every later check
+ */
+void test_EDD_ProtVerifyStep_CorruptionReported(void) {
+  uint16_t failed;
+
+  TEST_ASSERT_EQUAL(EDD_OK, EDD_ProtInit(&set, vars, 5u, 2u));
+  varD[17] ^= 0x10u;
+
+  TEST_ASSERT_EQUAL(EDD_OK, EDD_ProtVerifyStep(&set, &failed));
+  TEST_ASSERT_EQUAL_UINT16(0u, failed);
+
+  TEST_ASSERT_EQUAL(EDD_OK, EDD_ProtVerifyStep(&set, &failed));
+  TEST_ASSERT_EQUAL_UINT16(1u, failed);
+  TEST_ASSERT_EQUAL_UINT16(1u, set.lastFailed);
+  TEST_ASSERT_EQUAL_UINT16(3u, set.firstFailed);
+
+  TEST_ASSERT_EQUAL(EDD_OK, EDD_ProtVerifyStep(&set, &failed));
+  TEST_ASSERT_EQUAL_UINT16(0u, failed);
+  TEST_ASSERT_EQUAL(EDD_OK, EDD_ProtVerifyStep(&set, &failed));
+  TEST_ASSERT_EQUAL(EDD_OK, EDD_ProtVerifyStep(&set, &failed));
+  TEST_ASSERT_EQUAL_UINT16(1u, failed);
+  TEST_ASSERT_EQUAL_UINT32(2u, set.failCount);
+
+  /* Restored by the application and re-synchronized */
+  varD[17] ^= 0x10u;
+  TEST_ASSERT_EQUAL(EDD_OK, EDD_ProtInit(&set, vars, 5u, 5u));
+  TEST_ASSERT_EQUAL(EDD_OK, EDD_ProtVerifyStep(&set, &failed));
+  TEST_ASSERT_EQUAL_UINT16(0u, failed);
+}
+
+/**
+ * @test Test several mismatches in one step
+ * @brief Verify count and first index when a step finds two corrupted variables
+ */
+void test_EDD_ProtVerifyStep_SeveralMismatches(void) {
+  uint16_t failed;
+
+  TEST_ASSERT_EQUAL(EDD_OK, EDD_ProtInit(&set, vars, 5u, 5u));
+  varB[0] ^= 0x01u;
+  varE[1] ^= 0x80u;
+
+  TEST_ASSERT_EQUAL(EDD_OK, EDD_ProtVerifyStep(&set, &failed));
+  TEST_ASSERT_EQUAL_UINT16(2u, failed);
+  TEST_ASSERT_EQUAL_UINT16(1u, set.firstFailed);
+  TEST_ASSERT_EQUAL_UINT16(0u, set.next);
+}
+
+/**
+ * @test Test the worst case detection figures
+ * @brief Verify ceil(count / perTick) against the longest observed gap between two checks of a corrupted variable, and the byte bound
+ */
+void test_EDD_ProtVerifyStep_WorstCaseDetection(void) {
+  EDD_ProtWorstCaseType wc;
+  uint16_t failed;
+  uint16_t step;
+  uint16_t lastDetection = 0u;
+  uint16_t maxGap = 0u;
+
+  TEST_ASSERT_EQUAL(EDD_OK, EDD_ProtInit(&set, vars, 5u, 2u));
+  TEST_ASSERT_EQUAL(EDD_OK, EDD_ProtGetWorstCase(&set, &wc));
+  TEST_ASSERT_EQUAL_UINT16(3u, wc.detectionTicks);
+  TEST_ASSERT_EQUAL_UINT32(60u, wc.bytesPerTick);
+
+  varA[0] ^= 0x01u;
+  for(step = 1u; step <= 20u; step++) {
+    TEST_ASSERT_EQUAL(EDD_OK, EDD_ProtVerifyStep(&set, &failed));
+    if(failed != 0u) {
+      if((lastDetection != 0u) && ((uint16_t)(step - lastDetection) > maxGap)) { maxGap = (uint16_t)(step - lastDetection); }
+      lastDetection = step;
+    }
+  }
+  TEST_ASSERT_EQUAL_UINT16(wc.detectionTicks, maxGap);
+
+  /* perTick above the number of variables is limited to it */
+  TEST_ASSERT_EQUAL(EDD_OK, EDD_ProtInit(&set, vars, 5u, 9u));
+  TEST_ASSERT_EQUAL_UINT16(5u, set.perTick);
+  TEST_ASSERT_EQUAL(EDD_OK, EDD_ProtGetWorstCase(&set, &wc));
+  TEST_ASSERT_EQUAL_UINT16(1u, wc.detectionTicks);
+  TEST_ASSERT_EQUAL_UINT32(150u, wc.bytesPerTick);
+}
+
+/**
+ * @test Test the setup checks used by the verifier
+ * @brief Verify EDD_ProtInit rejects NULL pointers, empty lists, zero perTick and empty variables, and computes the CRCs
+ */
+void test_EDD_ProtVerifyStep_InitValidation(void) {
+  EDD_ProtVarType bad[2] = {{varA, 4u, 0u}, {NULL, 4u, 0u}};
+
+  TEST_ASSERT_EQUAL(EDD_NULL_PTR, EDD_ProtInit(NULL, vars, 5u, 1u));
+  TEST_ASSERT_EQUAL(EDD_NULL_PTR, EDD_ProtInit(&set, NULL, 5u, 1u));
+  TEST_ASSERT_EQUAL(EDD_NULL_PTR, EDD_ProtInit(&set, bad, 2u, 1u));
+  TEST_ASSERT_EQUAL(EDD_INVALID_LENGTH, EDD_ProtInit(&set, vars, 0u, 1u));
+  TEST_ASSERT_EQUAL(EDD_INVALID_LENGTH, EDD_ProtInit(&set, vars, 5u, 0u));
+
+  bad[1].data = varB;
+  bad[1].length = 0u;
+  TEST_ASSERT_EQUAL(EDD_INVALID_LENGTH, EDD_ProtInit(&set, bad, 2u, 1u));
+
+  TEST_ASSERT_EQUAL(EDD_OK, EDD_ProtInit(&set, vars, 5u, 1u));
+  TEST_ASSERT_EQUAL_HEX8(EDD_Crc8ComputeInternal(0x00u, varC, 1u), vars[2].crc);
+}
@@ -0,0 +1,61 @@
+#include "EDD_ProtWrite.h"
+
+/* CRC patch used by the function under test */
+uint8_t EDD_Crc8GfMul(uint8_t a, uint8_t b) {
+  uint8_t product = 0u;
+  uint8_t bit;
+
+  for(bit = 0u; bit < 8u; bit++) {
+    if((b & 0x01u) != 0u) { product ^= a; }
+    b >>= 1;
+    a = ((a & 0x80u) != 0u) ? (uint8_t)((uint8_t)(a << 1) ^ EDD_CRC8_POLY) : (uint8_t)(a << 1);
+  }
+
+  return product;
+}
+
+uint8_t EDD_Crc8ShiftZeros(uint8_t crc, uint32_t length) {
+  uint8_t power = EDD_CRC8_POLY; /* x^8 mod P */
+
+  while(length != 0u) {
+    if((length & 0x01u) != 0u) { crc = EDD_Crc8GfMul(crc, power); }
+    power = EDD_Crc8GfMul(power, power);
+    length >>= 1;
+  }
+
+  return crc;
+}
+
+EDD_ReturnType EDD_Crc8Patch(uint8_t oldCrc, uint32_t offset, const uint8_t *oldBytes, const uint8_t *newBytes, uint32_t length, uint32_t totalLength, uint8_t *crc_out) {
+  uint8_t delta = EDD_CRC8_INIT;
+  uint32_t i;
+
+  if((oldBytes == NULL) || (newBytes == NULL) || (crc_out == NULL)) { return EDD_NULL_PTR; }
+
+  if((length == 0u) || (length > totalLength) || (offset > (totalLength - length))) { return EDD_INVALID_LENGTH; }
+
+  /* CRC of the difference pattern; the zero bytes in front of it do not change it */
+  for(i = 0u; i < length; i++) { delta = EDD_CRC8_BYTE_UPDATE(delta, (uint8_t)(oldBytes[i] ^ newBytes[i])); }
+
+  /* Move the difference to its position: zero bytes behind the patched area */
+  *crc_out = (uint8_t)(oldCrc ^ EDD_Crc8ShiftZeros(delta, totalLength - offset - length));
+
+  return EDD_OK;
+}
+
+/* FUNCTION TO TEST */
+
+EDD_ReturnType EDD_ProtWrite(EDD_ProtVarType *var, uint16_t offset, const uint8_t *src, uint16_t length) {
+  uint16_t i;
+
+  if((var == NULL) || (var->data == NULL) || (src == NULL)) { return EDD_NULL_PTR; }
+
+  if((length == 0u) || (length > var->length) || (offset > (uint16_t)(var->length - length))) { return EDD_INVALID_LENGTH; }
+
+  /* Arguments are valid, the patch cannot fail */
+  (void)EDD_Crc8Patch(var->crc, offset, &var->data[offset], src, length, var->length, &var->crc);
+
+  for(i = 0u; i < length; i++) { var->data[offset + i] = src[i]; }
+
+  return EDD_OK;
+}
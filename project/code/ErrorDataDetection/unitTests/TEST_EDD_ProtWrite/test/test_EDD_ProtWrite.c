@@ -0,0 +1,124 @@
+#include "EDD_ProtWrite.h"
+#include "unity.h"
+
+/**
+ * @file test_EDD_ProtWrite.c
+ * @brief Unit tests for EDD_ProtWrite function
+ * @details Checks the argument checks, the incremental CRC against a full recomputation and that earlier corruption stays visible
+ */
+
+/* Stand-in for a module context: mixed field sizes, 12 bytes */
+typedef struct {
+  uint8_t state;
+  uint8_t spare;
+  uint16_t timerA_ms;
+  uint16_t timerB_ms;
+  uint16_t timerC_ms;
+  uint32_t counter;
+} TestCtx_t;
+
+static TestCtx_t ctx;
+static EDD_ProtVarType var;
+
+/**
+ * @brief Helper: bitwise CRC-8/ATM reference
+ */
+static uint8_t referenceCrc8(const uint8_t *data, uint32_t length) {
+  uint8_t crc = 0x00u;
+  uint32_t i;
+  uint8_t bit;
+
+  for(i = 0u; i < length; i++) {
+    crc ^= data[i];
+    for(bit = 0u; bit < 8u; bit++) { crc = ((crc & 0x80u) != 0u) ? (uint8_t)((uint8_t)(crc << 1) ^ 0x07u) : (uint8_t)(crc << 1); }
+  }
+
+  return crc;
+}
+
+/* Setup and teardown functions */
+void setUp(void) {
+  ctx.state = 1u;
+  ctx.spare = 0u;
+  ctx.timerA_ms = 120u;
+  ctx.timerB_ms = 0u;
+  ctx.timerC_ms = 500u;
+  ctx.counter = 0x12345678uL;
+
+  var.data = (uint8_t *)&ctx;
+  var.length = (uint16_t)sizeof(ctx);
+  var.crc = referenceCrc8(var.data, var.length);
+}
+
+void tearDown(void) { /* Teardown code if needed */ }
+
+/**
+ * @test Test NULL pointers
+ * @brief Verify EDD_NULL_PTR for NULL var, NULL var->data and NULL src, without modifying the variable
+ */
+void test_EDD_ProtWrite_NullPointers(void) {
+  const uint8_t value = 2u;
+  EDD_ProtVarType noData = {NULL, 4u, 0u};
+
+  TEST_ASSERT_EQUAL(EDD_NULL_PTR, EDD_ProtWrite(NULL, 0u, &value, 1u));
+  TEST_ASSERT_EQUAL(EDD_NULL_PTR, EDD_ProtWrite(&noData, 0u, &value, 1u));
+  TEST_ASSERT_EQUAL(EDD_NULL_PTR, EDD_ProtWrite(&var, 0u, NULL, 1u));
+  TEST_ASSERT_EQUAL_UINT8(1u, ctx.state);
+}
+
+/**
+ * @test Test invalid areas
+ * @brief Verify EDD_INVALID_LENGTH for an empty write and for writes beyond the variable
+ */
+void test_EDD_ProtWrite_InvalidArea(void) {
+  const uint8_t bytes[16] = {0u};
+  const uint8_t savedCrc = var.crc;
+
+  TEST_ASSERT_EQUAL(EDD_INVALID_LENGTH, EDD_ProtWrite(&var, 0u, bytes, 0u));
+  TEST_ASSERT_EQUAL(EDD_INVALID_LENGTH, EDD_ProtWrite(&var, 0u, bytes, (uint16_t)(sizeof(ctx) + 1u)));
+  TEST_ASSERT_EQUAL(EDD_INVALID_LENGTH, EDD_ProtWrite(&var, (uint16_t)(sizeof(ctx) - 1u), bytes, 2u));
+  TEST_ASSERT_EQUAL(EDD_INVALID_LENGTH, EDD_ProtWrite(&var, 0xFFFFu, bytes, 1u));
+  TEST_ASSERT_EQUAL_HEX8(savedCrc, var.crc);
+  TEST_ASSERT_EQUAL_UINT8(1u, ctx.state);
+}
+
+/**
+ * @test Test field writes
+ * @brief Verify that after each write of a field (first, middle, last, whole variable) the CRC equals a full recomputation
+ */
+void test_EDD_ProtWrite_CrcFollowsWrites(void) {
+  const uint8_t state = 2u;
+  const uint16_t timer = 130u;
+  const uint32_t counter = 0xCAFEF00DuL;
+  TestCtx_t whole = {0u, 0u, 1u, 2u, 3u, 4u};
+
+  TEST_ASSERT_EQUAL(EDD_OK, EDD_ProtWrite(&var, 0u, &state, 1u));
+  TEST_ASSERT_EQUAL_UINT8(2u, ctx.state);
+  TEST_ASSERT_EQUAL_HEX8(referenceCrc8(var.data, var.length), var.crc);
+
+  TEST_ASSERT_EQUAL(EDD_OK, EDD_ProtWrite(&var, 2u, (const uint8_t *)&timer, 2u));
+  TEST_ASSERT_EQUAL_UINT16(130u, ctx.timerA_ms);
+  TEST_ASSERT_EQUAL_HEX8(referenceCrc8(var.data, var.length), var.crc);
+
+  TEST_ASSERT_EQUAL(EDD_OK, EDD_ProtWrite(&var, 8u, (const uint8_t *)&counter, 4u));
+  TEST_ASSERT_EQUAL_HEX32(0xCAFEF00DuL, ctx.counter);
+  TEST_ASSERT_EQUAL_HEX8(referenceCrc8(var.data, var.length), var.crc);
+
+  TEST_ASSERT_EQUAL(EDD_OK, EDD_ProtWrite(&var, 0u, (const uint8_t *)&whole, (uint16_t)sizeof(whole)));
+  TEST_ASSERT_EQUAL_HEX8(referenceCrc8(var.data, var.length), var.crc);
+}
+
+/**
+ * @test Test a write after a corruption
+ * @brief Verify that a bit flip made behind the API is not masked by a later write to another field
+ */
+void test_EDD_ProtWrite_CorruptionStaysVisible(void) {
+  const uint16_t timer = 0u;
+
+  ctx.timerC_ms ^= 0x0100u;
+  TEST_ASSERT_EQUAL(EDD_OK, EDD_ProtWrite(&var, 2u, (const uint8_t *)&timer, 2u));
+  TEST_ASSERT_NOT_EQUAL(referenceCrc8(var.data, var.length), var.crc);
+
+  ctx.timerC_ms ^= 0x0100u;
+  TEST_ASSERT_EQUAL_HEX8(referenceCrc8(var.data, var.length), var.crc);
+}
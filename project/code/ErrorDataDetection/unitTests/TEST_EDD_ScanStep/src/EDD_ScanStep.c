@@ -0,0 +1,94 @@
+#include "EDD_ScanStep.h"
+
+/* Bitwise stand-in for the CRC-8 engine, also counts the bytes it is given per step */
+uint32_t EDD_ScanTestEngineBytes = 0u;
+
+uint8_t EDD_Crc8ComputeInternal(uint8_t crc, const uint8_t *data, uint32_t length) {
+  uint32_t i;
+  uint8_t bit;
+
+  EDD_ScanTestEngineBytes += length;
+  for(i = 0u; i < length; i++) {
+    crc ^= data[i];
+    for(bit = 0u; bit < 8u; bit++) { crc = ((crc & 0x80u) != 0u) ? (uint8_t)((uint8_t)(crc << 1) ^ EDD_CRC8_POLY) : (uint8_t)(crc << 1); }
+  }
+
+  return crc;
+}
+
+/* Scanner setup used by the function under test */
+EDD_ReturnType EDD_ScanInit(EDD_ScanCtx *ctx, const EDD_ScanRegionType *regions, uint16_t count, uint32_t budget) {
+  uint16_t i;
+
+  if((ctx == NULL) || (regions == NULL)) { return EDD_NULL_PTR; }
+
+  if((count == 0u) || (budget == 0u)) { return EDD_INVALID_LENGTH; }
+
+  for(i = 0u; i < count; i++) {
+    if(regions[i].data == NULL) { return EDD_NULL_PTR; }
+    if(regions[i].length == 0u) { return EDD_INVALID_LENGTH; }
+  }
+
+  ctx->regions = regions;
+  ctx->regionCount = count;
+  ctx->budget = budget;
+  ctx->region = 0u;
+  ctx->offset = 0u;
+  ctx->crc = EDD_CRC8_INIT;
+  ctx->failedRegions = 0u;
+  ctx->firstFailed = 0u;
+  ctx->lastPassFailedRegions = 0u;
+  ctx->lastPassFirstFailed = 0u;
+  ctx->passCount = 0u;
+
+  return EDD_OK;
+}
+
+/* FUNCTION TO TEST */
+
+EDD_ReturnType EDD_ScanStep(EDD_ScanCtx *ctx, EDD_ScanResultType *result_out) {
+  const EDD_ScanRegionType *region;
+  uint32_t left;
+  uint32_t chunk;
+
+  if((ctx == NULL) || (result_out == NULL)) { return EDD_NULL_PTR; }
+
+  left = ctx->budget;
+  *result_out = EDD_SCAN_BUSY;
+
+  while(left > 0u) {
+    region = &ctx->regions[ctx->region];
+    chunk = region->length - ctx->offset;
+    if(chunk > left) { chunk = left; }
+
+    ctx->crc = EDD_Crc8ComputeInternal(ctx->crc, &region->data[ctx->offset], chunk);
+    ctx->offset += chunk;
+    left -= chunk;
+
+    if(ctx->offset == region->length) {
+      if(ctx->crc != region->expectedCrc) {
+        if(ctx->failedRegions == 0u) { ctx->firstFailed = ctx->region; }
+        ctx->failedRegions++;
+      }
+
+      ctx->region++;
+      ctx->offset = 0u;
+      ctx->crc = EDD_CRC8_INIT;
+
+      if(ctx->region == ctx->regionCount) {
+        /* End of pass: publish the verdict and restart, one verdict per step */
+        ctx->lastPassFailedRegions = ctx->failedRegions;
+        ctx->lastPassFirstFailed = ctx->firstFailed;
+        ctx->passCount++;
+        *result_out = (ctx->failedRegions == 0u) ? EDD_SCAN_PASS_OK : EDD_SCAN_PASS_FAILED;
+
+        ctx->region = 0u;
+        ctx->failedRegions = 0u;
+        ctx->firstFailed = 0u;
+        break;
+      }
+    }
+  }
+
+  return EDD_OK;
+}
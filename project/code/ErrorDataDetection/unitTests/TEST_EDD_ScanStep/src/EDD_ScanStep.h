@@ -0,0 +1,14 @@
+#ifndef EDD_ScanStep_H
+#define EDD_ScanStep_H
+
+#include "errorDataDetection.h"
+#include "errorDataDetection_priv.h"
+#include <stdint.h>
+
+uint8_t EDD_Crc8ComputeInternal(uint8_t crc, const uint8_t *data, uint32_t length);
+
+EDD_ReturnType EDD_ScanInit(EDD_ScanCtx *ctx, const EDD_ScanRegionType *regions, uint16_t count, uint32_t budget);
+
+EDD_ReturnType EDD_ScanStep(EDD_ScanCtx *ctx, EDD_ScanResultType *result_out);
+
+#endif
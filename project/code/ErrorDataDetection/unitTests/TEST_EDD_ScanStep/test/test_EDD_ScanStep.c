@@ -0,0 +1,179 @@
+#include "EDD_ScanStep.h"
+#include "unity.h"
+
+/**
+ * @file test_EDD_ScanStep.c
+ * @brief Unit tests for EDD_ScanStep function
+ * @details Checks the per-step byte budget, the partial CRC kept across steps and the pass verdicts
+ */
+
+extern uint32_t EDD_ScanTestEngineBytes;
+
+static uint8_t calibration[100];
+static uint8_t code[37];
+static uint8_t table[5];
+static EDD_ScanRegionType regions[3];
+static EDD_ScanCtx ctx;
+
+/**
+ * @brief Helper: bitwise CRC-8/ATM reference
+ */
+static uint8_t referenceCrc8(const uint8_t *data, uint32_t length) {
+  uint8_t crc = 0x00u;
+  uint32_t i;
+  uint8_t bit;
+
+  for(i = 0u; i < length; i++) {
+    crc ^= data[i];
+    for(bit = 0u; bit < 8u; bit++) { crc = ((crc & 0x80u) != 0u) ? (uint8_t)((uint8_t)(crc << 1) ^ 0x07u) : (uint8_t)(crc << 1); }
+  }
+
+  return crc;
+}
+
+/* Setup and teardown functions */
+void setUp(void) {
+  uint32_t i;
+
+  for(i = 0u; i < sizeof(calibration); i++) { calibration[i] = (uint8_t)((i * 7u) + 1u); }
+  for(i = 0u; i < sizeof(code); i++) { code[i] = (uint8_t)(0xA5u ^ i); }
+  for(i = 0u; i < sizeof(table); i++) { table[i] = (uint8_t)(i + 0x30u); }
+
+  regions[0].data = calibration;
+  regions[0].length = sizeof(calibration);
+  regions[0].expectedCrc = referenceCrc8(calibration, sizeof(calibration));
+  regions[1].data = code;
+  regions[1].length = sizeof(code);
+  regions[1].expectedCrc = referenceCrc8(code, sizeof(code));
+  regions[2].data = table;
+  regions[2].length = sizeof(table);
+  regions[2].expectedCrc = referenceCrc8(table, sizeof(table));
+
+  EDD_ScanTestEngineBytes = 0u;
+}
+
+void tearDown(void) { /* Teardown code if needed */ }
+
+/**
+ * @test Test NULL pointers
+ * @brief Verify that function returns EDD_NULL_PTR for every NULL pointer argument
+ */
+void test_EDD_ScanStep_NullPointers(void) {
+  EDD_ScanResultType result;
+
+  TEST_ASSERT_EQUAL(EDD_OK, EDD_ScanInit(&ctx, regions, 3u, 16u));
+
+  TEST_ASSERT_EQUAL(EDD_NULL_PTR, EDD_ScanStep(NULL, &result));
+  TEST_ASSERT_EQUAL(EDD_NULL_PTR, EDD_ScanStep(&ctx, NULL));
+  TEST_ASSERT_EQUAL_UINT32(0u, EDD_ScanTestEngineBytes);
+}
+
+/**
+ * @test Test the budget per step
+ * @brief Verify that no step hands more than the budget to the CRC engine and that a pass needs ceil(total / budget) steps
+ */
+void test_EDD_ScanStep_BudgetPerStep(void) {
+  EDD_ScanResultType result = EDD_SCAN_BUSY;
+  uint32_t steps = 0u;
+
+  TEST_ASSERT_EQUAL(EDD_OK, EDD_ScanInit(&ctx, regions, 3u, 16u));
+
+  while(result == EDD_SCAN_BUSY) {
+    EDD_ScanTestEngineBytes = 0u;
+    TEST_ASSERT_EQUAL(EDD_OK, EDD_ScanStep(&ctx, &result));
+    TEST_ASSERT_TRUE(EDD_ScanTestEngineBytes <= 16u);
+    steps++;
+  }
+
+  TEST_ASSERT_EQUAL(EDD_SCAN_PASS_OK, result);
+  TEST_ASSERT_EQUAL_UINT32((142u + 15u) / 16u, steps);
+  TEST_ASSERT_EQUAL_UINT32(1u, ctx.passCount);
+  TEST_ASSERT_EQUAL_UINT16(0u, ctx.lastPassFailedRegions);
+}
+
+/**
+ * @test Test a budget of one byte
+ * @brief Verify that the partial CRC is carried across every step (one byte per call)
+ */
+void test_EDD_ScanStep_SingleByteBudget(void) {
+  EDD_ScanResultType result;
+  uint32_t i;
+
+  TEST_ASSERT_EQUAL(EDD_OK, EDD_ScanInit(&ctx, regions, 3u, 1u));
+
+  for(i = 0u; i < 141u; i++) {
+    TEST_ASSERT_EQUAL(EDD_OK, EDD_ScanStep(&ctx, &result));
+    TEST_ASSERT_EQUAL(EDD_SCAN_BUSY, result);
+  }
+
+  TEST_ASSERT_EQUAL(EDD_OK, EDD_ScanStep(&ctx, &result));
+  TEST_ASSERT_EQUAL(EDD_SCAN_PASS_OK, result);
+}
+
+/**
+ * @test Test a corrupted region
+ * @brief Verify that the mismatch is reported only at the end of the pass, with count and first region
+ */
+void test_EDD_ScanStep_MismatchReportedAtEndOfPass(void) {
+  EDD_ScanResultType result = EDD_SCAN_BUSY;
+  uint32_t steps = 0u;
+
+  code[20] ^= 0x04u;
+  TEST_ASSERT_EQUAL(EDD_OK, EDD_ScanInit(&ctx, regions, 3u, 50u));
+
+  while(result == EDD_SCAN_BUSY) {
+    TEST_ASSERT_EQUAL(EDD_OK, EDD_ScanStep(&ctx, &result));
+    steps++;
+  }
+
+  TEST_ASSERT_EQUAL(EDD_SCAN_PASS_FAILED, result);
+  TEST_ASSERT_EQUAL_UINT32(3u, steps);
+  TEST_ASSERT_EQUAL_UINT16(1u, ctx.lastPassFailedRegions);
+  TEST_ASSERT_EQUAL_UINT16(1u, ctx.lastPassFirstFailed);
+}
+
+/**
+ * @test Test consecutive passes
+ * @brief Verify that a pass ends the step, the scan restarts and a repaired region gives a clean second pass
+ */
+void test_EDD_ScanStep_ConsecutivePasses(void) {
+  EDD_ScanResultType result;
+
+  calibration[0] ^= 0xFFu;
+  table[4] ^= 0x01u;
+  TEST_ASSERT_EQUAL(EDD_OK, EDD_ScanInit(&ctx, regions, 3u, 1000u));
+
+  /* Budget covers more than a pass: the step stops at the end of the pass */
+  EDD_ScanTestEngineBytes = 0u;
+  TEST_ASSERT_EQUAL(EDD_OK, EDD_ScanStep(&ctx, &result));
+  TEST_ASSERT_EQUAL(EDD_SCAN_PASS_FAILED, result);
+  TEST_ASSERT_EQUAL_UINT32(142u, EDD_ScanTestEngineBytes);
+  TEST_ASSERT_EQUAL_UINT16(2u, ctx.lastPassFailedRegions);
+  TEST_ASSERT_EQUAL_UINT16(0u, ctx.lastPassFirstFailed);
+
+  calibration[0] ^= 0xFFu;
+  table[4] ^= 0x01u;
+
+  TEST_ASSERT_EQUAL(EDD_OK, EDD_ScanStep(&ctx, &result));
+  TEST_ASSERT_EQUAL(EDD_SCAN_PASS_OK, result);
+  TEST_ASSERT_EQUAL_UINT16(0u, ctx.lastPassFailedRegions);
+  TEST_ASSERT_EQUAL_UINT32(2u, ctx.passCount);
+}
+
+/**
+ * @test Test the setup checks used by the scanner
+ * @brief Verify EDD_ScanInit rejects NULL pointers, empty lists, zero budget and empty regions
+ */
+void test_EDD_ScanStep_InitValidation(void) {
+  EDD_ScanRegionType bad[2] = {{calibration, 4u, 0u}, {NULL, 4u, 0u}};
+
+  TEST_ASSERT_EQUAL(EDD_NULL_PTR, EDD_ScanInit(NULL, regions, 3u, 16u));
+  TEST_ASSERT_EQUAL(EDD_NULL_PTR, EDD_ScanInit(&ctx, NULL, 3u, 16u));
+  TEST_ASSERT_EQUAL(EDD_NULL_PTR, EDD_ScanInit(&ctx, bad, 2u, 16u));
+  TEST_ASSERT_EQUAL(EDD_INVALID_LENGTH, EDD_ScanInit(&ctx, regions, 0u, 16u));
+  TEST_ASSERT_EQUAL(EDD_INVALID_LENGTH, EDD_ScanInit(&ctx, regions, 3u, 0u));
+
+  bad[1].data = code;
+  bad[1].length = 0u;
+  TEST_ASSERT_EQUAL(EDD_INVALID_LENGTH, EDD_ScanInit(&ctx, bad, 2u, 16u));
+}
@@ -3,14 +3,14 @@
 
 /* FUNCTION TO TEST */
 
-EDD_ReturnType EDD_VerifyCrc8(const uint8_t *data, uint8_t length, uint8_t expected_crc, uint8_t *result_out) {
+EDD_ReturnType EDD_VerifyCrc8(const uint8_t *data, uint32_t length, uint8_t expected_crc, uint8_t *result_out) {
   uint8_t computed;
 
   if((data == NULL) || (result_out == NULL)) { return EDD_NULL_PTR; }
 
   if(length == 0u) { return EDD_INVALID_LENGTH; }
 
-  computed = EDD_Crc8ComputeInternal(data, length);
+  computed = EDD_Crc8ComputeInternal(EDD_CRC8_INIT, data, length);
 
   *result_out = (computed == expected_crc) ? 1u : 0u;
 
@@ -49,11 +49,12 @@ static const uint8_t EDD_Crc8Table[256] = {
  * This function is intended for internal use only and provides the CRC-8
  * calculation using the lookup table.
  *
+ * @param crc    CRC accumulator to continue from.
  * @param data   Pointer to input data buffer.
  * @param length Number of bytes in the buffer.
  *
  * @return Computed CRC-8 value.
  */
-uint8_t EDD_Crc8ComputeInternal(const uint8_t *data, uint8_t length);
+uint8_t EDD_Crc8ComputeInternal(uint8_t crc, const uint8_t *data, uint32_t length);
 
 #endif /* ERRORDATADETECTION_PRIV_H */
@@ -75,7 +75,7 @@ void test_EDD_VerifyCrc8_ValidCrcMatch(void) {
   EDD_ReturnType ret;
 
   /* Mock the CRC computation to return the expected value */
-  EDD_Crc8ComputeInternal_ExpectAndReturn(data, 4, expected_crc);
+  EDD_Crc8ComputeInternal_ExpectAndReturn(EDD_CRC8_INIT, data, 4, expected_crc);
 
   ret = EDD_VerifyCrc8(data, 4, expected_crc, &result);
 
@@ -94,7 +94,7 @@ void test_EDD_VerifyCrc8_ValidCrcMismatch(void) {
   EDD_ReturnType ret;
 
   /* Mock the CRC computation to return a different value */
-  EDD_Crc8ComputeInternal_ExpectAndReturn(data, 4, computed_crc);
+  EDD_Crc8ComputeInternal_ExpectAndReturn(EDD_CRC8_INIT, data, 4, computed_crc);
 
   ret = EDD_VerifyCrc8(data, 4, expected_crc, &result);
 
@@ -111,7 +111,7 @@ void test_EDD_VerifyCrc8_SingleByteMatch(void) {
   uint8_t result = 0xFF;
   EDD_ReturnType ret;
 
-  EDD_Crc8ComputeInternal_ExpectAndReturn(data, 1, expected_crc);
+  EDD_Crc8ComputeInternal_ExpectAndReturn(EDD_CRC8_INIT, data, 1, expected_crc);
 
   ret = EDD_VerifyCrc8(data, 1, expected_crc, &result);
 
@@ -131,7 +131,7 @@ void test_EDD_VerifyCrc8_MaxLengthMatch(void) {
   /* Fill data with pattern */
   for(int i = 0; i < 255; i++) { data[i] = (uint8_t)(i & 0xFF); }
 
-  EDD_Crc8ComputeInternal_ExpectAndReturn(data, 255, expected_crc);
+  EDD_Crc8ComputeInternal_ExpectAndReturn(EDD_CRC8_INIT, data, 255, expected_crc);
 
   ret = EDD_VerifyCrc8(data, 255, expected_crc, &result);
 
@@ -148,7 +148,7 @@ void test_EDD_VerifyCrc8_LengthOne(void) {
   uint8_t result = 0xFF;
   EDD_ReturnType ret;
 
-  EDD_Crc8ComputeInternal_ExpectAndReturn(data, 1, expected_crc);
+  EDD_Crc8ComputeInternal_ExpectAndReturn(EDD_CRC8_INIT, data, 1, expected_crc);
 
   ret = EDD_VerifyCrc8(data, 1, expected_crc, &result);
 
@@ -165,7 +165,7 @@ void test_EDD_VerifyCrc8_CrcZero(void) {
   uint8_t result = 0xFF;
   EDD_ReturnType ret;
 
-  EDD_Crc8ComputeInternal_ExpectAndReturn(data, 2, expected_crc);
+  EDD_Crc8ComputeInternal_ExpectAndReturn(EDD_CRC8_INIT, data, 2, expected_crc);
 
   ret = EDD_VerifyCrc8(data, 2, expected_crc, &result);
 
@@ -182,7 +182,7 @@ void test_EDD_VerifyCrc8_CrcMaxValue(void) {
   uint8_t result = 0xFF;
   EDD_ReturnType ret;
 
-  EDD_Crc8ComputeInternal_ExpectAndReturn(data, 2, expected_crc);
+  EDD_Crc8ComputeInternal_ExpectAndReturn(EDD_CRC8_INIT, data, 2, expected_crc);
 
   ret = EDD_VerifyCrc8(data, 2, expected_crc, &result);
 
@@ -0,0 +1,33 @@
+#include "EDD_VerifyCrc8Batch.h"
+#include "errorDataDetection_priv.h"
+
+/* FUNCTION TO TEST */
+
+EDD_ReturnType EDD_VerifyCrc8Batch(const EDD_Crc8FrameType *frames, uint16_t count, uint8_t *result_bitmap) {
+  uint8_t crc[EDD_CRC8_BATCH_STREAMS];
+  uint16_t i;
+  uint8_t s;
+
+  if((frames == NULL) || (result_bitmap == NULL)) { return EDD_NULL_PTR; }
+
+  for(i = 0u; i < count; i++) {
+    if(frames[i].data == NULL) { return EDD_NULL_PTR; }
+    if(frames[i].length == 0u) { return EDD_INVALID_LENGTH; }
+  }
+
+  for(i = 0u; i < (uint16_t)((count + 7u) / 8u); i++) { result_bitmap[i] = 0u; }
+
+  for(i = 0u; ((uint32_t)count - i) >= EDD_CRC8_BATCH_STREAMS; i += EDD_CRC8_BATCH_STREAMS) {
+    EDD_Crc8ComputeInterleaved(&frames[i], crc);
+
+    for(s = 0u; s < EDD_CRC8_BATCH_STREAMS; s++) {
+      if(crc[s] == frames[i + s].expectedCrc) { result_bitmap[(i + s) >> 3] |= (uint8_t)(1u << ((i + s) & 7u)); }
+    }
+  }
+
+  for(; i < count; i++) {
+    if(EDD_Crc8ComputeInternal(EDD_CRC8_INIT, frames[i].data, frames[i].length) == frames[i].expectedCrc) { result_bitmap[i >> 3] |= (uint8_t)(1u << (i & 7u)); }
+  }
+
+  return EDD_OK;
+}
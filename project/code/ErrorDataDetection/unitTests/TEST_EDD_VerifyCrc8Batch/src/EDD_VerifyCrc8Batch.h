@@ -0,0 +1,9 @@
+#ifndef EDD_VerifyCrc8Batch_H
+#define EDD_VerifyCrc8Batch_H
+
+#include "errorDataDetection.h"
+#include <stdint.h>
+
+EDD_ReturnType EDD_VerifyCrc8Batch(const EDD_Crc8FrameType *frames, uint16_t count, uint8_t *result_bitmap);
+
+#endif
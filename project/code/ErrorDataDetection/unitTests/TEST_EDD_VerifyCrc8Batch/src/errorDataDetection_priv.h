@@ -0,0 +1,44 @@
+#ifndef ERRORDATADETECTION_PRIV_H
+#define ERRORDATADETECTION_PRIV_H
+
+#include "errorDataDetection.h"
+#include <stdint.h>
+
+/**
+ * @file errorDataDetection_priv.h
+ * @brief Private declarations for the Error Data Detection module (unit test view).
+ */
+
+/* CRC-8 parameters (CRC-8/ATM) */
+#define EDD_CRC8_POLY (0x07u) /**< CRC polynomial: x^8 + x^2 + x + 1 */
+#define EDD_CRC8_INIT (0x00u) /**< CRC initial value */
+
+/**
+ * @brief Internal CRC-8 computation routine.
+ *
+ * @details
+ * This function is intended for internal use only and provides the CRC-8
+ * calculation using the lookup table(s) selected by `EDD_CRC8_SLICING_FACTOR`.
+ *
+ * @param crc    CRC accumulator to continue from (`EDD_CRC8_INIT` for a new message).
+ * @param data   Pointer to input data buffer.
+ * @param length Number of bytes in the buffer.
+ *
+ * @return Computed CRC-8 value.
+ */
+uint8_t EDD_Crc8ComputeInternal(uint8_t crc, const uint8_t *data, uint32_t length);
+
+/**
+ * @brief Interleaved CRC-8 computation of `EDD_CRC8_BATCH_STREAMS` frames.
+ *
+ * @details
+ * Processes the common prefix length of all frames one byte per frame per
+ * iteration (independent dependency chains), then finishes every frame with
+ * @ref EDD_Crc8ComputeInternal.
+ *
+ * @param frames  `EDD_CRC8_BATCH_STREAMS` validated frame descriptors.
+ * @param crc_out Receives the `EDD_CRC8_BATCH_STREAMS` computed CRC-8 values.
+ */
+void EDD_Crc8ComputeInterleaved(const EDD_Crc8FrameType *frames, uint8_t *crc_out);
+
+#endif /* ERRORDATADETECTION_PRIV_H */
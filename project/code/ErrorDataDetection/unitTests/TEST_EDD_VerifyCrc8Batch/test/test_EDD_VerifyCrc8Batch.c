@@ -0,0 +1,103 @@
+#include "EDD_VerifyCrc8Batch.h"
+#include "mock_errorDataDetection_priv.h"
+#include "unity.h"
+
+/**
+ * @file test_EDD_VerifyCrc8Batch.c
+ * @brief Unit tests for EDD_VerifyCrc8Batch function
+ * @details Tests descriptor validation, grouping into interleaved streams and the result bitmap
+ */
+
+#define TEST_FRAME_COUNT (11u)
+
+static uint8_t testData[TEST_FRAME_COUNT][8];
+static EDD_Crc8FrameType testFrames[TEST_FRAME_COUNT];
+
+/* Setup and teardown functions */
+void setUp(void) {
+  uint8_t i;
+
+  for(i = 0u; i < TEST_FRAME_COUNT; i++) {
+    testFrames[i].data = testData[i];
+    testFrames[i].length = 8u;
+    testFrames[i].expectedCrc = (uint8_t)(0x10u + i);
+  }
+}
+
+void tearDown(void) { /* Teardown code if needed */ }
+
+/**
+ * @brief Callback: every interleaved stream returns the expected CRC except frame 2
+ */
+static void interleavedCallback(const EDD_Crc8FrameType *frames, uint8_t *crc_out, int cmock_num_calls) {
+  uint8_t s;
+
+  (void)cmock_num_calls;
+
+  for(s = 0u; s < EDD_CRC8_BATCH_STREAMS; s++) { crc_out[s] = (&frames[s] == &testFrames[2]) ? 0x00u : frames[s].expectedCrc; }
+}
+
+/* =============================
+ *  Test Cases
+ * ============================= */
+
+/**
+ * @brief Test: NULL frames or bitmap pointer should return EDD_NULL_PTR
+ */
+void test_EDD_VerifyCrc8Batch_NullPointers(void) {
+  uint8_t bitmap[2];
+
+  TEST_ASSERT_EQUAL(EDD_NULL_PTR, EDD_VerifyCrc8Batch(NULL, 1u, bitmap));
+  TEST_ASSERT_EQUAL(EDD_NULL_PTR, EDD_VerifyCrc8Batch(testFrames, 1u, NULL));
+}
+
+/**
+ * @brief Test: A frame with NULL data is rejected before any CRC is computed
+ */
+void test_EDD_VerifyCrc8Batch_NullFrameData(void) {
+  uint8_t bitmap[2] = {0xAAu, 0xAAu};
+
+  testFrames[5].data = NULL;
+
+  TEST_ASSERT_EQUAL(EDD_NULL_PTR, EDD_VerifyCrc8Batch(testFrames, TEST_FRAME_COUNT, bitmap));
+  TEST_ASSERT_EQUAL_HEX8(0xAA, bitmap[0]);
+}
+
+/**
+ * @brief Test: A frame with zero length is rejected
+ */
+void test_EDD_VerifyCrc8Batch_ZeroLengthFrame(void) {
+  uint8_t bitmap[2];
+
+  testFrames[0].length = 0u;
+
+  TEST_ASSERT_EQUAL(EDD_INVALID_LENGTH, EDD_VerifyCrc8Batch(testFrames, TEST_FRAME_COUNT, bitmap));
+}
+
+/**
+ * @brief Test: Empty batch returns EDD_OK without computation
+ */
+void test_EDD_VerifyCrc8Batch_EmptyBatch(void) {
+  uint8_t bitmap[1] = {0x55u};
+
+  TEST_ASSERT_EQUAL(EDD_OK, EDD_VerifyCrc8Batch(testFrames, 0u, bitmap));
+}
+
+/**
+ * @brief Test: Full groups are interleaved, the remainder is computed frame by frame
+ */
+void test_EDD_VerifyCrc8Batch_GroupsAndRemainder(void) {
+  uint8_t bitmap[2] = {0xFFu, 0xFFu};
+  uint8_t expected[2] = {0xFBu, 0x03u};
+  uint8_t i;
+
+  EDD_Crc8ComputeInterleaved_StubWithCallback(interleavedCallback);
+
+  for(i = (uint8_t)((TEST_FRAME_COUNT / EDD_CRC8_BATCH_STREAMS) * EDD_CRC8_BATCH_STREAMS); i < TEST_FRAME_COUNT; i++) {
+    EDD_Crc8ComputeInternal_ExpectAndReturn(EDD_CRC8_INIT, testData[i], 8u, (i == 10u) ? 0x00u : testFrames[i].expectedCrc);
+    if(i == 10u) { expected[1] = (uint8_t)(expected[1] & ~0x04u); }
+  }
+
+  TEST_ASSERT_EQUAL(EDD_OK, EDD_VerifyCrc8Batch(testFrames, TEST_FRAME_COUNT, bitmap));
+  TEST_ASSERT_EQUAL_HEX8_ARRAY(expected, bitmap, 2);
+}
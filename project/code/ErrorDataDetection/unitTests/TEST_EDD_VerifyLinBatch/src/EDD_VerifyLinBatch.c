@@ -0,0 +1,52 @@
+#include "EDD_VerifyLinBatch.h"
+
+/* Checksum kernel used by the function under test */
+uint32_t EDD_LinSumInternal(uint32_t sum, const uint8_t *data, uint32_t length) {
+  uint32_t word;
+  uint32_t i = 0u;
+
+  for(; (length - i) >= 4u; i += 4u) {
+    word = (uint32_t)data[i] | ((uint32_t)data[i + 1u] << 8) | ((uint32_t)data[i + 2u] << 16) | ((uint32_t)data[i + 3u] << 24);
+    sum += word;
+    sum += (sum < word) ? 1u : 0u;
+  }
+
+  for(; i < length; i++) {
+    sum += data[i];
+    sum += (sum < data[i]) ? 1u : 0u;
+  }
+
+  return sum;
+}
+
+uint8_t EDD_LinFold(uint32_t sum) {
+  sum = (sum & 0xFFFFu) + (sum >> 16);
+  sum = (sum & 0xFFFFu) + (sum >> 16);
+  sum = (sum & 0xFFu) + (sum >> 8);
+  sum = (sum & 0xFFu) + (sum >> 8);
+
+  return (uint8_t)~sum;
+}
+
+/* FUNCTION TO TEST */
+
+EDD_ReturnType EDD_VerifyLinBatch(const EDD_LinFrameType *frames, uint16_t count, uint8_t *result_bitmap) {
+  uint32_t sum;
+  uint16_t i;
+
+  if((frames == NULL) || (result_bitmap == NULL)) { return EDD_NULL_PTR; }
+
+  for(i = 0u; i < count; i++) {
+    if(frames[i].data == NULL) { return EDD_NULL_PTR; }
+    if(frames[i].length == 0u) { return EDD_INVALID_LENGTH; }
+  }
+
+  for(i = 0u; i < (uint16_t)((count + 7u) / 8u); i++) { result_bitmap[i] = 0u; }
+
+  for(i = 0u; i < count; i++) {
+    sum = (frames[i].model == EDD_LIN_ENHANCED) ? (uint32_t)frames[i].pid : EDD_LIN_SUM_INIT;
+    if(EDD_LinFold(EDD_LinSumInternal(sum, frames[i].data, frames[i].length)) == frames[i].expectedChecksum) { result_bitmap[i >> 3] |= (uint8_t)(1u << (i & 7u)); }
+  }
+
+  return EDD_OK;
+}
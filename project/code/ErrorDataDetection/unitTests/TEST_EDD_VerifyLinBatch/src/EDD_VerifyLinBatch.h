@@ -0,0 +1,14 @@
+#ifndef EDD_VerifyLinBatch_H
+#define EDD_VerifyLinBatch_H
+
+#include "errorDataDetection.h"
+#include "errorDataDetection_priv.h"
+#include <stdint.h>
+
+uint32_t EDD_LinSumInternal(uint32_t sum, const uint8_t *data, uint32_t length);
+
+uint8_t EDD_LinFold(uint32_t sum);
+
+EDD_ReturnType EDD_VerifyLinBatch(const EDD_LinFrameType *frames, uint16_t count, uint8_t *result_bitmap);
+
+#endif
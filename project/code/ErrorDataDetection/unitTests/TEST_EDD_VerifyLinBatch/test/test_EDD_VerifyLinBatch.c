@@ -0,0 +1,96 @@
+#include "EDD_VerifyLinBatch.h"
+#include "unity.h"
+
+/**
+ * @file test_EDD_VerifyLinBatch.c
+ * @brief Unit tests for EDD_VerifyLinBatch function
+ * @details Checks classic and enhanced frames, mixed batches and the input validation
+ */
+
+/* LIN 2.x specification example: PID 0x4A, data 55 93 E5 -> enhanced checksum 0xE6 */
+static const uint8_t specData[3] = {0x55u, 0x93u, 0xE5u};
+
+/* Diagnostic request frame (0x3C, classic checksum): ReadDataByIdentifier 0xF308 to NAD 0x01 */
+static const uint8_t diagData[8] = {0x01u, 0x03u, 0x22u, 0xF3u, 0x08u, 0xFFu, 0xFFu, 0xFFu};
+
+/* Setup and teardown functions */
+void setUp(void) { /* Setup code if needed */ }
+
+void tearDown(void) { /* Teardown code if needed */ }
+
+/**
+ * @test Test NULL pointers
+ * @brief Verify EDD_NULL_PTR for the frame list, the bitmap and a frame buffer
+ */
+void test_EDD_VerifyLinBatch_NullPointers(void) {
+  EDD_LinFrameType frames[2] = {{specData, 3u, 0x4Au, EDD_LIN_ENHANCED, 0xE6u}, {NULL, 3u, 0x00u, EDD_LIN_CLASSIC, 0x00u}};
+  uint8_t bitmap = 0xAAu;
+
+  TEST_ASSERT_EQUAL(EDD_NULL_PTR, EDD_VerifyLinBatch(NULL, 1u, &bitmap));
+  TEST_ASSERT_EQUAL(EDD_NULL_PTR, EDD_VerifyLinBatch(frames, 1u, NULL));
+  TEST_ASSERT_EQUAL(EDD_NULL_PTR, EDD_VerifyLinBatch(frames, 2u, &bitmap));
+  TEST_ASSERT_EQUAL_HEX8(0xAA, bitmap);
+}
+
+/**
+ * @test Test a frame without data
+ * @brief Verify EDD_INVALID_LENGTH before any result is written
+ */
+void test_EDD_VerifyLinBatch_ZeroLength(void) {
+  EDD_LinFrameType frames[2] = {{specData, 3u, 0x4Au, EDD_LIN_ENHANCED, 0xE6u}, {specData, 0u, 0x4Au, EDD_LIN_ENHANCED, 0xE6u}};
+  uint8_t bitmap = 0xAAu;
+
+  TEST_ASSERT_EQUAL(EDD_INVALID_LENGTH, EDD_VerifyLinBatch(frames, 2u, &bitmap));
+  TEST_ASSERT_EQUAL_HEX8(0xAA, bitmap);
+}
+
+/**
+ * @test Test the specification examples
+ * @brief Verify the enhanced example and that the classic model ignores the PID
+ */
+void test_EDD_VerifyLinBatch_SpecificationExample(void) {
+  EDD_LinFrameType frames[3] = {
+      {specData, 3u, 0x4Au, EDD_LIN_ENHANCED, 0xE6u}, /* correct enhanced checksum */
+      {specData, 3u, 0x4Au, EDD_LIN_CLASSIC, 0xE6u},  /* same byte, classic model: mismatch */
+      {specData, 3u, 0x00u, EDD_LIN_CLASSIC, 0x31u},  /* classic: ~(0x55 + 0x93 + 0xE5 with carries) */
+  };
+  uint8_t bitmap = 0u;
+
+  TEST_ASSERT_EQUAL(EDD_OK, EDD_VerifyLinBatch(frames, 3u, &bitmap));
+  TEST_ASSERT_EQUAL_HEX8(0x05, bitmap);
+}
+
+/**
+ * @test Test a mixed batch over more than 8 frames
+ * @brief Verify bit positions in a 2-byte bitmap with diagnostic (classic) and application (enhanced) frames
+ */
+void test_EDD_VerifyLinBatch_MixedBatch(void) {
+  EDD_LinFrameType frames[10];
+  uint8_t bitmap[2] = {0xFFu, 0xFFu};
+  uint8_t checksum;
+  uint16_t i;
+
+  checksum = EDD_LinFold(EDD_LinSumInternal(0u, diagData, sizeof(diagData)));
+
+  for(i = 0u; i < 10u; i++) {
+    if((i & 1u) == 0u) {
+      frames[i].data = diagData;
+      frames[i].length = sizeof(diagData);
+      frames[i].pid = 0x3Cu;
+      frames[i].model = EDD_LIN_CLASSIC;
+      frames[i].expectedChecksum = checksum;
+    } else {
+      frames[i].data = specData;
+      frames[i].length = sizeof(specData);
+      frames[i].pid = 0x4Au;
+      frames[i].model = EDD_LIN_ENHANCED;
+      frames[i].expectedChecksum = 0xE6u;
+    }
+  }
+  frames[3].expectedChecksum = 0xE7u;
+  frames[8].pid = 0x7Du; /* ignored by the classic model */
+
+  TEST_ASSERT_EQUAL(EDD_OK, EDD_VerifyLinBatch(frames, 10u, bitmap));
+  TEST_ASSERT_EQUAL_HEX8(0xF7, bitmap[0]);
+  TEST_ASSERT_EQUAL_HEX8(0x03, bitmap[1]);
+}
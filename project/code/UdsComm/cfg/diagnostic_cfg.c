@@ -7,9 +7,39 @@
  */
 
 #include "diagnostic_cfg.h"
+#include "diagnostic.h"
 #include "diagnostic_cfg_priv.h"
 #define NULL ((void *)0)
 
+/* Indexed by SID - DIAG_CFG_SID_FIRST; SIDs not listed have no service. Minimum lengths include the SID. */
+const DiagCfg_SidCfg_t DiagCfg_SidCfg_cst[DIAG_CFG_SID_COUNT] = {
+    /* ClearDiagnosticInformation: groupOfDTC (3 bytes) */
+    [0x14u - DIAG_CFG_SID_FIRST] = {4u, DIAG_CFG_SESSION_DEFAULT | DIAG_CFG_SESSION_EXTENDED, 0u, &ApplLinDiagClearDiagnosticInformation},
+    /* ReadDTCInformation: sub-function */
+    [0x19u - DIAG_CFG_SID_FIRST] = {2u, DIAG_CFG_SESSION_DEFAULT | DIAG_CFG_SESSION_EXTENDED, 0u, &ApplLinDiagReadDtcInformation},
+    /* ReadDataByIdentifier: DID#1 .. DID#n */
+    [0x22u - DIAG_CFG_SID_FIRST] = {3u, DIAG_CFG_SESSION_DEFAULT | DIAG_CFG_SESSION_EXTENDED, 0u, &ApplLinDiagReadDataById},
+    /* ReadDataByPeriodicIdentifier: transmissionMode, periodic identifiers (none with stopSending) */
+    [0x2Au - DIAG_CFG_SID_FIRST] = {2u, DIAG_CFG_SESSION_DEFAULT | DIAG_CFG_SESSION_EXTENDED, 0u, &ApplLinDiagReadDataByPeriodicId},
+    /* WriteDataByIdentifier: DID, at least one data byte */
+    [0x2Eu - DIAG_CFG_SID_FIRST] = {4u, DIAG_CFG_SESSION_DEFAULT | DIAG_CFG_SESSION_EXTENDED, 0u, &ApplLinDiagWriteDataById},
+    /* RoutineControl: sub-function, RID */
+    [0x31u - DIAG_CFG_SID_FIRST] = {4u, DIAG_CFG_SESSION_DEFAULT | DIAG_CFG_SESSION_EXTENDED, 0u, &ApplLinDiagRoutineControl},
+    /* TesterPresent: sub-function */
+    [0x3Eu - DIAG_CFG_SID_FIRST] = {2u, DIAG_CFG_SESSION_DEFAULT | DIAG_CFG_SESSION_PROGRAMMING | DIAG_CFG_SESSION_EXTENDED, 0u, &ApplLinDiagTesterPresent},
+};
+
+/* Example fault memory: one over-voltage DTC, status testFailed | confirmedDTC */
+static const uint32 diagCfgDtc_cau32[] = {0x901217u};
+static uint8 diagCfgDtcStatus_au8[sizeof(diagCfgDtc_cau32) / sizeof(diagCfgDtc_cau32[0])] = {0x09u};
+
+/* Response cache: serialized payloads of the cached DIDs, their slot state,
+ * length and remaining lifetime (ageDidCache() ticks, 0 = no expiry) */
+static uint8 diagCfgCacheArena_au8[DIAG_CFG_CACHE_ARENA_ALLOC];
+static volatile uint8 diagCfgCacheState_au8[DIAG_CFG_CACHE_SLOT_ALLOC];
+static uint8 diagCfgCacheLen_au8[DIAG_CFG_CACHE_SLOT_ALLOC];
+static uint16 diagCfgCacheTicks_au16[DIAG_CFG_CACHE_SLOT_ALLOC];
+
 /** @copydoc checkCurrentNad */
 void checkCurrentNad(uint8 currentNad, Std_ReturnType *result) {
   (void)currentNad;
@@ -21,42 +51,246 @@ void checkCurrentNad(uint8 currentNad, Std_ReturnType *result) {
 }
 
 void checkMsgDataLength(uint16_t dataLength, Std_ReturnType *result) {
-  if(dataLength > 0u && dataLength <= 32u) {
+  if(dataLength > 0u && dataLength <= DIAG_CFG_RX_BUFFER_SIZE) {
     *result = E_OK;
   } else {
     *result = E_NOT_OK;
   }
 }
 
-Std_ReturnType RdbiVhitOverVoltageFaultDiag_(uint8 *const output_pu8, uint8 *const size_pu8, uint8 *const errCode_pu8) {
+Std_ReturnType RdbiVhitOverVoltageFaultDiag_(uint8 *const output_pu8, uint8 *const size_pu8, uint8 *const errCode_pu8, uint8 opStatus_u8) {
   (void)size_pu8;
   (void)errCode_pu8;
+  (void)opStatus_u8;
   output_pu8[0] = 0x01; /* Example data */
   return E_OK;
 }
 
-Std_ReturnType SubfunctionRequestOutOfRange_(uint8 *const output_pu8, uint8 *const size_pu8, uint8 *const errCode_pu8) {
+Std_ReturnType SubfunctionRequestOutOfRange_(uint8 *const output_pu8, uint8 *const size_pu8, uint8 *const errCode_pu8, uint8 opStatus_u8) {
   (void)output_pu8;
   (void)size_pu8;
+  (void)opStatus_u8;
   if(NULL != errCode_pu8) { *errCode_pu8 = 0x12; }
   return E_NOT_OK;
 }
 
-Std_ReturnType getHandlersForReadDataById(uint8 *l_errCode_u8, uint16 l_did_cu16, uint8 *l_diagBufSize_u8, Std_ReturnType *l_didSupported_, uint8 *l_diagBuf_pu8) {
-  diagHandler_t l_handler_ = &SubfunctionRequestOutOfRange_;
+const DiagCfg_DidCfg_t *getDidCfg(uint16 did_u16) {
+  uint16 l_low_u16 = 0u;
+  uint16 l_high_u16 = DIAG_CFG_DID_COUNT;
+  uint16 l_mid_u16;
+  const DiagCfg_DidCfg_t *l_didCfg_pst = NULL;
 
-  switch(l_did_cu16) {
-  /* IS_OVERVOLT_FLAG */
-  case 0xF308:
-    *l_diagBufSize_u8 = DID_F308_SIZE;
-    l_handler_ = &RdbiVhitOverVoltageFaultDiag_;
-    break;
+  while((l_low_u16 < l_high_u16) && (NULL == l_didCfg_pst)) {
+    l_mid_u16 = (uint16)((l_low_u16 + l_high_u16) >> 1);
+    if(DiagCfg_DidCfg_cst[l_mid_u16].did_u16 < did_u16) {
+      l_low_u16 = (uint16)(l_mid_u16 + 1u);
+    } else if(DiagCfg_DidCfg_cst[l_mid_u16].did_u16 > did_u16) {
+      l_high_u16 = l_mid_u16;
+    } else {
+      l_didCfg_pst = &DiagCfg_DidCfg_cst[l_mid_u16];
+    }
+  }
 
-  default:
+  return l_didCfg_pst;
+}
+
+Std_ReturnType checkDidAccess(const DiagCfg_DidCfg_t *didCfg_pst, uint8 access_u8, uint8 *errCode_pu8) {
+  Std_ReturnType l_result_ = E_NOT_OK;
+
+  /* A DID outside the active session is hidden like an unknown DID */
+  if((NULL == didCfg_pst) || (0u == (didCfg_pst->access_u8 & access_u8)) || (0u == (didCfg_pst->session_u8 & LinDiagGetSession()))) {
+    *errCode_pu8 = kLinDiagNrcRequestOutOfRange;
+  } else if(didCfg_pst->security_u8 > LinDiagGetSecurityLevel()) {
+    *errCode_pu8 = kLinDiagNrcSecurityAccessDenied;
+  } else {
+    l_result_ = E_OK;
+  }
+
+  return l_result_;
+}
+
+Std_ReturnType getHandlersForReadDataById(uint8 *l_errCode_u8, uint16 l_did_cu16, uint8 *l_diagBufSize_u8, Std_ReturnType *l_didSupported_, uint8 *l_diagBuf_pu8, uint8 opStatus_u8) {
+  diagHandler_t l_handler_ = &SubfunctionRequestOutOfRange_;
+  const DiagCfg_DidCfg_t *l_didCfg_pst = getDidCfg(l_did_cu16);
+  uint8 l_slot_u8 = DIAG_CFG_CACHE_NO_SLOT;
+  uint8 l_byte_u8;
+  uint8 l_nrc_u8 = kLinDiagNrcRequestOutOfRange;
+  Std_ReturnType l_result_;
+
+  if(E_OK == checkDidAccess(l_didCfg_pst, DIAG_CFG_ACCESS_READ, &l_nrc_u8)) {
+    *l_diagBufSize_u8 = l_didCfg_pst->size_u8;
+    l_handler_ = l_didCfg_pst->read_pf;
+    l_slot_u8 = l_didCfg_pst->cacheSlot_u8;
+  } else {
     *l_didSupported_ = E_NOT_OK;
+  }
+
+  if((DIAG_CFG_CACHE_NO_SLOT != l_slot_u8) && (DIAG_OPSTATUS_INITIAL == opStatus_u8) && (DIAG_CFG_CACHE_VALID == diagCfgCacheState_au8[l_slot_u8])) {
+    /* Cache hit: the handler is not called */
+    *l_diagBufSize_u8 = diagCfgCacheLen_au8[l_slot_u8];
+    for(l_byte_u8 = 0u; l_byte_u8 < *l_diagBufSize_u8; l_byte_u8++) { l_diagBuf_pu8[l_byte_u8] = diagCfgCacheArena_au8[l_didCfg_pst->cacheOfs_u16 + l_byte_u8]; }
+    l_result_ = E_OK;
+  } else {
+    /* An invalidation from now on resets the slot and the payload is not stored */
+    if((DIAG_CFG_CACHE_NO_SLOT != l_slot_u8) && (DIAG_OPSTATUS_INITIAL == opStatus_u8)) {
+      diagCfgCacheTicks_au16[l_slot_u8] = 0u;
+      diagCfgCacheState_au8[l_slot_u8] = DIAG_CFG_CACHE_FILLING;
+    }
+
+    l_result_ = l_handler_(l_diagBuf_pu8, l_diagBufSize_u8, l_errCode_u8, opStatus_u8);
+
+    if((DIAG_CFG_CACHE_NO_SLOT != l_slot_u8) && (DIAG_OPSTATUS_CANCEL != opStatus_u8) && (E_OK == l_result_) && (DIAG_CFG_CACHE_FILLING == diagCfgCacheState_au8[l_slot_u8]) &&
+       (*l_diagBufSize_u8 <= l_didCfg_pst->size_u8)) {
+      for(l_byte_u8 = 0u; l_byte_u8 < *l_diagBufSize_u8; l_byte_u8++) { diagCfgCacheArena_au8[l_didCfg_pst->cacheOfs_u16 + l_byte_u8] = l_diagBuf_pu8[l_byte_u8]; }
+      diagCfgCacheLen_au8[l_slot_u8] = *l_diagBufSize_u8;
+      diagCfgCacheTicks_au16[l_slot_u8] = (DIAG_CFG_CACHE_TTL == l_didCfg_pst->cache_u8) ? DIAG_CFG_CACHE_TTL_TICKS(l_didCfg_pst->cacheTtl_u16) : 0u;
+      diagCfgCacheState_au8[l_slot_u8] = DIAG_CFG_CACHE_VALID;
+    }
+  }
+
+  /* A DID that cannot be read now is answered with the NRC of the access check, whatever the fallback handler wrote */
+  if(E_NOT_OK == *l_didSupported_) { *l_errCode_u8 = l_nrc_u8; }
+
+  return l_result_;
+}
+
+Std_ReturnType getDidReadSize(uint16 did_u16, uint8 *size_pu8) {
+  const DiagCfg_DidCfg_t *l_didCfg_pst = getDidCfg(did_u16);
+  uint8 l_nrc_u8 = 0u;
+  Std_ReturnType l_result_ = E_NOT_OK;
+
+  /* A DID locked by security is sized anyway: its read answers securityAccessDenied */
+  if((E_OK == checkDidAccess(l_didCfg_pst, DIAG_CFG_ACCESS_READ, &l_nrc_u8)) || (kLinDiagNrcSecurityAccessDenied == l_nrc_u8)) {
+    *size_pu8 = l_didCfg_pst->size_u8;
+    l_result_ = E_OK;
+  }
+
+  return l_result_;
+}
+
+const DiagCfg_SidCfg_t *getSidCfg(uint8 sid_u8) {
+  const DiagCfg_SidCfg_t *l_sidCfg_pst = NULL;
+
+  if((sid_u8 >= DIAG_CFG_SID_FIRST) && (sid_u8 <= DIAG_CFG_SID_LAST) && (NULL != DiagCfg_SidCfg_cst[sid_u8 - DIAG_CFG_SID_FIRST].service_pf)) {
+    l_sidCfg_pst = &DiagCfg_SidCfg_cst[sid_u8 - DIAG_CFG_SID_FIRST];
+  }
+
+  return l_sidCfg_pst;
+}
+
+Std_ReturnType getHandlersForWriteDataById(uint8 *l_errCode_u8, uint16 l_did_cu16, uint8 l_dataSize_u8, uint8 *l_data_pu8) {
+  const DiagCfg_DidCfg_t *l_didCfg_pst = getDidCfg(l_did_cu16);
+  uint8 l_size_u8 = l_dataSize_u8;
+  Std_ReturnType l_result_ = E_NOT_OK;
+
+  if(E_OK != checkDidAccess(l_didCfg_pst, DIAG_CFG_ACCESS_WRITE, l_errCode_u8)) {
+    /* NRC set by the access check */
+  } else if(NULL == l_didCfg_pst->write_pf) {
     *l_errCode_u8 = kLinDiagNrcRequestOutOfRange;
-    break;
+  } else if(l_dataSize_u8 != l_didCfg_pst->size_u8) {
+    *l_errCode_u8 = kLinDiagNrcIncorrectMessageLength;
+  } else {
+    *l_errCode_u8 = kLinDiagNrcConditionsNotCorrect;
+    if(E_OK == l_didCfg_pst->write_pf(l_data_pu8, &l_size_u8, l_errCode_u8, DIAG_OPSTATUS_INITIAL)) {
+      /* The cached payload no longer matches the stored data */
+      (void)invalidateDidCache(l_did_cu16);
+      l_result_ = E_OK;
+    }
+  }
+
+  return l_result_;
+}
+
+Std_ReturnType getHandlersForRoutineControl(uint8 *errCode_pu8, uint8 subFunction_u8, uint16 rid_u16, const uint8 *option_pu8, uint8 optionLen_u8, uint8 *status_pu8, uint8 *statusLen_pu8) {
+  (void)subFunction_u8;
+  (void)rid_u16;
+  (void)option_pu8;
+  (void)optionLen_u8;
+  (void)status_pu8;
+  (void)statusLen_pu8;
+  /* No routine configured */
+  *errCode_pu8 = kLinDiagNrcRequestOutOfRange;
+  return E_NOT_OK;
+}
+
+uint16 getDtcCount(void) { return (uint16)(sizeof(diagCfgDtc_cau32) / sizeof(diagCfgDtc_cau32[0])); }
+
+Std_ReturnType getDtcByIndex(uint16 index_u16, uint32 *dtc_pu32, uint8 *status_pu8) {
+  Std_ReturnType l_result_ = E_NOT_OK;
+
+  if(index_u16 < getDtcCount()) {
+    *dtc_pu32 = diagCfgDtc_cau32[index_u16];
+    *status_pu8 = diagCfgDtcStatus_au8[index_u16];
+    l_result_ = E_OK;
+  }
+
+  return l_result_;
+}
+
+Std_ReturnType clearDtc(uint32 group_u32, uint8 *errCode_pu8) {
+  Std_ReturnType l_result_ = E_NOT_OK;
+  uint16 l_idx_u16;
+
+  if(DIAG_CFG_DTC_GROUP_ALL == group_u32) {
+    for(l_idx_u16 = 0u; l_idx_u16 < getDtcCount(); l_idx_u16++) { diagCfgDtcStatus_au8[l_idx_u16] = 0x00u; }
+    l_result_ = E_OK;
+  } else {
+    *errCode_pu8 = kLinDiagNrcRequestOutOfRange;
+  }
+
+  return l_result_;
+}
+
+Std_ReturnType invalidateDidCache(uint16 did_u16) {
+  const DiagCfg_DidCfg_t *l_didCfg_pst = getDidCfg(did_u16);
+  Std_ReturnType l_result_ = E_NOT_OK;
+
+  if((NULL != l_didCfg_pst) && (DIAG_CFG_CACHE_NO_SLOT != l_didCfg_pst->cacheSlot_u8)) {
+    diagCfgCacheState_au8[l_didCfg_pst->cacheSlot_u8] = DIAG_CFG_CACHE_INVALID;
+    l_result_ = E_OK;
+  }
+
+  return l_result_;
+}
+
+void ageDidCache(void) {
+  uint8 l_slot_u8;
+
+  for(l_slot_u8 = 0u; l_slot_u8 < DIAG_CFG_CACHE_SLOT_ALLOC; l_slot_u8++) {
+    if(0u != diagCfgCacheTicks_au16[l_slot_u8]) {
+      diagCfgCacheTicks_au16[l_slot_u8]--;
+      if(0u == diagCfgCacheTicks_au16[l_slot_u8]) { diagCfgCacheState_au8[l_slot_u8] = DIAG_CFG_CACHE_INVALID; }
+    }
+  }
+}
+
+Std_ReturnType checkDidCfgCrc(void) {
+  uint8 l_crc_u8 = 0x00u;
+  uint8 l_bytes_au8[13];
+  uint16 l_entry_u16;
+  uint8 l_byte_u8;
+  uint8 l_bit_u8;
+
+  for(l_entry_u16 = 0u; l_entry_u16 < DIAG_CFG_DID_COUNT; l_entry_u16++) {
+    l_bytes_au8[0] = (uint8)(DiagCfg_DidCfg_cst[l_entry_u16].did_u16 & 0xFFu);
+    l_bytes_au8[1] = (uint8)(DiagCfg_DidCfg_cst[l_entry_u16].did_u16 >> 8);
+    l_bytes_au8[2] = DiagCfg_DidCfg_cst[l_entry_u16].size_u8;
+    l_bytes_au8[3] = DiagCfg_DidCfg_cst[l_entry_u16].access_u8;
+    l_bytes_au8[4] = DiagCfg_DidCfg_cst[l_entry_u16].session_u8;
+    l_bytes_au8[5] = DiagCfg_DidCfg_cst[l_entry_u16].security_u8;
+    l_bytes_au8[6] = DiagCfg_DidCfg_cst[l_entry_u16].kind_u8;
+    l_bytes_au8[7] = DiagCfg_DidCfg_cst[l_entry_u16].cache_u8;
+    l_bytes_au8[8] = DiagCfg_DidCfg_cst[l_entry_u16].cacheSlot_u8;
+    l_bytes_au8[9] = (uint8)(DiagCfg_DidCfg_cst[l_entry_u16].cacheTtl_u16 & 0xFFu);
+    l_bytes_au8[10] = (uint8)(DiagCfg_DidCfg_cst[l_entry_u16].cacheTtl_u16 >> 8);
+    l_bytes_au8[11] = (uint8)(DiagCfg_DidCfg_cst[l_entry_u16].cacheOfs_u16 & 0xFFu);
+    l_bytes_au8[12] = (uint8)(DiagCfg_DidCfg_cst[l_entry_u16].cacheOfs_u16 >> 8);
+
+    for(l_byte_u8 = 0u; l_byte_u8 < 13u; l_byte_u8++) {
+      l_crc_u8 ^= l_bytes_au8[l_byte_u8];
+      for(l_bit_u8 = 0u; l_bit_u8 < 8u; l_bit_u8++) { l_crc_u8 = ((l_crc_u8 & 0x80u) != 0u) ? (uint8)((uint8)(l_crc_u8 << 1) ^ 0x07u) : (uint8)(l_crc_u8 << 1); }
+    }
   }
 
-  return l_handler_(l_diagBuf_pu8, l_diagBufSize_u8, &l_errCode_u8);
+  return (l_crc_u8 == DiagCfg_DidCfgCrc_cu8) ? E_OK : E_NOT_OK;
 }
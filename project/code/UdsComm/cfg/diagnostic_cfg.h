@@ -19,11 +19,127 @@
 
 typedef uint8_t uint8;
 typedef uint16_t uint16;
+typedef uint32_t uint32;
 typedef uint8_t Std_ReturnType;
 
 #define E_OK ((Std_ReturnType)0x00u)
 #define E_NOT_OK ((Std_ReturnType)0x01u)
+/** @brief Handler has not finished yet and must be called again (AUTOSAR DCM_E_PENDING). */
+#define E_PENDING ((Std_ReturnType)0x0Au)
+
+/** @brief Operation status passed to a DID handler: first call for this request. */
+#define DIAG_OPSTATUS_INITIAL ((uint8)0x00u)
+/** @brief Operation status passed to a DID handler: call again after it returned E_PENDING. */
+#define DIAG_OPSTATUS_PENDING ((uint8)0x01u)
+/** @brief Operation status passed to a DID handler: the pending request is abandoned, stop the job. */
+#define DIAG_OPSTATUS_CANCEL ((uint8)0x02u)
+
 #define kLinDiagNrcRequestOutOfRange ((uint8)0x31u)
+#define kLinDiagNrcIncorrectMessageLength ((uint8)0x13u)
+#define kLinDiagNrcResponseTooLong ((uint8)0x14u)
+#define kLinDiagNrcServiceNotSupported ((uint8)0x11u)
+#define kLinDiagNrcBusyRepeatRequest ((uint8)0x21u)
+#define kLinDiagNrcGeneralReject ((uint8)0x10u)
+#define kLinDiagNrcResponsePending ((uint8)0x78u)
+#define kLinDiagNrcSubFunctionNotSupported ((uint8)0x12u)
+#define kLinDiagNrcConditionsNotCorrect ((uint8)0x22u)
+#define kLinDiagNrcSecurityAccessDenied ((uint8)0x33u)
+#define kLinDiagNrcServiceNotSupportedInActiveSession ((uint8)0x7Fu)
+
+/** @brief Default session (0x01) bit of a session mask. */
+#define DIAG_CFG_SESSION_DEFAULT 0x01U
+/** @brief Programming session (0x02) bit of a session mask. */
+#define DIAG_CFG_SESSION_PROGRAMMING 0x02U
+/** @brief Extended session (0x03) bit of a session mask. */
+#define DIAG_CFG_SESSION_EXTENDED 0x04U
+
+/** @brief Lowest SID of the service table `DiagCfg_SidCfg_cst`. */
+#define DIAG_CFG_SID_FIRST 0x10u
+/** @brief Highest SID of the service table `DiagCfg_SidCfg_cst`. */
+#define DIAG_CFG_SID_LAST 0x3Eu
+/** @brief Number of entries of the service table, one per SID of [DIAG_CFG_SID_FIRST, DIAG_CFG_SID_LAST]. */
+#define DIAG_CFG_SID_COUNT (DIAG_CFG_SID_LAST - DIAG_CFG_SID_FIRST + 1u)
+
+/**
+ * @brief Diagnostic service: handles the request in `pbLinDiagBuffer`
+ *        (`g_linDiagDataLength_u16` bytes) and sends its response.
+ */
+typedef void (*diagServiceHandler_t)(void);
+
+/**
+ * @brief Constant descriptor of one diagnostic service.
+ *
+ * @details
+ * `DiagCfg_SidCfg_cst` holds one entry per SID from @ref DIAG_CFG_SID_FIRST to
+ * @ref DIAG_CFG_SID_LAST, indexed by `SID - DIAG_CFG_SID_FIRST`; SIDs without
+ * a service have a NULL `service_pf`. LinDiagRxIndication() checks the fields
+ * below before it calls the service, so a service only validates the
+ * request layout that is specific to it.
+ */
+typedef struct {
+  uint8 minLen_u8;                /**< Shortest valid request, SID included [byte]. */
+  uint8 session_u8;               /**< Sessions the service is available in, DIAG_CFG_SESSION_* bits. */
+  uint8 security_u8;              /**< Security level needed, 0 = unlocked. */
+  diagServiceHandler_t service_pf; /**< Service, NULL if the SID is not supported. */
+} DiagCfg_SidCfg_t;
+
+/** @brief Service descriptor table (ROM), indexed by `SID - DIAG_CFG_SID_FIRST`. */
+extern const DiagCfg_SidCfg_t DiagCfg_SidCfg_cst[DIAG_CFG_SID_COUNT];
+
+/** @brief DTC status bits supported by the fault memory (testFailed, confirmedDTC). */
+#define DIAG_CFG_DTC_STATUS_AVAILABILITY_MASK 0x09u
+
+/** @brief Group of all DTCs for ClearDiagnosticInformation (0x14). */
+#define DIAG_CFG_DTC_GROUP_ALL 0xFFFFFFu
+
+/** @brief Call period of LinDiagMainFunction() [ms]. */
+#define DIAG_CFG_MAIN_PERIOD_MS 10u
+
+/**
+ * @brief Size of the request buffer `pbLinDiagBuffer` [byte], 7..255.
+ *
+ * @details
+ * Bounds the longest request the LIN transport layer can reassemble. A
+ * ReadDataByIdentifier (0x22) request for n DIDs takes 1 + 2n bytes, so 64
+ * bytes hold up to 31 DIDs. A longer request is answered with NRC 0x13
+ * (LinDiagRxOverflow()).
+ */
+#define DIAG_CFG_RX_BUFFER_SIZE 64u
+
+/** @brief Periodic identifiers ReadDataByPeriodicIdentifier (0x2A) can schedule at the same time. */
+#define DIAG_CFG_PDID_MAX 4u
+
+/**
+ * @brief Largest payload of a periodic DID [byte].
+ *
+ * @details
+ * Each scheduled DID keeps a sample buffer of this size. With 4 bytes a
+ * periodic response (0x6A, periodic identifier, data) fits one LIN single frame.
+ */
+#define DIAG_CFG_PDID_DATA_MAX 4u
+
+/** @brief DID of periodic identifier 0x00; periodic identifier N reads DID `DIAG_CFG_PDID_DID_BASE + N`. */
+#define DIAG_CFG_PDID_DID_BASE 0xF200u
+
+/** @brief Periods of the slow, medium and fast transmission modes of service 0x2A [ms]. */
+#define DIAG_CFG_PDID_SLOW_MS 1000u
+#define DIAG_CFG_PDID_MEDIUM_MS 200u
+#define DIAG_CFG_PDID_FAST_MS 50u
+
+/**
+ * @brief Time a pending DID handler may take before the first NRC 0x78 is queued [ms].
+ *
+ * @details
+ * Keep it below the P2 server timeout of the tester, minus the LIN schedule
+ * delay until the next slave response header.
+ */
+#define DIAG_CFG_P2_MS 40u
+
+/** @brief Time between two NRC 0x78 while a DID handler is still pending [ms]; below P2* of the tester. */
+#define DIAG_CFG_P2STAR_MS 2000u
+
+/** @brief Number of NRC 0x78 sent for one request; the next expiry cancels it with NRC 0x10. */
+#define DIAG_CFG_RESP_PEND_MAX 3u
 
 /**
  * @brief Validate that the LIN diagnostic request is addressed to the expected NAD.
@@ -76,12 +192,13 @@ void checkCurrentNad(uint8 currentNad, Std_ReturnType *result);
  *
  * The purpose of this function is to verify that the received diagnostic message
  * length is within the supported range. The function ensures that the message
- * contains at least one byte and does not exceed the maximum supported payload.
+ * contains at least one byte and does not exceed the request buffer
+ * (`DIAG_CFG_RX_BUFFER_SIZE`).
  *
  * The processing logic:
  * - Reads the `dataLength` input value.
  * - Checks whether `dataLength` is greater than 0.
- * - Checks whether `dataLength` is less than or equal to 32 bytes.
+ * - Checks whether `dataLength` is less than or equal to `DIAG_CFG_RX_BUFFER_SIZE`.
  * - If both checks are true:
  *   - sets `*result = E_OK`.
  * - Otherwise:
@@ -98,7 +215,7 @@ void checkCurrentNad(uint8 currentNad, Std_ReturnType *result);
  *
  * @startuml
  * start
- * :Check (dataLength > 0) AND (dataLength <= 32);
+ * :Check (dataLength > 0) AND (dataLength <= DIAG_CFG_RX_BUFFER_SIZE);
  * if (valid length) then (YES)
  *   :*result = E_OK;
  * else (NO)
@@ -119,23 +236,42 @@ void checkMsgDataLength(uint16_t dataLength, Std_ReturnType *result);
  * **Goal of the function**
  *
  * The purpose of this function is to select and execute the correct DID handler
- * for a "ReadDataByIdentifier" diagnostic request. The dispatcher evaluates the
- * requested DID and, if supported, configures the expected payload size and calls
- * the corresponding handler to fill the response buffer. If the DID is not
+ * for a "ReadDataByIdentifier" diagnostic request. The dispatcher looks up the
+ * requested DID in the constant DID descriptor table (`getDidCfg`, binary
+ * search) and, if the DID is readable, configures the expected payload size and
+ * calls the configured handler to fill the response buffer. If the DID is not
  * supported, it reports a negative response condition and provides the NRC code.
+ * A handler that needs more time returns `E_PENDING`; the service then calls
+ * this function again for the same DID with `DIAG_OPSTATUS_PENDING`, or once
+ * with `DIAG_OPSTATUS_CANCEL` when the request is abandoned.
+ * Adding a DID only means adding it to cfgGen/didSpec.yaml and regenerating
+ * `DiagCfg_DidCfg_cst`.
+ * A DID with a cache slot is answered from the cache arena while its cached
+ * payload is valid; the handler only runs to fill the cache again after
+ * invalidateDidCache() or the TTL expiry.
  *
  * The processing logic:
  * - Initializes the handler to `SubfunctionRequestOutOfRange_`.
- * - Evaluates the requested DID (`l_did_cu16`) using a switch statement.
- * - If DID is supported (0xF308):
- *   - sets `*l_diagBufSize_u8 = DID_F308_SIZE`.
- *   - sets handler to `RdbiVhitOverVoltageFaultDiag_`.
+ * - Looks up `l_did_cu16` in the DID descriptor table.
+ * - If the DID is found, its access mask allows reading, the active session is
+ *   in its session mask and its security level is unlocked (`checkDidAccess`):
+ *   - sets `*l_diagBufSize_u8` to the configured size.
+ *   - selects the configured handler (e.g. `RdbiVhitOverVoltageFaultDiag_` for 0xF308).
  * - Otherwise:
  *   - sets `*l_didSupported_ = E_NOT_OK`.
- *   - sets `*l_errCode_u8 = kLinDiagNrcRequestOutOfRange`.
- * - Finally calls the selected handler:
+ * - On the first call (`DIAG_OPSTATUS_INITIAL`) for a cached DID whose slot is
+ *   valid, copies the cached payload and its length and returns `E_OK`.
+ * - Otherwise, for a cached DID on the first call, marks the slot as filling.
+ * - Calls the selected handler with `l_errCode_u8` and `opStatus_u8`:
  *   - handler writes payload into `l_diagBuf_pu8` if supported,
- *   - handler may update the error code.
+ *   - handler may update the error code,
+ *   - handler may return `E_PENDING` to be called again.
+ * - If the handler of a cached DID returns `E_OK` and the slot is still
+ *   filling (no invalidation meanwhile), stores the payload, loads the TTL
+ *   and marks the slot valid.
+ * - For a DID that cannot be read sets `*l_errCode_u8` to the NRC of the
+ *   access check: `kLinDiagNrcRequestOutOfRange` (unknown, not readable or
+ *   not available in the active session) or `kLinDiagNrcSecurityAccessDenied`.
  *
  * @par Interface summary
  *
@@ -146,32 +282,373 @@ void checkMsgDataLength(uint16_t dataLength, Std_ReturnType *result);
  * | l_diagBufSize_u8    | X  |  X  | uint8*                                                    |   -   |      1      |      0      |     1     | [0,255]         | [byte]   |
  * | l_didSupported_     | X  |  X  | Std_ReturnType*                                          |   -   |      -      |      -      |     -     | E_OK/E_NOT_OK   | [-]      |
  * | l_diagBuf_pu8       | X  |  X  | uint8*                                                    |   -   |      1      |      0      |     N     | project-defined | [-]      |
- * | RdbiVhitOverVoltageFaultDiag_ | X | X | Std_ReturnType(uint8*,uint8*,uint8*)                 |   -   |      -      |      -      |     -     | E_OK/E_NOT_OK   | [-]      |
- * | SubfunctionRequestOutOfRange_ | X | X | Std_ReturnType(uint8*,uint8*,uint8*)                |   -   |      -      |      -      |     -     | E_OK/E_NOT_OK   | [-]      |
+ * | opStatus_u8         | X  |     | uint8                                                    |   -   |      1      |      0      |     1     | DIAG_OPSTATUS_* | [-]      |
+ * | DiagCfg_DidCfg_cst  | X  |     | const DiagCfg_DidCfg_t[]                                  |   -   |      -      |      -      |     -     | -               | [-]      |
+ * | SubfunctionRequestOutOfRange_ | X | X | Std_ReturnType(uint8*,uint8*,uint8*,uint8)          |   -   |      -      |      -      |     -     | E_OK/E_NOT_OK   | [-]      |
  *
  * @par Activity diagram (PlantUML)
  *
  * @startuml
  * start
  * :l_handler = SubfunctionRequestOutOfRange_;
+ * :cfg = getDidCfg(l_did_cu16);
+ *
+ * if (checkDidAccess(cfg, READ, &nrc) == E_OK) then (YES)
+ *   : *l_diagBufSize_u8 = cfg.size;
+ *   :l_handler = cfg.read;
+ * else (NO)
+ *   : *l_didSupported_ = E_NOT_OK;
+ * endif
+ *
+ * if (cached AND INITIAL AND slot VALID) then (HIT)
+ *   :copy cached payload, *l_diagBufSize_u8 = cached length;
+ *   :result = E_OK;
+ * else (MISS)
+ *   if (cached AND INITIAL) then (YES)
+ *     :slot = FILLING;
+ *   endif
+ *   :result = l_handler(l_diagBuf_pu8, l_diagBufSize_u8, l_errCode_u8, opStatus_u8);
+ *   if (cached AND result == E_OK AND slot FILLING) then (YES)
+ *     :store payload; load TTL; slot = VALID;
+ *   endif
+ * endif
+ * if (*l_didSupported_ == E_NOT_OK) then (YES)
+ *   : *l_errCode_u8 = nrc;
+ * endif
+ * :return result;
+ * stop
+ * @enduml
+ *
+ * @return Std_ReturnType.
+ * - E_OK: handler executed successfully or payload taken from the cache.
+ * - E_PENDING: handler not finished, call again with `DIAG_OPSTATUS_PENDING`.
+ * - E_NOT_OK: DID not readable in the active session and security level, or handler failure.
+ */
+Std_ReturnType getHandlersForReadDataById(uint8 *l_errCode_u8, uint16 l_did_cu16, uint8 *l_diagBufSize_u8, Std_ReturnType *l_didSupported_, uint8 *l_diagBuf_pu8, uint8 opStatus_u8);
+
+/**
+ * @brief Get the response payload size of a readable DID.
+ *
+ * @details
+ * **Goal of the function**
+ *
+ * The purpose of this function is to let the ReadDataByIdentifier service size
+ * a multi-DID response before any handler runs. It looks up the DID in the
+ * constant DID descriptor table and reports the configured payload size if the
+ * DID is readable. No handler is called. The security level is not checked
+ * here: a locked DID is sized and its read (`getHandlersForReadDataById`)
+ * answers `kLinDiagNrcSecurityAccessDenied` for the whole request.
+ *
+ * The processing logic:
+ * - Looks up `did_u16` in the DID descriptor table (`getDidCfg`).
+ * - If the DID is found, its access mask allows reading and the active session
+ *   is in its session mask (`checkDidAccess`):
+ *   - sets `*size_pu8` to the configured size,
+ *   - returns `E_OK`.
+ * - Otherwise leaves `*size_pu8` unchanged and returns `E_NOT_OK`.
+ *
+ * @par Interface summary
+ *
+ * | Interface           | In | Out | Data type / Signature     | Param | Data factor | Data offset | Data size | Data range      | Data unit |
+ * |---------------------|:--:|:---:|---------------------------|:-----:|------------:|------------:|----------:|-----------------|----------|
+ * | did_u16             | X  |     | uint16                    |   -   |      1      |      0      |     1     | [0,65535]       | [-]      |
+ * | size_pu8            |    |  X  | uint8*                    |   -   |      1      |      0      |     1     | [1,255]         | [byte]   |
+ * | DiagCfg_DidCfg_cst  | X  |     | const DiagCfg_DidCfg_t[]  |   -   |      -      |      -      |     -     | -               | [-]      |
+ *
+ * @par Activity diagram (PlantUML)
+ *
+ * @startuml
+ * start
+ * :cfg = getDidCfg(did_u16);
+ * if (checkDidAccess(cfg, READ, &nrc) == E_OK OR nrc == SecurityAccessDenied) then (YES)
+ *   : *size_pu8 = cfg.size;
+ *   :return E_OK;
+ * else (NO)
+ *   :return E_NOT_OK;
+ * endif
+ * stop
+ * @enduml
+ *
+ * @return Std_ReturnType.
+ * - E_OK: DID readable, `*size_pu8` written.
+ * - E_NOT_OK: DID not configured, not readable or not available in the active session.
+ */
+Std_ReturnType getDidReadSize(uint16 did_u16, uint8 *size_pu8);
+
+/**
+ * @brief Check the DID configuration table against its compile-time CRC.
+ *
+ * @details
+ * **Goal of the function**
+ *
+ * The purpose of this function is to detect a corruption of the constant DID
+ * configuration (DID numbers, response sizes, access/session masks, security
+ * levels, kinds and cache layout) in ROM. The reference CRC `DiagCfg_DidCfgCrc_cu8` is
+ * produced by the preprocessor from the same generated initializers, so no
+ * CRC is computed at startup; this check runs only when the application
+ * requests it.
+ *
+ * The processing logic:
+ * - For each entry of `DiagCfg_DidCfg_cst`:
+ *   - feeds DID low byte, DID high byte, size, access mask, session mask,
+ *     security level, kind, cache policy, cache slot, TTL (low, high) and
+ *     arena offset (low, high) into a bitwise CRC-8/ATM.
+ * - Compares the result with `DiagCfg_DidCfgCrc_cu8`.
+ * - Returns `E_OK` on match, `E_NOT_OK` otherwise.
+ *
+ * @par Interface summary
+ *
+ * | Interface              | In | Out | Data type / Signature   | Param | Data factor | Data offset | Data size          | Data range    | Data unit |
+ * |------------------------|:--:|:---:|-------------------------|:-----:|------------:|------------:|-------------------:|---------------|----------|
+ * | DiagCfg_DidCfg_cst     | X  |     | const DiagCfg_DidCfg_t[] |   -   |      -      |      -      | DIAG_CFG_DID_COUNT | -             | [-]      |
+ * | DiagCfg_DidCfgCrc_cu8  | X  |     | const uint8             |   -   |      1      |      0      |         1          | [0,255]       | [-]      |
+ * | return                 |    |  X  | Std_ReturnType          |   -   |      -      |      -      |         -          | E_OK/E_NOT_OK | [-]      |
+ *
+ * @par Activity diagram (PlantUML)
+ *
+ * @startuml
+ * start
+ * :crc = 0x00;
+ * while (more DID entries?) is (yes)
+ *   :crc = crc8(crc, did, size, access, session, security, kind, cache, slot, ttl, ofs);
+ * endwhile (no)
+ * if (crc == DiagCfg_DidCfgCrc_cu8) then (MATCH)
+ *   :return E_OK;
+ * else (MISMATCH)
+ *   :return E_NOT_OK;
+ * endif
+ * stop
+ * @enduml
+ *
+ * @return Std_ReturnType.
+ * - E_OK: DID configuration intact.
+ * - E_NOT_OK: DID configuration corrupted.
+ */
+Std_ReturnType checkDidCfgCrc(void);
+
+/**
+ * @brief Drop the cached response payload of a DID.
+ *
+ * @details
+ * **Goal of the function**
+ *
+ * The purpose of this function is to let the owner of the data behind a
+ * cached DID (NVM block written, calibration changed, ...) tell the
+ * diagnostic layer that the cached payload is stale. The next
+ * ReadDataByIdentifier of the DID calls its handler again.
+ *
+ * The processing logic:
+ * - Looks up `did_u16` in the DID descriptor table (`getDidCfg`).
+ * - If the DID has a cache slot, marks the slot invalid and returns `E_OK`.
+ *   A read of the DID in progress (handler pending) then does not store its
+ *   payload.
+ * - Otherwise returns `E_NOT_OK`.
+ *
+ * The slot state is a single byte, so data owners may call this function
+ * from any task; only a call preempting the final store of a payload inside
+ * getHandlersForReadDataById() can be lost, which callers running above the
+ * diagnostic task avoid by calling it inside their exclusive area.
+ *
+ * @par Interface summary
+ *
+ * | Interface           | In | Out | Data type / Signature     | Param | Data factor | Data offset | Data size | Data range      | Data unit |
+ * |---------------------|:--:|:---:|---------------------------|:-----:|------------:|------------:|----------:|-----------------|----------|
+ * | did_u16             | X  |     | uint16                    |   -   |      1      |      0      |     1     | [0,65535]       | [-]      |
+ * | DiagCfg_DidCfg_cst  | X  |     | const DiagCfg_DidCfg_t[]  |   -   |      -      |      -      |     -     | -               | [-]      |
+ * | return              |    |  X  | Std_ReturnType            |   -   |      -      |      -      |     1     | E_OK/E_NOT_OK   | [-]      |
+ *
+ * @par Activity diagram (PlantUML)
  *
- * if (l_did_cu16 == 0xF308) then (YES)
- *   : *l_diagBufSize_u8 = DID_F308_SIZE;
- *   :l_handler = RdbiVhitOverVoltageFaultDiag_;
+ * @startuml
+ * start
+ * :cfg = getDidCfg(did_u16);
+ * if (cfg != NULL AND cfg.cacheSlot != NO_SLOT) then (YES)
+ *   :slot = INVALID;
+ *   :return E_OK;
  * else (NO)
- *   : *l_didSupported_) = E_NOT_OK;
- *   : *l_errCode_u8 = kLinDiagNrcRequestOutOfRange";
+ *   :return E_NOT_OK;
  * endif
+ * stop
+ * @enduml
+ *
+ * @return Std_ReturnType.
+ * - E_OK: cached payload dropped (or none was stored).
+ * - E_NOT_OK: DID not configured or not cached.
+ */
+Std_ReturnType invalidateDidCache(uint16 did_u16);
+
+/**
+ * @brief Expire cached response payloads whose TTL is over.
+ *
+ * @details
+ * Called by LinDiagMainFunction() every @ref DIAG_CFG_MAIN_PERIOD_MS. Counts
+ * down the remaining lifetime of every slot stored with a TTL and marks the
+ * slot invalid when it reaches 0. Slots of DIDs cached until invalidation
+ * have no lifetime and are not touched.
  *
- * :return l_handler(l_diagBuf_pu8, l_diagBufSize_u8, &l_errCode_u8);
+ * @return None.
+ */
+void ageDidCache(void);
+
+/**
+ * @brief Find the descriptor of a diagnostic service.
+ *
+ * @details
+ * **Goal of the function**
+ *
+ * The purpose of this function is to resolve a SID to its service descriptor
+ * in constant time, so that adding a service only means filling its entry of
+ * `DiagCfg_SidCfg_cst`.
+ *
+ * The processing logic:
+ * - SIDs outside [@ref DIAG_CFG_SID_FIRST, @ref DIAG_CFG_SID_LAST] are not supported.
+ * - Otherwise indexes `DiagCfg_SidCfg_cst` with `SID - DIAG_CFG_SID_FIRST`.
+ * - Returns the entry if it has a service, NULL otherwise.
+ *
+ * @par Interface summary
+ *
+ * | Interface           | In | Out | Data type / Signature     | Param | Data factor | Data offset | Data size          | Data range      | Data unit |
+ * |---------------------|:--:|:---:|---------------------------|:-----:|------------:|------------:|-------------------:|-----------------|----------|
+ * | sid_u8              | X  |     | uint8                     |   -   |      1      |      0      |         1          | [0,255]         | [-]      |
+ * | DiagCfg_SidCfg_cst  | X  |     | const DiagCfg_SidCfg_t[]  |   -   |      -      |      -      | DIAG_CFG_SID_COUNT | -               | [-]      |
+ * | return              |    |  X  | const DiagCfg_SidCfg_t*   |   -   |      -      |      -      |         1          | entry or NULL   | [-]      |
+ *
+ * @par Activity diagram (PlantUML)
+ *
+ * @startuml
+ * start
+ * if (FIRST <= sid <= LAST AND table[sid - FIRST].service != NULL) then (YES)
+ *   :return &table[sid - FIRST];
+ * else (NO)
+ *   :return NULL;
+ * endif
  * stop
  * @enduml
  *
+ * @return Pointer to the service descriptor, NULL if the SID is not supported.
+ */
+const DiagCfg_SidCfg_t *getSidCfg(uint8 sid_u8);
+
+/**
+ * @brief Dispatch the write handler associated with a WriteDataByIdentifier DID request.
+ *
+ * @details
+ * **Goal of the function**
+ *
+ * The purpose of this function is to store the payload of a
+ * "WriteDataByIdentifier" request through the write handler of the DID
+ * descriptor table, and to keep the response cache of the DID consistent.
+ *
+ * The processing logic:
+ * - Looks up `l_did_cu16` in the DID descriptor table (`getDidCfg`).
+ * - Applies the access mask, session mask and security level of the DID
+ *   (`checkDidAccess`): `*l_errCode_u8 = kLinDiagNrcRequestOutOfRange` for a DID
+ *   not found, not writable or not available in the active session,
+ *   `kLinDiagNrcSecurityAccessDenied` for a DID above the unlocked level.
+ * - No write handler: `*l_errCode_u8 = kLinDiagNrcRequestOutOfRange`.
+ * - Payload size different from the configured size:
+ *   `*l_errCode_u8 = kLinDiagNrcIncorrectMessageLength`.
+ * - Otherwise presets `*l_errCode_u8 = kLinDiagNrcConditionsNotCorrect` and
+ *   calls the write handler with `DIAG_OPSTATUS_INITIAL`; write handlers
+ *   finish in one call, any result but `E_OK` is a failure with the NRC the
+ *   handler left in `*l_errCode_u8`.
+ * - On success drops the cached payload of the DID (`invalidateDidCache`).
+ *
+ * @par Interface summary
+ *
+ * | Interface           | In | Out | Data type / Signature     | Param | Data factor | Data offset | Data size | Data range      | Data unit |
+ * |---------------------|:--:|:---:|---------------------------|:-----:|------------:|------------:|----------:|-----------------|----------|
+ * | l_errCode_u8        |    |  X  | uint8*                    |   -   |      1      |      0      |     1     | [0,255]         | [-]      |
+ * | l_did_cu16          | X  |     | uint16                    |   -   |      1      |      0      |     1     | [0,65535]       | [-]      |
+ * | l_dataSize_u8       | X  |     | uint8                     |   -   |      1      |      0      |     1     | [0,255]         | [byte]   |
+ * | l_data_pu8          | X  |     | uint8*                    |   -   |      1      |      0      |     N     | project-defined | [-]      |
+ * | DiagCfg_DidCfg_cst  | X  |     | const DiagCfg_DidCfg_t[]  |   -   |      -      |      -      |     -     | -               | [-]      |
+ *
+ * @par Activity diagram (PlantUML)
+ *
+ * @startuml
+ * start
+ * :cfg = getDidCfg(l_did_cu16);
+ * if (checkDidAccess(cfg, WRITE, l_errCode_u8) != E_OK) then (YES)
+ *   :return E_NOT_OK;
+ * elseif (cfg.write == NULL) then (YES)
+ *   : *l_errCode_u8 = RequestOutOfRange;
+ *   :return E_NOT_OK;
+ * elseif (l_dataSize_u8 != cfg.size) then (YES)
+ *   : *l_errCode_u8 = IncorrectMessageLength;
+ *   :return E_NOT_OK;
+ * else (NO)
+ *   : *l_errCode_u8 = ConditionsNotCorrect;
+ *   :result = cfg.write(l_data_pu8, &size, l_errCode_u8, INITIAL);
+ *   if (result == E_OK) then (YES)
+ *     :invalidateDidCache(l_did_cu16);
+ *   endif
+ *   :return result == E_OK ? E_OK : E_NOT_OK;
+ * endif
+ * stop
+ * @enduml
+ *
+ * @return Std_ReturnType.
+ * - E_OK: payload stored.
+ * - E_NOT_OK: DID not writable in the active session and security level, wrong
+ *   size or handler failure, NRC in `*l_errCode_u8`.
+ */
+Std_ReturnType getHandlersForWriteDataById(uint8 *l_errCode_u8, uint16 l_did_cu16, uint8 l_dataSize_u8, uint8 *l_data_pu8);
+
+/**
+ * @brief Run a RoutineControl (0x31) sub-function on a routine.
+ *
+ * @details
+ * Project hook behind the RoutineControl service: starts (0x01), stops (0x02)
+ * or reads the results (0x03) of routine `rid_u16` with the option record
+ * `option_pu8` (`optionLen_u8` bytes), and writes the status record into
+ * `status_pu8` (at most `*statusLen_pu8` bytes on input, the written length
+ * on output). No routine is configured yet: every RID is answered with
+ * `kLinDiagNrcRequestOutOfRange`.
+ *
+ * @return Std_ReturnType.
+ * - E_OK: sub-function executed, status record written.
+ * - E_NOT_OK: NRC in `*errCode_pu8`.
+ */
+Std_ReturnType getHandlersForRoutineControl(uint8 *errCode_pu8, uint8 subFunction_u8, uint16 rid_u16, const uint8 *option_pu8, uint8 optionLen_u8, uint8 *status_pu8, uint8 *statusLen_pu8);
+
+/**
+ * @brief Number of DTCs of the fault memory.
+ *
+ * @details
+ * Project hook behind ReadDTCInformation (0x19). DTCs are numbered
+ * 0..getDtcCount()-1 for getDtcByIndex().
+ *
+ * @return Number of DTCs.
+ */
+uint16 getDtcCount(void);
+
+/**
+ * @brief Read one DTC of the fault memory.
+ *
+ * @details
+ * Writes the 3-byte DTC number of entry `index_u16` into `*dtc_pu32` and its
+ * ISO 14229-1 status byte into `*status_pu8`.
+ *
+ * @return Std_ReturnType.
+ * - E_OK: DTC and status written.
+ * - E_NOT_OK: `index_u16` out of range.
+ */
+Std_ReturnType getDtcByIndex(uint16 index_u16, uint32 *dtc_pu32, uint8 *status_pu8);
+
+/**
+ * @brief Clear a group of DTCs of the fault memory.
+ *
+ * @details
+ * Project hook behind ClearDiagnosticInformation (0x14). Only
+ * @ref DIAG_CFG_DTC_GROUP_ALL is supported: it resets the status of every
+ * DTC. Any other group is answered with `kLinDiagNrcRequestOutOfRange`.
+ *
  * @return Std_ReturnType.
- * - E_OK: handler executed successfully.
- * - E_NOT_OK: unsupported DID or handler failure.
+ * - E_OK: group cleared.
+ * - E_NOT_OK: NRC in `*errCode_pu8`.
  */
-Std_ReturnType getHandlersForReadDataById(uint8 *l_errCode_u8, uint16 l_did_cu16, uint8 *l_diagBufSize_u8, Std_ReturnType *l_didSupported_, uint8 *l_diagBuf_pu8);
+Std_ReturnType clearDtc(uint32 group_u32, uint8 *errCode_pu8);
 
 /** @} */
 
@@ -0,0 +1,45 @@
+/* GENERATED by cfgGen/didCfgGen.py from cfgGen/didSpec.yaml. Do not edit, regenerate instead. */
+/**
+ * @file diagnostic_cfg_did.c
+ * @brief Generated DID descriptor table of the Diagnostic configuration.
+ *
+ * @details
+ * `DiagCfg_DidCfg_cst` sorted by ascending DID and its CRC-8/ATM
+ * `DiagCfg_DidCfgCrc_cu8`, both documented in diagnostic_cfg_priv.h.
+ */
+
+#include "diagnostic_cfg.h"
+#include "diagnostic_cfg_priv.h"
+#define NULL ((void *)0)
+
+/* CRC-8/ATM of one byte as an integer constant expression (same expansion as
+ * EDD_CRC8_CT_BYTE; the component is built standalone and does not see the
+ * ErrorDataDetection headers). */
+#define DIAG_CFG_CRC8_BYTE(crc, byte)                                                                                                                                          \
+  ((((((crc) ^ (byte)) >> 0) & 1u) * 0x07u) ^ (((((crc) ^ (byte)) >> 1) & 1u) * 0x0Eu) ^ (((((crc) ^ (byte)) >> 2) & 1u) * 0x1Cu) ^                                           \
+   (((((crc) ^ (byte)) >> 3) & 1u) * 0x38u) ^ (((((crc) ^ (byte)) >> 4) & 1u) * 0x70u) ^ (((((crc) ^ (byte)) >> 5) & 1u) * 0xE0u) ^                                            \
+   (((((crc) ^ (byte)) >> 6) & 1u) * 0xC7u) ^ (((((crc) ^ (byte)) >> 7) & 1u) * 0x89u))
+
+#define DIAG_CFG_CRC8_U16(crc, value) DIAG_CFG_CRC8_BYTE(DIAG_CFG_CRC8_BYTE((crc), ((value) & 0xFFu)), (((value) >> 8) & 0xFFu))
+
+/* Sorted by ascending DID: one row per DID, no control flow to edit */
+const DiagCfg_DidCfg_t DiagCfg_DidCfg_cst[DIAG_CFG_DID_COUNT] = {
+    /* IS_OVERVOLT_FLAG */
+    {DID_F308, DID_F308_SIZE, DID_F308_ACCESS, DID_F308_SESSION, DID_F308_SECURITY, DID_F308_KIND, DID_F308_CACHE, DID_F308_CACHE_SLOT, DID_F308_CACHE_TTL, DID_F308_CACHE_OFS, &RdbiVhitOverVoltageFaultDiag_, NULL},
+};
+
+/* One constant per table field, in table order: the expansion stays linear */
+enum {
+  DIAG_CFG_CRC_F308_DID = DIAG_CFG_CRC8_U16(0x00u, DID_F308),
+  DIAG_CFG_CRC_F308_SIZE = DIAG_CFG_CRC8_BYTE(DIAG_CFG_CRC_F308_DID, DID_F308_SIZE),
+  DIAG_CFG_CRC_F308_ACCESS = DIAG_CFG_CRC8_BYTE(DIAG_CFG_CRC_F308_SIZE, DID_F308_ACCESS),
+  DIAG_CFG_CRC_F308_SESSION = DIAG_CFG_CRC8_BYTE(DIAG_CFG_CRC_F308_ACCESS, DID_F308_SESSION),
+  DIAG_CFG_CRC_F308_SECURITY = DIAG_CFG_CRC8_BYTE(DIAG_CFG_CRC_F308_SESSION, DID_F308_SECURITY),
+  DIAG_CFG_CRC_F308_KIND = DIAG_CFG_CRC8_BYTE(DIAG_CFG_CRC_F308_SECURITY, DID_F308_KIND),
+  DIAG_CFG_CRC_F308_CACHE = DIAG_CFG_CRC8_BYTE(DIAG_CFG_CRC_F308_KIND, DID_F308_CACHE),
+  DIAG_CFG_CRC_F308_CACHE_SLOT = DIAG_CFG_CRC8_BYTE(DIAG_CFG_CRC_F308_CACHE, DID_F308_CACHE_SLOT),
+  DIAG_CFG_CRC_F308_CACHE_TTL = DIAG_CFG_CRC8_U16(DIAG_CFG_CRC_F308_CACHE_SLOT, DID_F308_CACHE_TTL),
+  DIAG_CFG_CRC_F308_CACHE_OFS = DIAG_CFG_CRC8_U16(DIAG_CFG_CRC_F308_CACHE_TTL, DID_F308_CACHE_OFS)
+};
+
+const uint8 DiagCfg_DidCfgCrc_cu8 = (uint8)DIAG_CFG_CRC_F308_CACHE_OFS;
@@ -0,0 +1,49 @@
+/* GENERATED by cfgGen/didCfgGen.py from cfgGen/didSpec.yaml. Do not edit, regenerate instead. */
+#ifndef DIAGNOSTIC_CFG_DID_H
+#define DIAGNOSTIC_CFG_DID_H
+/**
+ * @file diagnostic_cfg_did.h
+ * @brief Generated DID constants of the Diagnostic configuration.
+ *
+ * @details
+ * One block of constants per DID, the table and cache sizes and the
+ * handler prototypes. Included by diagnostic_cfg_priv.h, which defines
+ * the DIAG_CFG_ACCESS_*, DIAG_CFG_SESSION_*, DIAG_CFG_DID_* and
+ * DIAG_CFG_CACHE_* values.
+ */
+#include "diagnostic_cfg.h"
+
+/** @brief Largest DID payload the transport can carry [byte]. */
+#define DIAG_CFG_MAX_PAYLOAD 255U
+
+/** @brief Number of entries of the DID configuration table. */
+#define DIAG_CFG_DID_COUNT 1U
+
+/** @brief Largest configured DID payload [byte]. */
+#define DIAG_CFG_DID_MAX_SIZE 1U
+
+/** @brief Number of DIDs with a response cache slot. */
+#define DIAG_CFG_CACHE_SLOT_COUNT 0U
+
+/** @brief Bytes of cache arena used by the cached DIDs (bound: cacheArena = 32). */
+#define DIAG_CFG_CACHE_ARENA_SIZE 0U
+
+/* IS_OVERVOLT_FLAG */
+#define DID_F308 0xF308U
+#define DID_F308_SIZE 1U
+#define DID_F308_ACCESS (DIAG_CFG_ACCESS_READ)
+#define DID_F308_SESSION (DIAG_CFG_SESSION_DEFAULT | DIAG_CFG_SESSION_EXTENDED)
+#define DID_F308_SECURITY 0U
+#define DID_F308_KIND DIAG_CFG_DID_DYNAMIC
+#define DID_F308_CACHE DIAG_CFG_CACHE_NEVER
+#define DID_F308_CACHE_SLOT DIAG_CFG_CACHE_NO_SLOT
+#define DID_F308_CACHE_TTL 0U
+#define DID_F308_CACHE_OFS 0U
+
+/* Buffer-length checks: a DID that does not fit the transport makes the array size negative */
+typedef char DiagCfg_DID_F308_SizeCheck_t[((DID_F308_SIZE >= 1U) && (DID_F308_SIZE <= DIAG_CFG_MAX_PAYLOAD)) ? 1 : -1];
+
+/* DID handlers (data sources) */
+Std_ReturnType RdbiVhitOverVoltageFaultDiag_(uint8 *const output_pu8, uint8 *const size_pu8, uint8 *const errCode_pu8, uint8 opStatus_u8);
+
+#endif
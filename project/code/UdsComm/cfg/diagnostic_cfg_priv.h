@@ -15,9 +15,191 @@
  */
 #include "diagnostic_cfg.h"
 
-#define DID_F308_SIZE 1U
+/** @brief DID may be read (ReadDataByIdentifier 0x22). */
+#define DIAG_CFG_ACCESS_READ 0x01U
+/** @brief DID may be written (WriteDataByIdentifier 0x2E). */
+#define DIAG_CFG_ACCESS_WRITE 0x02U
 
-typedef Std_ReturnType (*diagHandler_t)(uint8 *const output_pu8, uint8 *const size_pu8, uint8 *const errCode_pu8);
+/** @brief DID payload is sampled on every request. */
+#define DIAG_CFG_DID_DYNAMIC 0x00U
+/** @brief DID payload does not change while the ECU runs. */
+#define DIAG_CFG_DID_STATIC 0x01U
+
+/** @brief Response payload is never cached, the handler runs on every request. */
+#define DIAG_CFG_CACHE_NEVER 0x00U
+/** @brief Cached payload stays valid until invalidateDidCache() is called for the DID. */
+#define DIAG_CFG_CACHE_UNTIL_INVALIDATED 0x01U
+/** @brief Cached payload expires after the DID's TTL, or earlier on invalidateDidCache(). */
+#define DIAG_CFG_CACHE_TTL 0x02U
+
+/** @brief Cache slot of a DID that is not cached. */
+#define DIAG_CFG_CACHE_NO_SLOT 0xFFU
+
+/* Cache slot state: a payload is stored only if no invalidation arrived
+ * between the first handler call and its E_OK (slot still FILLING) */
+#define DIAG_CFG_CACHE_INVALID 0x00U
+#define DIAG_CFG_CACHE_FILLING 0x01U
+#define DIAG_CFG_CACHE_VALID 0x02U
+
+/* DID numbers, sizes, access constants and DIAG_CFG_DID_COUNT, generated
+ * from cfgGen/didSpec.yaml */
+#include "diagnostic_cfg_did.h"
+
+/**
+ * @brief DID handler: writes the payload of one DID into `output_pu8`.
+ *
+ * @details
+ * Read handlers (`read_pf`) fill `output_pu8`; write handlers (`write_pf`)
+ * store the `*size_pu8` bytes passed in `output_pu8` and must finish in one call.
+ * A read handler that cannot finish in one call (NVM read, sensor conversion)
+ * starts its job and returns `E_PENDING`; it is called again with
+ * `DIAG_OPSTATUS_PENDING` every LinDiagMainFunction() period until it returns
+ * `E_OK` or `E_NOT_OK`. `DIAG_OPSTATUS_CANCEL` tells it to stop the job; the
+ * return value is then ignored.
+ */
+typedef Std_ReturnType (*diagHandler_t)(uint8 *const output_pu8, uint8 *const size_pu8, uint8 *const errCode_pu8, uint8 opStatus_u8);
+
+/**
+ * @brief Constant descriptor of one supported DID.
+ *
+ * @details
+ * `DiagCfg_DidCfg_cst` is generated by cfgGen/didCfgGen.py, sorted by
+ * ascending `did_u16` (binary search in `getDidCfg`). The table is covered
+ * by `DiagCfg_DidCfgCrc_cu8`; each entry contributes 13 bytes to the CRC:
+ * DID low byte, DID high byte, size, access mask, session mask, security
+ * level, kind, cache policy, cache slot, TTL low/high byte, arena offset
+ * low/high byte. Handler addresses are not known to the preprocessor and are
+ * not covered.
+ *
+ * Cached DIDs own one slot (0..DIAG_CFG_CACHE_SLOT_COUNT-1) and `size_u8`
+ * bytes at `cacheOfs_u16` of the cache arena; the generator lays the slots
+ * out back to back within the `cacheArena` bound of the specification.
+ */
+typedef struct {
+  uint16 did_u16;         /**< Data identifier. */
+  uint8 size_u8;          /**< Response payload size in bytes. */
+  uint8 access_u8;        /**< Allowed services, DIAG_CFG_ACCESS_* bits. */
+  uint8 session_u8;       /**< Sessions the DID is available in, DIAG_CFG_SESSION_* bits. */
+  uint8 security_u8;      /**< Security level needed, 0 = unlocked. */
+  uint8 kind_u8;          /**< DIAG_CFG_DID_STATIC or DIAG_CFG_DID_DYNAMIC. */
+  uint8 cache_u8;         /**< Response cache policy, DIAG_CFG_CACHE_NEVER/UNTIL_INVALIDATED/TTL. */
+  uint8 cacheSlot_u8;     /**< Cache slot, DIAG_CFG_CACHE_NO_SLOT if not cached. */
+  uint16 cacheTtl_u16;    /**< Lifetime of a cached payload [ms], 0 unless DIAG_CFG_CACHE_TTL. */
+  uint16 cacheOfs_u16;    /**< Offset of the payload in the cache arena [byte]. */
+  diagHandler_t read_pf;  /**< Handler writing the response payload. */
+  diagHandler_t write_pf; /**< Handler storing a WriteDataByIdentifier payload, NULL if not writable. */
+} DiagCfg_DidCfg_t;
+
+/** @brief DID descriptor table (ROM), sorted by DID. */
+extern const DiagCfg_DidCfg_t DiagCfg_DidCfg_cst[DIAG_CFG_DID_COUNT];
+
+/** @brief CRC-8/ATM of `DiagCfg_DidCfg_cst`, computed at compile time. */
+extern const uint8 DiagCfg_DidCfgCrc_cu8;
+
+/* Cache RAM is allocated with at least one element so that a configuration
+ * without cached DIDs stays valid C */
+#define DIAG_CFG_CACHE_SLOT_ALLOC ((DIAG_CFG_CACHE_SLOT_COUNT > 0U) ? DIAG_CFG_CACHE_SLOT_COUNT : 1U)
+#define DIAG_CFG_CACHE_ARENA_ALLOC ((DIAG_CFG_CACHE_ARENA_SIZE > 0U) ? DIAG_CFG_CACHE_ARENA_SIZE : 1U)
+
+/* Lifetime of a cached payload in ageDidCache() ticks: rounded down to the
+ * main period, at least one tick */
+#define DIAG_CFG_CACHE_TTL_TICKS(ms) ((((ms) / DIAG_CFG_MAIN_PERIOD_MS) > 0U) ? (uint16)((ms) / DIAG_CFG_MAIN_PERIOD_MS) : (uint16)1U)
+
+/**
+ * @brief Find the descriptor of a DID.
+ *
+ * @details
+ * **Goal of the function**
+ *
+ * The purpose of this function is to resolve a DID to its descriptor with a
+ * cost that grows with log2 of the table size (at most 9 comparisons for 256
+ * DIDs), so that adding DIDs only means adding table rows.
+ *
+ * The processing logic:
+ * - Binary search over `DiagCfg_DidCfg_cst` (sorted by ascending DID).
+ * - Returns the matching entry, or NULL if the DID is not configured.
+ *
+ * @par Interface summary
+ *
+ * | Interface           | In | Out | Data type / Signature     | Param | Data factor | Data offset | Data size          | Data range      | Data unit |
+ * |---------------------|:--:|:---:|---------------------------|:-----:|------------:|------------:|-------------------:|-----------------|----------|
+ * | did_u16             | X  |     | uint16                    |   -   |      1      |      0      |         1          | [0,65535]       | [-]      |
+ * | DiagCfg_DidCfg_cst  | X  |     | const DiagCfg_DidCfg_t[]  |   -   |      -      |      -      | DIAG_CFG_DID_COUNT | -               | [-]      |
+ * | return              |    |  X  | const DiagCfg_DidCfg_t*   |   -   |      -      |      -      |         1          | entry or NULL   | [-]      |
+ *
+ * @par Activity diagram (PlantUML)
+ *
+ * @startuml
+ * start
+ * :low = 0, high = DIAG_CFG_DID_COUNT;
+ * while (low < high AND not found) is (yes)
+ *   :mid = (low + high) / 2;
+ *   if (table[mid].did < did) then (YES)
+ *     :low = mid + 1;
+ *   elseif (table[mid].did > did) then (YES)
+ *     :high = mid;
+ *   else (EQUAL)
+ *     :found = table[mid];
+ *   endif
+ * endwhile (no)
+ * :return found (or NULL);
+ * stop
+ * @enduml
+ *
+ * @return Pointer to the DID descriptor, NULL if the DID is not supported.
+ */
+const DiagCfg_DidCfg_t *getDidCfg(uint16 did_u16);
+
+/**
+ * @brief Check that a DID may be accessed in the active session and security level.
+ *
+ * @details
+ * **Goal of the function**
+ *
+ * The purpose of this function is to apply the access mask, the session mask
+ * and the security level of a DID descriptor in one place, so that
+ * ReadDataByIdentifier and WriteDataByIdentifier answer the same NRC for the
+ * same DID. The active session and the unlocked security level come from the
+ * diagnostic module (`LinDiagGetSession()`, `LinDiagGetSecurityLevel()`).
+ *
+ * The processing logic:
+ * - DID not configured, `access_u8` not allowed or active session not in the
+ *   DID session mask: `*errCode_pu8 = kLinDiagNrcRequestOutOfRange`.
+ * - DID security level above the unlocked level:
+ *   `*errCode_pu8 = kLinDiagNrcSecurityAccessDenied`.
+ * - Otherwise `*errCode_pu8` is left unchanged and `E_OK` is returned.
+ *
+ * @par Interface summary
+ *
+ * | Interface                 | In | Out | Data type / Signature     | Param | Data factor | Data offset | Data size | Data range          | Data unit |
+ * |---------------------------|:--:|:---:|---------------------------|:-----:|------------:|------------:|----------:|---------------------|----------|
+ * | didCfg_pst                | X  |     | const DiagCfg_DidCfg_t*   |   -   |      -      |      -      |     1     | entry or NULL       | [-]      |
+ * | access_u8                 | X  |     | uint8                     |   -   |      1      |      0      |     1     | DIAG_CFG_ACCESS_*   | [-]      |
+ * | errCode_pu8               |    |  X  | uint8*                    |   -   |      1      |      0      |     1     | 0x31, 0x33          | [-]      |
+ * | LinDiagGetSession()       | X  |     | uint8_t(void)             |   -   |      -      |      -      |     -     | DIAG_CFG_SESSION_*  | [-]      |
+ * | LinDiagGetSecurityLevel() | X  |     | uint8_t(void)             |   -   |      -      |      -      |     -     | [0,255]             | [-]      |
+ *
+ * @par Activity diagram (PlantUML)
+ *
+ * @startuml
+ * start
+ * if (cfg == NULL OR access not allowed OR session not in cfg.session) then (YES)
+ *   : *errCode_pu8 = kLinDiagNrcRequestOutOfRange;
+ *   :return E_NOT_OK;
+ * elseif (cfg.security > unlocked level) then (YES)
+ *   : *errCode_pu8 = kLinDiagNrcSecurityAccessDenied;
+ *   :return E_NOT_OK;
+ * else (NO)
+ *   :return E_OK;
+ * endif
+ * stop
+ * @enduml
+ *
+ * @return Std_ReturnType.
+ * - E_OK: the DID may be accessed.
+ * - E_NOT_OK: access refused, NRC in `*errCode_pu8`.
+ */
+Std_ReturnType checkDidAccess(const DiagCfg_DidCfg_t *didCfg_pst, uint8 access_u8, uint8 *errCode_pu8);
 
 /**
  * @brief DID handler that provides the Over Voltage Fault diagnostic information.
@@ -41,6 +223,7 @@ typedef Std_ReturnType (*diagHandler_t)(uint8 *const output_pu8, uint8 *const si
  * | output_pu8    | X  |  X  | uint8*                              |   -   |      1      |      0      |     N     | project-defined | [-]      |
  * | size_pu8      | X  |     | uint8*                              |   -   |      1      |      0      |     1     | [0,255]         | [byte]   |
  * | errCode_pu8   | X  |  X  | uint8*                              |   -   |      1      |      0      |     1     | [0,255]         | [-]      |
+ * | opStatus_u8   | X  |     | uint8                               |   -   |      1      |      0      |     1     | DIAG_OPSTATUS_* | [-]      |
  *
  * @par Activity diagram (PlantUML)
  *
@@ -78,6 +261,7 @@ typedef Std_ReturnType (*diagHandler_t)(uint8 *const output_pu8, uint8 *const si
  * | output_pu8    | X  |  X  | uint8*                              |   -   |      1      |      0      |     N     | project-defined | [-]      |
  * | size_pu8      | X  |  X  | uint8*                              |   -   |      1      |      0      |     1     | [0,255]         | [byte]   |
  * | errCode_pu8   | X  |  X  | uint8*                              |   -   |      1      |      0      |     1     | [0,255]         | [-]      |
+ * | opStatus_u8   | X  |     | uint8                               |   -   |      1      |      0      |     1     | DIAG_OPSTATUS_* | [-]      |
  *
  * @par Activity diagram (PlantUML)
  *
@@ -94,7 +278,7 @@ typedef Std_ReturnType (*diagHandler_t)(uint8 *const output_pu8, uint8 *const si
  * - E_NOT_OK: handler failure (not expected in current implementation).
  */
 
-Std_ReturnType RdbiVhitOverVoltageFaultDiag_(uint8 *const output_pu8, uint8 *const size_pu8, uint8 *const errCode_pu8);
+Std_ReturnType RdbiVhitOverVoltageFaultDiag_(uint8 *const output_pu8, uint8 *const size_pu8, uint8 *const errCode_pu8, uint8 opStatus_u8);
 
 /**
  * @brief Default DID handler used for unsupported requests ("Request Out Of Range").
@@ -120,6 +304,7 @@ Std_ReturnType RdbiVhitOverVoltageFaultDiag_(uint8 *const output_pu8, uint8 *con
  * | output_pu8    | X  |     | uint8*                              |   -   |      1      |      0      |     N     | project-defined | [-]      |
  * | size_pu8      | X  |     | uint8*                              |   -   |      1      |      0      |     1     | [0,255]         | [byte]   |
  * | errCode_pu8   | X  |  X  | uint8*                              |   -   |      1      |      0      |     1     | [0,255]         | [-]      |
+ * | opStatus_u8   | X  |     | uint8                               |   -   |      1      |      0      |     1     | DIAG_OPSTATUS_* | [-]      |
  *
  * @par Activity diagram (PlantUML)
  *
@@ -159,6 +344,7 @@ Std_ReturnType RdbiVhitOverVoltageFaultDiag_(uint8 *const output_pu8, uint8 *con
  * | output_pu8    | X  |     | uint8*                              |   -   |      1      |      0      |     N     | project-defined | [-]      |
  * | size_pu8      | X  |  X  | uint8*                              |   -   |      1      |      0      |     1     | [0,255]         | [byte]   |
  * | errCode_pu8   | X  |  X  | uint8*                              |   -   |      1      |      0      |     1     | [0,255]         | [-]      |
+ * | opStatus_u8   | X  |     | uint8                               |   -   |      1      |      0      |     1     | DIAG_OPSTATUS_* | [-]      |
  *
  * @par Activity diagram (PlantUML)
  *
@@ -178,6 +364,6 @@ Std_ReturnType RdbiVhitOverVoltageFaultDiag_(uint8 *const output_pu8, uint8 *con
  * - E_NOT_OK: request is not supported.
  */
 
-Std_ReturnType SubfunctionRequestOutOfRange_(uint8 *const output_pu8, uint8 *const size_pu8, uint8 *const errCode_pu8);
+Std_ReturnType SubfunctionRequestOutOfRange_(uint8 *const output_pu8, uint8 *const size_pu8, uint8 *const errCode_pu8, uint8 opStatus_u8);
 
 #endif
\ No newline at end of file
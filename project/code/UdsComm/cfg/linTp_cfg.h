@@ -0,0 +1,55 @@
+#ifndef LINTP_CFG_H
+#define LINTP_CFG_H
+/**
+ * @file linTp_cfg.h
+ * @brief Configuration of the LIN transport layer (ISO 17987-2).
+ *
+ * @defgroup LinTpCfgModule LIN Transport Layer Configuration
+ * @{
+ *
+ * @details
+ * Node address, timing and buffer sizes of the LIN transport layer, and the
+ * binding of the reassembled requests to the diagnostic layer.
+ */
+
+#include "diagnostic.h"
+
+/** @brief Node address (NAD) of this slave. */
+#define LINTP_NAD 0x10u
+
+/** @brief Broadcast NAD, accepted in addition to @ref LINTP_NAD. */
+#define LINTP_NAD_BROADCAST 0x7Fu
+
+/** @brief Call period of LinTp_MainFunction() [ms]. */
+#define LINTP_MAIN_PERIOD_MS 10u
+
+/** @brief N_As: longest time between handing a response frame to the LIN driver and its confirmation [ms]. */
+#define LINTP_N_AS_MS 1000u
+
+/** @brief N_Cr: longest time between two frames of a segmented request [ms]. */
+#define LINTP_N_CR_MS 1000u
+
+/**
+ * @brief Size of the response ring buffer [byte].
+ *
+ * @details
+ * Every queued response takes its length plus a 2-byte record header. The
+ * largest single response is @ref LINTP_TX_MAX_MSG_LEN.
+ */
+#define LINTP_TX_RING_SIZE 512u
+
+/** @brief Request reassembly buffer: requests are written in place into the diagnostic buffer. */
+#define LINTP_RX_BUFFER pbLinDiagBuffer
+
+/** @brief Size of @ref LINTP_RX_BUFFER [byte], set by `DIAG_CFG_RX_BUFFER_SIZE`; longer requests go to @ref LINTP_RX_OVERFLOW. */
+#define LINTP_RX_BUFFER_SIZE ((uint16_t)sizeof(pbLinDiagBuffer))
+
+/** @brief Called once a complete request of @p len bytes is in @ref LINTP_RX_BUFFER. */
+#define LINTP_RX_INDICATION(len) LinDiagRxIndication(len)
+
+/** @brief Called instead of the reassembly when a first frame announces more than @ref LINTP_RX_BUFFER_SIZE bytes; @p sid is its first data byte. */
+#define LINTP_RX_OVERFLOW(sid) LinDiagRxOverflow(sid)
+
+/** @} */
+
+#endif
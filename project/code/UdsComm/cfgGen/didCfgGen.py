@@ -0,0 +1,381 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+
+"""
+DID configuration generator of the UdsComm component.
+
+Reads a declarative DID specification (YAML or JSON, see didSpec.yaml) and
+generates into ../cfg:
+- diagnostic_cfg_did.h : DID numbers, size/access/session/security/kind
+                         and response cache constants, table size, cache
+                         arena size, handler prototypes and the
+                         compile-time buffer-length checks
+- diagnostic_cfg_did.c : the DID descriptor table sorted by DID (binary
+                         search in getDidCfg) and its compile-time CRC chain
+
+Usage:
+  python3 didCfgGen.py [spec] [--out DIR] [--check]
+
+  spec    DID specification, default: didSpec.yaml next to this script
+  --out   output folder, default: ../cfg
+  --check do not write, exit 1 if the generated files are out of date
+"""
+
+from __future__ import annotations
+
+import argparse
+import json
+import re
+import sys
+from pathlib import Path
+from typing import Any, Dict, List, Tuple
+
+
+SCRIPT_DIR = Path(__file__).resolve().parent
+DEFAULT_SPEC = SCRIPT_DIR / "didSpec.yaml"
+DEFAULT_OUT = SCRIPT_DIR.parent / "cfg"
+
+HEADER_NAME = "diagnostic_cfg_did.h"
+SOURCE_NAME = "diagnostic_cfg_did.c"
+
+ACCESS_BITS = {"read": "DIAG_CFG_ACCESS_READ", "write": "DIAG_CFG_ACCESS_WRITE"}
+SESSION_BITS = {
+    "default": "DIAG_CFG_SESSION_DEFAULT",
+    "programming": "DIAG_CFG_SESSION_PROGRAMMING",
+    "extended": "DIAG_CFG_SESSION_EXTENDED",
+}
+KINDS = {"static": "DIAG_CFG_DID_STATIC", "dynamic": "DIAG_CFG_DID_DYNAMIC"}
+CACHE_NEVER = "DIAG_CFG_CACHE_NEVER"
+CACHE_UNTIL_INVALIDATED = "DIAG_CFG_CACHE_UNTIL_INVALIDATED"
+CACHE_TTL = "DIAG_CFG_CACHE_TTL"
+CACHE_NO_SLOT = "DIAG_CFG_CACHE_NO_SLOT"
+
+C_IDENTIFIER = re.compile(r"^[A-Za-z_][A-Za-z0-9_]*$")
+
+# CRC-8/ATM byte step as an integer constant expression (same expansion as
+# EDD_CRC8_CT_BYTE), emitted into the generated source.
+CRC8_MACROS = r"""/* CRC-8/ATM of one byte as an integer constant expression (same expansion as
+ * EDD_CRC8_CT_BYTE; the component is built standalone and does not see the
+ * ErrorDataDetection headers). */
+#define DIAG_CFG_CRC8_BYTE(crc, byte)                                                                                                                                          \
+  ((((((crc) ^ (byte)) >> 0) & 1u) * 0x07u) ^ (((((crc) ^ (byte)) >> 1) & 1u) * 0x0Eu) ^ (((((crc) ^ (byte)) >> 2) & 1u) * 0x1Cu) ^                                           \
+   (((((crc) ^ (byte)) >> 3) & 1u) * 0x38u) ^ (((((crc) ^ (byte)) >> 4) & 1u) * 0x70u) ^ (((((crc) ^ (byte)) >> 5) & 1u) * 0xE0u) ^                                            \
+   (((((crc) ^ (byte)) >> 6) & 1u) * 0xC7u) ^ (((((crc) ^ (byte)) >> 7) & 1u) * 0x89u))
+
+#define DIAG_CFG_CRC8_U16(crc, value) DIAG_CFG_CRC8_BYTE(DIAG_CFG_CRC8_BYTE((crc), ((value) & 0xFFu)), (((value) >> 8) & 0xFFu))
+"""
+
+# Descriptor fields after the DID, in table and checkDidCfgCrc order, with
+# their width in bytes (u16 fields are fed low byte first, like the DID)
+CRC_FIELDS = [("SIZE", 1), ("ACCESS", 1), ("SESSION", 1), ("SECURITY", 1), ("KIND", 1),
+              ("CACHE", 1), ("CACHE_SLOT", 1), ("CACHE_TTL", 2), ("CACHE_OFS", 2)]
+
+
+class SpecError(Exception):
+    pass
+
+
+# -------------------------
+# Specification loading
+# -------------------------
+def load_spec(path: Path) -> Dict[str, Any]:
+    text = path.read_text(encoding="utf-8")
+    if path.suffix.lower() == ".json":
+        return json.loads(text)
+    try:
+        import yaml
+    except ImportError as exc:
+        raise SpecError("PyYAML is required for YAML specifications (or use a .json spec)") from exc
+    return yaml.safe_load(text)
+
+
+def as_int(value: Any, what: str) -> int:
+    if isinstance(value, bool):
+        raise SpecError(f"{what}: expected an integer, got {value!r}")
+    if isinstance(value, int):
+        return value
+    if isinstance(value, str):
+        try:
+            return int(value, 0)
+        except ValueError:
+            pass
+    raise SpecError(f"{what}: expected an integer, got {value!r}")
+
+
+def as_bits(values: Any, allowed: Dict[str, str], what: str) -> List[str]:
+    if not isinstance(values, list) or not values:
+        raise SpecError(f"{what}: expected a non-empty list out of {sorted(allowed)}")
+    bits = []
+    for value in values:
+        key = str(value).lower()
+        if key not in allowed:
+            raise SpecError(f"{what}: unknown value {value!r}, allowed {sorted(allowed)}")
+        if allowed[key] not in bits:
+            bits.append(allowed[key])
+    # Stable output whatever the order in the spec
+    return [bit for bit in allowed.values() if bit in bits]
+
+
+def as_cache(value: Any, what: str) -> Tuple[str, int]:
+    if isinstance(value, str) and value.lower() == "never":
+        return CACHE_NEVER, 0
+    if isinstance(value, str) and value.lower() == "invalidate":
+        return CACHE_UNTIL_INVALIDATED, 0
+    ttl = as_int(value, f"{what} (never, invalidate or a TTL in ms)")
+    if not 1 <= ttl <= 0xFFFF:
+        raise SpecError(f"{what}: TTL {ttl} ms out of range [1,65535]")
+    return CACHE_TTL, ttl
+
+
+def validate(spec: Dict[str, Any]) -> Dict[str, Any]:
+    if not isinstance(spec, dict):
+        raise SpecError("specification must be a mapping with 'maxPayload' and 'dids'")
+
+    max_payload = as_int(spec.get("maxPayload"), "maxPayload")
+    if not 1 <= max_payload <= 255:
+        raise SpecError(f"maxPayload: {max_payload} out of range [1,255]")
+
+    cache_arena = as_int(spec.get("cacheArena", 0), "cacheArena")
+    if not 0 <= cache_arena <= 0xFFFF:
+        raise SpecError(f"cacheArena: {cache_arena} out of range [0,65535]")
+
+    entries = spec.get("dids")
+    if not isinstance(entries, list) or not entries:
+        raise SpecError("dids: at least one DID is required")
+
+    dids = []
+    seen = set()
+    for index, entry in enumerate(entries):
+        where = f"dids[{index}]"
+        if not isinstance(entry, dict):
+            raise SpecError(f"{where}: expected a mapping")
+
+        did = as_int(entry.get("did"), f"{where}.did")
+        if not 0 <= did <= 0xFFFF:
+            raise SpecError(f"{where}.did: 0x{did:X} out of range [0x0000,0xFFFF]")
+        if did in seen:
+            raise SpecError(f"{where}.did: DID 0x{did:04X} configured twice")
+        seen.add(did)
+        where = f"DID 0x{did:04X}"
+
+        length = as_int(entry.get("length"), f"{where}.length")
+        if not 1 <= length <= max_payload:
+            raise SpecError(f"{where}.length: {length} out of range [1,{max_payload}] (maxPayload)")
+
+        source = entry.get("source")
+        if not isinstance(source, str) or not C_IDENTIFIER.match(source):
+            raise SpecError(f"{where}.source: expected a C function name, got {source!r}")
+
+        security = as_int(entry.get("security", 0), f"{where}.security")
+        if not 0 <= security <= 255:
+            raise SpecError(f"{where}.security: {security} out of range [0,255]")
+
+        kind = str(entry.get("kind", "dynamic")).lower()
+        if kind not in KINDS:
+            raise SpecError(f"{where}.kind: unknown value {kind!r}, allowed {sorted(KINDS)}")
+
+        access = as_bits(entry.get("access"), ACCESS_BITS, f"{where}.access")
+        sink = entry.get("sink")
+        if ACCESS_BITS["write"] in access:
+            if not isinstance(sink, str) or not C_IDENTIFIER.match(sink):
+                raise SpecError(f"{where}.sink: writable DID needs a C function name, got {sink!r}")
+        elif sink is not None:
+            raise SpecError(f"{where}.sink: DID is not writable (access has no 'write')")
+        cache, ttl = as_cache(entry.get("cache", "invalidate" if kind == "static" else "never"), f"{where}.cache")
+        if cache != CACHE_NEVER and ACCESS_BITS["read"] not in access:
+            raise SpecError(f"{where}.cache: only readable DIDs can be cached")
+
+        dids.append({
+            "did": did,
+            "name": str(entry.get("name", "")),
+            "length": length,
+            "source": source,
+            "sink": sink,
+            "access": access,
+            "sessions": as_bits(entry.get("sessions", ["default"]), SESSION_BITS, f"{where}.sessions"),
+            "security": security,
+            "kind": KINDS[kind],
+            "cache": cache,
+            "ttl": ttl,
+        })
+
+    dids.sort(key=lambda d: d["did"])
+
+    # Cache slots and arena offsets in table order, payloads back to back
+    slot = 0
+    offset = 0
+    for d in dids:
+        d["slot"] = None
+        d["offset"] = 0
+        if d["cache"] != CACHE_NEVER:
+            d["slot"] = slot
+            d["offset"] = offset
+            slot += 1
+            offset += d["length"]
+    if slot > 0xFF:
+        raise SpecError(f"cache: {slot} cached DIDs, at most 255 (0xFF marks an uncached DID)")
+    if offset > cache_arena:
+        raise SpecError(f"cacheArena: cached DIDs need {offset} byte(s), bound is {cache_arena}")
+
+    return {"maxPayload": max_payload, "cacheArena": cache_arena, "cacheSlots": slot, "cacheSize": offset, "dids": dids}
+
+
+# -------------------------
+# Code emission
+# -------------------------
+def generated_banner(spec_path: Path) -> str:
+    return (f"/* GENERATED by cfgGen/{Path(__file__).name} from cfgGen/{spec_path.name}."
+            " Do not edit, regenerate instead. */\n")
+
+
+def did_macro(did: int) -> str:
+    return f"DID_{did:04X}"
+
+
+def emit_header(cfg: Dict[str, Any], spec_path: Path) -> str:
+    dids = cfg["dids"]
+    out = [generated_banner(spec_path)]
+    out.append("#ifndef DIAGNOSTIC_CFG_DID_H\n#define DIAGNOSTIC_CFG_DID_H\n")
+    out.append("/**\n"
+               f" * @file {HEADER_NAME}\n"
+               " * @brief Generated DID constants of the Diagnostic configuration.\n"
+               " *\n"
+               " * @details\n"
+               " * One block of constants per DID, the table and cache sizes and the\n"
+               " * handler prototypes. Included by diagnostic_cfg_priv.h, which defines\n"
+               " * the DIAG_CFG_ACCESS_*, DIAG_CFG_SESSION_*, DIAG_CFG_DID_* and\n"
+               " * DIAG_CFG_CACHE_* values.\n"
+               " */\n")
+    out.append('#include "diagnostic_cfg.h"\n\n')
+
+    out.append("/** @brief Largest DID payload the transport can carry [byte]. */\n")
+    out.append(f"#define DIAG_CFG_MAX_PAYLOAD {cfg['maxPayload']}U\n\n")
+    out.append("/** @brief Number of entries of the DID configuration table. */\n")
+    out.append(f"#define DIAG_CFG_DID_COUNT {len(dids)}U\n\n")
+    out.append("/** @brief Largest configured DID payload [byte]. */\n")
+    out.append(f"#define DIAG_CFG_DID_MAX_SIZE {max(d['length'] for d in dids)}U\n\n")
+    out.append("/** @brief Number of DIDs with a response cache slot. */\n")
+    out.append(f"#define DIAG_CFG_CACHE_SLOT_COUNT {cfg['cacheSlots']}U\n\n")
+    out.append(f"/** @brief Bytes of cache arena used by the cached DIDs (bound: cacheArena = {cfg['cacheArena']}). */\n")
+    out.append(f"#define DIAG_CFG_CACHE_ARENA_SIZE {cfg['cacheSize']}U\n")
+
+    for d in dids:
+        m = did_macro(d["did"])
+        out.append("\n")
+        if d["name"]:
+            out.append(f"/* {d['name']} */\n")
+        out.append(f"#define {m} 0x{d['did']:04X}U\n")
+        out.append(f"#define {m}_SIZE {d['length']}U\n")
+        out.append(f"#define {m}_ACCESS ({' | '.join(d['access'])})\n")
+        out.append(f"#define {m}_SESSION ({' | '.join(d['sessions'])})\n")
+        out.append(f"#define {m}_SECURITY {d['security']}U\n")
+        out.append(f"#define {m}_KIND {d['kind']}\n")
+        out.append(f"#define {m}_CACHE {d['cache']}\n")
+        out.append(f"#define {m}_CACHE_SLOT {CACHE_NO_SLOT if d['slot'] is None else str(d['slot']) + 'U'}\n")
+        out.append(f"#define {m}_CACHE_TTL {d['ttl']}U\n")
+        out.append(f"#define {m}_CACHE_OFS {d['offset']}U\n")
+
+    out.append("\n/* Buffer-length checks: a DID that does not fit the transport makes the array size negative */\n")
+    for d in dids:
+        m = did_macro(d["did"])
+        out.append(f"typedef char DiagCfg_{m}_SizeCheck_t[(({m}_SIZE >= 1U) && ({m}_SIZE <= DIAG_CFG_MAX_PAYLOAD)) ? 1 : -1];\n")
+
+    out.append("\n/* DID handlers (data sources) */\n")
+    emitted = set()
+    for d in dids:
+        for handler in (d["source"], d["sink"]):
+            if handler is not None and handler not in emitted:
+                emitted.add(handler)
+                out.append(f"Std_ReturnType {handler}(uint8 *const output_pu8, uint8 *const size_pu8, uint8 *const errCode_pu8, uint8 opStatus_u8);\n")
+
+    out.append("\n#endif\n")
+    return "".join(out)
+
+
+def emit_source(cfg: Dict[str, Any], spec_path: Path) -> str:
+    dids = cfg["dids"]
+    out = [generated_banner(spec_path)]
+    out.append("/**\n"
+               f" * @file {SOURCE_NAME}\n"
+               " * @brief Generated DID descriptor table of the Diagnostic configuration.\n"
+               " *\n"
+               " * @details\n"
+               " * `DiagCfg_DidCfg_cst` sorted by ascending DID and its CRC-8/ATM\n"
+               " * `DiagCfg_DidCfgCrc_cu8`, both documented in diagnostic_cfg_priv.h.\n"
+               " */\n\n")
+    out.append('#include "diagnostic_cfg.h"\n#include "diagnostic_cfg_priv.h"\n#define NULL ((void *)0)\n\n')
+    out.append(CRC8_MACROS)
+
+    out.append("\n/* Sorted by ascending DID: one row per DID, no control flow to edit */\n")
+    out.append("const DiagCfg_DidCfg_t DiagCfg_DidCfg_cst[DIAG_CFG_DID_COUNT] = {\n")
+    for d in dids:
+        m = did_macro(d["did"])
+        if d["name"]:
+            out.append(f"    /* {d['name']} */\n")
+        fields = [m] + [f"{m}_{field}" for field, _ in CRC_FIELDS] + [f"&{d['source']}", f"&{d['sink']}" if d["sink"] else "NULL"]
+        out.append(f"    {{{', '.join(fields)}}},\n")
+    out.append("};\n")
+
+    out.append("\n/* One constant per table field, in table order: the expansion stays linear */\n")
+    out.append("enum {\n")
+    previous = "0x00u"
+    constants = []
+    for d in dids:
+        m = did_macro(d["did"])
+        crc = f"DIAG_CFG_CRC_{d['did']:04X}"
+        constants.append(f"  {crc}_DID = DIAG_CFG_CRC8_U16({previous}, {m})")
+        previous = f"{crc}_DID"
+        for field, width in CRC_FIELDS:
+            step = "DIAG_CFG_CRC8_U16" if width == 2 else "DIAG_CFG_CRC8_BYTE"
+            constants.append(f"  {crc}_{field} = {step}({previous}, {m}_{field})")
+            previous = f"{crc}_{field}"
+    out.append(",\n".join(constants))
+    out.append("\n};\n\n")
+    out.append(f"const uint8 DiagCfg_DidCfgCrc_cu8 = (uint8){previous};\n")
+    return "".join(out)
+
+
+# -------------------------
+# Main
+# -------------------------
+def main(argv: List[str]) -> int:
+    parser = argparse.ArgumentParser(description="Generate the UdsComm DID configuration from a DID specification.")
+    parser.add_argument("spec", nargs="?", type=Path, default=DEFAULT_SPEC, help="DID specification (.yaml/.yml/.json)")
+    parser.add_argument("--out", type=Path, default=DEFAULT_OUT, help="output folder (default: ../cfg)")
+    parser.add_argument("--check", action="store_true", help="exit 1 if the generated files are out of date")
+    args = parser.parse_args(argv)
+
+    try:
+        cfg = validate(load_spec(args.spec))
+    except (OSError, ValueError, SpecError) as exc:
+        print(f"[ERROR] {args.spec}: {exc}")
+        return 1
+
+    outputs = {
+        args.out / HEADER_NAME: emit_header(cfg, args.spec),
+        args.out / SOURCE_NAME: emit_source(cfg, args.spec),
+    }
+
+    stale = []
+    for path, text in outputs.items():
+        current = path.read_text(encoding="utf-8") if path.is_file() else None
+        if current == text:
+            continue
+        if args.check:
+            stale.append(path)
+        else:
+            path.write_text(text, encoding="utf-8")
+            print(f"[INFO] Generated {path}")
+
+    if stale:
+        for path in stale:
+            print(f"[ERROR] Out of date: {path}")
+        return 1
+
+    print(f"[INFO] {len(cfg['dids'])} DID(s), largest payload {max(d['length'] for d in cfg['dids'])} byte(s), "
+          f"{cfg['cacheSlots']} cached using {cfg['cacheSize']}/{cfg['cacheArena']} arena byte(s)")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv[1:]))
@@ -1,7 +1,7 @@
 #include "diagnostic_priv.h"
 
 /* Global buffers normally provided by LIN stack */
-uint8_t pbLinDiagBuffer[32];
+uint8_t pbLinDiagBuffer[DIAG_CFG_RX_BUFFER_SIZE];
 /* Message length */
 uint16_t g_linDiagDataLength_u16 = 0;
 
@@ -41,35 +41,488 @@ static bool checkCorrectResultll_b(uint8_t input) {
 }
 
 /* Send positive response */
-void LinDiagSendPosResponse(void) { /* Implementation stub: send positive response via LIN */ }
+void LinDiagSendPosResponse(void) { LinTp_TxCommit((uint16_t)(g_linDiagDataLength_u16 + 1u)); }
 
 /* Send negative response with error code */
-void LinDiagSendNegResponse(uint8_t errorCode) {
-  /* Implementation stub: send negative response via LIN */
-  (void)errorCode;
+void LinDiagSendNegResponse(uint8_t errorCode) { LinDiagSendNegResponseSid(pbLinDiagBuffer[0], errorCode); }
+
+/* Send negative response with error code for a request no longer (or not) in pbLinDiagBuffer */
+void LinDiagSendNegResponseSid(uint8_t sid_u8, uint8_t errorCode) {
+  uint8_t *const l_resp_pu8 = LinTp_TxReserve(3u);
+
+  /* Without room in the ring the tester times out and repeats the request */
+  if(NULL != l_resp_pu8) {
+    l_resp_pu8[0] = DIAG_SID_NEGATIVE_RESPONSE;
+    l_resp_pu8[1] = sid_u8;
+    l_resp_pu8[2] = errorCode;
+    LinTp_TxCommit(3u);
+  }
 }
 
-void ApplLinDiagReadDataById(void) {
-  const uint16_t l_did_cu16 = ((uint16_t)(pbLinDiagBuffer[1] << 8) & (uint16_t)0xFF00) | ((uint16_t)pbLinDiagBuffer[2] & (uint16_t)0x00FF);
+/* Reserve a positive response of len_u16 bytes (SID included) in the LIN TP ring and write its SID;
+ * g_linDiagDataLength_u16 is set to the bytes after the SID. NRC busyRepeatRequest if the ring is full. */
+static uint8_t *linDiagPosResponse(uint16_t len_u16) {
+  uint8_t *const l_resp_pu8 = LinTp_TxReserve(len_u16);
+
+  if(NULL == l_resp_pu8) {
+    LinDiagSendNegResponse(kLinDiagNrcBusyRepeatRequest);
+  } else {
+    l_resp_pu8[0] = (uint8_t)(pbLinDiagBuffer[0] + DIAG_POSITIVE_RESPONSE_OFFSET);
+    g_linDiagDataLength_u16 = (uint16_t)(len_u16 - 1u);
+  }
+
+  return l_resp_pu8;
+}
+
+/* Active session (DIAG_CFG_SESSION_* bit) and unlocked security level. No service changes them yet:
+ * the ECU stays in the default session, locked. */
+static uint8_t linDiagSession_u8 = DIAG_CFG_SESSION_DEFAULT;
+static uint8_t linDiagSecurityLevel_u8 = 0u;
+
+uint8_t LinDiagGetSession(void) { return linDiagSession_u8; }
+
+uint8_t LinDiagGetSecurityLevel(void) { return linDiagSecurityLevel_u8; }
+
+/* ReadDataByIdentifier job, kept from the request to the final response while a DID handler is pending */
+static uint16_t linDiagRdbiDids_au16[DIAG_RDBI_MAX_DIDS]; /* Supported DIDs of the request */
+static uint8_t linDiagRdbiDidCount_u8 = 0u;
+static uint8_t linDiagRdbiDidIdx_u8 = 0u;   /* Next DID to read */
+static uint16_t linDiagRdbiPos_u16 = 1u;    /* Next free byte of the response */
+static uint8_t *linDiagRdbiResp_pu8 = NULL; /* Response area reserved in the LIN TP ring */
+
+/* Response pending supervision */
+static bool linDiagPending_b = false;
+static uint16_t linDiagP2Timer_u16 = 0u;    /* Ticks left before the next NRC 0x78 */
+static uint8_t linDiagRespPendCnt_u8 = 0u;  /* NRC 0x78 sent for the current request */
+
+/* ReadDataByPeriodicIdentifier schedule; the active entries are packed in [0, linDiagPdidCount_u8) */
+static LinDiagPdid_t linDiagPdid_ast[DIAG_CFG_PDID_MAX];
+static uint8_t linDiagPdidCount_u8 = 0u;
+/* Period of each transmission mode, indexed by mode - DIAG_PDID_MODE_SLOW */
+static const uint16_t linDiagPdidPeriod_cau16[3] = {DIAG_PDID_TICKS(DIAG_CFG_PDID_SLOW_MS), DIAG_PDID_TICKS(DIAG_CFG_PDID_MEDIUM_MS), DIAG_PDID_TICKS(DIAG_CFG_PDID_FAST_MS)};
+
+/* Read the DIDs from linDiagRdbiDidIdx_u8 on; the first handler gets opStatus_u8, the next ones start fresh */
+static Std_ReturnType linDiagRdbiRead(uint8_t opStatus_u8, uint8_t *errCode_pu8) {
   Std_ReturnType l_result_ = E_OK;
-  uint8_t l_errCode_u8 = 0;
-  uint8_t *const l_diagBuf_pu8 = &pbLinDiagBuffer[3];
-  uint8_t l_diagBufSize_u8 = 0;
   Std_ReturnType l_didSupported_ = E_OK;
-  checkCurrentNad((uint8_t)0u, &l_result_);
-  if(E_OK == l_result_) { checkMsgDataLength(g_linDiagDataLength_u16, &l_result_); }
-  if(E_OK == l_result_) { l_result_ = getHandlersForReadDataById(&l_errCode_u8, l_did_cu16, &l_diagBufSize_u8, &l_didSupported_, l_diagBuf_pu8); }
-  switch(l_result_) {
+  uint8_t l_opStatus_u8 = opStatus_u8;
+  uint8_t l_diagBufSize_u8;
+  uint16_t l_did_u16;
+
+  while((E_OK == l_result_) && (linDiagRdbiDidIdx_u8 < linDiagRdbiDidCount_u8)) {
+    l_did_u16 = linDiagRdbiDids_au16[linDiagRdbiDidIdx_u8];
+    linDiagRdbiResp_pu8[linDiagRdbiPos_u16] = (uint8_t)(l_did_u16 >> 8);
+    linDiagRdbiResp_pu8[linDiagRdbiPos_u16 + 1u] = (uint8_t)(l_did_u16 & 0xFFu);
+    l_diagBufSize_u8 = 0u;
+    l_result_ = getHandlersForReadDataById(errCode_pu8, l_did_u16, &l_diagBufSize_u8, &l_didSupported_, &linDiagRdbiResp_pu8[linDiagRdbiPos_u16 + 2u], l_opStatus_u8);
+    if(E_OK == l_result_) {
+      linDiagRdbiPos_u16 += (uint16_t)l_diagBufSize_u8 + 2u;
+      linDiagRdbiDidIdx_u8++;
+      l_opStatus_u8 = DIAG_OPSTATUS_INITIAL;
+    }
+  }
+
+  return l_result_;
+}
+
+/* Send the response once the handlers are done, or start the response pending supervision */
+static void linDiagRdbiConclude(Std_ReturnType result_, uint8_t errCode_u8) {
+  switch(result_) {
   case E_OK:
-    g_linDiagDataLength_u16 = ((uint16_t)l_diagBufSize_u8 + 2u);
+    linDiagPending_b = false;
+    g_linDiagDataLength_u16 = (uint16_t)(linDiagRdbiPos_u16 - 1u);
     LinDiagSendPosResponse();
     break;
+  case E_PENDING:
+    if(!linDiagPending_b) {
+      linDiagPending_b = true;
+      linDiagP2Timer_u16 = DIAG_P2_TICKS;
+      linDiagRespPendCnt_u8 = 0u;
+    }
+    break;
   default:
-    LinDiagSendNegResponse(l_errCode_u8);
+    linDiagPending_b = false;
+    /* pbLinDiagBuffer may already hold a newer request when a pending handler fails */
+    LinDiagSendNegResponseSid(DIAG_SID_READ_DATA_BY_ID, errCode_u8);
     break;
   }
 }
 
+/* Stop the pending handler; its response reservation is dropped by the next LinTp_TxReserve() */
+static void linDiagRdbiCancel(void) {
+  uint8_t l_errCode_u8 = 0u;
+  uint8_t l_diagBufSize_u8 = 0u;
+  Std_ReturnType l_didSupported_ = E_OK;
+
+  linDiagPending_b = false;
+  (void)getHandlersForReadDataById(&l_errCode_u8, linDiagRdbiDids_au16[linDiagRdbiDidIdx_u8], &l_diagBufSize_u8, &l_didSupported_, &linDiagRdbiResp_pu8[linDiagRdbiPos_u16 + 2u],
+                                   DIAG_OPSTATUS_CANCEL);
+}
+
+void LinDiagRxIndication(uint16_t length) {
+  const DiagCfg_SidCfg_t *l_sidCfg_pst;
+  Std_ReturnType l_result_ = E_OK;
+
+  /* A new request abandons the one still waiting for a handler */
+  if(linDiagPending_b) { linDiagRdbiCancel(); }
+  g_linDiagDataLength_u16 = length;
+
+  /* Pre-checks shared by all services, run once per request; a request for another node gets no response */
+  checkCurrentNad((uint8_t)0u, &l_result_);
+  if(E_OK == l_result_) {
+    checkMsgDataLength(length, &l_result_);
+    l_sidCfg_pst = getSidCfg(pbLinDiagBuffer[0]);
+    if(NULL == l_sidCfg_pst) {
+      LinDiagSendNegResponse(kLinDiagNrcServiceNotSupported);
+    } else if(0u == (l_sidCfg_pst->session_u8 & linDiagSession_u8)) {
+      LinDiagSendNegResponse(kLinDiagNrcServiceNotSupportedInActiveSession);
+    } else if(l_sidCfg_pst->security_u8 > linDiagSecurityLevel_u8) {
+      /* ISO 14229-1 order: SID, session, security, then the request length */
+      LinDiagSendNegResponse(kLinDiagNrcSecurityAccessDenied);
+    } else if((E_OK != l_result_) || (length < l_sidCfg_pst->minLen_u8)) {
+      LinDiagSendNegResponse(kLinDiagNrcIncorrectMessageLength);
+    } else {
+      l_sidCfg_pst->service_pf();
+    }
+  }
+}
+
+void LinDiagRxOverflow(uint8_t sid_u8) {
+  /* The tester moved on, as for a new request */
+  if(linDiagPending_b) { linDiagRdbiCancel(); }
+  LinDiagSendNegResponseSid(sid_u8, kLinDiagNrcIncorrectMessageLength);
+}
+
+void ApplLinDiagReadDataById(void) {
+  uint8_t l_reqDids_u8 = 0u;
+  uint16_t l_respLen_u16 = 0u;
+  Std_ReturnType l_result_ = E_OK;
+  uint8_t l_errCode_u8 = 0;
+  uint8_t l_diagBufSize_u8 = 0;
+  uint8_t l_idx_u8;
+  linDiagRdbiDidCount_u8 = 0u;
+  linDiagRdbiDidIdx_u8 = 0u;
+  linDiagRdbiPos_u16 = 1u;
+  /* SID followed by at least one complete DID */
+  if((g_linDiagDataLength_u16 < 3u) || (0u == (g_linDiagDataLength_u16 & 1u))) {
+    l_errCode_u8 = kLinDiagNrcIncorrectMessageLength;
+    l_result_ = E_NOT_OK;
+  }
+  if(E_OK == l_result_) {
+    /* Size the whole response before any handler runs; unsupported DIDs are skipped. The DID list is
+     * kept because a pending handler may outlive the request in pbLinDiagBuffer. */
+    l_reqDids_u8 = (uint8_t)((g_linDiagDataLength_u16 - 1u) >> 1);
+    for(l_idx_u8 = 0u; l_idx_u8 < l_reqDids_u8; l_idx_u8++) {
+      const uint16_t l_did_cu16 = ((uint16_t)(pbLinDiagBuffer[1u + (2u * l_idx_u8)] << 8) & (uint16_t)0xFF00) | ((uint16_t)pbLinDiagBuffer[2u + (2u * l_idx_u8)] & (uint16_t)0x00FF);
+      if(E_OK == getDidReadSize(l_did_cu16, &l_diagBufSize_u8)) {
+        linDiagRdbiDids_au16[linDiagRdbiDidCount_u8] = l_did_cu16;
+        linDiagRdbiDidCount_u8++;
+        l_respLen_u16 += (uint16_t)l_diagBufSize_u8 + 2u;
+      }
+    }
+    if(0u == linDiagRdbiDidCount_u8) {
+      l_errCode_u8 = kLinDiagNrcRequestOutOfRange;
+      l_result_ = E_NOT_OK;
+    } else if(l_respLen_u16 > DIAG_RDBI_RESPONSE_CAPACITY) {
+      l_errCode_u8 = kLinDiagNrcResponseTooLong;
+      l_result_ = E_NOT_OK;
+    } else {
+      /* Handlers write the response straight into the LIN TP ring */
+      linDiagRdbiResp_pu8 = LinTp_TxReserve((uint16_t)(l_respLen_u16 + 1u));
+      if(NULL == linDiagRdbiResp_pu8) {
+        l_errCode_u8 = kLinDiagNrcBusyRepeatRequest;
+        l_result_ = E_NOT_OK;
+      } else {
+        linDiagRdbiResp_pu8[0] = (uint8_t)(DIAG_SID_READ_DATA_BY_ID + DIAG_POSITIVE_RESPONSE_OFFSET);
+      }
+    }
+  }
+  if(E_OK == l_result_) { l_result_ = linDiagRdbiRead(DIAG_OPSTATUS_INITIAL, &l_errCode_u8); }
+  linDiagRdbiConclude(l_result_, l_errCode_u8);
+}
+
+/* Index of a scheduled periodic identifier, linDiagPdidCount_u8 if not scheduled */
+static uint8_t linDiagPdidFind(uint8_t pdid_u8) {
+  uint8_t l_idx_u8 = 0u;
+
+  while((l_idx_u8 < linDiagPdidCount_u8) && (pdid_u8 != linDiagPdid_ast[l_idx_u8].msg_au8[1])) { l_idx_u8++; }
+
+  return l_idx_u8;
+}
+
+/* Sample the periodic DIDs that are due and queue their responses. Nothing is sampled or queued while a
+ * ReadDataByIdentifier request is pending: its response is reserved in the ring and a new reservation
+ * would drop it; the due entries are served once it completes. */
+static void linDiagPdidSchedule(void) {
+  LinDiagPdid_t *l_pdid_pst;
+  uint8_t *l_resp_pu8;
+  uint8_t l_errCode_u8 = 0u;
+  uint8_t l_diagBufSize_u8;
+  Std_ReturnType l_didSupported_ = E_OK;
+  Std_ReturnType l_result_;
+  uint16_t l_did_u16;
+  uint8_t l_idx_u8;
+
+  for(l_idx_u8 = 0u; l_idx_u8 < linDiagPdidCount_u8; l_idx_u8++) {
+    l_pdid_pst = &linDiagPdid_ast[l_idx_u8];
+    if(0u != l_pdid_pst->timer_u16) { l_pdid_pst->timer_u16--; }
+    if(!linDiagPending_b) {
+      if(0u == l_pdid_pst->timer_u16) {
+        l_pdid_pst->timer_u16 = linDiagPdidPeriod_cau16[l_pdid_pst->mode_u8 - DIAG_PDID_MODE_SLOW];
+        l_did_u16 = (uint16_t)(DIAG_CFG_PDID_DID_BASE + l_pdid_pst->msg_au8[1]);
+        l_diagBufSize_u8 = 0u;
+        l_result_ = getHandlersForReadDataById(&l_errCode_u8, l_did_u16, &l_diagBufSize_u8, &l_didSupported_, &l_pdid_pst->msg_au8[2], DIAG_OPSTATUS_INITIAL);
+        if(E_OK == l_result_) {
+          l_pdid_pst->len_u8 = (uint8_t)(l_diagBufSize_u8 + 2u);
+        } else {
+          /* No sample this period; a slow source is not waited for */
+          if(E_PENDING == l_result_) { (void)getHandlersForReadDataById(&l_errCode_u8, l_did_u16, &l_diagBufSize_u8, &l_didSupported_, &l_pdid_pst->msg_au8[2], DIAG_OPSTATUS_CANCEL); }
+          l_pdid_pst->len_u8 = 0u;
+        }
+      }
+      /* A sample the ring has no room for is retried on the next call, until the next sample replaces it */
+      if(0u != l_pdid_pst->len_u8) {
+        l_resp_pu8 = LinTp_TxReserve(l_pdid_pst->len_u8);
+        if(NULL != l_resp_pu8) {
+          (void)memcpy(l_resp_pu8, l_pdid_pst->msg_au8, l_pdid_pst->len_u8);
+          LinTp_TxCommit(l_pdid_pst->len_u8);
+          l_pdid_pst->len_u8 = 0u;
+        }
+      }
+    }
+  }
+}
+
+void ApplLinDiagReadDataByPeriodicId(void) {
+  const uint8_t l_mode_cu8 = pbLinDiagBuffer[1];
+  const uint8_t l_pdidNum_cu8 = (uint8_t)(g_linDiagDataLength_u16 - 2u);
+  uint8_t l_errCode_u8 = 0u;
+  uint8_t l_new_u8 = 0u;
+  uint8_t l_size_u8 = 0u;
+  uint8_t l_pdid_u8;
+  uint8_t l_idx_u8;
+  uint8_t l_prev_u8;
+  uint8_t l_slot_u8;
+
+  if(DIAG_PDID_MODE_STOP == l_mode_cu8) {
+    /* No periodic identifier: stop all */
+    if(0u == l_pdidNum_cu8) { linDiagPdidCount_u8 = 0u; }
+    for(l_idx_u8 = 0u; l_idx_u8 < l_pdidNum_cu8; l_idx_u8++) {
+      l_slot_u8 = linDiagPdidFind(pbLinDiagBuffer[2u + l_idx_u8]);
+      if(l_slot_u8 < linDiagPdidCount_u8) {
+        linDiagPdidCount_u8--;
+        linDiagPdid_ast[l_slot_u8] = linDiagPdid_ast[linDiagPdidCount_u8];
+      }
+    }
+  } else if((l_mode_cu8 < DIAG_PDID_MODE_SLOW) || (l_mode_cu8 > DIAG_PDID_MODE_FAST)) {
+    l_errCode_u8 = kLinDiagNrcRequestOutOfRange;
+  } else if(0u == l_pdidNum_cu8) {
+    l_errCode_u8 = kLinDiagNrcIncorrectMessageLength;
+  } else {
+    /* Check the whole request before the schedule changes: readable DIDs that fit the sample
+     * buffer, and a free entry for every periodic identifier not yet scheduled */
+    for(l_idx_u8 = 0u; (0u == l_errCode_u8) && (l_idx_u8 < l_pdidNum_cu8); l_idx_u8++) {
+      l_pdid_u8 = pbLinDiagBuffer[2u + l_idx_u8];
+      if((E_OK != getDidReadSize((uint16_t)(DIAG_CFG_PDID_DID_BASE + l_pdid_u8), &l_size_u8)) || (l_size_u8 > DIAG_CFG_PDID_DATA_MAX)) {
+        l_errCode_u8 = kLinDiagNrcRequestOutOfRange;
+      } else if(linDiagPdidFind(l_pdid_u8) == linDiagPdidCount_u8) {
+        l_prev_u8 = 0u;
+        while((l_prev_u8 < l_idx_u8) && (l_pdid_u8 != pbLinDiagBuffer[2u + l_prev_u8])) { l_prev_u8++; }
+        if(l_prev_u8 == l_idx_u8) { l_new_u8++; }
+      } else {
+        /* Already scheduled: only its mode changes */
+      }
+    }
+    if((0u == l_errCode_u8) && ((uint8_t)(linDiagPdidCount_u8 + l_new_u8) > DIAG_CFG_PDID_MAX)) { l_errCode_u8 = kLinDiagNrcRequestOutOfRange; }
+    for(l_idx_u8 = 0u; (0u == l_errCode_u8) && (l_idx_u8 < l_pdidNum_cu8); l_idx_u8++) {
+      l_pdid_u8 = pbLinDiagBuffer[2u + l_idx_u8];
+      l_slot_u8 = linDiagPdidFind(l_pdid_u8);
+      if(l_slot_u8 == linDiagPdidCount_u8) {
+        linDiagPdidCount_u8++;
+        linDiagPdid_ast[l_slot_u8].msg_au8[0] = (uint8_t)(DIAG_SID_READ_DATA_BY_PERIODIC_ID + DIAG_POSITIVE_RESPONSE_OFFSET);
+        linDiagPdid_ast[l_slot_u8].msg_au8[1] = l_pdid_u8;
+        linDiagPdid_ast[l_slot_u8].len_u8 = 0u;
+      }
+      /* First sample on the next LinDiagMainFunction() call */
+      linDiagPdid_ast[l_slot_u8].mode_u8 = l_mode_cu8;
+      linDiagPdid_ast[l_slot_u8].timer_u16 = 0u;
+    }
+  }
+
+  if(0u != l_errCode_u8) {
+    LinDiagSendNegResponse(l_errCode_u8);
+  } else if(NULL != linDiagPosResponse(1u)) {
+    LinDiagSendPosResponse();
+  } else {
+    /* Ring full: busyRepeatRequest already sent */
+  }
+}
+
+void ApplLinDiagWriteDataById(void) {
+  uint8_t l_errCode_u8 = 0u;
+  uint8_t *l_resp_pu8;
+  const uint16_t l_did_cu16 = (uint16_t)((uint16_t)pbLinDiagBuffer[1] << 8) | (uint16_t)pbLinDiagBuffer[2];
+
+  /* Request: SID, DID (2 bytes), data; response: 0x6E, DID */
+  if(E_OK != getHandlersForWriteDataById(&l_errCode_u8, l_did_cu16, (uint8_t)(g_linDiagDataLength_u16 - 3u), &pbLinDiagBuffer[3])) {
+    LinDiagSendNegResponse(l_errCode_u8);
+  } else {
+    l_resp_pu8 = linDiagPosResponse(3u);
+    if(NULL != l_resp_pu8) {
+      l_resp_pu8[1] = pbLinDiagBuffer[1];
+      l_resp_pu8[2] = pbLinDiagBuffer[2];
+      LinDiagSendPosResponse();
+    }
+  }
+}
+
+void ApplLinDiagRoutineControl(void) {
+  const uint8_t l_subFunction_cu8 = (uint8_t)(pbLinDiagBuffer[1] & (uint8_t)~DIAG_SUPPRESS_POS_RSP);
+  const uint16_t l_rid_cu16 = (uint16_t)((uint16_t)pbLinDiagBuffer[2] << 8) | (uint16_t)pbLinDiagBuffer[3];
+  /* Taken before linDiagPosResponse() sets g_linDiagDataLength_u16 to the response length */
+  const uint8_t l_optionLen_cu8 = (uint8_t)(g_linDiagDataLength_u16 - 4u);
+  uint8_t l_errCode_u8 = 0u;
+  uint8_t l_statusLen_u8 = DIAG_RC_STATUS_CAPACITY;
+  uint8_t *l_resp_pu8;
+
+  if((l_subFunction_cu8 < DIAG_RC_START) || (l_subFunction_cu8 > DIAG_RC_RESULTS)) {
+    LinDiagSendNegResponse(kLinDiagNrcSubFunctionNotSupported);
+  } else {
+    /* The routine writes its status record straight into the response: 0x71, sub-function, RID, status */
+    l_resp_pu8 = linDiagPosResponse((uint16_t)(4u + DIAG_RC_STATUS_CAPACITY));
+    if(NULL != l_resp_pu8) {
+      if(E_OK != getHandlersForRoutineControl(&l_errCode_u8, l_subFunction_cu8, l_rid_cu16, &pbLinDiagBuffer[4], l_optionLen_cu8, &l_resp_pu8[4], &l_statusLen_u8)) {
+        LinDiagSendNegResponse(l_errCode_u8);
+      } else if(0u == (pbLinDiagBuffer[1] & DIAG_SUPPRESS_POS_RSP)) {
+        l_resp_pu8[1] = l_subFunction_cu8;
+        l_resp_pu8[2] = pbLinDiagBuffer[2];
+        l_resp_pu8[3] = pbLinDiagBuffer[3];
+        g_linDiagDataLength_u16 = (uint16_t)(3u + l_statusLen_u8);
+        LinDiagSendPosResponse();
+      } else {
+        /* Positive response suppressed: the reservation is dropped by the next LinTp_TxReserve() */
+      }
+    }
+  }
+}
+
+void ApplLinDiagTesterPresent(void) {
+  uint8_t *l_resp_pu8;
+
+  /* Request: SID, zeroSubFunction; response: 0x7E, 0x00 */
+  if(0u != (pbLinDiagBuffer[1] & (uint8_t)~DIAG_SUPPRESS_POS_RSP)) {
+    LinDiagSendNegResponse(kLinDiagNrcSubFunctionNotSupported);
+  } else if(2u != g_linDiagDataLength_u16) {
+    LinDiagSendNegResponse(kLinDiagNrcIncorrectMessageLength);
+  } else if(0u == (pbLinDiagBuffer[1] & DIAG_SUPPRESS_POS_RSP)) {
+    l_resp_pu8 = linDiagPosResponse(2u);
+    if(NULL != l_resp_pu8) {
+      l_resp_pu8[1] = 0x00u;
+      LinDiagSendPosResponse();
+    }
+  } else {
+    /* Positive response suppressed */
+  }
+}
+
+void ApplLinDiagReadDtcInformation(void) {
+  const uint8_t l_subFunction_cu8 = pbLinDiagBuffer[1];
+  const uint8_t l_mask_cu8 = (uint8_t)(pbLinDiagBuffer[2] & DIAG_CFG_DTC_STATUS_AVAILABILITY_MASK);
+  const uint16_t l_dtcCount_cu16 = getDtcCount();
+  uint16_t l_matches_u16 = 0u;
+  uint16_t l_pos_u16 = 3u;
+  uint16_t l_idx_u16;
+  uint32 l_dtc_u32;
+  uint8 l_status_u8;
+  uint8_t *l_resp_pu8;
+
+  if((DIAG_RDTCI_NUMBER_BY_STATUS_MASK != l_subFunction_cu8) && (DIAG_RDTCI_DTC_BY_STATUS_MASK != l_subFunction_cu8)) {
+    LinDiagSendNegResponse(kLinDiagNrcSubFunctionNotSupported);
+  } else if(3u != g_linDiagDataLength_u16) {
+    LinDiagSendNegResponse(kLinDiagNrcIncorrectMessageLength);
+  } else {
+    for(l_idx_u16 = 0u; l_idx_u16 < l_dtcCount_cu16; l_idx_u16++) {
+      if((E_OK == getDtcByIndex(l_idx_u16, &l_dtc_u32, &l_status_u8)) && (0u != (l_status_u8 & l_mask_cu8))) { l_matches_u16++; }
+    }
+    if(DIAG_RDTCI_NUMBER_BY_STATUS_MASK == l_subFunction_cu8) {
+      /* Response: 0x59, 0x01, availability mask, format, count (2 bytes) */
+      l_resp_pu8 = linDiagPosResponse(6u);
+      if(NULL != l_resp_pu8) {
+        l_resp_pu8[1] = l_subFunction_cu8;
+        l_resp_pu8[2] = DIAG_CFG_DTC_STATUS_AVAILABILITY_MASK;
+        l_resp_pu8[3] = DIAG_RDTCI_FORMAT_ISO14229_1;
+        l_resp_pu8[4] = (uint8_t)(l_matches_u16 >> 8);
+        l_resp_pu8[5] = (uint8_t)(l_matches_u16 & 0xFFu);
+        LinDiagSendPosResponse();
+      }
+    } else if(((uint32)l_matches_u16 * 4u) > (uint32)(LINTP_TX_MAX_MSG_LEN - 3u)) {
+      LinDiagSendNegResponse(kLinDiagNrcResponseTooLong);
+    } else {
+      /* Response: 0x59, 0x02, availability mask, then DTC (3 bytes) + status per matching DTC */
+      l_resp_pu8 = linDiagPosResponse((uint16_t)(3u + (4u * l_matches_u16)));
+      if(NULL != l_resp_pu8) {
+        l_resp_pu8[1] = l_subFunction_cu8;
+        l_resp_pu8[2] = DIAG_CFG_DTC_STATUS_AVAILABILITY_MASK;
+        for(l_idx_u16 = 0u; l_idx_u16 < l_dtcCount_cu16; l_idx_u16++) {
+          if((E_OK == getDtcByIndex(l_idx_u16, &l_dtc_u32, &l_status_u8)) && (0u != (l_status_u8 & l_mask_cu8))) {
+            l_resp_pu8[l_pos_u16] = (uint8_t)(l_dtc_u32 >> 16);
+            l_resp_pu8[l_pos_u16 + 1u] = (uint8_t)(l_dtc_u32 >> 8);
+            l_resp_pu8[l_pos_u16 + 2u] = (uint8_t)(l_dtc_u32 & 0xFFu);
+            l_resp_pu8[l_pos_u16 + 3u] = (uint8_t)(l_status_u8 & DIAG_CFG_DTC_STATUS_AVAILABILITY_MASK);
+            l_pos_u16 += 4u;
+          }
+        }
+        LinDiagSendPosResponse();
+      }
+    }
+  }
+}
+
+void ApplLinDiagClearDiagnosticInformation(void) {
+  const uint32 l_group_cu32 = ((uint32)pbLinDiagBuffer[1] << 16) | ((uint32)pbLinDiagBuffer[2] << 8) | (uint32)pbLinDiagBuffer[3];
+  uint8_t l_errCode_u8 = 0u;
+
+  /* Request: SID, groupOfDTC (3 bytes); response: 0x54 */
+  if(4u != g_linDiagDataLength_u16) {
+    LinDiagSendNegResponse(kLinDiagNrcIncorrectMessageLength);
+  } else if(E_OK != clearDtc(l_group_cu32, &l_errCode_u8)) {
+    LinDiagSendNegResponse(l_errCode_u8);
+  } else if(NULL != linDiagPosResponse(1u)) {
+    LinDiagSendPosResponse();
+  } else {
+    /* Ring full: busyRepeatRequest already sent */
+  }
+}
+
+void LinDiagMainFunction(void) {
+  Std_ReturnType l_result_;
+  uint8_t l_errCode_u8 = 0u;
+
+  ageDidCache();
+
+  if(linDiagPending_b) {
+    l_result_ = linDiagRdbiRead(DIAG_OPSTATUS_PENDING, &l_errCode_u8);
+    if(E_PENDING != l_result_) {
+      linDiagRdbiConclude(l_result_, l_errCode_u8);
+    } else {
+      if(0u != linDiagP2Timer_u16) { linDiagP2Timer_u16--; }
+      if(0u != linDiagP2Timer_u16) {
+        /* Still within the P2 (then P2*) budget */
+      } else if(linDiagRespPendCnt_u8 < DIAG_CFG_RESP_PEND_MAX) {
+        /* Budget used up: ask the tester to wait another P2* */
+        LinTp_TxResponsePending(DIAG_SID_READ_DATA_BY_ID);
+        linDiagRespPendCnt_u8++;
+        linDiagP2Timer_u16 = DIAG_P2STAR_TICKS;
+      } else {
+        linDiagRdbiCancel();
+        LinDiagSendNegResponseSid(DIAG_SID_READ_DATA_BY_ID, kLinDiagNrcGeneralReject);
+      }
+    }
+  }
+
+  linDiagPdidSchedule();
+}
+
 /** @copydoc genericGet_b */
 bool genericGet_b(uint8_t intput) { return checkCorrectResultll_b(intput); }
 
@@ -1,6 +1,7 @@
 #ifndef DIAGNOSTIC_H
 #define DIAGNOSTIC_H
 
+#include "diagnostic_cfg.h"
 #include <stdbool.h>
 #include <stdint.h>
 
@@ -14,8 +15,12 @@
  * - **diagnostic.c**: implementation of the diagnostic services
  *
  * The main data items exchanged with the LIN stack are:
- * - @ref pbLinDiagBuffer: global diagnostic buffer (request/response)
+ * - @ref pbLinDiagBuffer: global diagnostic buffer (reassembled request)
  * - @ref g_linDiagDataLength_u16: length of the valid data inside the buffer
+ * - LinDiagRxIndication(): entry point called by the LIN transport layer
+ *
+ * Responses are written straight into the response ring of the LIN transport
+ * layer (see @ref LinTpModule).
  *
  * @note
  * Some helpers and state are intentionally kept **internal** to the implementation
@@ -64,11 +69,13 @@
  * service handler(s).
  *
  * **Data flow overview**
- * - Incoming diagnostic requests are stored in `pbLinDiagBuffer`.
+ * - Incoming diagnostic requests are reassembled by the LIN transport layer into
+ *   `pbLinDiagBuffer`, which then calls LinDiagRxIndication().
  * - `g_linDiagDataLength_u16` represents the current request/response length (in bytes),
  *   interpreted by the diagnostic services.
  * - Service handlers (e.g. ReadDataByIdentifier 0x22) parse the request fields from
- *   `pbLinDiagBuffer` and build the response payload in-place.
+ *   `pbLinDiagBuffer` and build the response payload in an area reserved with
+ *   LinTp_TxReserve(), from which the response frames are sent.
  *
  * @note
  * The diagnostic buffer is shared across multiple services. Callers must ensure
@@ -79,22 +86,26 @@
  * @brief Shared LIN diagnostic buffer.
  *
  * @details
- * Fixed-size buffer used by the LIN diagnostic layer for both requests and responses.
- * The layout is service-dependent; for service 0x22 the DID is expected at:
- * - `pbLinDiagBuffer[1]` = DID MSB
- * - `pbLinDiagBuffer[2]` = DID LSB
- * - `pbLinDiagBuffer[3..]` = response payload area
+ * Fixed-size buffer into which the LIN transport layer reassembles requests; its
+ * size (`DIAG_CFG_RX_BUFFER_SIZE`) bounds the longest accepted request, a
+ * longer one is answered with NRC 0x13 (LinDiagRxOverflow()). The layout is service-dependent; for
+ * service 0x22 the request carries one or more DIDs:
+ * - `pbLinDiagBuffer[1 + 2i]` = DID#i MSB
+ * - `pbLinDiagBuffer[2 + 2i]` = DID#i LSB
+ *
+ * Responses are not built here but in the LIN transport response ring, so
+ * they may be longer than the buffer.
  *
  * @par Interface summary
  *
  * | Interface             | In | Out | Data type | Param | Data factor | Data offset | Data size | Data range | Data unit |
  * |-----------------------|:--:|:---:|-----------|:-----:|------------:|------------:|----------:|------------|----------|
- * | pbLinDiagBuffer[32]   | X  |  X  | uint8[]   |   -   |      1      |      0      |     32    | [0,255]    | [-]      |
+ * | pbLinDiagBuffer[]     | X  |     | uint8[]   |   -   |      1      |      0      | DIAG_CFG_RX_BUFFER_SIZE | [0,255] | [-] |
  *
  * @warning
- * Buffer overrun must be prevented by all services writing into this array.
+ * Buffer overrun must be prevented by all code writing into this array.
  */
-extern uint8_t pbLinDiagBuffer[32];
+extern uint8_t pbLinDiagBuffer[DIAG_CFG_RX_BUFFER_SIZE];
 
 /**
  * @brief Current LIN diagnostic message length.
@@ -113,6 +124,95 @@ extern uint8_t pbLinDiagBuffer[32];
  */
 extern uint16_t g_linDiagDataLength_u16;
 
+/**
+ * @brief Process a complete diagnostic request.
+ *
+ * @details
+ * **Goal of the function**
+ *
+ * The purpose of this function is to hand a request reassembled by the LIN
+ * transport layer into `pbLinDiagBuffer` to the service selected by its SID
+ * (`pbLinDiagBuffer[0]`). The service is looked up in the SID table
+ * `DiagCfg_SidCfg_cst` (one ROM entry per SID, indexed directly) and the
+ * checks common to all services run here once, so the services only check
+ * their own request layout.
+ *
+ * The processing logic:
+ * - Cancels a ReadDataByIdentifier request still waiting for a pending DID
+ *   handler (the handler is called with `DIAG_OPSTATUS_CANCEL`).
+ * - Stores @p length in `g_linDiagDataLength_u16`.
+ * - Request not addressed to this node (`checkCurrentNad()`): no response.
+ * - SID without table entry (`getSidCfg()` returns NULL): NRC `kLinDiagNrcServiceNotSupported`.
+ * - Service not allowed in the active session: NRC `kLinDiagNrcServiceNotSupportedInActiveSession`.
+ * - Entry requires a higher security level than the unlocked one: NRC
+ *   `kLinDiagNrcSecurityAccessDenied`.
+ * - `checkMsgDataLength()` fails or @p length is below the entry's minimum:
+ *   NRC `kLinDiagNrcIncorrectMessageLength`.
+ * - Otherwise calls the entry's service function.
+ *
+ * @note No service changes the session or the security level yet: the node
+ * stays in the default session with security locked.
+ *
+ * @par Interface summary
+ *
+ * | Interface                    | In | Out | Data type / Signature | Param | Data factor | Data offset | Data size | Data range | Data unit |
+ * |------------------------------|:--:|:---:|-----------------------|:-----:|------------:|------------:|----------:|------------|----------|
+ * | length                       | X  |     | uint16_t              |   -   |      1      |      0      |     1     | [1,DIAG_CFG_RX_BUFFER_SIZE] | [byte] |
+ * | pbLinDiagBuffer[0]           | X  |     | uint8                 |   -   |      1      |      0      |     1     | [0,255]    | [-]      |
+ * | g_linDiagDataLength_u16      |    |  X  | uint16                |   -   |      1      |      0      |     1     | [1,DIAG_CFG_RX_BUFFER_SIZE] | [byte] |
+ * | checkCurrentNad()            | X  |  X  | void(uint8 nad, Std_ReturnType *result) | - |   -   |      -      |     -     | E_OK/E_NOT_OK | [-] |
+ * | checkMsgDataLength()         | X  |  X  | void(uint16 len, Std_ReturnType *result) | - |  -   |      -      |     -     | E_OK/E_NOT_OK | [-] |
+ * | getSidCfg()                  | X  |  X  | const DiagCfg_SidCfg_t*(uint8 sid) | - |   -   |      -      |     -     | entry or NULL | [-] |
+ * | LinDiagSendNegResponse()     | X  |  X  | void(uint8 errorCode) |   -   |      -      |      -      |     -     | -          | [-]      |
+ *
+ * @par Activity diagram (PlantUML)
+ *
+ * @startuml
+ * start
+ * if (RDBI pending?) then (YES)
+ *   :cancel pending handler;
+ * endif
+ * :g_linDiagDataLength_u16 = length;
+ * :checkCurrentNad(0, &l_result);
+ * if (l_result == E_OK) then (OK)
+ *   :checkMsgDataLength(length, &l_result);
+ *   :cfg = getSidCfg(pbLinDiagBuffer[0]);
+ *   if (cfg == NULL) then (YES)
+ *     :NRC ServiceNotSupported;
+ *   elseif (session not in cfg->session) then (YES)
+ *     :NRC ServiceNotSupportedInActiveSession;
+ *   elseif (cfg->security > unlocked level) then (YES)
+ *     :NRC SecurityAccessDenied;
+ *   elseif (l_result != E_OK OR length < cfg->minLen) then (YES)
+ *     :NRC IncorrectMessageLength;
+ *   else (NO)
+ *     :cfg->service();
+ *   endif
+ * endif
+ * stop
+ * @enduml
+ *
+ * @param length Length of the request in `pbLinDiagBuffer` [byte].
+ * @return None.
+ */
+void LinDiagRxIndication(uint16_t length);
+
+/**
+ * @brief Answer a request too long for `pbLinDiagBuffer`.
+ *
+ * @details
+ * Called by the LIN transport layer instead of LinDiagRxIndication() when a
+ * first frame announces more than `DIAG_CFG_RX_BUFFER_SIZE` bytes; the rest of
+ * the request is not received. Like a new request, it cancels a
+ * ReadDataByIdentifier request still waiting for a pending DID handler, then
+ * sends NRC `kLinDiagNrcIncorrectMessageLength` for @p sid_u8, so the tester
+ * gets an answer instead of a timeout.
+ *
+ * @param sid_u8 SID of the request, first data byte of the first frame.
+ * @return None.
+ */
+void LinDiagRxOverflow(uint8_t sid_u8);
+
 /**
  * @internal
  * Internal helper functions (documented in diagnostic.c):
@@ -126,78 +226,372 @@ extern uint16_t g_linDiagDataLength_u16;
  * @details
  * **Goal of the function**
  *
- * The purpose of this function is to decode the requested DID (Data Identifier)
- * from the LIN diagnostic request buffer, validate the request (target NAD and
- * expected message length), retrieve the DID payload through the configured
- * handler, and finally send either a positive response (with DID + data) or a
- * negative response (with the detected error code).
+ * The purpose of this function is to decode the list of requested DIDs (Data
+ * Identifiers, ISO 14229 allows several in one request) from the LIN diagnostic
+ * request buffer, check up front that the complete response fits the transport, retrieve the DID
+ * payloads through the configured handlers back to back, and finally send either
+ * a positive response (DID + data for every supported DID) or a negative
+ * response (with the detected error code).
  *
  * The processing logic:
- * - Extracts the DID from `pbLinDiagBuffer[1]` (MSB) and `pbLinDiagBuffer[2]` (LSB).
- * - Validates that the current request is addressed to the correct NAD.
- * - Validates the received request length (`g_linDiagDataLength_u16`).
- * - Calls the DID handler dispatcher to:
- *   - determine whether the DID is supported,
- *   - fill the response data into the diagnostic buffer starting at `pbLinDiagBuffer[3]`,
- *   - return the number of payload bytes written.
- * - If processing is successful, updates `g_linDiagDataLength_u16` to `payloadLen + 2`
- *   (DID bytes) and sends a positive response.
+ * - The target NAD and the received length are checked by LinDiagRxIndication().
+ * - Checks that the request is the SID followed by whole DIDs (odd length, at
+ *   least 3 bytes); otherwise NRC `kLinDiagNrcIncorrectMessageLength`.
+ * - For each DID at `pbLinDiagBuffer[1 + 2i]` (MSB) / `pbLinDiagBuffer[2 + 2i]` (LSB):
+ *   - asks `getDidReadSize()` for the configured payload size,
+ *   - skips unsupported DIDs, keeps the supported ones in a local list,
+ *   - adds DID (2 bytes) + payload size to the response length.
+ * - No supported DID: NRC `kLinDiagNrcRequestOutOfRange`.
+ * - Response longer than `DIAG_RDBI_RESPONSE_CAPACITY`: NRC `kLinDiagNrcResponseTooLong`.
+ * - Reserves RSID + response in the LIN transport ring (`LinTp_TxReserve()`);
+ *   no room: NRC `kLinDiagNrcBusyRepeatRequest`.
+ * - Otherwise, for each supported DID, writes the DID and calls the DID handler
+ *   dispatcher, which fills the payload right after it in the reserved area.
+ *   The first failing handler stops the loop with its error code.
+ * - A handler returning `E_PENDING` suspends the loop: the DID list, the
+ *   position and the reserved area are kept, and LinDiagMainFunction() calls
+ *   the handler again and sends the response when all DIDs are read.
+ * - If processing is successful, updates `g_linDiagDataLength_u16` to the sum of
+ *   `payloadLen + 2` over all DIDs and sends a positive response.
  * - Otherwise, sends a negative response using the error code.
  *
  * @par Interface summary
  *
- * | Interface                               | In | Out | Data type / Signature                                                | Param | Data factor | Data offset | Data size | Data range      | Data
- * unit |
- * |-----------------------------------------|:--:|:---:|----------------------------------------------------------------------|:-----:|------------:|------------:|----------:|-----------------|----------|
- * | pbLinDiagBuffer[1]                      | X  |     | uint8                                                                |   -   |      1      |      0      |     1     | [0,255]         | [-] |
- * | pbLinDiagBuffer[2]                      | X  |     | uint8                                                                |   -   |      1      |      0      |     1     | [0,255]         | [-] |
- * | pbLinDiagBuffer[3..]                    | X  |  X  | uint8[]                                                              |   -   |      1      |      0      |     N     | project-defined | [-] |
- * | g_linDiagDataLength_u16                     | X  |  X  | uint16                                                              |   -   |      1      |      0      |     1     | [0,65535]       |
- * [byte]   | | checkCurrentNad()                       | X  |  X  | void(uint8 nad, Std_ReturnType *result)                               |   -   |      -      |      -      |     -     | | [-] | |
- * checkMsgDataLength()                    | X  |  X  | void(uint16 len, Std_ReturnType *result)                              |   -   |      -      |      -      |     -     |               | [-] | |
- * getHandlersForReadDataById()             | X  |  X  | Std_ReturnType(uint8*, uint16, uint8*, Std_ReturnType*, uint8*)        |   -   |      -      |      -      |     -     | E_OK/E_NOT_OK   | [-]
- * | | LinDiagSendPosResponse()                |    |  X  | void(void)                                                          |   -   |      -      |      -      |     -     | -               | [-]
- * | | LinDiagSendNegResponse()                | X  |  X  | void(uint8 errorCode)                                                |   -   |      -      |      -      |     -     | -               | [-]
- * |
+ * | Interface                    | In | Out | Data type / Signature                                            | Param | Data factor | Data offset | Data size | Data range      | Data unit |
+ * |------------------------------|:--:|:---:|------------------------------------------------------------------|:-----:|------------:|------------:|----------:|-----------------|----------|
+ * | pbLinDiagBuffer[1..]         | X  |     | uint8[]                                                          |   -   |      1      |      0      |     N     | project-defined | [-]      |
+ * | g_linDiagDataLength_u16      | X  |  X  | uint16                                                           |   -   |      1      |      0      |     1     | [0,65535]       | [byte]   |
+ * | getDidReadSize()             | X  |  X  | Std_ReturnType(uint16, uint8*)                                   |   -   |      -      |      -      |     -     | E_OK/E_NOT_OK   | [-]      |
+ * | LinTp_TxReserve()            | X  |  X  | uint8*(uint16 len)                                               |   -   |      -      |      -      |     -     | area or NULL    | [-]      |
+ * | getHandlersForReadDataById() | X  |  X  | Std_ReturnType(uint8*, uint16, uint8*, Std_ReturnType*, uint8*, uint8) | - | - | - | - | E_OK/E_PENDING/E_NOT_OK | [-]      |
+ * | LinDiagSendPosResponse()     |    |  X  | void(void)                                                       |   -   |      -      |      -      |     -     | -               | [-]      |
+ * | LinDiagSendNegResponse()     | X  |  X  | void(uint8 errorCode)                                            |   -   |      -      |      -      |     -     | -               | [-]      |
  *
  * @par Activity diagram (PlantUML)
  *
  * @startuml
  * start
- * :Read DID from pbLinDiagBuffer[1..2];
  * :l_result = E_OK;
- * :l_errCode = 0;
- * :l_diagBuf = &pbLinDiagBuffer[3];
- * :l_diagBufSize = 0;
- *
- * :checkCurrentNad(0, &l_result);
- * if (l_result == E_OK) then (OK)
- *   :checkMsgDataLength(g_linDiagDataLength_u16, &l_result);
+ * if (len < 3 OR len even) then (YES)
+ *   :l_errCode = IncorrectMessageLength;
+ *   :l_result = E_NOT_OK;
  * endif
- *
  * if (l_result == E_OK) then (OK)
- *   :getHandlersForReadDataById(&l_errCode, l_did,
- *                               &l_diagBufSize,
- *                               &l_didSupported,
- *                               l_diagBuf);
+ *   while (more requested DIDs?) is (yes)
+ *     if (getDidReadSize(did, &size) == E_OK) then (supported)
+ *       :l_dids[n++] = did;
+ *       :respLen += size + 2;
+ *     endif
+ *   endwhile (no)
+ *   if (n == 0) then (YES)
+ *     :l_errCode = RequestOutOfRange;
+ *     :l_result = E_NOT_OK;
+ *   elseif (respLen > DIAG_RDBI_RESPONSE_CAPACITY) then (YES)
+ *     :l_errCode = ResponseTooLong;
+ *     :l_result = E_NOT_OK;
+ *   elseif ((buf = LinTp_TxReserve(respLen + 1)) == NULL) then (YES)
+ *     :l_errCode = BusyRepeatRequest;
+ *     :l_result = E_NOT_OK;
+ *   else (NO)
+ *     :buf[0] = 0x62;
+ *   endif
  * endif
- *
- * if (l_result == E_OK) then (POS)
- *   :g_linDiagDataLength_u16 = l_diagBufSize + 2;
+ * while (l_result == E_OK AND more supported DIDs?) is (yes)
+ *   :write DID at pos;
+ *   :l_result = getHandlersForReadDataById(&l_errCode, did, &size,
+ *                                         &l_didSupported, &buf[pos + 2], INITIAL);
+ *   if (l_result == E_OK) then (YES)
+ *     :pos += size + 2;
+ *   endif
+ * endwhile (no)
+ * switch (l_result)
+ * case (E_OK)
+ *   :g_linDiagDataLength_u16 = pos - 1;
  *   :LinDiagSendPosResponse();
- * else (NEG)
+ * case (E_PENDING)
+ *   :keep job; start P2 budget;
+ * case (E_NOT_OK)
  *   :LinDiagSendNegResponse(l_errCode);
- * endif
+ * endswitch
  * stop
  * @enduml
  *
  * @return None.
  * The function sends a LIN diagnostic response and may update
- * `g_linDiagDataLength_u16` and the payload area `pbLinDiagBuffer[3..]`
- * depending on the outcome.
+ * `g_linDiagDataLength_u16` and the reserved response area depending on
+ * the outcome.
  */
 void ApplLinDiagReadDataById(void);
 
+/**
+ * @brief Handle LIN diagnostic service "WriteDataByIdentifier" (0x2E).
+ *
+ * @details
+ * **Goal of the function**
+ *
+ * The purpose of this function is to pass the data record of a write request
+ * to the write handler of its DID and acknowledge it.
+ *
+ * The processing logic:
+ * - Request: SID, DID (MSB, LSB), data record; at least 4 bytes (checked by
+ *   LinDiagRxIndication()).
+ * - Calls `getHandlersForWriteDataById()` with the `g_linDiagDataLength_u16 - 3`
+ *   bytes at `pbLinDiagBuffer[3]`; on failure sends its NRC.
+ * - Otherwise sends 0x6E, DID MSB, DID LSB.
+ *
+ * @par Interface summary
+ *
+ * | Interface                     | In | Out | Data type / Signature                           | Param | Data factor | Data offset | Data size | Data range    | Data unit |
+ * |-------------------------------|:--:|:---:|-------------------------------------------------|:-----:|------------:|------------:|----------:|---------------|----------|
+ * | pbLinDiagBuffer[1..]          | X  |     | uint8[]                                         |   -   |      1      |      0      |     N     | [0,255]       | [-]      |
+ * | g_linDiagDataLength_u16       | X  |  X  | uint16                                          |   -   |      1      |      0      |     1     | [4,DIAG_CFG_RX_BUFFER_SIZE] | [byte] |
+ * | getHandlersForWriteDataById() | X  |  X  | Std_ReturnType(uint8*, uint16, uint8, uint8*)   |   -   |      -      |      -      |     -     | E_OK/E_NOT_OK | [-]      |
+ *
+ * @return None.
+ */
+void ApplLinDiagWriteDataById(void);
+
+/**
+ * @brief Handle LIN diagnostic service "ReadDataByPeriodicIdentifier" (0x2A).
+ *
+ * @details
+ * **Goal of the function**
+ *
+ * The purpose of this function is to let the tester subscribe to DIDs instead
+ * of polling them: the scheduled DIDs are sent by LinDiagMainFunction()
+ * without further requests, which halves the bus load of a polling loop.
+ *
+ * The processing logic:
+ * - Request: SID, transmission mode, periodic identifier#1 .. #n. Periodic
+ *   identifier N is DID `DIAG_CFG_PDID_DID_BASE + N`.
+ * - Mode 0x01/0x02/0x03 (slow/medium/fast, `DIAG_CFG_PDID_*_MS`):
+ *   - no periodic identifier: NRC `kLinDiagNrcIncorrectMessageLength`,
+ *   - a DID not readable (`getDidReadSize()`) or longer than
+ *     `DIAG_CFG_PDID_DATA_MAX`, or more scheduled identifiers than
+ *     `DIAG_CFG_PDID_MAX`: NRC `kLinDiagNrcRequestOutOfRange`, the schedule
+ *     is left unchanged,
+ *   - otherwise schedules each identifier (an identifier already scheduled
+ *     takes the new mode); the first sample is taken on the next
+ *     LinDiagMainFunction() call.
+ * - Mode 0x04 (stopSending): stops the listed identifiers, or all of them
+ *   if none is listed; identifiers not scheduled are ignored.
+ * - Any other mode: NRC `kLinDiagNrcRequestOutOfRange`.
+ * - Positive response: 0x6A. Periodic responses: 0x6A, periodic identifier, data.
+ *
+ * @par Interface summary
+ *
+ * | Interface               | In | Out | Data type / Signature          | Param | Data factor | Data offset | Data size | Data range    | Data unit |
+ * |-------------------------|:--:|:---:|--------------------------------|:-----:|------------:|------------:|----------:|---------------|----------|
+ * | pbLinDiagBuffer[1..]    | X  |     | uint8[]                        |   -   |      1      |      0      |     N     | [0,255]       | [-]      |
+ * | g_linDiagDataLength_u16 | X  |  X  | uint16                         |   -   |      1      |      0      |     1     | [2,DIAG_CFG_RX_BUFFER_SIZE] | [byte] |
+ * | getDidReadSize()        | X  |  X  | Std_ReturnType(uint16, uint8*) |   -   |      -      |      -      |     -     | E_OK/E_NOT_OK | [-]      |
+ *
+ * @return None.
+ */
+void ApplLinDiagReadDataByPeriodicId(void);
+
+/**
+ * @brief Handle LIN diagnostic service "RoutineControl" (0x31).
+ *
+ * @details
+ * **Goal of the function**
+ *
+ * The purpose of this function is to start or stop a routine, or read its
+ * results, through `getHandlersForRoutineControl()`.
+ *
+ * The processing logic:
+ * - Request: SID, sub-function (bit 7 suppresses the positive response), RID
+ *   (MSB, LSB), option record; at least 4 bytes.
+ * - Sub-function other than start (1), stop (2) or request results (3): NRC
+ *   `kLinDiagNrcSubFunctionNotSupported`.
+ * - Reserves 0x71, sub-function, RID and `DIAG_RC_STATUS_CAPACITY` status
+ *   bytes in the LIN transport ring; the routine writes its status record in
+ *   place. No room: NRC `kLinDiagNrcBusyRepeatRequest`.
+ * - Routine failure: its NRC. Otherwise the positive response is sent unless
+ *   suppressed.
+ *
+ * @par Interface summary
+ *
+ * | Interface                      | In | Out | Data type / Signature                                                  | Param | Data factor | Data offset | Data size | Data range    | Data unit |
+ * |--------------------------------|:--:|:---:|------------------------------------------------------------------------|:-----:|------------:|------------:|----------:|---------------|----------|
+ * | pbLinDiagBuffer[1..]           | X  |     | uint8[]                                                                |   -   |      1      |      0      |     N     | [0,255]       | [-]      |
+ * | g_linDiagDataLength_u16        | X  |  X  | uint16                                                                 |   -   |      1      |      0      |     1     | [4,DIAG_CFG_RX_BUFFER_SIZE] | [byte] |
+ * | getHandlersForRoutineControl() | X  |  X  | Std_ReturnType(uint8*, uint8, uint16, const uint8*, uint8, uint8*, uint8*) | - |    -     |      -      |     -     | E_OK/E_NOT_OK | [-]      |
+ *
+ * @return None.
+ */
+void ApplLinDiagRoutineControl(void);
+
+/**
+ * @brief Handle LIN diagnostic service "TesterPresent" (0x3E).
+ *
+ * @details
+ * Request: SID, sub-function 0x00 (0x80 suppresses the positive response).
+ * Another sub-function: NRC `kLinDiagNrcSubFunctionNotSupported`; a length
+ * other than 2: NRC `kLinDiagNrcIncorrectMessageLength`. Positive response:
+ * 0x7E, 0x00.
+ *
+ * @return None.
+ */
+void ApplLinDiagTesterPresent(void);
+
+/**
+ * @brief Handle LIN diagnostic service "ReadDTCInformation" (0x19).
+ *
+ * @details
+ * **Goal of the function**
+ *
+ * The purpose of this function is to report the DTCs of the fault memory
+ * (`getDtcCount()`, `getDtcByIndex()`) matching a status mask.
+ *
+ * The processing logic:
+ * - Request: SID, sub-function, DTC status mask (exactly 3 bytes, else NRC
+ *   `kLinDiagNrcIncorrectMessageLength`). The mask is reduced to
+ *   `DIAG_CFG_DTC_STATUS_AVAILABILITY_MASK`.
+ * - Sub-function 0x01 (reportNumberOfDTCByStatusMask): 0x59, 0x01,
+ *   availability mask, format 0x01 (ISO 14229-1), count MSB, count LSB.
+ * - Sub-function 0x02 (reportDTCByStatusMask): 0x59, 0x02, availability mask,
+ *   then DTC (3 bytes) and status for every matching DTC. Counted first; a
+ *   response above `LINTP_TX_MAX_MSG_LEN` gets NRC `kLinDiagNrcResponseTooLong`.
+ * - Any other sub-function: NRC `kLinDiagNrcSubFunctionNotSupported`.
+ *
+ * @par Interface summary
+ *
+ * | Interface               | In | Out | Data type / Signature                  | Param | Data factor | Data offset | Data size | Data range    | Data unit |
+ * |-------------------------|:--:|:---:|----------------------------------------|:-----:|------------:|------------:|----------:|---------------|----------|
+ * | pbLinDiagBuffer[1..2]   | X  |     | uint8[]                                |   -   |      1      |      0      |     2     | [0,255]       | [-]      |
+ * | g_linDiagDataLength_u16 | X  |  X  | uint16                                 |   -   |      1      |      0      |     1     | 3             | [byte]   |
+ * | getDtcCount()           |    |  X  | uint16(void)                           |   -   |      -      |      -      |     -     | [0,65535]     | [-]      |
+ * | getDtcByIndex()         | X  |  X  | Std_ReturnType(uint16, uint32*, uint8*) |  -   |      -      |      -      |     -     | E_OK/E_NOT_OK | [-]      |
+ *
+ * @return None.
+ */
+void ApplLinDiagReadDtcInformation(void);
+
+/**
+ * @brief Handle LIN diagnostic service "ClearDiagnosticInformation" (0x14).
+ *
+ * @details
+ * Request: SID, group of DTC (3 bytes, MSB first); a length other than 4 gets
+ * NRC `kLinDiagNrcIncorrectMessageLength`. The group is passed to `clearDtc()`,
+ * whose NRC is sent on failure; positive response: 0x54.
+ *
+ * @return None.
+ */
+void ApplLinDiagClearDiagnosticInformation(void);
+
+/**
+ * @brief Active diagnostic session.
+ *
+ * @details
+ * Used by the DID lookup (`checkDidAccess()`) to apply the per-DID session
+ * mask of the DID descriptor table.
+ *
+ * @return `DIAG_CFG_SESSION_*` bit of the active session.
+ */
+uint8_t LinDiagGetSession(void);
+
+/**
+ * @brief Unlocked security level.
+ *
+ * @details
+ * Used by the DID lookup (`checkDidAccess()`) to apply the per-DID security
+ * level of the DID descriptor table.
+ *
+ * @return Unlocked security level, 0 = locked.
+ */
+uint8_t LinDiagGetSecurityLevel(void);
+
+/**
+ * @brief Cyclic part of the diagnostic services: DID cache aging, pending DID handlers, P2/P2* timing and periodic DIDs.
+ *
+ * @details
+ * **Goal of the function**
+ *
+ * The purpose of this function is to complete ReadDataByIdentifier requests
+ * whose DID handler returned `E_PENDING`, without blocking the task that
+ * received the request, and to keep the tester waiting within the P2/P2*
+ * budget while doing so, and to send the periodic DIDs scheduled with
+ * ApplLinDiagReadDataByPeriodicId(). It must be called every
+ * `DIAG_CFG_MAIN_PERIOD_MS`.
+ *
+ * The processing logic:
+ * - Ages the DID response cache (`ageDidCache()`).
+ * - If a request is pending:
+ *   - calls the pending handler again with `DIAG_OPSTATUS_PENDING`, then the
+ *     remaining DIDs with `DIAG_OPSTATUS_INITIAL`,
+ *   - all DIDs read: positive response. Handler failure: negative response,
+ *   - still pending: counts down the budget, `DIAG_CFG_P2_MS` after the
+ *     request, then `DIAG_CFG_P2STAR_MS` after each NRC 0x78; budget used up:
+ *     queues NRC 0x78 (`LinTp_TxResponsePending()`) and restarts the budget
+ *     with P2*, at most `DIAG_CFG_RESP_PEND_MAX` times; after that cancels the
+ *     handler and sends NRC 0x10 (generalReject).
+ * - For each scheduled periodic identifier (O(scheduled), no other work):
+ *   - counts down its period,
+ *   - unless a request is still pending (its response is reserved in the
+ *     ring), samples a due DID once into the entry's serialized response
+ *     (0x6A, periodic identifier, data) through `getHandlersForReadDataById()`
+ *     and restarts the period. A handler returning `E_PENDING` is cancelled
+ *     and the period has no sample; a failing handler has none either,
+ *   - unless a request is still pending, copies the sample into the LIN
+ *     transport ring. Without room it is retried on the next call, until
+ *     the next sample replaces it.
+ *
+ * @par Interface summary
+ *
+ * | Interface                    | In | Out | Data type / Signature                                                  | Param | Data factor | Data offset | Data size | Data range     | Data unit |
+ * |------------------------------|:--:|:---:|------------------------------------------------------------------------|:-----:|------------:|------------:|----------:|----------------|----------|
+ * | ageDidCache()                |    |  X  | void(void)                                                             |   -   |      -      |      -      |     -     | -              | [-]      |
+ * | getHandlersForReadDataById() | X  |  X  | Std_ReturnType(uint8*, uint16, uint8*, Std_ReturnType*, uint8*, uint8) |   -   |      -      |      -      |     -     | E_OK/E_PENDING/E_NOT_OK | [-] |
+ * | LinTp_TxResponsePending()    |    |  X  | void(uint8 sid)                                                        |   -   |      -      |      -      |     -     | -              | [-]      |
+ * | LinTp_TxReserve()            | X  |  X  | uint8*(uint16 len)                                                     |   -   |      -      |      -      |     -     | area or NULL   | [-]      |
+ * | LinTp_TxCommit()             |    |  X  | void(uint16 len)                                                       |   -   |      -      |      -      |     -     | -              | [-]      |
+ * | LinDiagSendPosResponse()     |    |  X  | void(void)                                                             |   -   |      -      |      -      |     -     | -              | [-]      |
+ * | LinDiagSendNegResponse()     |    |  X  | void(uint8 errorCode)                                                  |   -   |      -      |      -      |     -     | -              | [-]      |
+ *
+ * @par Activity diagram (PlantUML)
+ *
+ * @startuml
+ * start
+ * :ageDidCache();
+ * if (request pending?) then (YES)
+ *   :l_result = read DIDs from the pending one (PENDING);
+ *   if (l_result != E_PENDING) then (done)
+ *     :send positive or negative response;
+ *   else (pending)
+ *     :timer--;
+ *     if (timer == 0) then (YES)
+ *       if (NRC 0x78 sent < DIAG_CFG_RESP_PEND_MAX) then (YES)
+ *         :LinTp_TxResponsePending(0x22);
+ *         :timer = P2*;
+ *       else (NO)
+ *         :cancel handler;
+ *         :LinDiagSendNegResponse(generalReject);
+ *       endif
+ *     endif
+ *   endif
+ * endif
+ * while (more scheduled periodic identifiers?) is (yes)
+ *   if (timer > 0) then (YES)
+ *     :timer--;
+ *   endif
+ *   if (request pending?) then (NO)
+ *     if (timer == 0) then (due)
+ *       :timer = period of the mode;
+ *       :sample DID 0xF2xx into the entry (INITIAL);
+ *     endif
+ *     if (sample waiting AND LinTp_TxReserve(len) != NULL) then (YES)
+ *       :copy sample; LinTp_TxCommit(len);
+ *     endif
+ *   endif
+ * endwhile (no)
+ * stop
+ * @enduml
+ *
+ * @return None.
+ */
+void LinDiagMainFunction(void);
+
 /**
  * @brief Generic getter service for diagnostic data.
  *
@@ -0,0 +1,299 @@
+#include "linTp_priv.h"
+
+/* Reassembly of the request in progress */
+static bool linTpRxActive_b = false;
+static uint16_t linTpRxLen_u16 = 0u;   /* Announced request length */
+static uint16_t linTpRxPos_u16 = 0u;   /* Bytes received so far */
+static uint8_t linTpRxSn_u8 = 0u;      /* Sequence number of the next CF */
+static uint16_t linTpRxTimer_u16 = 0u; /* N_Cr ticks left, 0 = stopped */
+
+/* Response ring: committed records between tail and head */
+static uint8_t linTpTxRing_au8[LINTP_TX_RING_SIZE];
+static uint16_t linTpTxHead_u16 = 0u; /* Offset of the next record */
+static uint16_t linTpTxTail_u16 = 0u; /* Offset of the oldest record */
+static uint16_t linTpTxUsed_u16 = 0u; /* Committed bytes, wrap padding included */
+
+/* Open reservation */
+static bool linTpRsvOpen_b = false;
+static uint16_t linTpRsvLen_u16 = 0u; /* Reserved message bytes */
+static uint16_t linTpRsvPad_u16 = 0u; /* Padding skipped at the end of the ring, 0 if none */
+
+/* Segmentation of the record at tail */
+static uint16_t linTpTxLen_u16 = 0u;   /* Length of the response in transmission, 0 = none */
+static uint16_t linTpTxPos_u16 = 0u;   /* Confirmed bytes */
+static uint8_t linTpTxFrameLen_u8 = 0u; /* Message bytes in the frame awaiting confirmation */
+static uint8_t linTpTxSn_u8 = 0u;      /* Sequence number of the next CF */
+static uint16_t linTpTxTimer_u16 = 0u; /* N_As ticks left, 0 = stopped */
+
+/* Response pending notice */
+static uint8_t linTpRcrrpState_u8 = LINTP_RCRRP_NONE;
+static uint8_t linTpRcrrpSid_u8 = 0u;
+
+static void linTpRxAbort(void) {
+  linTpRxActive_b = false;
+  linTpRxTimer_u16 = 0u;
+}
+
+static void linTpRxIndicate(uint16_t len_u16) {
+  /* The tester moved on: a notice for the previous request is obsolete */
+  if(LINTP_RCRRP_REQUESTED == linTpRcrrpState_u8) { linTpRcrrpState_u8 = LINTP_RCRRP_NONE; }
+  LINTP_RX_INDICATION(len_u16);
+}
+
+static void linTpRxOverflow(uint8_t sid_u8) {
+  if(LINTP_RCRRP_REQUESTED == linTpRcrrpState_u8) { linTpRcrrpState_u8 = LINTP_RCRRP_NONE; }
+  LINTP_RX_OVERFLOW(sid_u8);
+}
+
+static void linTpRxCopy(const uint8_t *data_pu8, uint8_t count_u8) {
+  uint8_t l_idx_u8;
+
+  for(l_idx_u8 = 0u; l_idx_u8 < count_u8; l_idx_u8++) { LINTP_RX_BUFFER[linTpRxPos_u16 + l_idx_u8] = data_pu8[l_idx_u8]; }
+  linTpRxPos_u16 += count_u8;
+}
+
+/* Skip wrap padding and load the oldest record; returns true if a response is in transmission */
+static bool linTpTxFetch(void) {
+  uint16_t l_rem_u16;
+  uint16_t l_len_u16;
+
+  while((0u == linTpTxLen_u16) && (0u != linTpTxUsed_u16)) {
+    l_rem_u16 = (uint16_t)(LINTP_TX_RING_SIZE - linTpTxTail_u16);
+    l_len_u16 = LINTP_TX_WRAP_MARK;
+    if(l_rem_u16 >= LINTP_TX_HDR_LEN) { l_len_u16 = (uint16_t)(((uint16_t)linTpTxRing_au8[linTpTxTail_u16] << 8) | linTpTxRing_au8[linTpTxTail_u16 + 1u]); }
+    if(LINTP_TX_WRAP_MARK == l_len_u16) {
+      linTpTxUsed_u16 -= l_rem_u16;
+      linTpTxTail_u16 = 0u;
+    } else {
+      linTpTxLen_u16 = l_len_u16;
+      linTpTxPos_u16 = 0u;
+      linTpTxSn_u8 = 1u;
+    }
+  }
+
+  return (0u != linTpTxLen_u16);
+}
+
+static void linTpTxRelease(void) {
+  linTpTxTail_u16 += (uint16_t)(LINTP_TX_HDR_LEN + linTpTxLen_u16);
+  linTpTxUsed_u16 -= (uint16_t)(LINTP_TX_HDR_LEN + linTpTxLen_u16);
+  if(LINTP_TX_RING_SIZE == linTpTxTail_u16) { linTpTxTail_u16 = 0u; }
+  linTpTxLen_u16 = 0u;
+  linTpTxFrameLen_u8 = 0u;
+  linTpTxTimer_u16 = 0u;
+}
+
+/* The master moved on to a new request: drop the response in transmission and its notice, keep the queued records */
+static void linTpTxAbort(void) {
+  if(0u != linTpTxLen_u16) { linTpTxRelease(); }
+  if(LINTP_RCRRP_SENT == linTpRcrrpState_u8) { linTpTxTimer_u16 = 0u; }
+  linTpRcrrpState_u8 = LINTP_RCRRP_NONE;
+}
+
+/** @copydoc LinTp_Init */
+void LinTp_Init(void) {
+  linTpRxAbort();
+  linTpRxLen_u16 = 0u;
+  linTpRxPos_u16 = 0u;
+  linTpTxHead_u16 = 0u;
+  linTpTxTail_u16 = 0u;
+  linTpTxUsed_u16 = 0u;
+  linTpRsvOpen_b = false;
+  linTpTxLen_u16 = 0u;
+  linTpTxFrameLen_u8 = 0u;
+  linTpTxTimer_u16 = 0u;
+  linTpRcrrpState_u8 = LINTP_RCRRP_NONE;
+}
+
+/** @copydoc LinTp_RxFrame */
+void LinTp_RxFrame(const uint8_t frame_pu8[LINTP_FRAME_LEN]) {
+  const uint8_t l_pci_cu8 = frame_pu8[1];
+  uint16_t l_len_u16;
+  uint8_t l_count_u8;
+
+  if((LINTP_NAD == frame_pu8[0]) || (LINTP_NAD_BROADCAST == frame_pu8[0])) {
+    switch(l_pci_cu8 & LINTP_PCI_TYPE_MASK) {
+    case LINTP_PCI_SF:
+      linTpRxAbort();
+      linTpTxAbort();
+      l_len_u16 = (uint16_t)(l_pci_cu8 & 0x0Fu);
+      if((l_len_u16 >= 1u) && (l_len_u16 <= LINTP_SF_MAX_DATA) && (l_len_u16 <= LINTP_RX_BUFFER_SIZE)) {
+        linTpRxPos_u16 = 0u;
+        linTpRxCopy(&frame_pu8[2], (uint8_t)l_len_u16);
+        linTpRxIndicate(l_len_u16);
+      }
+      break;
+
+    case LINTP_PCI_FF:
+      linTpRxAbort();
+      linTpTxAbort();
+      l_len_u16 = (uint16_t)(((uint16_t)(l_pci_cu8 & 0x0Fu) << 8) | frame_pu8[2]);
+      if((l_len_u16 > LINTP_SF_MAX_DATA) && (l_len_u16 <= LINTP_RX_BUFFER_SIZE)) {
+        linTpRxPos_u16 = 0u;
+        linTpRxCopy(&frame_pu8[3], (uint8_t)LINTP_FF_DATA);
+        linTpRxLen_u16 = l_len_u16;
+        linTpRxSn_u8 = 1u;
+        linTpRxTimer_u16 = LINTP_N_CR_TICKS;
+        linTpRxActive_b = true;
+      } else if(l_len_u16 > LINTP_RX_BUFFER_SIZE) {
+        /* A request the buffer cannot hold is not reassembled, its CFs are ignored */
+        linTpRxOverflow(frame_pu8[3]);
+      } else {
+        /* FF for a message that fits a SF */
+      }
+      break;
+
+    case LINTP_PCI_CF:
+      if(linTpRxActive_b && ((l_pci_cu8 & 0x0Fu) == linTpRxSn_u8)) {
+        l_count_u8 = ((uint16_t)(linTpRxLen_u16 - linTpRxPos_u16) < LINTP_CF_DATA) ? (uint8_t)(linTpRxLen_u16 - linTpRxPos_u16) : (uint8_t)LINTP_CF_DATA;
+        linTpRxCopy(&frame_pu8[2], l_count_u8);
+        linTpRxSn_u8 = (uint8_t)((linTpRxSn_u8 + 1u) & 0x0Fu);
+        linTpRxTimer_u16 = LINTP_N_CR_TICKS;
+        if(linTpRxPos_u16 == linTpRxLen_u16) {
+          linTpRxAbort();
+          linTpRxIndicate(linTpRxLen_u16);
+        }
+      } else {
+        linTpRxAbort();
+      }
+      break;
+
+    default:
+      /* Not a transport layer frame */
+      break;
+    }
+  }
+}
+
+/** @copydoc LinTp_TxFrame */
+bool LinTp_TxFrame(uint8_t frame_pu8[LINTP_FRAME_LEN]) {
+  const uint8_t *l_msg_pu8;
+  uint8_t l_data_u8 = 2u; /* First data byte of the frame */
+  uint8_t l_idx_u8;
+  bool l_send_b = true;
+
+  if((0u == linTpTxLen_u16) && (LINTP_RCRRP_NONE != linTpRcrrpState_u8)) {
+    frame_pu8[0] = LINTP_NAD;
+    frame_pu8[1] = (uint8_t)(LINTP_PCI_SF | LINTP_RCRRP_LEN);
+    frame_pu8[2] = 0x7Fu;
+    frame_pu8[3] = linTpRcrrpSid_u8;
+    frame_pu8[4] = LINTP_RCRRP_NRC;
+    for(l_idx_u8 = 5u; l_idx_u8 < LINTP_FRAME_LEN; l_idx_u8++) { frame_pu8[l_idx_u8] = LINTP_FILLER; }
+    linTpRcrrpState_u8 = LINTP_RCRRP_SENT;
+    linTpTxTimer_u16 = LINTP_N_AS_TICKS;
+  } else if(linTpTxFetch()) {
+    l_msg_pu8 = &linTpTxRing_au8[linTpTxTail_u16 + LINTP_TX_HDR_LEN + linTpTxPos_u16];
+    frame_pu8[0] = LINTP_NAD;
+    if(linTpTxLen_u16 <= LINTP_SF_MAX_DATA) {
+      frame_pu8[1] = (uint8_t)(LINTP_PCI_SF | linTpTxLen_u16);
+      linTpTxFrameLen_u8 = (uint8_t)linTpTxLen_u16;
+    } else if(0u == linTpTxPos_u16) {
+      frame_pu8[1] = (uint8_t)(LINTP_PCI_FF | (linTpTxLen_u16 >> 8));
+      frame_pu8[2] = (uint8_t)(linTpTxLen_u16 & 0xFFu);
+      l_data_u8 = 3u;
+      linTpTxFrameLen_u8 = LINTP_FF_DATA;
+    } else {
+      frame_pu8[1] = (uint8_t)(LINTP_PCI_CF | linTpTxSn_u8);
+      linTpTxFrameLen_u8 = ((uint16_t)(linTpTxLen_u16 - linTpTxPos_u16) < LINTP_CF_DATA) ? (uint8_t)(linTpTxLen_u16 - linTpTxPos_u16) : (uint8_t)LINTP_CF_DATA;
+    }
+    for(l_idx_u8 = l_data_u8; l_idx_u8 < LINTP_FRAME_LEN; l_idx_u8++) {
+      frame_pu8[l_idx_u8] = ((l_idx_u8 - l_data_u8) < linTpTxFrameLen_u8) ? l_msg_pu8[l_idx_u8 - l_data_u8] : LINTP_FILLER;
+    }
+    linTpTxTimer_u16 = LINTP_N_AS_TICKS;
+  } else {
+    l_send_b = false;
+  }
+
+  return l_send_b;
+}
+
+/** @copydoc LinTp_TxConfirmation */
+void LinTp_TxConfirmation(void) {
+  if(LINTP_RCRRP_SENT == linTpRcrrpState_u8) {
+    linTpRcrrpState_u8 = LINTP_RCRRP_NONE;
+    linTpTxTimer_u16 = 0u;
+  } else if((0u != linTpTxLen_u16) && (0u != linTpTxFrameLen_u8)) {
+    if(0u != linTpTxPos_u16) { linTpTxSn_u8 = (uint8_t)((linTpTxSn_u8 + 1u) & 0x0Fu); }
+    linTpTxPos_u16 += linTpTxFrameLen_u8;
+    linTpTxFrameLen_u8 = 0u;
+    linTpTxTimer_u16 = 0u;
+    if(linTpTxPos_u16 >= linTpTxLen_u16) { linTpTxRelease(); }
+  }
+}
+
+/** @copydoc LinTp_TxReserve */
+uint8_t *LinTp_TxReserve(uint16_t len_u16) {
+  const uint16_t l_need_cu16 = (uint16_t)(len_u16 + LINTP_TX_HDR_LEN);
+  uint16_t l_free_u16;
+  uint8_t *l_area_pu8 = NULL;
+
+  linTpRsvOpen_b = false;
+  if((0u != len_u16) && (len_u16 <= LINTP_TX_MAX_MSG_LEN)) {
+    if((0u == linTpTxUsed_u16) && (0u == linTpTxLen_u16)) {
+      linTpTxHead_u16 = 0u;
+      linTpTxTail_u16 = 0u;
+    }
+    l_free_u16 = (uint16_t)(LINTP_TX_RING_SIZE - linTpTxUsed_u16);
+    if((l_need_cu16 <= (uint16_t)(LINTP_TX_RING_SIZE - linTpTxHead_u16)) && (l_need_cu16 <= l_free_u16)) {
+      linTpRsvPad_u16 = 0u;
+      l_area_pu8 = &linTpTxRing_au8[linTpTxHead_u16 + LINTP_TX_HDR_LEN];
+    } else if(((uint16_t)(LINTP_TX_RING_SIZE - linTpTxHead_u16) + l_need_cu16) <= l_free_u16) {
+      linTpRsvPad_u16 = (uint16_t)(LINTP_TX_RING_SIZE - linTpTxHead_u16);
+      l_area_pu8 = &linTpTxRing_au8[LINTP_TX_HDR_LEN];
+    } else {
+      /* No room: the caller answers busy or retries later */
+    }
+  }
+  if(NULL != l_area_pu8) {
+    linTpRsvOpen_b = true;
+    linTpRsvLen_u16 = len_u16;
+  }
+
+  return l_area_pu8;
+}
+
+/** @copydoc LinTp_TxCommit */
+void LinTp_TxCommit(uint16_t len_u16) {
+  if(linTpRsvOpen_b && (0u != len_u16) && (len_u16 <= linTpRsvLen_u16)) {
+    if(0u != linTpRsvPad_u16) {
+      if(linTpRsvPad_u16 >= LINTP_TX_HDR_LEN) {
+        linTpTxRing_au8[linTpTxHead_u16] = (uint8_t)(LINTP_TX_WRAP_MARK >> 8);
+        linTpTxRing_au8[linTpTxHead_u16 + 1u] = (uint8_t)(LINTP_TX_WRAP_MARK & 0xFFu);
+      }
+      linTpTxUsed_u16 += linTpRsvPad_u16;
+      linTpTxHead_u16 = 0u;
+    }
+    linTpTxRing_au8[linTpTxHead_u16] = (uint8_t)(len_u16 >> 8);
+    linTpTxRing_au8[linTpTxHead_u16 + 1u] = (uint8_t)(len_u16 & 0xFFu);
+    linTpTxHead_u16 += (uint16_t)(LINTP_TX_HDR_LEN + len_u16);
+    linTpTxUsed_u16 += (uint16_t)(LINTP_TX_HDR_LEN + len_u16);
+    if(LINTP_TX_RING_SIZE == linTpTxHead_u16) { linTpTxHead_u16 = 0u; }
+  }
+  linTpRsvOpen_b = false;
+}
+
+/** @copydoc LinTp_TxResponsePending */
+void LinTp_TxResponsePending(uint8_t sid_u8) {
+  linTpRcrrpSid_u8 = sid_u8;
+  if(LINTP_RCRRP_NONE == linTpRcrrpState_u8) { linTpRcrrpState_u8 = LINTP_RCRRP_REQUESTED; }
+}
+
+/** @copydoc LinTp_MainFunction */
+void LinTp_MainFunction(void) {
+  if(0u != linTpRxTimer_u16) {
+    linTpRxTimer_u16--;
+    /* N_Cr expired: the rest of the request will not come */
+    if(0u == linTpRxTimer_u16) { linTpRxAbort(); }
+  }
+  if(0u != linTpTxTimer_u16) {
+    linTpTxTimer_u16--;
+    /* N_As expired: drop the notice or the response, the next one starts with its first frame */
+    if(0u == linTpTxTimer_u16) {
+      if(LINTP_RCRRP_SENT == linTpRcrrpState_u8) {
+        linTpRcrrpState_u8 = LINTP_RCRRP_NONE;
+      } else {
+        linTpTxRelease();
+      }
+    }
+  }
+}
@@ -0,0 +1,38 @@
+#include "diagnostic_priv.h"
+
+/* Global buffers normally provided by LIN stack */
+uint8_t pbLinDiagBuffer[32];
+/* Message length */
+uint16_t g_linDiagDataLength_u16 = 0;
+
+/* Reserve a positive response of len_u16 bytes (SID included) in the LIN TP ring and write its SID;
+ * g_linDiagDataLength_u16 is set to the bytes after the SID. NRC busyRepeatRequest if the ring is full. */
+static uint8_t *linDiagPosResponse(uint16_t len_u16) {
+  uint8_t *const l_resp_pu8 = LinTp_TxReserve(len_u16);
+
+  if(NULL == l_resp_pu8) {
+    LinDiagSendNegResponse(kLinDiagNrcBusyRepeatRequest);
+  } else {
+    l_resp_pu8[0] = (uint8_t)(pbLinDiagBuffer[0] + DIAG_POSITIVE_RESPONSE_OFFSET);
+    g_linDiagDataLength_u16 = (uint16_t)(len_u16 - 1u);
+  }
+
+  return l_resp_pu8;
+}
+
+/* FUNCTION TO TEST */
+void ApplLinDiagClearDiagnosticInformation(void) {
+  const uint32 l_group_cu32 = ((uint32)pbLinDiagBuffer[1] << 16) | ((uint32)pbLinDiagBuffer[2] << 8) | (uint32)pbLinDiagBuffer[3];
+  uint8_t l_errCode_u8 = 0u;
+
+  /* Request: SID, groupOfDTC (3 bytes); response: 0x54 */
+  if(4u != g_linDiagDataLength_u16) {
+    LinDiagSendNegResponse(kLinDiagNrcIncorrectMessageLength);
+  } else if(E_OK != clearDtc(l_group_cu32, &l_errCode_u8)) {
+    LinDiagSendNegResponse(l_errCode_u8);
+  } else if(NULL != linDiagPosResponse(1u)) {
+    LinDiagSendPosResponse();
+  } else {
+    /* Ring full: busyRepeatRequest already sent */
+  }
+}
@@ -0,0 +1,22 @@
+#ifndef DIAGNOSTIC_CFG_H
+#define DIAGNOSTIC_CFG_H
+
+#include <stdint.h>
+
+typedef uint8_t uint8;
+typedef uint16_t uint16;
+typedef uint32_t uint32;
+typedef uint8_t Std_ReturnType;
+
+#define E_OK ((Std_ReturnType)0x00u)
+#define E_NOT_OK ((Std_ReturnType)0x01u)
+#define kLinDiagNrcRequestOutOfRange ((uint8)0x31u)
+#define kLinDiagNrcIncorrectMessageLength ((uint8)0x13u)
+#define kLinDiagNrcBusyRepeatRequest ((uint8)0x21u)
+
+/* groupOfDTC selecting every DTC */
+#define DIAG_CFG_DTC_GROUP_ALL 0xFFFFFFu
+
+Std_ReturnType clearDtc(uint32 group_u32, uint8 *errCode_pu8);
+
+#endif
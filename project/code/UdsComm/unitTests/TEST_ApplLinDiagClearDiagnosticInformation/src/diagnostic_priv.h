@@ -0,0 +1,12 @@
+#include "ApplLinDiagClearDiagnosticInformation.h"
+#include "diagnostic_cfg.h"
+#include "linTp.h"
+#include <stddef.h>
+
+#define DIAG_POSITIVE_RESPONSE_OFFSET 0x40u
+
+/* Send positive response */
+void LinDiagSendPosResponse(void);
+
+/* Send negative response with error code */
+void LinDiagSendNegResponse(uint8_t errorCode);
@@ -0,0 +1,124 @@
+#include "ApplLinDiagClearDiagnosticInformation.h"
+#include "mock_diagnostic_cfg.h"
+#include "mock_diagnostic_priv.h"
+#include "mock_linTp.h"
+#include "unity.h"
+#include <string.h>
+
+/* Response area returned by LinTp_TxReserve */
+static uint8_t s_txArea_au8[4];
+static uint16_t s_txReserved_u16;
+
+/* Groups seen by clearDtc() */
+static uint32 s_clearGroup_u32;
+static uint8_t s_clearCalls_u8;
+
+/* Fault memory with all DTCs and the single group 0x901217; other groups are unknown */
+static Std_ReturnType clearDtc_Callback(uint32 group_u32, uint8 *errCode_pu8, int cmock_num_calls) {
+  Std_ReturnType l_result_ = E_OK;
+  (void)cmock_num_calls;
+
+  s_clearGroup_u32 = group_u32;
+  s_clearCalls_u8++;
+  if((DIAG_CFG_DTC_GROUP_ALL != group_u32) && (0x901217u != group_u32)) {
+    *errCode_pu8 = kLinDiagNrcRequestOutOfRange;
+    l_result_ = E_NOT_OK;
+  }
+
+  return l_result_;
+}
+
+static uint8_t *LinTp_TxReserve_Callback(uint16_t len_u16, int cmock_num_calls) {
+  (void)cmock_num_calls;
+  s_txReserved_u16 = len_u16;
+
+  return s_txArea_au8;
+}
+
+static uint8_t *LinTp_TxReserve_Full_Callback(uint16_t len_u16, int cmock_num_calls) {
+  (void)len_u16;
+  (void)cmock_num_calls;
+
+  return NULL; /* ring full */
+}
+
+void setUp(void) {
+  clearDtc_StubWithCallback(clearDtc_Callback);
+  LinTp_TxReserve_StubWithCallback(LinTp_TxReserve_Callback);
+
+  memset(pbLinDiagBuffer, 0, sizeof(pbLinDiagBuffer));
+  memset(s_txArea_au8, 0, sizeof(s_txArea_au8));
+  s_txReserved_u16 = 0u;
+  s_clearGroup_u32 = 0u;
+  s_clearCalls_u8 = 0u;
+
+  /* 14 FF FF FF */
+  pbLinDiagBuffer[0] = 0x14u;
+  pbLinDiagBuffer[1] = 0xFFu;
+  pbLinDiagBuffer[2] = 0xFFu;
+  pbLinDiagBuffer[3] = 0xFFu;
+  g_linDiagDataLength_u16 = 4u;
+}
+
+void tearDown(void) {}
+
+/* Test: all groups -> fault memory cleared, response 54 */
+void test_ApplLinDiagClearDiagnosticInformation_AllGroups(void) {
+  LinDiagSendPosResponse_Expect();
+
+  ApplLinDiagClearDiagnosticInformation();
+
+  TEST_ASSERT_EQUAL_HEX32(DIAG_CFG_DTC_GROUP_ALL, s_clearGroup_u32);
+  TEST_ASSERT_EQUAL_UINT16(1u, s_txReserved_u16);
+  TEST_ASSERT_EQUAL_HEX8(0x54u, s_txArea_au8[0]);
+  TEST_ASSERT_EQUAL_UINT16(0u, g_linDiagDataLength_u16);
+}
+
+/* Test: single group -> groupOfDTC passed MSB first, response 54 */
+void test_ApplLinDiagClearDiagnosticInformation_SingleGroup(void) {
+  pbLinDiagBuffer[1] = 0x90u;
+  pbLinDiagBuffer[2] = 0x12u;
+  pbLinDiagBuffer[3] = 0x17u;
+  LinDiagSendPosResponse_Expect();
+
+  ApplLinDiagClearDiagnosticInformation();
+
+  TEST_ASSERT_EQUAL_HEX32(0x901217u, s_clearGroup_u32);
+  TEST_ASSERT_EQUAL_HEX8(0x54u, s_txArea_au8[0]);
+}
+
+/* Test: unknown group -> NRC of clearDtc(), nothing reserved */
+void test_ApplLinDiagClearDiagnosticInformation_UnknownGroup(void) {
+  pbLinDiagBuffer[1] = 0x12u;
+  pbLinDiagBuffer[2] = 0x34u;
+  pbLinDiagBuffer[3] = 0x56u;
+  LinDiagSendNegResponse_Expect(kLinDiagNrcRequestOutOfRange);
+
+  ApplLinDiagClearDiagnosticInformation();
+
+  TEST_ASSERT_EQUAL_HEX32(0x123456u, s_clearGroup_u32);
+  TEST_ASSERT_EQUAL_UINT16(0u, s_txReserved_u16);
+}
+
+/* Test: groupOfDTC not 3 bytes -> incorrectMessageLength, nothing cleared */
+void test_ApplLinDiagClearDiagnosticInformation_WrongLength(void) {
+  g_linDiagDataLength_u16 = 5u;
+  LinDiagSendNegResponse_Expect(kLinDiagNrcIncorrectMessageLength);
+  ApplLinDiagClearDiagnosticInformation();
+
+  g_linDiagDataLength_u16 = 3u;
+  LinDiagSendNegResponse_Expect(kLinDiagNrcIncorrectMessageLength);
+  ApplLinDiagClearDiagnosticInformation();
+
+  TEST_ASSERT_EQUAL_UINT8(0u, s_clearCalls_u8);
+}
+
+/* Test: LIN TP ring full after clearing -> busyRepeatRequest */
+void test_ApplLinDiagClearDiagnosticInformation_RingFull(void) {
+  LinTp_TxReserve_StubWithCallback(LinTp_TxReserve_Full_Callback);
+  LinDiagSendNegResponse_Expect(kLinDiagNrcBusyRepeatRequest);
+
+  ApplLinDiagClearDiagnosticInformation();
+
+  TEST_ASSERT_EQUAL_UINT8(1u, s_clearCalls_u8);
+}
@@ -5,25 +5,111 @@ uint8_t pbLinDiagBuffer[32];
 /* Message length */
 uint16_t g_linDiagDataLength_u16 = 0;
 
-/* FUNCTION TO TEST */
+/* ReadDataByIdentifier job, kept from the request to the final response while a DID handler is pending */
+static uint16_t linDiagRdbiDids_au16[DIAG_RDBI_MAX_DIDS]; /* Supported DIDs of the request */
+static uint8_t linDiagRdbiDidCount_u8 = 0u;
+static uint8_t linDiagRdbiDidIdx_u8 = 0u;   /* Next DID to read */
+static uint16_t linDiagRdbiPos_u16 = 1u;    /* Next free byte of the response */
+static uint8_t *linDiagRdbiResp_pu8 = NULL; /* Response area reserved in the LIN TP ring */
 
-void ApplLinDiagReadDataById(void) {
-  const uint16_t l_did_cu16 = ((uint16_t)(pbLinDiagBuffer[1] << 8) & (uint16_t)0xFF00) | ((uint16_t)pbLinDiagBuffer[2] & (uint16_t)0x00FF);
+/* Response pending supervision */
+static bool linDiagPending_b = false;
+static uint16_t linDiagP2Timer_u16 = 0u;    /* Ticks left before the next NRC 0x78 */
+static uint8_t linDiagRespPendCnt_u8 = 0u;  /* NRC 0x78 sent for the current request */
+
+/* Read the DIDs from linDiagRdbiDidIdx_u8 on; the first handler gets opStatus_u8, the next ones start fresh */
+static Std_ReturnType linDiagRdbiRead(uint8_t opStatus_u8, uint8_t *errCode_pu8) {
   Std_ReturnType l_result_ = E_OK;
-  uint8_t l_errCode_u8 = 0;
-  uint8_t *const l_diagBuf_pu8 = &pbLinDiagBuffer[3];
-  uint8_t l_diagBufSize_u8 = 0;
   Std_ReturnType l_didSupported_ = E_OK;
-  checkCurrentNad((uint8_t)0u, &l_result_);
-  if(E_OK == l_result_) { checkMsgDataLength(g_linDiagDataLength_u16, &l_result_); }
-  if(E_OK == l_result_) { l_result_ = getHandlersForReadDataById(&l_errCode_u8, l_did_cu16, &l_diagBufSize_u8, &l_didSupported_, l_diagBuf_pu8); }
-  switch(l_result_) {
+  uint8_t l_opStatus_u8 = opStatus_u8;
+  uint8_t l_diagBufSize_u8;
+  uint16_t l_did_u16;
+
+  while((E_OK == l_result_) && (linDiagRdbiDidIdx_u8 < linDiagRdbiDidCount_u8)) {
+    l_did_u16 = linDiagRdbiDids_au16[linDiagRdbiDidIdx_u8];
+    linDiagRdbiResp_pu8[linDiagRdbiPos_u16] = (uint8_t)(l_did_u16 >> 8);
+    linDiagRdbiResp_pu8[linDiagRdbiPos_u16 + 1u] = (uint8_t)(l_did_u16 & 0xFFu);
+    l_diagBufSize_u8 = 0u;
+    l_result_ = getHandlersForReadDataById(errCode_pu8, l_did_u16, &l_diagBufSize_u8, &l_didSupported_, &linDiagRdbiResp_pu8[linDiagRdbiPos_u16 + 2u], l_opStatus_u8);
+    if(E_OK == l_result_) {
+      linDiagRdbiPos_u16 += (uint16_t)l_diagBufSize_u8 + 2u;
+      linDiagRdbiDidIdx_u8++;
+      l_opStatus_u8 = DIAG_OPSTATUS_INITIAL;
+    }
+  }
+
+  return l_result_;
+}
+
+/* Send the response once the handlers are done, or start the response pending supervision */
+static void linDiagRdbiConclude(Std_ReturnType result_, uint8_t errCode_u8) {
+  switch(result_) {
   case E_OK:
-    g_linDiagDataLength_u16 = ((uint16_t)l_diagBufSize_u8 + 2u);
+    linDiagPending_b = false;
+    g_linDiagDataLength_u16 = (uint16_t)(linDiagRdbiPos_u16 - 1u);
     LinDiagSendPosResponse();
     break;
+  case E_PENDING:
+    if(!linDiagPending_b) {
+      linDiagPending_b = true;
+      linDiagP2Timer_u16 = DIAG_P2_TICKS;
+      linDiagRespPendCnt_u8 = 0u;
+    }
+    break;
   default:
-    LinDiagSendNegResponse(l_errCode_u8);
+    linDiagPending_b = false;
+    /* pbLinDiagBuffer may already hold a newer request when a pending handler fails */
+    LinDiagSendNegResponseSid(DIAG_SID_READ_DATA_BY_ID, errCode_u8);
     break;
   }
 }
+
+/* FUNCTION TO TEST */
+
+void ApplLinDiagReadDataById(void) {
+  uint8_t l_reqDids_u8 = 0u;
+  uint16_t l_respLen_u16 = 0u;
+  Std_ReturnType l_result_ = E_OK;
+  uint8_t l_errCode_u8 = 0;
+  uint8_t l_diagBufSize_u8 = 0;
+  uint8_t l_idx_u8;
+  linDiagRdbiDidCount_u8 = 0u;
+  linDiagRdbiDidIdx_u8 = 0u;
+  linDiagRdbiPos_u16 = 1u;
+  /* SID followed by at least one complete DID */
+  if((g_linDiagDataLength_u16 < 3u) || (0u == (g_linDiagDataLength_u16 & 1u))) {
+    l_errCode_u8 = kLinDiagNrcIncorrectMessageLength;
+    l_result_ = E_NOT_OK;
+  }
+  if(E_OK == l_result_) {
+    /* Size the whole response before any handler runs; unsupported DIDs are skipped. The DID list is
+     * kept because a pending handler may outlive the request in pbLinDiagBuffer. */
+    l_reqDids_u8 = (uint8_t)((g_linDiagDataLength_u16 - 1u) >> 1);
+    for(l_idx_u8 = 0u; l_idx_u8 < l_reqDids_u8; l_idx_u8++) {
+      const uint16_t l_did_cu16 = ((uint16_t)(pbLinDiagBuffer[1u + (2u * l_idx_u8)] << 8) & (uint16_t)0xFF00) | ((uint16_t)pbLinDiagBuffer[2u + (2u * l_idx_u8)] & (uint16_t)0x00FF);
+      if(E_OK == getDidReadSize(l_did_cu16, &l_diagBufSize_u8)) {
+        linDiagRdbiDids_au16[linDiagRdbiDidCount_u8] = l_did_cu16;
+        linDiagRdbiDidCount_u8++;
+        l_respLen_u16 += (uint16_t)l_diagBufSize_u8 + 2u;
+      }
+    }
+    if(0u == linDiagRdbiDidCount_u8) {
+      l_errCode_u8 = kLinDiagNrcRequestOutOfRange;
+      l_result_ = E_NOT_OK;
+    } else if(l_respLen_u16 > DIAG_RDBI_RESPONSE_CAPACITY) {
+      l_errCode_u8 = kLinDiagNrcResponseTooLong;
+      l_result_ = E_NOT_OK;
+    } else {
+      /* Handlers write the response straight into the LIN TP ring */
+      linDiagRdbiResp_pu8 = LinTp_TxReserve((uint16_t)(l_respLen_u16 + 1u));
+      if(NULL == linDiagRdbiResp_pu8) {
+        l_errCode_u8 = kLinDiagNrcBusyRepeatRequest;
+        l_result_ = E_NOT_OK;
+      } else {
+        linDiagRdbiResp_pu8[0] = (uint8_t)(DIAG_SID_READ_DATA_BY_ID + DIAG_POSITIVE_RESPONSE_OFFSET);
+      }
+    }
+  }
+  if(E_OK == l_result_) { l_result_ = linDiagRdbiRead(DIAG_OPSTATUS_INITIAL, &l_errCode_u8); }
+  linDiagRdbiConclude(l_result_, l_errCode_u8);
+}
@@ -1,8 +1,7 @@
-
-
 #ifndef DIAGNOSTIC_H
 #define DIAGNOSTIC_H
 
+#include <stdbool.h>
 #include <stdint.h>
 
 extern uint8_t pbLinDiagBuffer[32];
@@ -10,12 +10,28 @@ typedef uint8_t Std_ReturnType;
 
 #define E_OK ((Std_ReturnType)0x00u)
 #define E_NOT_OK ((Std_ReturnType)0x01u)
+#define E_PENDING ((Std_ReturnType)0x0Au)
+#define DIAG_OPSTATUS_INITIAL ((uint8)0x00u)
+#define DIAG_OPSTATUS_PENDING ((uint8)0x01u)
+#define DIAG_OPSTATUS_CANCEL ((uint8)0x02u)
 #define kLinDiagNrcRequestOutOfRange ((uint8)0x31u)
+#define kLinDiagNrcIncorrectMessageLength ((uint8)0x13u)
+#define kLinDiagNrcResponseTooLong ((uint8)0x14u)
+#define kLinDiagNrcBusyRepeatRequest ((uint8)0x21u)
+#define kLinDiagNrcGeneralReject ((uint8)0x10u)
+
+/* P2 = 2 ticks, P2* = 5 ticks, 2 x NRC 0x78 */
+#define DIAG_CFG_MAIN_PERIOD_MS 10u
+#define DIAG_CFG_P2_MS 20u
+#define DIAG_CFG_P2STAR_MS 50u
+#define DIAG_CFG_RESP_PEND_MAX 2u
 
 void checkCurrentNad(uint8 currentNad, Std_ReturnType *result);
 
 void checkMsgDataLength(uint16_t dataLength, Std_ReturnType *result);
 
-Std_ReturnType getHandlersForReadDataById(uint8 l_did_u8, uint16 l_did_cu16, uint8 *l_diagBufSize_u8, Std_ReturnType *l_didSupported_, uint8 *l_diagBuf_pu8);
+Std_ReturnType getHandlersForReadDataById(uint8 *l_errCode_u8, uint16 l_did_cu16, uint8 *l_diagBufSize_u8, Std_ReturnType *l_didSupported_, uint8 *l_diagBuf_pu8, uint8 opStatus_u8);
+
+Std_ReturnType getDidReadSize(uint16 did_u16, uint8 *size_pu8);
 
 #endif
\ No newline at end of file
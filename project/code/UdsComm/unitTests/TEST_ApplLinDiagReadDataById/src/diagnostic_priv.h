@@ -1,9 +1,24 @@
 #include "ApplLinDiagReadDataById.h"
 #include "diagnostic_cfg.h"
+#include "linTp.h"
 #include <stddef.h>
 
+#define DIAG_SID_READ_DATA_BY_ID 0x22u
+#define DIAG_POSITIVE_RESPONSE_OFFSET 0x40u
+
+/* ReadDataByIdentifier (0x22) request in pbLinDiagBuffer: SID, DID#1 (2 bytes) .. DID#n (2 bytes)
+ * ReadDataByIdentifier (0x22) response in the LIN TP ring:  0x62, DID#1, data#1 .. DID#n, data#n */
+#define DIAG_RDBI_RESPONSE_CAPACITY ((uint16_t)(LINTP_TX_MAX_MSG_LEN - 1u))
+#define DIAG_RDBI_MAX_DIDS ((sizeof(pbLinDiagBuffer) - 1u) / 2u)
+
+#define DIAG_P2_TICKS ((uint16_t)(DIAG_CFG_P2_MS / DIAG_CFG_MAIN_PERIOD_MS))
+#define DIAG_P2STAR_TICKS ((uint16_t)(DIAG_CFG_P2STAR_MS / DIAG_CFG_MAIN_PERIOD_MS))
+
 /* Send positive response */
 void LinDiagSendPosResponse(void);
 
 /* Send negative response with error code */
-void LinDiagSendNegResponse(uint8_t errorCode);
\ No newline at end of file
+void LinDiagSendNegResponse(uint8_t errorCode);
+
+/* Send negative response with error code for a request no longer (or not) in pbLinDiagBuffer */
+void LinDiagSendNegResponseSid(uint8_t sid_u8, uint8_t errorCode);
\ No newline at end of file
@@ -0,0 +1,13 @@
+#ifndef LINTP_H
+#define LINTP_H
+
+#include <stdint.h>
+
+/* Ring of 512 bytes, 2-byte record header */
+#define LINTP_TX_MAX_MSG_LEN ((uint16_t)510u)
+
+uint8_t *LinTp_TxReserve(uint16_t len_u16);
+
+void LinTp_TxResponsePending(uint8_t sid_u8);
+
+#endif
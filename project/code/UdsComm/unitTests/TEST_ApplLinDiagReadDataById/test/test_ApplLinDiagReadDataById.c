@@ -1,77 +1,120 @@
 #include "ApplLinDiagReadDataById.h"
 #include "mock_diagnostic_cfg.h"
 #include "mock_diagnostic_priv.h"
+#include "mock_linTp.h"
 #include "unity.h"
 #include <string.h>
 
 #define MOCK_DID_F308_SIZE 4
+#define MOCK_DID_F186_SIZE 2
+#define MOCK_DID_F190_SIZE 17
+#define MOCK_DID_F1A0_SIZE 255
+
+/* Area della ring LIN TP restituita da LinTp_TxReserve */
+static uint8_t s_txArea_au8[LINTP_TX_MAX_MSG_LEN];
+static uint16_t s_txReserved_u16;
 
 /* ============================================================================
  * Callback di default (successo)
  * ============================================================================ */
-void CurrentNad_Callback(uint8 currentNad, Std_ReturnType *result, int cmock_num_calls) {
-  (void)cmock_num_calls;
+/* Dimensione configurata dei DID supportati dai mock, 0 = DID non supportato */
+static uint8 MockDidSize(uint16 did) {
+  uint8 size = 0u;
 
-  if(currentNad == 0u) {
-    *result = E_OK;
-  } else {
-    *result = E_NOT_OK;
+  switch(did) {
+  /* IS_OVERVOLT_FLAG */
+  case 0xF308:
+    size = MOCK_DID_F308_SIZE;
+    break;
+  case 0xF186:
+    size = MOCK_DID_F186_SIZE;
+    break;
+  case 0xF190:
+    size = MOCK_DID_F190_SIZE;
+    break;
+  case 0xF1A0:
+    size = MOCK_DID_F1A0_SIZE;
+    break;
+  default:
+    break;
   }
+
+  return size;
 }
 
-void MsgDataLength_Callback(uint16_t dataLength, Std_ReturnType *result, int cmock_num_calls) {
-  (void)dataLength;
+Std_ReturnType getDidReadSize_Callback(uint16 did_u16, uint8 *size_pu8, int cmock_num_calls) {
+  Std_ReturnType l_result_ = E_NOT_OK;
   (void)cmock_num_calls;
-  *result = E_OK;
+
+  if(0u != MockDidSize(did_u16)) {
+    *size_pu8 = MockDidSize(did_u16);
+    l_result_ = E_OK;
+  }
+
+  return l_result_;
 }
 
-Std_ReturnType getHandlersForReadDataById_Callback(uint8 l_errCode_u8, uint16 l_did_cu16, uint8 *l_diagBufSize_u8, Std_ReturnType *l_didSupported_, uint8 *l_diagBuf_pu8, int cmock_num_calls) {
+Std_ReturnType getHandlersForReadDataById_Callback(uint8 *l_errCode_u8, uint16 l_did_cu16, uint8 *l_diagBufSize_u8, Std_ReturnType *l_didSupported_, uint8 *l_diagBuf_pu8, uint8 opStatus_u8,
+                                                   int cmock_num_calls) {
   Std_ReturnType l_result_ = E_OK;
+  uint8 i;
   (void)l_errCode_u8;
-  (void)l_diagBuf_pu8;
+  (void)opStatus_u8;
   (void)cmock_num_calls;
 
-  switch(l_did_cu16) {
-  /* IS_OVERVOLT_FLAG: DID supportato */
-  case 0xF308:
-    *l_diagBufSize_u8 = MOCK_DID_F308_SIZE;
-    break;
-
-  default:
+  if(0u != MockDidSize(l_did_cu16)) {
+    *l_diagBufSize_u8 = MockDidSize(l_did_cu16);
+    /* Payload riconoscibile: byte basso del DID ripetuto */
+    for(i = 0u; i < *l_diagBufSize_u8; i++) { l_diagBuf_pu8[i] = (uint8)(l_did_cu16 & 0xFFu); }
+  } else {
     *l_didSupported_ = E_NOT_OK;
     l_result_ = E_NOT_OK;
-    /* l_errCode_u8 è passato per valore, la modifica qui non esce */
-    break;
   }
 
   return l_result_;
 }
 
+uint8_t *LinTp_TxReserve_Callback(uint16_t len_u16, int cmock_num_calls) {
+  (void)cmock_num_calls;
+  s_txReserved_u16 = len_u16;
+
+  return s_txArea_au8;
+}
+
 /* ============================================================================
  * Callback alternative (percorsi di errore)
  * ============================================================================ */
-static void CurrentNad_Fail_Callback(uint8 currentNad, Std_ReturnType *result, int cmock_num_calls) {
-  (void)currentNad;
+static Std_ReturnType getHandlersForReadDataById_Fail_Callback(uint8 *l_errCode_u8, uint16 l_did_cu16, uint8 *l_diagBufSize_u8, Std_ReturnType *l_didSupported_, uint8 *l_diagBuf_pu8,
+                                                               uint8 opStatus_u8, int cmock_num_calls) {
+  (void)l_errCode_u8;
+  (void)l_did_cu16;
+  (void)l_diagBufSize_u8;
+  (void)l_didSupported_;
+  (void)l_diagBuf_pu8;
+  (void)opStatus_u8;
   (void)cmock_num_calls;
-  *result = E_NOT_OK; /* qualunque NAD => fallisce */
-}
 
-static void MsgDataLength_Fail_Callback(uint16_t dataLength, Std_ReturnType *result, int cmock_num_calls) {
-  (void)dataLength;
-  (void)cmock_num_calls;
-  *result = E_NOT_OK; /* controllo lunghezza fallisce */
+  return E_NOT_OK; /* handler fallisce a prescindere dal DID */
 }
 
-static Std_ReturnType getHandlersForReadDataById_Fail_Callback(uint8 l_errCode_u8, uint16 l_did_cu16, uint8 *l_diagBufSize_u8, Std_ReturnType *l_didSupported_, uint8 *l_diagBuf_pu8,
-                                                               int cmock_num_calls) {
+static Std_ReturnType getHandlersForReadDataById_Pending_Callback(uint8 *l_errCode_u8, uint16 l_did_cu16, uint8 *l_diagBufSize_u8, Std_ReturnType *l_didSupported_, uint8 *l_diagBuf_pu8,
+                                                                  uint8 opStatus_u8, int cmock_num_calls) {
   (void)l_errCode_u8;
   (void)l_did_cu16;
   (void)l_diagBufSize_u8;
   (void)l_didSupported_;
   (void)l_diagBuf_pu8;
   (void)cmock_num_calls;
+  TEST_ASSERT_EQUAL(DIAG_OPSTATUS_INITIAL, opStatus_u8);
 
-  return E_NOT_OK; /* handler fallisce a prescindere dal DID */
+  return E_PENDING; /* sorgente dati lenta */
+}
+
+static uint8_t *LinTp_TxReserve_Full_Callback(uint16_t len_u16, int cmock_num_calls) {
+  (void)len_u16;
+  (void)cmock_num_calls;
+
+  return NULL; /* ring piena */
 }
 
 /* ============================================================================
@@ -79,9 +122,9 @@ static Std_ReturnType getHandlersForReadDataById_Fail_Callback(uint8 l_errCode_u
  * ============================================================================ */
 void setUp(void) {
   /* Callback di default (successo) */
-  checkCurrentNad_StubWithCallback(CurrentNad_Callback);
-  checkMsgDataLength_StubWithCallback(MsgDataLength_Callback);
   getHandlersForReadDataById_StubWithCallback(getHandlersForReadDataById_Callback);
+  getDidReadSize_StubWithCallback(getDidReadSize_Callback);
+  LinTp_TxReserve_StubWithCallback(LinTp_TxReserve_Callback);
 
   /* Inizializza i buffer globali prima di ogni test */
   extern uint8_t pbLinDiagBuffer[32];
@@ -89,6 +132,8 @@ void setUp(void) {
 
   memset(pbLinDiagBuffer, 0, sizeof(pbLinDiagBuffer));
   g_linDiagDataLength_u16 = 0;
+  memset(s_txArea_au8, 0, sizeof(s_txArea_au8));
+  s_txReserved_u16 = 0u;
 }
 
 void tearDown(void) {}
@@ -104,16 +149,16 @@ void test_ApplLinDiagReadDataById_DidNotSupported(void) {
   pbLinDiagBuffer[1] = 0x12u;
   pbLinDiagBuffer[2] = 0x34u;
 
-  g_linDiagDataLength_u16 = 0u;
+  g_linDiagDataLength_u16 = 3u; /* SID + 1 DID */
 
-  /* Ci aspettiamo una risposta negativa (codice errore non gestito qui) */
-  LinDiagSendNegResponse_Expect(0);
+  /* Nessun DID supportato => requestOutOfRange */
+  LinDiagSendNegResponseSid_Expect(DIAG_SID_READ_DATA_BY_ID, kLinDiagNrcRequestOutOfRange);
 
   /* Esecuzione */
   ApplLinDiagReadDataById();
 
   /* Verifica: la lunghezza rimane invariata */
-  TEST_ASSERT_EQUAL_UINT16(0u, g_linDiagDataLength_u16);
+  TEST_ASSERT_EQUAL_UINT16(3u, g_linDiagDataLength_u16);
 }
 
 /* ============================================================================
@@ -127,7 +172,7 @@ void test_ApplLinDiagReadDataById_SuccessfulExecution_DidSupported(void) {
   pbLinDiagBuffer[1] = 0xF3u;
   pbLinDiagBuffer[2] = 0x08u;
 
-  g_linDiagDataLength_u16 = 0u;
+  g_linDiagDataLength_u16 = 3u; /* SID + 1 DID */
 
   /* Tutti i check OK + handler OK => risposta positiva */
   LinDiagSendPosResponse_Expect();
@@ -137,83 +182,209 @@ void test_ApplLinDiagReadDataById_SuccessfulExecution_DidSupported(void) {
 
   /* Verifica: lunghezza = dimensione dati + 2 (per il DID) */
   TEST_ASSERT_EQUAL_UINT16(MOCK_DID_F308_SIZE + 2u, g_linDiagDataLength_u16);
+
+  /* Verifica: risposta riservata nella ring con RSID 0x62 davanti */
+  TEST_ASSERT_EQUAL_UINT16(MOCK_DID_F308_SIZE + 3u, s_txReserved_u16);
+  TEST_ASSERT_EQUAL_HEX8(0x62u, s_txArea_au8[0]);
+  TEST_ASSERT_EQUAL_HEX8(0xF3u, s_txArea_au8[1]);
+  TEST_ASSERT_EQUAL_HEX8(0x08u, s_txArea_au8[2]);
 }
 
 /* ============================================================================
- * TEST 3: NAD errato -> risposta negativa, non arriva al handler
+ * TEST 3: Handler fallisce -> risposta negativa, lunghezza invariata
  * ============================================================================ */
-void test_ApplLinDiagReadDataById_WrongNad_Fails(void) {
+void test_ApplLinDiagReadDataById_HandlerFails(void) {
   extern uint8_t pbLinDiagBuffer[32];
   extern uint16_t g_linDiagDataLength_u16;
 
-  /* DID valido, ma NAD fallisce: non deve importare il DID */
+  /* DID che normalmente sarebbe anche valido, ma qui forziamo il fallimento del handler */
   pbLinDiagBuffer[1] = 0xF3u;
   pbLinDiagBuffer[2] = 0x08u;
 
-  g_linDiagDataLength_u16 = 0u;
+  g_linDiagDataLength_u16 = 3u;
 
-  /* Forzo fallimento NAD per questo test */
-  checkCurrentNad_StubWithCallback(CurrentNad_Fail_Callback);
+  /* Richiesta valida, ma handler fallisce */
+  getHandlersForReadDataById_StubWithCallback(getHandlersForReadDataById_Fail_Callback);
 
-  /* Mi aspetto una risposta negativa (il codice esatto qui non interessa) */
-  LinDiagSendNegResponse_Expect(0);
+  LinDiagSendNegResponseSid_Expect(DIAG_SID_READ_DATA_BY_ID, 0);
 
   /* Esecuzione */
   ApplLinDiagReadDataById();
 
   /* Verifica: lunghezza invariata */
-  TEST_ASSERT_EQUAL_UINT16(0u, g_linDiagDataLength_u16);
+  TEST_ASSERT_EQUAL_UINT16(3u, g_linDiagDataLength_u16);
 }
 
 /* ============================================================================
- * TEST 4: MsgDataLength fallisce -> risposta negativa, handler non chiamato
+ * TEST 4: piu' DID in una richiesta -> risposta unica DID, dati, DID, dati
  * ============================================================================ */
-void test_ApplLinDiagReadDataById_MsgDataLength_Fails(void) {
+void test_ApplLinDiagReadDataById_MultipleDids(void) {
   extern uint8_t pbLinDiagBuffer[32];
   extern uint16_t g_linDiagDataLength_u16;
 
-  /* DID valido, ma fallisce il controllo lunghezza */
   pbLinDiagBuffer[1] = 0xF3u;
   pbLinDiagBuffer[2] = 0x08u;
+  pbLinDiagBuffer[3] = 0xF1u;
+  pbLinDiagBuffer[4] = 0x86u;
 
-  g_linDiagDataLength_u16 = 10u; /* valore non zero per verificare che resti invariato */
+  g_linDiagDataLength_u16 = 5u; /* SID + 2 DID */
 
-  /* NAD OK, ma controllo lunghezza fallisce */
-  checkCurrentNad_StubWithCallback(CurrentNad_Callback);
-  checkMsgDataLength_StubWithCallback(MsgDataLength_Fail_Callback);
+  LinDiagSendPosResponse_Expect();
 
-  LinDiagSendNegResponse_Expect(0);
+  ApplLinDiagReadDataById();
+
+  /* Verifica: lunghezza = somma di (dati + 2) per ogni DID */
+  TEST_ASSERT_EQUAL_UINT16((MOCK_DID_F308_SIZE + 2u) + (MOCK_DID_F186_SIZE + 2u), g_linDiagDataLength_u16);
+
+  /* Verifica: DID e dati in sequenza dopo l'RSID */
+  TEST_ASSERT_EQUAL_HEX8(0xF3u, s_txArea_au8[1]);
+  TEST_ASSERT_EQUAL_HEX8(0x08u, s_txArea_au8[2]);
+  TEST_ASSERT_EQUAL_HEX8(0x08u, s_txArea_au8[3]);
+  TEST_ASSERT_EQUAL_HEX8(0x08u, s_txArea_au8[2u + MOCK_DID_F308_SIZE]);
+  TEST_ASSERT_EQUAL_HEX8(0xF1u, s_txArea_au8[3u + MOCK_DID_F308_SIZE]);
+  TEST_ASSERT_EQUAL_HEX8(0x86u, s_txArea_au8[4u + MOCK_DID_F308_SIZE]);
+  TEST_ASSERT_EQUAL_HEX8(0x86u, s_txArea_au8[5u + MOCK_DID_F308_SIZE]);
+  TEST_ASSERT_EQUAL_HEX8(0x86u, s_txArea_au8[4u + MOCK_DID_F308_SIZE + MOCK_DID_F186_SIZE]);
+}
+
+/* ============================================================================
+ * TEST 5: DID non supportato in mezzo ad altri -> viene saltato
+ * ============================================================================ */
+void test_ApplLinDiagReadDataById_UnsupportedDidSkipped(void) {
+  extern uint8_t pbLinDiagBuffer[32];
+  extern uint16_t g_linDiagDataLength_u16;
+
+  pbLinDiagBuffer[1] = 0x12u;
+  pbLinDiagBuffer[2] = 0x34u;
+  pbLinDiagBuffer[3] = 0xF1u;
+  pbLinDiagBuffer[4] = 0x86u;
+
+  g_linDiagDataLength_u16 = 5u;
+
+  LinDiagSendPosResponse_Expect();
 
-  /* Esecuzione */
   ApplLinDiagReadDataById();
 
-  /* Verifica: lunghezza invariata */
-  TEST_ASSERT_EQUAL_UINT16(10u, g_linDiagDataLength_u16);
+  TEST_ASSERT_EQUAL_UINT16(MOCK_DID_F186_SIZE + 2u, g_linDiagDataLength_u16);
+  TEST_ASSERT_EQUAL_HEX8(0xF1u, s_txArea_au8[1]);
+  TEST_ASSERT_EQUAL_HEX8(0x86u, s_txArea_au8[2]);
 }
 
 /* ============================================================================
- * TEST 5: Handler fallisce -> risposta negativa, lunghezza invariata
+ * TEST 6: lunghezza richiesta non composta da DID interi -> incorrectMessageLength
  * ============================================================================ */
-void test_ApplLinDiagReadDataById_HandlerFails(void) {
+void test_ApplLinDiagReadDataById_IncompleteDid(void) {
   extern uint8_t pbLinDiagBuffer[32];
   extern uint16_t g_linDiagDataLength_u16;
 
-  /* DID che normalmente sarebbe anche valido, ma qui forziamo il fallimento del handler */
   pbLinDiagBuffer[1] = 0xF3u;
   pbLinDiagBuffer[2] = 0x08u;
+  pbLinDiagBuffer[3] = 0xF1u;
 
-  g_linDiagDataLength_u16 = 5u;
+  g_linDiagDataLength_u16 = 4u; /* SID + 1 DID + mezzo DID */
 
-  /* NAD OK + MsgDataLength OK, ma handler fallisce */
-  checkCurrentNad_StubWithCallback(CurrentNad_Callback);
-  checkMsgDataLength_StubWithCallback(MsgDataLength_Callback);
+  /* Nessun handler deve essere chiamato */
   getHandlersForReadDataById_StubWithCallback(getHandlersForReadDataById_Fail_Callback);
+  LinDiagSendNegResponseSid_Expect(DIAG_SID_READ_DATA_BY_ID, kLinDiagNrcIncorrectMessageLength);
+
+  ApplLinDiagReadDataById();
 
-  LinDiagSendNegResponse_Expect(0);
+  TEST_ASSERT_EQUAL_UINT16(4u, g_linDiagDataLength_u16);
+}
+
+/* ============================================================================
+ * TEST 7: risposta totale oltre la capacita' del buffer -> responseTooLong
+ * ============================================================================ */
+void test_ApplLinDiagReadDataById_ResponseTooLong(void) {
+  extern uint8_t pbLinDiagBuffer[32];
+  extern uint16_t g_linDiagDataLength_u16;
+
+  /* 2 x (255 + 2) = 514 byte > 509 disponibili */
+  pbLinDiagBuffer[1] = 0xF1u;
+  pbLinDiagBuffer[2] = 0xA0u;
+  pbLinDiagBuffer[3] = 0xF1u;
+  pbLinDiagBuffer[4] = 0xA0u;
+
+  g_linDiagDataLength_u16 = 5u;
+
+  /* Controllo fatto prima di chiamare qualunque handler */
+  getHandlersForReadDataById_StubWithCallback(getHandlersForReadDataById_Fail_Callback);
+  LinDiagSendNegResponseSid_Expect(DIAG_SID_READ_DATA_BY_ID, kLinDiagNrcResponseTooLong);
 
-  /* Esecuzione */
   ApplLinDiagReadDataById();
 
-  /* Verifica: lunghezza invariata */
   TEST_ASSERT_EQUAL_UINT16(5u, g_linDiagDataLength_u16);
+  TEST_ASSERT_EQUAL_UINT16(0u, s_txReserved_u16);
+}
+
+/* ============================================================================
+ * TEST 8: risposta piu' lunga del buffer di richiesta -> inviata dalla ring
+ * ============================================================================ */
+void test_ApplLinDiagReadDataById_ResponseLongerThanRequestBuffer(void) {
+  extern uint8_t pbLinDiagBuffer[32];
+  extern uint16_t g_linDiagDataLength_u16;
+
+  /* 2 x (17 + 2) = 38 byte, oltre i 32 di pbLinDiagBuffer */
+  pbLinDiagBuffer[1] = 0xF1u;
+  pbLinDiagBuffer[2] = 0x90u;
+  pbLinDiagBuffer[3] = 0xF1u;
+  pbLinDiagBuffer[4] = 0x90u;
+
+  g_linDiagDataLength_u16 = 5u;
+
+  LinDiagSendPosResponse_Expect();
+
+  ApplLinDiagReadDataById();
+
+  TEST_ASSERT_EQUAL_UINT16(2u * (MOCK_DID_F190_SIZE + 2u), g_linDiagDataLength_u16);
+  TEST_ASSERT_EQUAL_UINT16((2u * (MOCK_DID_F190_SIZE + 2u)) + 1u, s_txReserved_u16);
+  TEST_ASSERT_EQUAL_HEX8(0xF1u, s_txArea_au8[20]);
+  TEST_ASSERT_EQUAL_HEX8(0x90u, s_txArea_au8[21]);
+  TEST_ASSERT_EQUAL_HEX8(0x90u, s_txArea_au8[38]);
+}
+
+/* ============================================================================
+ * TEST 9: ring LIN TP piena -> busyRepeatRequest, nessun handler chiamato
+ * ============================================================================ */
+void test_ApplLinDiagReadDataById_TxRingFull(void) {
+  extern uint8_t pbLinDiagBuffer[32];
+  extern uint16_t g_linDiagDataLength_u16;
+
+  pbLinDiagBuffer[1] = 0xF3u;
+  pbLinDiagBuffer[2] = 0x08u;
+
+  g_linDiagDataLength_u16 = 3u;
+
+  LinTp_TxReserve_StubWithCallback(LinTp_TxReserve_Full_Callback);
+  getHandlersForReadDataById_StubWithCallback(getHandlersForReadDataById_Fail_Callback);
+  LinDiagSendNegResponseSid_Expect(DIAG_SID_READ_DATA_BY_ID, kLinDiagNrcBusyRepeatRequest);
+
+  ApplLinDiagReadDataById();
+
+  TEST_ASSERT_EQUAL_UINT16(3u, g_linDiagDataLength_u16);
+}
+
+/* ============================================================================
+ * TEST 10: handler in attesa (E_PENDING) -> nessuna risposta, continua nel main
+ * ============================================================================ */
+void test_ApplLinDiagReadDataById_HandlerPending(void) {
+  extern uint8_t pbLinDiagBuffer[32];
+  extern uint16_t g_linDiagDataLength_u16;
+
+  pbLinDiagBuffer[1] = 0xF3u;
+  pbLinDiagBuffer[2] = 0x08u;
+
+  g_linDiagDataLength_u16 = 3u;
+
+  getHandlersForReadDataById_StubWithCallback(getHandlersForReadDataById_Pending_Callback);
+
+  /* Nessuna risposta positiva o negativa attesa: LinDiagMainFunction la inviera' */
+  ApplLinDiagReadDataById();
+
+  /* La risposta resta riservata nella ring con il DID gia' scritto */
+  TEST_ASSERT_EQUAL_UINT16(MOCK_DID_F308_SIZE + 3u, s_txReserved_u16);
+  TEST_ASSERT_EQUAL_HEX8(0x62u, s_txArea_au8[0]);
+  TEST_ASSERT_EQUAL_HEX8(0xF3u, s_txArea_au8[1]);
+  TEST_ASSERT_EQUAL_HEX8(0x08u, s_txArea_au8[2]);
+  TEST_ASSERT_EQUAL_UINT16(3u, g_linDiagDataLength_u16);
 }
@@ -0,0 +1,100 @@
+#include "diagnostic_priv.h"
+
+/* Global buffers normally provided by LIN stack */
+uint8_t pbLinDiagBuffer[32];
+/* Message length */
+uint16_t g_linDiagDataLength_u16 = 0;
+
+/* Reserve a positive response of len_u16 bytes (SID included) in the LIN TP ring and write its SID;
+ * g_linDiagDataLength_u16 is set to the bytes after the SID. NRC busyRepeatRequest if the ring is full. */
+static uint8_t *linDiagPosResponse(uint16_t len_u16) {
+  uint8_t *const l_resp_pu8 = LinTp_TxReserve(len_u16);
+
+  if(NULL == l_resp_pu8) {
+    LinDiagSendNegResponse(kLinDiagNrcBusyRepeatRequest);
+  } else {
+    l_resp_pu8[0] = (uint8_t)(pbLinDiagBuffer[0] + DIAG_POSITIVE_RESPONSE_OFFSET);
+    g_linDiagDataLength_u16 = (uint16_t)(len_u16 - 1u);
+  }
+
+  return l_resp_pu8;
+}
+
+/* ReadDataByPeriodicIdentifier schedule; the active entries are packed in [0, linDiagPdidCount_u8) */
+static LinDiagPdid_t linDiagPdid_ast[DIAG_CFG_PDID_MAX];
+static uint8_t linDiagPdidCount_u8 = 0u;
+
+/* Index of a scheduled periodic identifier, linDiagPdidCount_u8 if not scheduled */
+static uint8_t linDiagPdidFind(uint8_t pdid_u8) {
+  uint8_t l_idx_u8 = 0u;
+
+  while((l_idx_u8 < linDiagPdidCount_u8) && (pdid_u8 != linDiagPdid_ast[l_idx_u8].msg_au8[1])) { l_idx_u8++; }
+
+  return l_idx_u8;
+}
+
+/* FUNCTION TO TEST */
+void ApplLinDiagReadDataByPeriodicId(void) {
+  const uint8_t l_mode_cu8 = pbLinDiagBuffer[1];
+  const uint8_t l_pdidNum_cu8 = (uint8_t)(g_linDiagDataLength_u16 - 2u);
+  uint8_t l_errCode_u8 = 0u;
+  uint8_t l_new_u8 = 0u;
+  uint8_t l_size_u8 = 0u;
+  uint8_t l_pdid_u8;
+  uint8_t l_idx_u8;
+  uint8_t l_prev_u8;
+  uint8_t l_slot_u8;
+
+  if(DIAG_PDID_MODE_STOP == l_mode_cu8) {
+    /* No periodic identifier: stop all */
+    if(0u == l_pdidNum_cu8) { linDiagPdidCount_u8 = 0u; }
+    for(l_idx_u8 = 0u; l_idx_u8 < l_pdidNum_cu8; l_idx_u8++) {
+      l_slot_u8 = linDiagPdidFind(pbLinDiagBuffer[2u + l_idx_u8]);
+      if(l_slot_u8 < linDiagPdidCount_u8) {
+        linDiagPdidCount_u8--;
+        linDiagPdid_ast[l_slot_u8] = linDiagPdid_ast[linDiagPdidCount_u8];
+      }
+    }
+  } else if((l_mode_cu8 < DIAG_PDID_MODE_SLOW) || (l_mode_cu8 > DIAG_PDID_MODE_FAST)) {
+    l_errCode_u8 = kLinDiagNrcRequestOutOfRange;
+  } else if(0u == l_pdidNum_cu8) {
+    l_errCode_u8 = kLinDiagNrcIncorrectMessageLength;
+  } else {
+    /* Check the whole request before the schedule changes: readable DIDs that fit the sample
+     * buffer, and a free entry for every periodic identifier not yet scheduled */
+    for(l_idx_u8 = 0u; (0u == l_errCode_u8) && (l_idx_u8 < l_pdidNum_cu8); l_idx_u8++) {
+      l_pdid_u8 = pbLinDiagBuffer[2u + l_idx_u8];
+      if((E_OK != getDidReadSize((uint16_t)(DIAG_CFG_PDID_DID_BASE + l_pdid_u8), &l_size_u8)) || (l_size_u8 > DIAG_CFG_PDID_DATA_MAX)) {
+        l_errCode_u8 = kLinDiagNrcRequestOutOfRange;
+      } else if(linDiagPdidFind(l_pdid_u8) == linDiagPdidCount_u8) {
+        l_prev_u8 = 0u;
+        while((l_prev_u8 < l_idx_u8) && (l_pdid_u8 != pbLinDiagBuffer[2u + l_prev_u8])) { l_prev_u8++; }
+        if(l_prev_u8 == l_idx_u8) { l_new_u8++; }
+      } else {
+        /* Already scheduled: only its mode changes */
+      }
+    }
+    if((0u == l_errCode_u8) && ((uint8_t)(linDiagPdidCount_u8 + l_new_u8) > DIAG_CFG_PDID_MAX)) { l_errCode_u8 = kLinDiagNrcRequestOutOfRange; }
+    for(l_idx_u8 = 0u; (0u == l_errCode_u8) && (l_idx_u8 < l_pdidNum_cu8); l_idx_u8++) {
+      l_pdid_u8 = pbLinDiagBuffer[2u + l_idx_u8];
+      l_slot_u8 = linDiagPdidFind(l_pdid_u8);
+      if(l_slot_u8 == linDiagPdidCount_u8) {
+        linDiagPdidCount_u8++;
+        linDiagPdid_ast[l_slot_u8].msg_au8[0] = (uint8_t)(DIAG_SID_READ_DATA_BY_PERIODIC_ID + DIAG_POSITIVE_RESPONSE_OFFSET);
+        linDiagPdid_ast[l_slot_u8].msg_au8[1] = l_pdid_u8;
+        linDiagPdid_ast[l_slot_u8].len_u8 = 0u;
+      }
+      /* First sample on the next LinDiagMainFunction() call */
+      linDiagPdid_ast[l_slot_u8].mode_u8 = l_mode_cu8;
+      linDiagPdid_ast[l_slot_u8].timer_u16 = 0u;
+    }
+  }
+
+  if(0u != l_errCode_u8) {
+    LinDiagSendNegResponse(l_errCode_u8);
+  } else if(NULL != linDiagPosResponse(1u)) {
+    LinDiagSendPosResponse();
+  } else {
+    /* Ring full: busyRepeatRequest already sent */
+  }
+}
@@ -0,0 +1,24 @@
+#ifndef DIAGNOSTIC_CFG_H
+#define DIAGNOSTIC_CFG_H
+
+#include <stdint.h>
+
+typedef uint8_t uint8;
+typedef uint16_t uint16;
+typedef uint8_t Std_ReturnType;
+
+#define E_OK ((Std_ReturnType)0x00u)
+#define E_NOT_OK ((Std_ReturnType)0x01u)
+#define kLinDiagNrcRequestOutOfRange ((uint8)0x31u)
+#define kLinDiagNrcIncorrectMessageLength ((uint8)0x13u)
+#define kLinDiagNrcBusyRepeatRequest ((uint8)0x21u)
+
+/* 2 periodic identifiers of up to 4 bytes */
+#define DIAG_CFG_MAIN_PERIOD_MS 10u
+#define DIAG_CFG_PDID_MAX 2u
+#define DIAG_CFG_PDID_DATA_MAX 4u
+#define DIAG_CFG_PDID_DID_BASE 0xF200u
+
+Std_ReturnType getDidReadSize(uint16 did_u16, uint8 *size_pu8);
+
+#endif
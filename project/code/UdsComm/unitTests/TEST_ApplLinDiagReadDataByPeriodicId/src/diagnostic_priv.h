@@ -0,0 +1,29 @@
+#include "ApplLinDiagReadDataByPeriodicId.h"
+#include "diagnostic_cfg.h"
+#include "linTp.h"
+#include <stddef.h>
+
+#define DIAG_SID_READ_DATA_BY_PERIODIC_ID 0x2Au
+#define DIAG_POSITIVE_RESPONSE_OFFSET 0x40u
+
+/* ReadDataByPeriodicIdentifier (0x2A) transmission modes; request: SID, mode, periodic identifier#1 .. #n.
+ * Periodic response in the LIN TP ring: 0x6A, periodic identifier, data */
+#define DIAG_PDID_MODE_SLOW 0x01u
+#define DIAG_PDID_MODE_MEDIUM 0x02u
+#define DIAG_PDID_MODE_FAST 0x03u
+#define DIAG_PDID_MODE_STOP 0x04u
+#define DIAG_PDID_MSG_CAPACITY (2u + DIAG_CFG_PDID_DATA_MAX)
+
+/* One scheduled periodic identifier */
+typedef struct {
+  uint8_t mode_u8;                          /* DIAG_PDID_MODE_SLOW/MEDIUM/FAST */
+  uint8_t len_u8;                           /* Bytes of msg_au8 waiting for the ring, 0 = none */
+  uint16_t timer_u16;                       /* Ticks left before the next sample, 0 = due */
+  uint8_t msg_au8[DIAG_PDID_MSG_CAPACITY];  /* Serialized periodic response: 0x6A, periodic identifier, data */
+} LinDiagPdid_t;
+
+/* Send positive response */
+void LinDiagSendPosResponse(void);
+
+/* Send negative response with error code */
+void LinDiagSendNegResponse(uint8_t errorCode);
@@ -0,0 +1,8 @@
+#ifndef LINTP_H
+#define LINTP_H
+
+#include <stdint.h>
+
+uint8_t *LinTp_TxReserve(uint16_t len_u16);
+
+#endif
@@ -0,0 +1,168 @@
+#include "ApplLinDiagReadDataByPeriodicId.h"
+#include "mock_diagnostic_cfg.h"
+#include "mock_diagnostic_priv.h"
+#include "mock_linTp.h"
+#include "unity.h"
+#include <string.h>
+
+/* Response area returned by LinTp_TxReserve */
+static uint8_t s_txArea_au8[8];
+static uint16_t s_txReserved_u16;
+
+/* Last DID asked to getDidReadSize */
+static uint16 s_sizeDid_u16;
+
+/* Periodic DIDs 0xF201..0xF204 take 2 bytes, 0xF205 takes 5; other DIDs are not readable */
+static Std_ReturnType getDidReadSize_Callback(uint16 did_u16, uint8 *size_pu8, int cmock_num_calls) {
+  Std_ReturnType l_result_ = E_OK;
+  (void)cmock_num_calls;
+
+  s_sizeDid_u16 = did_u16;
+  if((did_u16 >= 0xF201) && (did_u16 <= 0xF204)) {
+    *size_pu8 = 2u;
+  } else if(0xF205 == did_u16) {
+    *size_pu8 = 5u;
+  } else {
+    l_result_ = E_NOT_OK;
+  }
+
+  return l_result_;
+}
+
+static uint8_t *LinTp_TxReserve_Callback(uint16_t len_u16, int cmock_num_calls) {
+  (void)cmock_num_calls;
+  s_txReserved_u16 = len_u16;
+
+  return s_txArea_au8;
+}
+
+static uint8_t *LinTp_TxReserve_Full_Callback(uint16_t len_u16, int cmock_num_calls) {
+  (void)len_u16;
+  (void)cmock_num_calls;
+
+  return NULL; /* ring full */
+}
+
+/* Request 0x2A: mode followed by up to 3 periodic identifiers */
+static void request(uint8_t mode, uint8_t pdidNum, uint8_t pdid1, uint8_t pdid2, uint8_t pdid3) {
+  pbLinDiagBuffer[0] = 0x2Au;
+  pbLinDiagBuffer[1] = mode;
+  pbLinDiagBuffer[2] = pdid1;
+  pbLinDiagBuffer[3] = pdid2;
+  pbLinDiagBuffer[4] = pdid3;
+  g_linDiagDataLength_u16 = (uint16_t)(2u + pdidNum);
+  ApplLinDiagReadDataByPeriodicId();
+}
+
+void setUp(void) {
+  getDidReadSize_StubWithCallback(getDidReadSize_Callback);
+  LinTp_TxReserve_StubWithCallback(LinTp_TxReserve_Callback);
+
+  memset(pbLinDiagBuffer, 0, sizeof(pbLinDiagBuffer));
+
+  /* Empty schedule */
+  LinDiagSendPosResponse_Expect();
+  request(DIAG_PDID_MODE_STOP, 0u, 0u, 0u, 0u);
+
+  memset(s_txArea_au8, 0, sizeof(s_txArea_au8));
+  s_txReserved_u16 = 0u;
+  s_sizeDid_u16 = 0u;
+}
+
+void tearDown(void) {}
+
+/* Test: fast rate for one identifier -> DID 0xF2xx checked, response 6A */
+void test_ApplLinDiagReadDataByPeriodicId_Schedule(void) {
+  LinDiagSendPosResponse_Expect();
+
+  request(DIAG_PDID_MODE_FAST, 1u, 0x01u, 0u, 0u);
+
+  TEST_ASSERT_EQUAL_HEX16(0xF201, s_sizeDid_u16);
+  TEST_ASSERT_EQUAL_UINT16(1u, s_txReserved_u16);
+  TEST_ASSERT_EQUAL_HEX8(0x6Au, s_txArea_au8[0]);
+  TEST_ASSERT_EQUAL_UINT16(0u, g_linDiagDataLength_u16);
+}
+
+/* Test: transmission modes outside 0x01..0x04 -> requestOutOfRange */
+void test_ApplLinDiagReadDataByPeriodicId_ModeOutOfRange(void) {
+  LinDiagSendNegResponse_Expect(kLinDiagNrcRequestOutOfRange);
+  request(0x00u, 1u, 0x01u, 0u, 0u);
+
+  LinDiagSendNegResponse_Expect(kLinDiagNrcRequestOutOfRange);
+  request(0x05u, 1u, 0x01u, 0u, 0u);
+}
+
+/* Test: rate without periodic identifier -> incorrectMessageLength */
+void test_ApplLinDiagReadDataByPeriodicId_NoIdentifier(void) {
+  LinDiagSendNegResponse_Expect(kLinDiagNrcIncorrectMessageLength);
+
+  request(DIAG_PDID_MODE_SLOW, 0u, 0u, 0u, 0u);
+}
+
+/* Test: DID not readable or longer than DIAG_CFG_PDID_DATA_MAX -> requestOutOfRange */
+void test_ApplLinDiagReadDataByPeriodicId_DidNotUsable(void) {
+  LinDiagSendNegResponse_Expect(kLinDiagNrcRequestOutOfRange);
+  request(DIAG_PDID_MODE_FAST, 1u, 0x09u, 0u, 0u);
+
+  LinDiagSendNegResponse_Expect(kLinDiagNrcRequestOutOfRange);
+  request(DIAG_PDID_MODE_FAST, 1u, 0x05u, 0u, 0u);
+}
+
+/* Test: more identifiers than DIAG_CFG_PDID_MAX -> requestOutOfRange */
+void test_ApplLinDiagReadDataByPeriodicId_ScheduleFull(void) {
+  LinDiagSendNegResponse_Expect(kLinDiagNrcRequestOutOfRange);
+  request(DIAG_PDID_MODE_FAST, 3u, 0x01u, 0x02u, 0x03u);
+
+  LinDiagSendPosResponse_Expect();
+  request(DIAG_PDID_MODE_FAST, 2u, 0x01u, 0x02u, 0x03u);
+  LinDiagSendNegResponse_Expect(kLinDiagNrcRequestOutOfRange);
+  request(DIAG_PDID_MODE_FAST, 1u, 0x03u, 0u, 0u);
+}
+
+/* Test: a rejected request leaves the schedule unchanged */
+void test_ApplLinDiagReadDataByPeriodicId_RejectedRequestNotApplied(void) {
+  LinDiagSendNegResponse_Expect(kLinDiagNrcRequestOutOfRange);
+  request(DIAG_PDID_MODE_FAST, 2u, 0x01u, 0x09u, 0u);
+
+  /* 0x01 was not scheduled: both entries are still free */
+  LinDiagSendPosResponse_Expect();
+  request(DIAG_PDID_MODE_FAST, 2u, 0x02u, 0x03u, 0u);
+}
+
+/* Test: an identifier repeated or already scheduled takes no further entry */
+void test_ApplLinDiagReadDataByPeriodicId_NoDuplicateEntries(void) {
+  LinDiagSendPosResponse_Expect();
+  request(DIAG_PDID_MODE_FAST, 2u, 0x01u, 0x01u, 0u);
+
+  LinDiagSendPosResponse_Expect();
+  request(DIAG_PDID_MODE_SLOW, 2u, 0x01u, 0x02u, 0u);
+
+  /* New mode for both scheduled identifiers */
+  LinDiagSendPosResponse_Expect();
+  request(DIAG_PDID_MODE_MEDIUM, 2u, 0x02u, 0x01u, 0u);
+
+  LinDiagSendNegResponse_Expect(kLinDiagNrcRequestOutOfRange);
+  request(DIAG_PDID_MODE_MEDIUM, 1u, 0x03u, 0u, 0u);
+}
+
+/* Test: stopSending a listed identifier frees its entry; identifiers not scheduled are ignored */
+void test_ApplLinDiagReadDataByPeriodicId_StopListed(void) {
+  LinDiagSendPosResponse_Expect();
+  request(DIAG_PDID_MODE_FAST, 2u, 0x01u, 0x02u, 0u);
+
+  LinDiagSendPosResponse_Expect();
+  request(DIAG_PDID_MODE_STOP, 2u, 0x01u, 0x07u, 0u);
+
+  LinDiagSendPosResponse_Expect();
+  request(DIAG_PDID_MODE_FAST, 1u, 0x03u, 0u, 0u);
+  LinDiagSendNegResponse_Expect(kLinDiagNrcRequestOutOfRange);
+  request(DIAG_PDID_MODE_FAST, 1u, 0x04u, 0u, 0u);
+}
+
+/* Test: LIN TP ring full -> busyRepeatRequest */
+void test_ApplLinDiagReadDataByPeriodicId_RingFull(void) {
+  LinTp_TxReserve_StubWithCallback(LinTp_TxReserve_Full_Callback);
+  LinDiagSendNegResponse_Expect(kLinDiagNrcBusyRepeatRequest);
+
+  request(DIAG_PDID_MODE_FAST, 1u, 0x01u, 0u, 0u);
+}
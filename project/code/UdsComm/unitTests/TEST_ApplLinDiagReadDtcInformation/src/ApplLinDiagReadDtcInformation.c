@@ -0,0 +1,75 @@
+#include "diagnostic_priv.h"
+
+/* Global buffers normally provided by LIN stack */
+uint8_t pbLinDiagBuffer[32];
+/* Message length */
+uint16_t g_linDiagDataLength_u16 = 0;
+
+/* Reserve a positive response of len_u16 bytes (SID included) in the LIN TP ring and write its SID;
+ * g_linDiagDataLength_u16 is set to the bytes after the SID. NRC busyRepeatRequest if the ring is full. */
+static uint8_t *linDiagPosResponse(uint16_t len_u16) {
+  uint8_t *const l_resp_pu8 = LinTp_TxReserve(len_u16);
+
+  if(NULL == l_resp_pu8) {
+    LinDiagSendNegResponse(kLinDiagNrcBusyRepeatRequest);
+  } else {
+    l_resp_pu8[0] = (uint8_t)(pbLinDiagBuffer[0] + DIAG_POSITIVE_RESPONSE_OFFSET);
+    g_linDiagDataLength_u16 = (uint16_t)(len_u16 - 1u);
+  }
+
+  return l_resp_pu8;
+}
+
+/* FUNCTION TO TEST */
+void ApplLinDiagReadDtcInformation(void) {
+  const uint8_t l_subFunction_cu8 = pbLinDiagBuffer[1];
+  const uint8_t l_mask_cu8 = (uint8_t)(pbLinDiagBuffer[2] & DIAG_CFG_DTC_STATUS_AVAILABILITY_MASK);
+  const uint16_t l_dtcCount_cu16 = getDtcCount();
+  uint16_t l_matches_u16 = 0u;
+  uint16_t l_pos_u16 = 3u;
+  uint16_t l_idx_u16;
+  uint32 l_dtc_u32;
+  uint8 l_status_u8;
+  uint8_t *l_resp_pu8;
+
+  if((DIAG_RDTCI_NUMBER_BY_STATUS_MASK != l_subFunction_cu8) && (DIAG_RDTCI_DTC_BY_STATUS_MASK != l_subFunction_cu8)) {
+    LinDiagSendNegResponse(kLinDiagNrcSubFunctionNotSupported);
+  } else if(3u != g_linDiagDataLength_u16) {
+    LinDiagSendNegResponse(kLinDiagNrcIncorrectMessageLength);
+  } else {
+    for(l_idx_u16 = 0u; l_idx_u16 < l_dtcCount_cu16; l_idx_u16++) {
+      if((E_OK == getDtcByIndex(l_idx_u16, &l_dtc_u32, &l_status_u8)) && (0u != (l_status_u8 & l_mask_cu8))) { l_matches_u16++; }
+    }
+    if(DIAG_RDTCI_NUMBER_BY_STATUS_MASK == l_subFunction_cu8) {
+      /* Response: 0x59, 0x01, availability mask, format, count (2 bytes) */
+      l_resp_pu8 = linDiagPosResponse(6u);
+      if(NULL != l_resp_pu8) {
+        l_resp_pu8[1] = l_subFunction_cu8;
+        l_resp_pu8[2] = DIAG_CFG_DTC_STATUS_AVAILABILITY_MASK;
+        l_resp_pu8[3] = DIAG_RDTCI_FORMAT_ISO14229_1;
+        l_resp_pu8[4] = (uint8_t)(l_matches_u16 >> 8);
+        l_resp_pu8[5] = (uint8_t)(l_matches_u16 & 0xFFu);
+        LinDiagSendPosResponse();
+      }
+    } else if(((uint32)l_matches_u16 * 4u) > (uint32)(LINTP_TX_MAX_MSG_LEN - 3u)) {
+      LinDiagSendNegResponse(kLinDiagNrcResponseTooLong);
+    } else {
+      /* Response: 0x59, 0x02, availability mask, then DTC (3 bytes) + status per matching DTC */
+      l_resp_pu8 = linDiagPosResponse((uint16_t)(3u + (4u * l_matches_u16)));
+      if(NULL != l_resp_pu8) {
+        l_resp_pu8[1] = l_subFunction_cu8;
+        l_resp_pu8[2] = DIAG_CFG_DTC_STATUS_AVAILABILITY_MASK;
+        for(l_idx_u16 = 0u; l_idx_u16 < l_dtcCount_cu16; l_idx_u16++) {
+          if((E_OK == getDtcByIndex(l_idx_u16, &l_dtc_u32, &l_status_u8)) && (0u != (l_status_u8 & l_mask_cu8))) {
+            l_resp_pu8[l_pos_u16] = (uint8_t)(l_dtc_u32 >> 16);
+            l_resp_pu8[l_pos_u16 + 1u] = (uint8_t)(l_dtc_u32 >> 8);
+            l_resp_pu8[l_pos_u16 + 2u] = (uint8_t)(l_dtc_u32 & 0xFFu);
+            l_resp_pu8[l_pos_u16 + 3u] = (uint8_t)(l_status_u8 & DIAG_CFG_DTC_STATUS_AVAILABILITY_MASK);
+            l_pos_u16 += 4u;
+          }
+        }
+        LinDiagSendPosResponse();
+      }
+    }
+  }
+}
@@ -0,0 +1,25 @@
+#ifndef DIAGNOSTIC_CFG_H
+#define DIAGNOSTIC_CFG_H
+
+#include <stdint.h>
+
+typedef uint8_t uint8;
+typedef uint16_t uint16;
+typedef uint32_t uint32;
+typedef uint8_t Std_ReturnType;
+
+#define E_OK ((Std_ReturnType)0x00u)
+#define E_NOT_OK ((Std_ReturnType)0x01u)
+#define kLinDiagNrcIncorrectMessageLength ((uint8)0x13u)
+#define kLinDiagNrcResponseTooLong ((uint8)0x14u)
+#define kLinDiagNrcBusyRepeatRequest ((uint8)0x21u)
+#define kLinDiagNrcSubFunctionNotSupported ((uint8)0x12u)
+
+/* testFailed | confirmedDTC */
+#define DIAG_CFG_DTC_STATUS_AVAILABILITY_MASK 0x09u
+
+uint16 getDtcCount(void);
+
+Std_ReturnType getDtcByIndex(uint16 index_u16, uint32 *dtc_pu32, uint8 *status_pu8);
+
+#endif
@@ -0,0 +1,17 @@
+#include "ApplLinDiagReadDtcInformation.h"
+#include "diagnostic_cfg.h"
+#include "linTp.h"
+#include <stddef.h>
+
+#define DIAG_POSITIVE_RESPONSE_OFFSET 0x40u
+
+/* ReadDTCInformation (0x19) sub-functions and DTC format identifier */
+#define DIAG_RDTCI_NUMBER_BY_STATUS_MASK 0x01u
+#define DIAG_RDTCI_DTC_BY_STATUS_MASK 0x02u
+#define DIAG_RDTCI_FORMAT_ISO14229_1 0x01u
+
+/* Send positive response */
+void LinDiagSendPosResponse(void);
+
+/* Send negative response with error code */
+void LinDiagSendNegResponse(uint8_t errorCode);
@@ -0,0 +1,132 @@
+#include "ApplLinDiagReadDtcInformation.h"
+#include "mock_diagnostic_cfg.h"
+#include "mock_diagnostic_priv.h"
+#include "mock_linTp.h"
+#include "unity.h"
+#include <string.h>
+
+/* Response area returned by LinTp_TxReserve */
+static uint8_t s_txArea_au8[LINTP_TX_MAX_MSG_LEN];
+static uint16_t s_txReserved_u16;
+
+/* Fault memory seen through getDtcByIndex(); status 0x40 is outside the availability mask */
+static const uint32 s_dtc_cau32[] = {0x901217u, 0xC07300u, 0x123456u};
+static const uint8 s_status_cau8[] = {0x09u, 0x08u, 0x40u};
+static uint16 s_dtcCount_u16;
+
+static uint16 getDtcCount_Callback(int cmock_num_calls) {
+  (void)cmock_num_calls;
+
+  return s_dtcCount_u16;
+}
+
+/* Indexes beyond the table repeat a confirmed DTC (large fault memory) */
+static Std_ReturnType getDtcByIndex_Callback(uint16 index_u16, uint32 *dtc_pu32, uint8 *status_pu8, int cmock_num_calls) {
+  (void)cmock_num_calls;
+
+  if(index_u16 < (uint16)(sizeof(s_dtc_cau32) / sizeof(s_dtc_cau32[0]))) {
+    *dtc_pu32 = s_dtc_cau32[index_u16];
+    *status_pu8 = s_status_cau8[index_u16];
+  } else {
+    *dtc_pu32 = 0x010000u + index_u16;
+    *status_pu8 = 0x08u;
+  }
+
+  return E_OK;
+}
+
+static uint8_t *LinTp_TxReserve_Callback(uint16_t len_u16, int cmock_num_calls) {
+  (void)cmock_num_calls;
+  s_txReserved_u16 = len_u16;
+
+  return s_txArea_au8;
+}
+
+void setUp(void) {
+  getDtcCount_StubWithCallback(getDtcCount_Callback);
+  getDtcByIndex_StubWithCallback(getDtcByIndex_Callback);
+  LinTp_TxReserve_StubWithCallback(LinTp_TxReserve_Callback);
+
+  memset(pbLinDiagBuffer, 0, sizeof(pbLinDiagBuffer));
+  memset(s_txArea_au8, 0, sizeof(s_txArea_au8));
+  s_txReserved_u16 = 0u;
+  s_dtcCount_u16 = 3u;
+
+  pbLinDiagBuffer[0] = 0x19u;
+  g_linDiagDataLength_u16 = 3u;
+}
+
+void tearDown(void) {}
+
+/* Test: reportNumberOfDTCByStatusMask, confirmedDTC -> 59 01 09 01 00 02 */
+void test_ApplLinDiagReadDtcInformation_NumberByStatusMask(void) {
+  static const uint8_t expected[] = {0x59u, 0x01u, 0x09u, 0x01u, 0x00u, 0x02u};
+
+  pbLinDiagBuffer[1] = 0x01u;
+  pbLinDiagBuffer[2] = 0x08u;
+  LinDiagSendPosResponse_Expect();
+
+  ApplLinDiagReadDtcInformation();
+
+  TEST_ASSERT_EQUAL_UINT16(sizeof(expected), s_txReserved_u16);
+  TEST_ASSERT_EQUAL_HEX8_ARRAY(expected, s_txArea_au8, sizeof(expected));
+  TEST_ASSERT_EQUAL_UINT16(sizeof(expected) - 1u, g_linDiagDataLength_u16);
+}
+
+/* Test: reportDTCByStatusMask, testFailed -> only the first DTC */
+void test_ApplLinDiagReadDtcInformation_DtcByStatusMask(void) {
+  static const uint8_t expected[] = {0x59u, 0x02u, 0x09u, 0x90u, 0x12u, 0x17u, 0x09u};
+
+  pbLinDiagBuffer[1] = 0x02u;
+  pbLinDiagBuffer[2] = 0x01u;
+  LinDiagSendPosResponse_Expect();
+
+  ApplLinDiagReadDtcInformation();
+
+  TEST_ASSERT_EQUAL_UINT16(sizeof(expected), s_txReserved_u16);
+  TEST_ASSERT_EQUAL_HEX8_ARRAY(expected, s_txArea_au8, sizeof(expected));
+  TEST_ASSERT_EQUAL_UINT16(sizeof(expected) - 1u, g_linDiagDataLength_u16);
+}
+
+/* Test: mask bits outside the availability mask match nothing -> header only */
+void test_ApplLinDiagReadDtcInformation_UnsupportedMaskBits(void) {
+  static const uint8_t expected[] = {0x59u, 0x02u, 0x09u};
+
+  pbLinDiagBuffer[1] = 0x02u;
+  pbLinDiagBuffer[2] = 0x40u;
+  LinDiagSendPosResponse_Expect();
+
+  ApplLinDiagReadDtcInformation();
+
+  TEST_ASSERT_EQUAL_UINT16(sizeof(expected), s_txReserved_u16);
+  TEST_ASSERT_EQUAL_HEX8_ARRAY(expected, s_txArea_au8, sizeof(expected));
+}
+
+/* Test: matching DTCs do not fit the LIN TP ring -> responseTooLong */
+void test_ApplLinDiagReadDtcInformation_ResponseTooLong(void) {
+  s_dtcCount_u16 = 130u;
+  pbLinDiagBuffer[1] = 0x02u;
+  pbLinDiagBuffer[2] = 0x08u;
+  LinDiagSendNegResponse_Expect(kLinDiagNrcResponseTooLong);
+
+  ApplLinDiagReadDtcInformation();
+
+  TEST_ASSERT_EQUAL_UINT16(0u, s_txReserved_u16);
+}
+
+/* Test: unsupported sub-function -> subFunctionNotSupported */
+void test_ApplLinDiagReadDtcInformation_SubFunctionNotSupported(void) {
+  pbLinDiagBuffer[1] = 0x0Au;
+  LinDiagSendNegResponse_Expect(kLinDiagNrcSubFunctionNotSupported);
+
+  ApplLinDiagReadDtcInformation();
+}
+
+/* Test: status mask missing -> incorrectMessageLength */
+void test_ApplLinDiagReadDtcInformation_WrongLength(void) {
+  pbLinDiagBuffer[1] = 0x01u;
+  g_linDiagDataLength_u16 = 2u;
+  LinDiagSendNegResponse_Expect(kLinDiagNrcIncorrectMessageLength);
+
+  ApplLinDiagReadDtcInformation();
+}
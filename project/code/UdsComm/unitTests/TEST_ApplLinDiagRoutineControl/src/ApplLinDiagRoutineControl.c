@@ -0,0 +1,52 @@
+#include "diagnostic_priv.h"
+
+/* Global buffers normally provided by LIN stack */
+uint8_t pbLinDiagBuffer[32];
+/* Message length */
+uint16_t g_linDiagDataLength_u16 = 0;
+
+/* Reserve a positive response of len_u16 bytes (SID included) in the LIN TP ring and write its SID;
+ * g_linDiagDataLength_u16 is set to the bytes after the SID. NRC busyRepeatRequest if the ring is full. */
+static uint8_t *linDiagPosResponse(uint16_t len_u16) {
+  uint8_t *const l_resp_pu8 = LinTp_TxReserve(len_u16);
+
+  if(NULL == l_resp_pu8) {
+    LinDiagSendNegResponse(kLinDiagNrcBusyRepeatRequest);
+  } else {
+    l_resp_pu8[0] = (uint8_t)(pbLinDiagBuffer[0] + DIAG_POSITIVE_RESPONSE_OFFSET);
+    g_linDiagDataLength_u16 = (uint16_t)(len_u16 - 1u);
+  }
+
+  return l_resp_pu8;
+}
+
+/* FUNCTION TO TEST */
+void ApplLinDiagRoutineControl(void) {
+  const uint8_t l_subFunction_cu8 = (uint8_t)(pbLinDiagBuffer[1] & (uint8_t)~DIAG_SUPPRESS_POS_RSP);
+  const uint16_t l_rid_cu16 = (uint16_t)((uint16_t)pbLinDiagBuffer[2] << 8) | (uint16_t)pbLinDiagBuffer[3];
+  /* Taken before linDiagPosResponse() sets g_linDiagDataLength_u16 to the response length */
+  const uint8_t l_optionLen_cu8 = (uint8_t)(g_linDiagDataLength_u16 - 4u);
+  uint8_t l_errCode_u8 = 0u;
+  uint8_t l_statusLen_u8 = DIAG_RC_STATUS_CAPACITY;
+  uint8_t *l_resp_pu8;
+
+  if((l_subFunction_cu8 < DIAG_RC_START) || (l_subFunction_cu8 > DIAG_RC_RESULTS)) {
+    LinDiagSendNegResponse(kLinDiagNrcSubFunctionNotSupported);
+  } else {
+    /* The routine writes its status record straight into the response: 0x71, sub-function, RID, status */
+    l_resp_pu8 = linDiagPosResponse((uint16_t)(4u + DIAG_RC_STATUS_CAPACITY));
+    if(NULL != l_resp_pu8) {
+      if(E_OK != getHandlersForRoutineControl(&l_errCode_u8, l_subFunction_cu8, l_rid_cu16, &pbLinDiagBuffer[4], l_optionLen_cu8, &l_resp_pu8[4], &l_statusLen_u8)) {
+        LinDiagSendNegResponse(l_errCode_u8);
+      } else if(0u == (pbLinDiagBuffer[1] & DIAG_SUPPRESS_POS_RSP)) {
+        l_resp_pu8[1] = l_subFunction_cu8;
+        l_resp_pu8[2] = pbLinDiagBuffer[2];
+        l_resp_pu8[3] = pbLinDiagBuffer[3];
+        g_linDiagDataLength_u16 = (uint16_t)(3u + l_statusLen_u8);
+        LinDiagSendPosResponse();
+      } else {
+        /* Positive response suppressed: the reservation is dropped by the next LinTp_TxReserve() */
+      }
+    }
+  }
+}
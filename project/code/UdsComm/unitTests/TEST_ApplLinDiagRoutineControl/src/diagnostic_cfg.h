@@ -0,0 +1,19 @@
+#ifndef DIAGNOSTIC_CFG_H
+#define DIAGNOSTIC_CFG_H
+
+#include <stdint.h>
+
+typedef uint8_t uint8;
+typedef uint16_t uint16;
+typedef uint8_t Std_ReturnType;
+
+#define E_OK ((Std_ReturnType)0x00u)
+#define E_NOT_OK ((Std_ReturnType)0x01u)
+#define kLinDiagNrcRequestOutOfRange ((uint8)0x31u)
+#define kLinDiagNrcIncorrectMessageLength ((uint8)0x13u)
+#define kLinDiagNrcBusyRepeatRequest ((uint8)0x21u)
+#define kLinDiagNrcSubFunctionNotSupported ((uint8)0x12u)
+
+Std_ReturnType getHandlersForRoutineControl(uint8 *errCode_pu8, uint8 subFunction_u8, uint16 rid_u16, const uint8 *option_pu8, uint8 optionLen_u8, uint8 *status_pu8, uint8 *statusLen_pu8);
+
+#endif
@@ -0,0 +1,21 @@
+#include "ApplLinDiagRoutineControl.h"
+#include "diagnostic_cfg.h"
+#include "linTp.h"
+#include <stddef.h>
+
+#define DIAG_POSITIVE_RESPONSE_OFFSET 0x40u
+
+/* suppressPosRspMsgIndicationBit of a sub-function byte */
+#define DIAG_SUPPRESS_POS_RSP 0x80u
+
+/* RoutineControl (0x31) sub-functions; request: SID, sub-function, RID (2 bytes), option record */
+#define DIAG_RC_START 0x01u
+#define DIAG_RC_STOP 0x02u
+#define DIAG_RC_RESULTS 0x03u
+#define DIAG_RC_STATUS_CAPACITY ((uint8_t)(sizeof(pbLinDiagBuffer) - 4u))
+
+/* Send positive response */
+void LinDiagSendPosResponse(void);
+
+/* Send negative response with error code */
+void LinDiagSendNegResponse(uint8_t errorCode);
@@ -0,0 +1,183 @@
+#include "ApplLinDiagRoutineControl.h"
+#include "mock_diagnostic_cfg.h"
+#include "mock_diagnostic_priv.h"
+#include "mock_linTp.h"
+#include "unity.h"
+#include <string.h>
+
+/* Response area returned by LinTp_TxReserve */
+static uint8_t s_txArea_au8[32];
+static uint16_t s_txReserved_u16;
+
+/* Arguments seen by the routine dispatcher */
+static uint8 s_rcSubFunction_u8;
+static uint16 s_rcRid_u16;
+static const uint8 *s_rcOption_pu8;
+static uint8 s_rcOptionLen_u8;
+static uint8 s_rcStatusCapacity_u8;
+
+/* Routine 0x0203 takes a 1-byte option record and answers a 2-byte status record; other RIDs are unknown */
+static Std_ReturnType getHandlersForRoutineControl_Callback(uint8 *errCode_pu8, uint8 subFunction_u8, uint16 rid_u16, const uint8 *option_pu8, uint8 optionLen_u8, uint8 *status_pu8,
+                                                            uint8 *statusLen_pu8, int cmock_num_calls) {
+  Std_ReturnType l_result_ = E_OK;
+  (void)cmock_num_calls;
+
+  s_rcSubFunction_u8 = subFunction_u8;
+  s_rcRid_u16 = rid_u16;
+  s_rcOption_pu8 = option_pu8;
+  s_rcOptionLen_u8 = optionLen_u8;
+  s_rcStatusCapacity_u8 = *statusLen_pu8;
+  if(0x0203 != rid_u16) {
+    *errCode_pu8 = kLinDiagNrcRequestOutOfRange;
+    l_result_ = E_NOT_OK;
+  } else if(1u != optionLen_u8) {
+    *errCode_pu8 = kLinDiagNrcIncorrectMessageLength;
+    l_result_ = E_NOT_OK;
+  } else {
+    status_pu8[0] = 0xA5u;
+    status_pu8[1] = option_pu8[0];
+    *statusLen_pu8 = 2u;
+  }
+
+  return l_result_;
+}
+
+static uint8_t *LinTp_TxReserve_Callback(uint16_t len_u16, int cmock_num_calls) {
+  (void)cmock_num_calls;
+  s_txReserved_u16 = len_u16;
+
+  return s_txArea_au8;
+}
+
+static uint8_t *LinTp_TxReserve_Full_Callback(uint16_t len_u16, int cmock_num_calls) {
+  (void)len_u16;
+  (void)cmock_num_calls;
+
+  return NULL; /* ring full */
+}
+
+void setUp(void) {
+  getHandlersForRoutineControl_StubWithCallback(getHandlersForRoutineControl_Callback);
+  LinTp_TxReserve_StubWithCallback(LinTp_TxReserve_Callback);
+
+  memset(pbLinDiagBuffer, 0, sizeof(pbLinDiagBuffer));
+  memset(s_txArea_au8, 0, sizeof(s_txArea_au8));
+  s_txReserved_u16 = 0u;
+  s_rcSubFunction_u8 = 0u;
+  s_rcRid_u16 = 0u;
+  s_rcOption_pu8 = NULL;
+  s_rcOptionLen_u8 = 0u;
+  s_rcStatusCapacity_u8 = 0u;
+
+  /* 31 01 02 03 5A: startRoutine 0x0203, option 0x5A */
+  pbLinDiagBuffer[0] = 0x31u;
+  pbLinDiagBuffer[1] = 0x01u;
+  pbLinDiagBuffer[2] = 0x02u;
+  pbLinDiagBuffer[3] = 0x03u;
+  pbLinDiagBuffer[4] = 0x5Au;
+  g_linDiagDataLength_u16 = 5u;
+}
+
+void tearDown(void) {}
+
+/* Test: startRoutine -> option record passed to the routine, response 71 01 02 03 + status */
+void test_ApplLinDiagRoutineControl_StartRoutine(void) {
+  static const uint8_t expected[] = {0x71u, 0x01u, 0x02u, 0x03u, 0xA5u, 0x5Au};
+
+  LinDiagSendPosResponse_Expect();
+
+  ApplLinDiagRoutineControl();
+
+  TEST_ASSERT_EQUAL_HEX8(0x01u, s_rcSubFunction_u8);
+  TEST_ASSERT_EQUAL_HEX16(0x0203, s_rcRid_u16);
+  TEST_ASSERT_EQUAL_PTR(&pbLinDiagBuffer[4], s_rcOption_pu8);
+  TEST_ASSERT_EQUAL_UINT8(1u, s_rcOptionLen_u8);
+  TEST_ASSERT_EQUAL_UINT8(sizeof(pbLinDiagBuffer) - 4u, s_rcStatusCapacity_u8);
+  TEST_ASSERT_EQUAL_UINT16(4u + (sizeof(pbLinDiagBuffer) - 4u), s_txReserved_u16);
+  TEST_ASSERT_EQUAL_HEX8_ARRAY(expected, s_txArea_au8, sizeof(expected));
+  TEST_ASSERT_EQUAL_UINT16(sizeof(expected) - 1u, g_linDiagDataLength_u16);
+}
+
+/* Test: requestRoutineResults is the highest supported sub-function */
+void test_ApplLinDiagRoutineControl_RequestResults(void) {
+  pbLinDiagBuffer[1] = 0x03u;
+  LinDiagSendPosResponse_Expect();
+
+  ApplLinDiagRoutineControl();
+
+  TEST_ASSERT_EQUAL_HEX8(0x03u, s_rcSubFunction_u8);
+  TEST_ASSERT_EQUAL_HEX8(0x03u, s_txArea_au8[1]);
+}
+
+/* Test: sub-function 0x00 -> subFunctionNotSupported, routine not called */
+void test_ApplLinDiagRoutineControl_SubFunctionZero(void) {
+  pbLinDiagBuffer[1] = 0x00u;
+  LinDiagSendNegResponse_Expect(kLinDiagNrcSubFunctionNotSupported);
+
+  ApplLinDiagRoutineControl();
+
+  TEST_ASSERT_EQUAL_UINT16(0u, s_txReserved_u16);
+  TEST_ASSERT_EQUAL_HEX16(0u, s_rcRid_u16);
+}
+
+/* Test: sub-function 0x04 -> subFunctionNotSupported, also with suppressPosRsp set */
+void test_ApplLinDiagRoutineControl_SubFunctionAboveRange(void) {
+  pbLinDiagBuffer[1] = 0x04u;
+  LinDiagSendNegResponse_Expect(kLinDiagNrcSubFunctionNotSupported);
+  ApplLinDiagRoutineControl();
+
+  pbLinDiagBuffer[1] = 0x84u;
+  LinDiagSendNegResponse_Expect(kLinDiagNrcSubFunctionNotSupported);
+  ApplLinDiagRoutineControl();
+
+  TEST_ASSERT_EQUAL_UINT16(0u, s_txReserved_u16);
+}
+
+/* Test: suppressPosRsp set -> routine runs with the bit cleared, no positive response */
+void test_ApplLinDiagRoutineControl_SuppressPosRsp(void) {
+  pbLinDiagBuffer[1] = 0x81u;
+
+  ApplLinDiagRoutineControl();
+
+  TEST_ASSERT_EQUAL_HEX8(0x01u, s_rcSubFunction_u8);
+  TEST_ASSERT_EQUAL_HEX16(0x0203, s_rcRid_u16);
+}
+
+/* Test: suppressPosRsp does not suppress a negative response */
+void test_ApplLinDiagRoutineControl_SuppressPosRsp_NegativeStillSent(void) {
+  pbLinDiagBuffer[1] = 0x81u;
+  pbLinDiagBuffer[3] = 0x04u;
+  LinDiagSendNegResponse_Expect(kLinDiagNrcRequestOutOfRange);
+
+  ApplLinDiagRoutineControl();
+}
+
+/* Test: unknown routine identifier -> requestOutOfRange of the dispatcher */
+void test_ApplLinDiagRoutineControl_UnknownRid(void) {
+  pbLinDiagBuffer[2] = 0xFFu;
+  LinDiagSendNegResponse_Expect(kLinDiagNrcRequestOutOfRange);
+
+  ApplLinDiagRoutineControl();
+
+  TEST_ASSERT_EQUAL_HEX16(0xFF03, s_rcRid_u16);
+}
+
+/* Test: option record of the wrong length -> incorrectMessageLength of the routine */
+void test_ApplLinDiagRoutineControl_WrongOptionLength(void) {
+  g_linDiagDataLength_u16 = 4u;
+  LinDiagSendNegResponse_Expect(kLinDiagNrcIncorrectMessageLength);
+
+  ApplLinDiagRoutineControl();
+
+  TEST_ASSERT_EQUAL_UINT8(0u, s_rcOptionLen_u8);
+}
+
+/* Test: LIN TP ring full -> busyRepeatRequest, routine not run */
+void test_ApplLinDiagRoutineControl_RingFull(void) {
+  LinTp_TxReserve_StubWithCallback(LinTp_TxReserve_Full_Callback);
+  LinDiagSendNegResponse_Expect(kLinDiagNrcBusyRepeatRequest);
+
+  ApplLinDiagRoutineControl();
+
+  TEST_ASSERT_EQUAL_HEX16(0u, s_rcRid_u16);
+}
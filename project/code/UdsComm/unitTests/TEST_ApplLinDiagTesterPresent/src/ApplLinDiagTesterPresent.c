@@ -0,0 +1,41 @@
+#include "diagnostic_priv.h"
+
+/* Global buffers normally provided by LIN stack */
+uint8_t pbLinDiagBuffer[32];
+/* Message length */
+uint16_t g_linDiagDataLength_u16 = 0;
+
+/* Reserve a positive response of len_u16 bytes (SID included) in the LIN TP ring and write its SID;
+ * g_linDiagDataLength_u16 is set to the bytes after the SID. NRC busyRepeatRequest if the ring is full. */
+static uint8_t *linDiagPosResponse(uint16_t len_u16) {
+  uint8_t *const l_resp_pu8 = LinTp_TxReserve(len_u16);
+
+  if(NULL == l_resp_pu8) {
+    LinDiagSendNegResponse(kLinDiagNrcBusyRepeatRequest);
+  } else {
+    l_resp_pu8[0] = (uint8_t)(pbLinDiagBuffer[0] + DIAG_POSITIVE_RESPONSE_OFFSET);
+    g_linDiagDataLength_u16 = (uint16_t)(len_u16 - 1u);
+  }
+
+  return l_resp_pu8;
+}
+
+/* FUNCTION TO TEST */
+void ApplLinDiagTesterPresent(void) {
+  uint8_t *l_resp_pu8;
+
+  /* Request: SID, zeroSubFunction; response: 0x7E, 0x00 */
+  if(0u != (pbLinDiagBuffer[1] & (uint8_t)~DIAG_SUPPRESS_POS_RSP)) {
+    LinDiagSendNegResponse(kLinDiagNrcSubFunctionNotSupported);
+  } else if(2u != g_linDiagDataLength_u16) {
+    LinDiagSendNegResponse(kLinDiagNrcIncorrectMessageLength);
+  } else if(0u == (pbLinDiagBuffer[1] & DIAG_SUPPRESS_POS_RSP)) {
+    l_resp_pu8 = linDiagPosResponse(2u);
+    if(NULL != l_resp_pu8) {
+      l_resp_pu8[1] = 0x00u;
+      LinDiagSendPosResponse();
+    }
+  } else {
+    /* Positive response suppressed */
+  }
+}
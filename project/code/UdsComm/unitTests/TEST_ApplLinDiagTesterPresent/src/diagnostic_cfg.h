@@ -0,0 +1,16 @@
+#ifndef DIAGNOSTIC_CFG_H
+#define DIAGNOSTIC_CFG_H
+
+#include <stdint.h>
+
+typedef uint8_t uint8;
+typedef uint16_t uint16;
+typedef uint8_t Std_ReturnType;
+
+#define E_OK ((Std_ReturnType)0x00u)
+#define E_NOT_OK ((Std_ReturnType)0x01u)
+#define kLinDiagNrcIncorrectMessageLength ((uint8)0x13u)
+#define kLinDiagNrcBusyRepeatRequest ((uint8)0x21u)
+#define kLinDiagNrcSubFunctionNotSupported ((uint8)0x12u)
+
+#endif
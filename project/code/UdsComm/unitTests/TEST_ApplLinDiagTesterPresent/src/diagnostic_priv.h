@@ -0,0 +1,15 @@
+#include "ApplLinDiagTesterPresent.h"
+#include "diagnostic_cfg.h"
+#include "linTp.h"
+#include <stddef.h>
+
+#define DIAG_POSITIVE_RESPONSE_OFFSET 0x40u
+
+/* suppressPosRspMsgIndicationBit of a sub-function byte */
+#define DIAG_SUPPRESS_POS_RSP 0x80u
+
+/* Send positive response */
+void LinDiagSendPosResponse(void);
+
+/* Send negative response with error code */
+void LinDiagSendNegResponse(uint8_t errorCode);
@@ -0,0 +1,100 @@
+#include "ApplLinDiagTesterPresent.h"
+#include "mock_diagnostic_cfg.h"
+#include "mock_diagnostic_priv.h"
+#include "mock_linTp.h"
+#include "unity.h"
+#include <string.h>
+
+/* Response area returned by LinTp_TxReserve */
+static uint8_t s_txArea_au8[4];
+static uint16_t s_txReserved_u16;
+
+static uint8_t *LinTp_TxReserve_Callback(uint16_t len_u16, int cmock_num_calls) {
+  (void)cmock_num_calls;
+  s_txReserved_u16 = len_u16;
+
+  return s_txArea_au8;
+}
+
+static uint8_t *LinTp_TxReserve_Full_Callback(uint16_t len_u16, int cmock_num_calls) {
+  (void)len_u16;
+  (void)cmock_num_calls;
+
+  return NULL; /* ring full */
+}
+
+void setUp(void) {
+  LinTp_TxReserve_StubWithCallback(LinTp_TxReserve_Callback);
+
+  memset(pbLinDiagBuffer, 0, sizeof(pbLinDiagBuffer));
+  memset(s_txArea_au8, 0, sizeof(s_txArea_au8));
+  s_txReserved_u16 = 0u;
+
+  /* 3E 00 */
+  pbLinDiagBuffer[0] = 0x3Eu;
+  pbLinDiagBuffer[1] = 0x00u;
+  g_linDiagDataLength_u16 = 2u;
+}
+
+void tearDown(void) {}
+
+/* Test: zeroSubFunction -> response 7E 00 */
+void test_ApplLinDiagTesterPresent_Success(void) {
+  LinDiagSendPosResponse_Expect();
+
+  ApplLinDiagTesterPresent();
+
+  TEST_ASSERT_EQUAL_UINT16(2u, s_txReserved_u16);
+  TEST_ASSERT_EQUAL_HEX8(0x7Eu, s_txArea_au8[0]);
+  TEST_ASSERT_EQUAL_HEX8(0x00u, s_txArea_au8[1]);
+  TEST_ASSERT_EQUAL_UINT16(1u, g_linDiagDataLength_u16);
+}
+
+/* Test: suppressPosRsp set -> no response, nothing reserved */
+void test_ApplLinDiagTesterPresent_SuppressPosRsp(void) {
+  pbLinDiagBuffer[1] = 0x80u;
+
+  ApplLinDiagTesterPresent();
+
+  TEST_ASSERT_EQUAL_UINT16(0u, s_txReserved_u16);
+}
+
+/* Test: sub-function other than 0x00 -> subFunctionNotSupported, also with suppressPosRsp set */
+void test_ApplLinDiagTesterPresent_SubFunctionNotZero(void) {
+  pbLinDiagBuffer[1] = 0x01u;
+  LinDiagSendNegResponse_Expect(kLinDiagNrcSubFunctionNotSupported);
+  ApplLinDiagTesterPresent();
+
+  pbLinDiagBuffer[1] = 0x81u;
+  LinDiagSendNegResponse_Expect(kLinDiagNrcSubFunctionNotSupported);
+  ApplLinDiagTesterPresent();
+
+  TEST_ASSERT_EQUAL_UINT16(0u, s_txReserved_u16);
+}
+
+/* Test: request longer than SID + sub-function -> incorrectMessageLength */
+void test_ApplLinDiagTesterPresent_WrongLength(void) {
+  g_linDiagDataLength_u16 = 3u;
+  LinDiagSendNegResponse_Expect(kLinDiagNrcIncorrectMessageLength);
+
+  ApplLinDiagTesterPresent();
+
+  TEST_ASSERT_EQUAL_UINT16(0u, s_txReserved_u16);
+}
+
+/* Test: suppressPosRsp does not suppress a negative response */
+void test_ApplLinDiagTesterPresent_SuppressPosRsp_WrongLength(void) {
+  pbLinDiagBuffer[1] = 0x80u;
+  g_linDiagDataLength_u16 = 3u;
+  LinDiagSendNegResponse_Expect(kLinDiagNrcIncorrectMessageLength);
+
+  ApplLinDiagTesterPresent();
+}
+
+/* Test: LIN TP ring full -> busyRepeatRequest */
+void test_ApplLinDiagTesterPresent_RingFull(void) {
+  LinTp_TxReserve_StubWithCallback(LinTp_TxReserve_Full_Callback);
+  LinDiagSendNegResponse_Expect(kLinDiagNrcBusyRepeatRequest);
+
+  ApplLinDiagTesterPresent();
+}
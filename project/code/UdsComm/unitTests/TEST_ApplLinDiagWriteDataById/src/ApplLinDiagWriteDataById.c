@@ -0,0 +1,40 @@
+#include "diagnostic_priv.h"
+
+/* Global buffers normally provided by LIN stack */
+uint8_t pbLinDiagBuffer[32];
+/* Message length */
+uint16_t g_linDiagDataLength_u16 = 0;
+
+/* Reserve a positive response of len_u16 bytes (SID included) in the LIN TP ring and write its SID;
+ * g_linDiagDataLength_u16 is set to the bytes after the SID. NRC busyRepeatRequest if the ring is full. */
+static uint8_t *linDiagPosResponse(uint16_t len_u16) {
+  uint8_t *const l_resp_pu8 = LinTp_TxReserve(len_u16);
+
+  if(NULL == l_resp_pu8) {
+    LinDiagSendNegResponse(kLinDiagNrcBusyRepeatRequest);
+  } else {
+    l_resp_pu8[0] = (uint8_t)(pbLinDiagBuffer[0] + DIAG_POSITIVE_RESPONSE_OFFSET);
+    g_linDiagDataLength_u16 = (uint16_t)(len_u16 - 1u);
+  }
+
+  return l_resp_pu8;
+}
+
+/* FUNCTION TO TEST */
+void ApplLinDiagWriteDataById(void) {
+  uint8_t l_errCode_u8 = 0u;
+  uint8_t *l_resp_pu8;
+  const uint16_t l_did_cu16 = (uint16_t)((uint16_t)pbLinDiagBuffer[1] << 8) | (uint16_t)pbLinDiagBuffer[2];
+
+  /* Request: SID, DID (2 bytes), data; response: 0x6E, DID */
+  if(E_OK != getHandlersForWriteDataById(&l_errCode_u8, l_did_cu16, (uint8_t)(g_linDiagDataLength_u16 - 3u), &pbLinDiagBuffer[3])) {
+    LinDiagSendNegResponse(l_errCode_u8);
+  } else {
+    l_resp_pu8 = linDiagPosResponse(3u);
+    if(NULL != l_resp_pu8) {
+      l_resp_pu8[1] = pbLinDiagBuffer[1];
+      l_resp_pu8[2] = pbLinDiagBuffer[2];
+      LinDiagSendPosResponse();
+    }
+  }
+}
@@ -0,0 +1,18 @@
+#ifndef DIAGNOSTIC_CFG_H
+#define DIAGNOSTIC_CFG_H
+
+#include <stdint.h>
+
+typedef uint8_t uint8;
+typedef uint16_t uint16;
+typedef uint8_t Std_ReturnType;
+
+#define E_OK ((Std_ReturnType)0x00u)
+#define E_NOT_OK ((Std_ReturnType)0x01u)
+#define kLinDiagNrcRequestOutOfRange ((uint8)0x31u)
+#define kLinDiagNrcIncorrectMessageLength ((uint8)0x13u)
+#define kLinDiagNrcBusyRepeatRequest ((uint8)0x21u)
+
+Std_ReturnType getHandlersForWriteDataById(uint8 *l_errCode_u8, uint16 l_did_cu16, uint8 l_dataSize_u8, uint8 *l_data_pu8);
+
+#endif
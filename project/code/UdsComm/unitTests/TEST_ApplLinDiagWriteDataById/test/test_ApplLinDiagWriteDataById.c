@@ -0,0 +1,117 @@
+#include "ApplLinDiagWriteDataById.h"
+#include "mock_diagnostic_cfg.h"
+#include "mock_diagnostic_priv.h"
+#include "mock_linTp.h"
+#include "unity.h"
+#include <string.h>
+
+/* Response area returned by LinTp_TxReserve */
+static uint8_t s_txArea_au8[8];
+static uint16_t s_txReserved_u16;
+
+/* Arguments seen by the write handler dispatcher */
+static uint16 s_writeDid_u16;
+static uint8 s_writeSize_u8;
+static uint8 *s_writeData_pu8;
+
+/* DID 0xF190 takes 4 bytes; any other DID is not writable */
+static Std_ReturnType getHandlersForWriteDataById_Callback(uint8 *l_errCode_u8, uint16 l_did_cu16, uint8 l_dataSize_u8, uint8 *l_data_pu8, int cmock_num_calls) {
+  Std_ReturnType l_result_ = E_OK;
+  (void)cmock_num_calls;
+
+  s_writeDid_u16 = l_did_cu16;
+  s_writeSize_u8 = l_dataSize_u8;
+  s_writeData_pu8 = l_data_pu8;
+  if(0xF190 != l_did_cu16) {
+    *l_errCode_u8 = kLinDiagNrcRequestOutOfRange;
+    l_result_ = E_NOT_OK;
+  } else if(4u != l_dataSize_u8) {
+    *l_errCode_u8 = kLinDiagNrcIncorrectMessageLength;
+    l_result_ = E_NOT_OK;
+  }
+
+  return l_result_;
+}
+
+static uint8_t *LinTp_TxReserve_Callback(uint16_t len_u16, int cmock_num_calls) {
+  (void)cmock_num_calls;
+  s_txReserved_u16 = len_u16;
+
+  return s_txArea_au8;
+}
+
+static uint8_t *LinTp_TxReserve_Full_Callback(uint16_t len_u16, int cmock_num_calls) {
+  (void)len_u16;
+  (void)cmock_num_calls;
+
+  return NULL; /* ring full */
+}
+
+void setUp(void) {
+  getHandlersForWriteDataById_StubWithCallback(getHandlersForWriteDataById_Callback);
+  LinTp_TxReserve_StubWithCallback(LinTp_TxReserve_Callback);
+
+  memset(pbLinDiagBuffer, 0, sizeof(pbLinDiagBuffer));
+  memset(s_txArea_au8, 0, sizeof(s_txArea_au8));
+  s_txReserved_u16 = 0u;
+  s_writeDid_u16 = 0u;
+  s_writeSize_u8 = 0u;
+  s_writeData_pu8 = NULL;
+
+  /* 2E F1 90 11 22 33 44 */
+  pbLinDiagBuffer[0] = 0x2Eu;
+  pbLinDiagBuffer[1] = 0xF1u;
+  pbLinDiagBuffer[2] = 0x90u;
+  pbLinDiagBuffer[3] = 0x11u;
+  pbLinDiagBuffer[4] = 0x22u;
+  pbLinDiagBuffer[5] = 0x33u;
+  pbLinDiagBuffer[6] = 0x44u;
+  g_linDiagDataLength_u16 = 7u;
+}
+
+void tearDown(void) {}
+
+/* Test: data record passed to the handler, response 6E F1 90 */
+void test_ApplLinDiagWriteDataById_Success(void) {
+  LinDiagSendPosResponse_Expect();
+
+  ApplLinDiagWriteDataById();
+
+  TEST_ASSERT_EQUAL_HEX16(0xF190, s_writeDid_u16);
+  TEST_ASSERT_EQUAL_UINT8(4u, s_writeSize_u8);
+  TEST_ASSERT_EQUAL_PTR(&pbLinDiagBuffer[3], s_writeData_pu8);
+  TEST_ASSERT_EQUAL_UINT16(3u, s_txReserved_u16);
+  TEST_ASSERT_EQUAL_HEX8(0x6Eu, s_txArea_au8[0]);
+  TEST_ASSERT_EQUAL_HEX8(0xF1u, s_txArea_au8[1]);
+  TEST_ASSERT_EQUAL_HEX8(0x90u, s_txArea_au8[2]);
+  TEST_ASSERT_EQUAL_UINT16(2u, g_linDiagDataLength_u16);
+}
+
+/* Test: DID not writable -> NRC of the handler, nothing reserved */
+void test_ApplLinDiagWriteDataById_DidNotWritable(void) {
+  pbLinDiagBuffer[2] = 0x91u;
+  LinDiagSendNegResponse_Expect(kLinDiagNrcRequestOutOfRange);
+
+  ApplLinDiagWriteDataById();
+
+  TEST_ASSERT_EQUAL_UINT16(0u, s_txReserved_u16);
+  TEST_ASSERT_EQUAL_UINT16(7u, g_linDiagDataLength_u16);
+}
+
+/* Test: data record of the wrong size -> incorrectMessageLength */
+void test_ApplLinDiagWriteDataById_WrongSize(void) {
+  g_linDiagDataLength_u16 = 6u;
+  LinDiagSendNegResponse_Expect(kLinDiagNrcIncorrectMessageLength);
+
+  ApplLinDiagWriteDataById();
+
+  TEST_ASSERT_EQUAL_UINT8(3u, s_writeSize_u8);
+}
+
+/* Test: LIN TP ring full after a successful write -> busyRepeatRequest */
+void test_ApplLinDiagWriteDataById_RingFull(void) {
+  LinTp_TxReserve_StubWithCallback(LinTp_TxReserve_Full_Callback);
+  LinDiagSendNegResponse_Expect(kLinDiagNrcBusyRepeatRequest);
+
+  ApplLinDiagWriteDataById();
+}
@@ -0,0 +1,292 @@
+#include "diagnostic_priv.h"
+
+/* Global buffers normally provided by LIN stack */
+uint8_t pbLinDiagBuffer[32];
+/* Message length */
+uint16_t g_linDiagDataLength_u16 = 0;
+
+/* Reserve a positive response of len_u16 bytes (SID included) in the LIN TP ring and write its SID;
+ * g_linDiagDataLength_u16 is set to the bytes after the SID. NRC busyRepeatRequest if the ring is full. */
+static uint8_t *linDiagPosResponse(uint16_t len_u16) {
+  uint8_t *const l_resp_pu8 = LinTp_TxReserve(len_u16);
+
+  if(NULL == l_resp_pu8) {
+    LinDiagSendNegResponse(kLinDiagNrcBusyRepeatRequest);
+  } else {
+    l_resp_pu8[0] = (uint8_t)(pbLinDiagBuffer[0] + DIAG_POSITIVE_RESPONSE_OFFSET);
+    g_linDiagDataLength_u16 = (uint16_t)(len_u16 - 1u);
+  }
+
+  return l_resp_pu8;
+}
+
+/* ReadDataByIdentifier job, kept from the request to the final response while a DID handler is pending */
+static uint16_t linDiagRdbiDids_au16[DIAG_RDBI_MAX_DIDS]; /* Supported DIDs of the request */
+static uint8_t linDiagRdbiDidCount_u8 = 0u;
+static uint8_t linDiagRdbiDidIdx_u8 = 0u;   /* Next DID to read */
+static uint16_t linDiagRdbiPos_u16 = 1u;    /* Next free byte of the response */
+static uint8_t *linDiagRdbiResp_pu8 = NULL; /* Response area reserved in the LIN TP ring */
+
+/* Response pending supervision */
+static bool linDiagPending_b = false;
+static uint16_t linDiagP2Timer_u16 = 0u;    /* Ticks left before the next NRC 0x78 */
+static uint8_t linDiagRespPendCnt_u8 = 0u;  /* NRC 0x78 sent for the current request */
+
+/* Read the DIDs from linDiagRdbiDidIdx_u8 on; the first handler gets opStatus_u8, the next ones start fresh */
+static Std_ReturnType linDiagRdbiRead(uint8_t opStatus_u8, uint8_t *errCode_pu8) {
+  Std_ReturnType l_result_ = E_OK;
+  Std_ReturnType l_didSupported_ = E_OK;
+  uint8_t l_opStatus_u8 = opStatus_u8;
+  uint8_t l_diagBufSize_u8;
+  uint16_t l_did_u16;
+
+  while((E_OK == l_result_) && (linDiagRdbiDidIdx_u8 < linDiagRdbiDidCount_u8)) {
+    l_did_u16 = linDiagRdbiDids_au16[linDiagRdbiDidIdx_u8];
+    linDiagRdbiResp_pu8[linDiagRdbiPos_u16] = (uint8_t)(l_did_u16 >> 8);
+    linDiagRdbiResp_pu8[linDiagRdbiPos_u16 + 1u] = (uint8_t)(l_did_u16 & 0xFFu);
+    l_diagBufSize_u8 = 0u;
+    l_result_ = getHandlersForReadDataById(errCode_pu8, l_did_u16, &l_diagBufSize_u8, &l_didSupported_, &linDiagRdbiResp_pu8[linDiagRdbiPos_u16 + 2u], l_opStatus_u8);
+    if(E_OK == l_result_) {
+      linDiagRdbiPos_u16 += (uint16_t)l_diagBufSize_u8 + 2u;
+      linDiagRdbiDidIdx_u8++;
+      l_opStatus_u8 = DIAG_OPSTATUS_INITIAL;
+    }
+  }
+
+  return l_result_;
+}
+
+/* Send the response once the handlers are done, or start the response pending supervision */
+static void linDiagRdbiConclude(Std_ReturnType result_, uint8_t errCode_u8) {
+  switch(result_) {
+  case E_OK:
+    linDiagPending_b = false;
+    g_linDiagDataLength_u16 = (uint16_t)(linDiagRdbiPos_u16 - 1u);
+    LinDiagSendPosResponse();
+    break;
+  case E_PENDING:
+    if(!linDiagPending_b) {
+      linDiagPending_b = true;
+      linDiagP2Timer_u16 = DIAG_P2_TICKS;
+      linDiagRespPendCnt_u8 = 0u;
+    }
+    break;
+  default:
+    linDiagPending_b = false;
+    /* pbLinDiagBuffer may already hold a newer request when a pending handler fails */
+    LinDiagSendNegResponseSid(DIAG_SID_READ_DATA_BY_ID, errCode_u8);
+    break;
+  }
+}
+
+/* Stop the pending handler; its response reservation is dropped by the next LinTp_TxReserve() */
+static void linDiagRdbiCancel(void) {
+  uint8_t l_errCode_u8 = 0u;
+  uint8_t l_diagBufSize_u8 = 0u;
+  Std_ReturnType l_didSupported_ = E_OK;
+
+  linDiagPending_b = false;
+  (void)getHandlersForReadDataById(&l_errCode_u8, linDiagRdbiDids_au16[linDiagRdbiDidIdx_u8], &l_diagBufSize_u8, &l_didSupported_, &linDiagRdbiResp_pu8[linDiagRdbiPos_u16 + 2u],
+                                   DIAG_OPSTATUS_CANCEL);
+}
+
+void ApplLinDiagReadDataById(void) {
+  uint8_t l_reqDids_u8 = 0u;
+  uint16_t l_respLen_u16 = 0u;
+  Std_ReturnType l_result_ = E_OK;
+  uint8_t l_errCode_u8 = 0;
+  uint8_t l_diagBufSize_u8 = 0;
+  uint8_t l_idx_u8;
+  linDiagRdbiDidCount_u8 = 0u;
+  linDiagRdbiDidIdx_u8 = 0u;
+  linDiagRdbiPos_u16 = 1u;
+  /* SID followed by at least one complete DID */
+  if((g_linDiagDataLength_u16 < 3u) || (0u == (g_linDiagDataLength_u16 & 1u))) {
+    l_errCode_u8 = kLinDiagNrcIncorrectMessageLength;
+    l_result_ = E_NOT_OK;
+  }
+  if(E_OK == l_result_) {
+    /* Size the whole response before any handler runs; unsupported DIDs are skipped. The DID list is
+     * kept because a pending handler may outlive the request in pbLinDiagBuffer. */
+    l_reqDids_u8 = (uint8_t)((g_linDiagDataLength_u16 - 1u) >> 1);
+    for(l_idx_u8 = 0u; l_idx_u8 < l_reqDids_u8; l_idx_u8++) {
+      const uint16_t l_did_cu16 = ((uint16_t)(pbLinDiagBuffer[1u + (2u * l_idx_u8)] << 8) & (uint16_t)0xFF00) | ((uint16_t)pbLinDiagBuffer[2u + (2u * l_idx_u8)] & (uint16_t)0x00FF);
+      if(E_OK == getDidReadSize(l_did_cu16, &l_diagBufSize_u8)) {
+        linDiagRdbiDids_au16[linDiagRdbiDidCount_u8] = l_did_cu16;
+        linDiagRdbiDidCount_u8++;
+        l_respLen_u16 += (uint16_t)l_diagBufSize_u8 + 2u;
+      }
+    }
+    if(0u == linDiagRdbiDidCount_u8) {
+      l_errCode_u8 = kLinDiagNrcRequestOutOfRange;
+      l_result_ = E_NOT_OK;
+    } else if(l_respLen_u16 > DIAG_RDBI_RESPONSE_CAPACITY) {
+      l_errCode_u8 = kLinDiagNrcResponseTooLong;
+      l_result_ = E_NOT_OK;
+    } else {
+      /* Handlers write the response straight into the LIN TP ring */
+      linDiagRdbiResp_pu8 = LinTp_TxReserve((uint16_t)(l_respLen_u16 + 1u));
+      if(NULL == linDiagRdbiResp_pu8) {
+        l_errCode_u8 = kLinDiagNrcBusyRepeatRequest;
+        l_result_ = E_NOT_OK;
+      } else {
+        linDiagRdbiResp_pu8[0] = (uint8_t)(DIAG_SID_READ_DATA_BY_ID + DIAG_POSITIVE_RESPONSE_OFFSET);
+      }
+    }
+  }
+  if(E_OK == l_result_) { l_result_ = linDiagRdbiRead(DIAG_OPSTATUS_INITIAL, &l_errCode_u8); }
+  linDiagRdbiConclude(l_result_, l_errCode_u8);
+}
+
+/* ReadDataByPeriodicIdentifier schedule; the active entries are packed in [0, linDiagPdidCount_u8) */
+static LinDiagPdid_t linDiagPdid_ast[DIAG_CFG_PDID_MAX];
+static uint8_t linDiagPdidCount_u8 = 0u;
+/* Period of each transmission mode, indexed by mode - DIAG_PDID_MODE_SLOW */
+static const uint16_t linDiagPdidPeriod_cau16[3] = {DIAG_PDID_TICKS(DIAG_CFG_PDID_SLOW_MS), DIAG_PDID_TICKS(DIAG_CFG_PDID_MEDIUM_MS), DIAG_PDID_TICKS(DIAG_CFG_PDID_FAST_MS)};
+
+/* Index of a scheduled periodic identifier, linDiagPdidCount_u8 if not scheduled */
+static uint8_t linDiagPdidFind(uint8_t pdid_u8) {
+  uint8_t l_idx_u8 = 0u;
+
+  while((l_idx_u8 < linDiagPdidCount_u8) && (pdid_u8 != linDiagPdid_ast[l_idx_u8].msg_au8[1])) { l_idx_u8++; }
+
+  return l_idx_u8;
+}
+
+/* Sample the periodic DIDs that are due and queue their responses. Nothing is sampled or queued while a
+ * ReadDataByIdentifier request is pending: its response is reserved in the ring and a new reservation
+ * would drop it; the due entries are served once it completes. */
+static void linDiagPdidSchedule(void) {
+  LinDiagPdid_t *l_pdid_pst;
+  uint8_t *l_resp_pu8;
+  uint8_t l_errCode_u8 = 0u;
+  uint8_t l_diagBufSize_u8;
+  Std_ReturnType l_didSupported_ = E_OK;
+  Std_ReturnType l_result_;
+  uint16_t l_did_u16;
+  uint8_t l_idx_u8;
+
+  for(l_idx_u8 = 0u; l_idx_u8 < linDiagPdidCount_u8; l_idx_u8++) {
+    l_pdid_pst = &linDiagPdid_ast[l_idx_u8];
+    if(0u != l_pdid_pst->timer_u16) { l_pdid_pst->timer_u16--; }
+    if(!linDiagPending_b) {
+      if(0u == l_pdid_pst->timer_u16) {
+        l_pdid_pst->timer_u16 = linDiagPdidPeriod_cau16[l_pdid_pst->mode_u8 - DIAG_PDID_MODE_SLOW];
+        l_did_u16 = (uint16_t)(DIAG_CFG_PDID_DID_BASE + l_pdid_pst->msg_au8[1]);
+        l_diagBufSize_u8 = 0u;
+        l_result_ = getHandlersForReadDataById(&l_errCode_u8, l_did_u16, &l_diagBufSize_u8, &l_didSupported_, &l_pdid_pst->msg_au8[2], DIAG_OPSTATUS_INITIAL);
+        if(E_OK == l_result_) {
+          l_pdid_pst->len_u8 = (uint8_t)(l_diagBufSize_u8 + 2u);
+        } else {
+          /* No sample this period; a slow source is not waited for */
+          if(E_PENDING == l_result_) { (void)getHandlersForReadDataById(&l_errCode_u8, l_did_u16, &l_diagBufSize_u8, &l_didSupported_, &l_pdid_pst->msg_au8[2], DIAG_OPSTATUS_CANCEL); }
+          l_pdid_pst->len_u8 = 0u;
+        }
+      }
+      /* A sample the ring has no room for is retried on the next call, until the next sample replaces it */
+      if(0u != l_pdid_pst->len_u8) {
+        l_resp_pu8 = LinTp_TxReserve(l_pdid_pst->len_u8);
+        if(NULL != l_resp_pu8) {
+          (void)memcpy(l_resp_pu8, l_pdid_pst->msg_au8, l_pdid_pst->len_u8);
+          LinTp_TxCommit(l_pdid_pst->len_u8);
+          l_pdid_pst->len_u8 = 0u;
+        }
+      }
+    }
+  }
+}
+
+void ApplLinDiagReadDataByPeriodicId(void) {
+  const uint8_t l_mode_cu8 = pbLinDiagBuffer[1];
+  const uint8_t l_pdidNum_cu8 = (uint8_t)(g_linDiagDataLength_u16 - 2u);
+  uint8_t l_errCode_u8 = 0u;
+  uint8_t l_new_u8 = 0u;
+  uint8_t l_size_u8 = 0u;
+  uint8_t l_pdid_u8;
+  uint8_t l_idx_u8;
+  uint8_t l_prev_u8;
+  uint8_t l_slot_u8;
+
+  if(DIAG_PDID_MODE_STOP == l_mode_cu8) {
+    /* No periodic identifier: stop all */
+    if(0u == l_pdidNum_cu8) { linDiagPdidCount_u8 = 0u; }
+    for(l_idx_u8 = 0u; l_idx_u8 < l_pdidNum_cu8; l_idx_u8++) {
+      l_slot_u8 = linDiagPdidFind(pbLinDiagBuffer[2u + l_idx_u8]);
+      if(l_slot_u8 < linDiagPdidCount_u8) {
+        linDiagPdidCount_u8--;
+        linDiagPdid_ast[l_slot_u8] = linDiagPdid_ast[linDiagPdidCount_u8];
+      }
+    }
+  } else if((l_mode_cu8 < DIAG_PDID_MODE_SLOW) || (l_mode_cu8 > DIAG_PDID_MODE_FAST)) {
+    l_errCode_u8 = kLinDiagNrcRequestOutOfRange;
+  } else if(0u == l_pdidNum_cu8) {
+    l_errCode_u8 = kLinDiagNrcIncorrectMessageLength;
+  } else {
+    /* Check the whole request before the schedule changes: readable DIDs that fit the sample
+     * buffer, and a free entry for every periodic identifier not yet scheduled */
+    for(l_idx_u8 = 0u; (0u == l_errCode_u8) && (l_idx_u8 < l_pdidNum_cu8); l_idx_u8++) {
+      l_pdid_u8 = pbLinDiagBuffer[2u + l_idx_u8];
+      if((E_OK != getDidReadSize((uint16_t)(DIAG_CFG_PDID_DID_BASE + l_pdid_u8), &l_size_u8)) || (l_size_u8 > DIAG_CFG_PDID_DATA_MAX)) {
+        l_errCode_u8 = kLinDiagNrcRequestOutOfRange;
+      } else if(linDiagPdidFind(l_pdid_u8) == linDiagPdidCount_u8) {
+        l_prev_u8 = 0u;
+        while((l_prev_u8 < l_idx_u8) && (l_pdid_u8 != pbLinDiagBuffer[2u + l_prev_u8])) { l_prev_u8++; }
+        if(l_prev_u8 == l_idx_u8) { l_new_u8++; }
+      } else {
+        /* Already scheduled: only its mode changes */
+      }
+    }
+    if((0u == l_errCode_u8) && ((uint8_t)(linDiagPdidCount_u8 + l_new_u8) > DIAG_CFG_PDID_MAX)) { l_errCode_u8 = kLinDiagNrcRequestOutOfRange; }
+    for(l_idx_u8 = 0u; (0u == l_errCode_u8) && (l_idx_u8 < l_pdidNum_cu8); l_idx_u8++) {
+      l_pdid_u8 = pbLinDiagBuffer[2u + l_idx_u8];
+      l_slot_u8 = linDiagPdidFind(l_pdid_u8);
+      if(l_slot_u8 == linDiagPdidCount_u8) {
+        linDiagPdidCount_u8++;
+        linDiagPdid_ast[l_slot_u8].msg_au8[0] = (uint8_t)(DIAG_SID_READ_DATA_BY_PERIODIC_ID + DIAG_POSITIVE_RESPONSE_OFFSET);
+        linDiagPdid_ast[l_slot_u8].msg_au8[1] = l_pdid_u8;
+        linDiagPdid_ast[l_slot_u8].len_u8 = 0u;
+      }
+      /* First sample on the next LinDiagMainFunction() call */
+      linDiagPdid_ast[l_slot_u8].mode_u8 = l_mode_cu8;
+      linDiagPdid_ast[l_slot_u8].timer_u16 = 0u;
+    }
+  }
+
+  if(0u != l_errCode_u8) {
+    LinDiagSendNegResponse(l_errCode_u8);
+  } else if(NULL != linDiagPosResponse(1u)) {
+    LinDiagSendPosResponse();
+  } else {
+    /* Ring full: busyRepeatRequest already sent */
+  }
+}
+
+/* FUNCTION TO TEST */
+
+void LinDiagMainFunction(void) {
+  Std_ReturnType l_result_;
+  uint8_t l_errCode_u8 = 0u;
+
+  ageDidCache();
+
+  if(linDiagPending_b) {
+    l_result_ = linDiagRdbiRead(DIAG_OPSTATUS_PENDING, &l_errCode_u8);
+    if(E_PENDING != l_result_) {
+      linDiagRdbiConclude(l_result_, l_errCode_u8);
+    } else {
+      if(0u != linDiagP2Timer_u16) { linDiagP2Timer_u16--; }
+      if(0u != linDiagP2Timer_u16) {
+        /* Still within the P2 (then P2*) budget */
+      } else if(linDiagRespPendCnt_u8 < DIAG_CFG_RESP_PEND_MAX) {
+        /* Budget used up: ask the tester to wait another P2* */
+        LinTp_TxResponsePending(DIAG_SID_READ_DATA_BY_ID);
+        linDiagRespPendCnt_u8++;
+        linDiagP2Timer_u16 = DIAG_P2STAR_TICKS;
+      } else {
+        linDiagRdbiCancel();
+        LinDiagSendNegResponseSid(DIAG_SID_READ_DATA_BY_ID, kLinDiagNrcGeneralReject);
+      }
+    }
+  }
+  linDiagPdidSchedule();
+}
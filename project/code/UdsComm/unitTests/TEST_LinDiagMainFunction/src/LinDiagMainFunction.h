@@ -0,0 +1,17 @@
+#ifndef DIAGNOSTIC_H
+#define DIAGNOSTIC_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+extern uint8_t pbLinDiagBuffer[32];
+/* Message length */
+extern uint16_t g_linDiagDataLength_u16;
+
+void ApplLinDiagReadDataById(void);
+
+void ApplLinDiagReadDataByPeriodicId(void);
+
+void LinDiagMainFunction(void);
+
+#endif
\ No newline at end of file
@@ -0,0 +1,44 @@
+#include "LinDiagMainFunction.h"
+#include "diagnostic_cfg.h"
+#include "linTp.h"
+#include <stddef.h>
+#include <string.h>
+
+#define DIAG_SID_READ_DATA_BY_ID 0x22u
+#define DIAG_SID_READ_DATA_BY_PERIODIC_ID 0x2Au
+#define DIAG_POSITIVE_RESPONSE_OFFSET 0x40u
+
+/* ReadDataByIdentifier (0x22) request in pbLinDiagBuffer: SID, DID#1 (2 bytes) .. DID#n (2 bytes)
+ * ReadDataByIdentifier (0x22) response in the LIN TP ring:  0x62, DID#1, data#1 .. DID#n, data#n */
+#define DIAG_RDBI_RESPONSE_CAPACITY ((uint16_t)(LINTP_TX_MAX_MSG_LEN - 1u))
+#define DIAG_RDBI_MAX_DIDS ((sizeof(pbLinDiagBuffer) - 1u) / 2u)
+
+/* ReadDataByPeriodicIdentifier (0x2A) transmission modes; request: SID, mode, periodic identifier#1 .. #n.
+ * Periodic response in the LIN TP ring: 0x6A, periodic identifier, data */
+#define DIAG_PDID_MODE_SLOW 0x01u
+#define DIAG_PDID_MODE_MEDIUM 0x02u
+#define DIAG_PDID_MODE_FAST 0x03u
+#define DIAG_PDID_MODE_STOP 0x04u
+#define DIAG_PDID_MSG_CAPACITY (2u + DIAG_CFG_PDID_DATA_MAX)
+/* LinDiagMainFunction() calls per period, at least 1 */
+#define DIAG_PDID_TICKS(ms) ((uint16_t)((((ms) / DIAG_CFG_MAIN_PERIOD_MS) > 0u) ? ((ms) / DIAG_CFG_MAIN_PERIOD_MS) : 1u))
+
+/* One scheduled periodic identifier */
+typedef struct {
+  uint8_t mode_u8;                          /* DIAG_PDID_MODE_SLOW/MEDIUM/FAST */
+  uint8_t len_u8;                           /* Bytes of msg_au8 waiting for the ring, 0 = none */
+  uint16_t timer_u16;                       /* Ticks left before the next sample, 0 = due */
+  uint8_t msg_au8[DIAG_PDID_MSG_CAPACITY];  /* Serialized periodic response: 0x6A, periodic identifier, data */
+} LinDiagPdid_t;
+
+#define DIAG_P2_TICKS ((uint16_t)(DIAG_CFG_P2_MS / DIAG_CFG_MAIN_PERIOD_MS))
+#define DIAG_P2STAR_TICKS ((uint16_t)(DIAG_CFG_P2STAR_MS / DIAG_CFG_MAIN_PERIOD_MS))
+
+/* Send positive response */
+void LinDiagSendPosResponse(void);
+
+/* Send negative response with error code */
+void LinDiagSendNegResponse(uint8_t errorCode);
+
+/* Send negative response with error code for a request no longer (or not) in pbLinDiagBuffer */
+void LinDiagSendNegResponseSid(uint8_t sid_u8, uint8_t errorCode);
\ No newline at end of file
@@ -0,0 +1,344 @@
+#include "LinDiagMainFunction.h"
+#include "mock_diagnostic_cfg.h"
+#include "mock_diagnostic_priv.h"
+#include "mock_linTp.h"
+#include "unity.h"
+#include <string.h>
+
+#define MOCK_DID_F308_SIZE 4
+#define MOCK_DID_F186_SIZE 2
+
+/* Response area returned by LinTp_TxReserve */
+static uint8_t s_txArea_au8[LINTP_TX_MAX_MSG_LEN];
+
+/* Handler behaviour: E_PENDING for the first s_pendingCalls_u8 calls, then s_finalResult_ */
+static uint8_t s_pendingCalls_u8;
+static Std_ReturnType s_finalResult_;
+
+/* DID whose handler is slow */
+static uint16 s_slowDid_u16;
+
+/* Ring full: LinTp_TxReserve returns NULL */
+static bool s_ringFull_b;
+
+/* Periodic responses committed to the ring: count and copy of the last one */
+static uint8_t s_commits_u8;
+static uint16_t s_commitLen_u16;
+static uint8_t s_commitMsg_au8[8];
+
+/* Handler calls recorded by the stub */
+static uint8_t s_calls_u8;
+static uint16 s_callDid_au16[16];
+static uint8 s_callOpStatus_au8[16];
+
+static uint8 MockDidSize(uint16 did) { return (0xF308 == did) ? MOCK_DID_F308_SIZE : MOCK_DID_F186_SIZE; }
+
+static Std_ReturnType getDidReadSize_Callback(uint16 did_u16, uint8 *size_pu8, int cmock_num_calls) {
+  (void)cmock_num_calls;
+  *size_pu8 = MockDidSize(did_u16);
+
+  return E_OK;
+}
+
+/* s_slowDid_u16 is the slow one; other DIDs answer at once */
+static Std_ReturnType getHandlersForReadDataById_Callback(uint8 *l_errCode_u8, uint16 l_did_cu16, uint8 *l_diagBufSize_u8, Std_ReturnType *l_didSupported_, uint8 *l_diagBuf_pu8,
+                                                          uint8 opStatus_u8, int cmock_num_calls) {
+  Std_ReturnType l_result_ = E_OK;
+  (void)l_didSupported_;
+  (void)cmock_num_calls;
+
+  s_callDid_au16[s_calls_u8] = l_did_cu16;
+  s_callOpStatus_au8[s_calls_u8] = opStatus_u8;
+  s_calls_u8++;
+  *l_diagBufSize_u8 = MockDidSize(l_did_cu16);
+  if((s_slowDid_u16 == l_did_cu16) && (DIAG_OPSTATUS_CANCEL != opStatus_u8)) {
+    if(0u != s_pendingCalls_u8) {
+      s_pendingCalls_u8--;
+      l_result_ = E_PENDING;
+    } else {
+      l_result_ = s_finalResult_;
+      if(E_NOT_OK == l_result_) { *l_errCode_u8 = 0x22u; }
+    }
+  }
+  if(E_OK == l_result_) { memset(l_diagBuf_pu8, (int)(l_did_cu16 & 0xFFu), *l_diagBufSize_u8); }
+
+  return l_result_;
+}
+
+static uint8_t *LinTp_TxReserve_Callback(uint16_t len_u16, int cmock_num_calls) {
+  (void)len_u16;
+  (void)cmock_num_calls;
+
+  return s_ringFull_b ? NULL : s_txArea_au8;
+}
+
+static void LinTp_TxCommit_Callback(uint16_t len_u16, int cmock_num_calls) {
+  (void)cmock_num_calls;
+
+  s_commits_u8++;
+  s_commitLen_u16 = len_u16;
+  memcpy(s_commitMsg_au8, s_txArea_au8, sizeof(s_commitMsg_au8));
+}
+
+/* Request 0x2A with one periodic identifier (none for stopSending all) */
+static void requestPeriodic(uint8_t mode, uint8_t pdid) {
+  pbLinDiagBuffer[0] = 0x2Au;
+  pbLinDiagBuffer[1] = mode;
+  pbLinDiagBuffer[2] = pdid;
+  g_linDiagDataLength_u16 = (DIAG_PDID_MODE_STOP == mode) ? 2u : 3u;
+  LinDiagSendPosResponse_Expect();
+  ApplLinDiagReadDataByPeriodicId();
+}
+
+/* Number of handler calls for one DID */
+static uint8_t callsOf(uint16 did) {
+  uint8_t l_idx_u8;
+  uint8_t l_count_u8 = 0u;
+
+  for(l_idx_u8 = 0u; l_idx_u8 < s_calls_u8; l_idx_u8++) {
+    if(did == s_callDid_au16[l_idx_u8]) { l_count_u8++; }
+  }
+
+  return l_count_u8;
+}
+
+/* Request 0x22 for one or two DIDs */
+static void request(uint16 did1, uint16 did2) {
+  pbLinDiagBuffer[0] = 0x22u;
+  pbLinDiagBuffer[1] = (uint8_t)(did1 >> 8);
+  pbLinDiagBuffer[2] = (uint8_t)(did1 & 0xFFu);
+  g_linDiagDataLength_u16 = 3u;
+  if(0u != did2) {
+    pbLinDiagBuffer[3] = (uint8_t)(did2 >> 8);
+    pbLinDiagBuffer[4] = (uint8_t)(did2 & 0xFFu);
+    g_linDiagDataLength_u16 = 5u;
+  }
+  ApplLinDiagReadDataById();
+}
+
+void setUp(void) {
+  getDidReadSize_StubWithCallback(getDidReadSize_Callback);
+  getHandlersForReadDataById_StubWithCallback(getHandlersForReadDataById_Callback);
+  LinTp_TxReserve_StubWithCallback(LinTp_TxReserve_Callback);
+  LinTp_TxCommit_StubWithCallback(LinTp_TxCommit_Callback);
+  ageDidCache_Ignore();
+
+  memset(pbLinDiagBuffer, 0, sizeof(pbLinDiagBuffer));
+  memset(s_txArea_au8, 0, sizeof(s_txArea_au8));
+  g_linDiagDataLength_u16 = 0u;
+  s_pendingCalls_u8 = 0u;
+  s_finalResult_ = E_OK;
+  s_slowDid_u16 = 0xF308;
+  s_ringFull_b = false;
+
+  /* Empty schedule */
+  requestPeriodic(DIAG_PDID_MODE_STOP, 0u);
+  s_calls_u8 = 0u;
+  s_commits_u8 = 0u;
+}
+
+void tearDown(void) {}
+
+/* Test: no request pending, only the DID cache is aged */
+void test_LinDiagMainFunction_Idle(void) {
+  ageDidCache_Expect();
+  LinDiagMainFunction();
+
+  TEST_ASSERT_EQUAL_UINT8(0u, s_calls_u8);
+}
+
+/* Test: handler finishing on the next call gives the positive response from the main function */
+void test_LinDiagMainFunction_PendingThenDone(void) {
+  s_pendingCalls_u8 = 1u;
+  request(0xF308, 0u);
+  TEST_ASSERT_EQUAL_UINT8(1u, s_calls_u8);
+
+  LinDiagSendPosResponse_Expect();
+  LinDiagMainFunction();
+
+  TEST_ASSERT_EQUAL_UINT8(2u, s_calls_u8);
+  TEST_ASSERT_EQUAL(DIAG_OPSTATUS_INITIAL, s_callOpStatus_au8[0]);
+  TEST_ASSERT_EQUAL(DIAG_OPSTATUS_PENDING, s_callOpStatus_au8[1]);
+  TEST_ASSERT_EQUAL_UINT16(MOCK_DID_F308_SIZE + 2u, g_linDiagDataLength_u16);
+  TEST_ASSERT_EQUAL_HEX8(0x62u, s_txArea_au8[0]);
+  TEST_ASSERT_EQUAL_HEX8(0xF3u, s_txArea_au8[1]);
+  TEST_ASSERT_EQUAL_HEX8(0x08u, s_txArea_au8[3]);
+
+  /* Job finished: nothing left to poll */
+  LinDiagMainFunction();
+  TEST_ASSERT_EQUAL_UINT8(2u, s_calls_u8);
+}
+
+/* Test: DIDs after the pending one start with DIAG_OPSTATUS_INITIAL and land after it */
+void test_LinDiagMainFunction_NextDidAfterPending(void) {
+  s_pendingCalls_u8 = 1u;
+  request(0xF308, 0xF186);
+
+  LinDiagSendPosResponse_Expect();
+  LinDiagMainFunction();
+
+  TEST_ASSERT_EQUAL_UINT8(3u, s_calls_u8);
+  TEST_ASSERT_EQUAL_HEX16(0xF186, s_callDid_au16[2]);
+  TEST_ASSERT_EQUAL(DIAG_OPSTATUS_INITIAL, s_callOpStatus_au8[2]);
+  TEST_ASSERT_EQUAL_UINT16((MOCK_DID_F308_SIZE + 2u) + (MOCK_DID_F186_SIZE + 2u), g_linDiagDataLength_u16);
+  TEST_ASSERT_EQUAL_HEX8(0xF1u, s_txArea_au8[3u + MOCK_DID_F308_SIZE]);
+  TEST_ASSERT_EQUAL_HEX8(0x86u, s_txArea_au8[5u + MOCK_DID_F308_SIZE]);
+}
+
+/* Test: handler failing after pending gives its negative response */
+void test_LinDiagMainFunction_PendingThenFails(void) {
+  s_pendingCalls_u8 = 1u;
+  s_finalResult_ = E_NOT_OK;
+  request(0xF308, 0u);
+  /* The buffer may already hold the next request */
+  pbLinDiagBuffer[0] = 0x2Eu;
+
+  LinDiagSendNegResponseSid_Expect(DIAG_SID_READ_DATA_BY_ID, 0x22u);
+  LinDiagMainFunction();
+}
+
+/* Test: NRC 0x78 when P2 (2 ticks) is used up, then every P2* (5 ticks) */
+void test_LinDiagMainFunction_ResponsePendingTiming(void) {
+  s_pendingCalls_u8 = 10u;
+  request(0xF308, 0u);
+
+  LinDiagMainFunction();
+  LinTp_TxResponsePending_Expect(0x22u);
+  LinDiagMainFunction();
+
+  LinDiagMainFunction();
+  LinDiagMainFunction();
+  LinDiagMainFunction();
+  LinDiagMainFunction();
+  LinTp_TxResponsePending_Expect(0x22u);
+  LinDiagMainFunction();
+
+  /* Done within the second P2* */
+  s_pendingCalls_u8 = 0u;
+  LinDiagSendPosResponse_Expect();
+  LinDiagMainFunction();
+}
+
+/* Test: after DIAG_CFG_RESP_PEND_MAX notices the handler is cancelled and NRC 0x10 sent */
+void test_LinDiagMainFunction_BudgetExhausted(void) {
+  uint8_t l_tick_u8;
+
+  s_pendingCalls_u8 = 0xFFu;
+  request(0xF308, 0u);
+
+  LinDiagMainFunction();
+  LinTp_TxResponsePending_Expect(0x22u);
+  LinDiagMainFunction();
+  for(l_tick_u8 = 0u; l_tick_u8 < 4u; l_tick_u8++) { LinDiagMainFunction(); }
+  LinTp_TxResponsePending_Expect(0x22u);
+  LinDiagMainFunction();
+  for(l_tick_u8 = 0u; l_tick_u8 < 4u; l_tick_u8++) { LinDiagMainFunction(); }
+
+  pbLinDiagBuffer[0] = 0x2Eu;
+  LinDiagSendNegResponseSid_Expect(DIAG_SID_READ_DATA_BY_ID, kLinDiagNrcGeneralReject);
+  LinDiagMainFunction();
+
+  /* Last call to the handler is the cancellation */
+  TEST_ASSERT_EQUAL(DIAG_OPSTATUS_CANCEL, s_callOpStatus_au8[s_calls_u8 - 1u]);
+
+  /* Nothing left to poll */
+  l_tick_u8 = s_calls_u8;
+  LinDiagMainFunction();
+  TEST_ASSERT_EQUAL_UINT8(l_tick_u8, s_calls_u8);
+}
+
+/* Test: fast rate (2 ticks) -> sampled and sent on the first call, then every 2 calls */
+void test_LinDiagMainFunction_PeriodicFastRate(void) {
+  static const uint8_t expected[] = {0x6Au, 0x01u, 0x01u, 0x01u};
+  uint8_t l_tick_u8;
+
+  requestPeriodic(DIAG_PDID_MODE_FAST, 0x01u);
+
+  LinDiagMainFunction();
+  TEST_ASSERT_EQUAL_UINT8(1u, s_commits_u8);
+  TEST_ASSERT_EQUAL_UINT16(sizeof(expected), s_commitLen_u16);
+  TEST_ASSERT_EQUAL_HEX8_ARRAY(expected, s_commitMsg_au8, sizeof(expected));
+  TEST_ASSERT_EQUAL_HEX16(0xF201, s_callDid_au16[0]);
+  TEST_ASSERT_EQUAL(DIAG_OPSTATUS_INITIAL, s_callOpStatus_au8[0]);
+
+  for(l_tick_u8 = 0u; l_tick_u8 < 4u; l_tick_u8++) { LinDiagMainFunction(); }
+  TEST_ASSERT_EQUAL_UINT8(3u, s_commits_u8);
+  TEST_ASSERT_EQUAL_UINT8(3u, s_calls_u8);
+}
+
+/* Test: two identifiers at different rates are sampled independently */
+void test_LinDiagMainFunction_PeriodicTwoRates(void) {
+  uint8_t l_tick_u8;
+
+  requestPeriodic(DIAG_PDID_MODE_FAST, 0x01u);
+  requestPeriodic(DIAG_PDID_MODE_MEDIUM, 0x02u);
+
+  for(l_tick_u8 = 0u; l_tick_u8 < 10u; l_tick_u8++) { LinDiagMainFunction(); }
+
+  TEST_ASSERT_EQUAL_UINT8(5u, callsOf(0xF201));
+  TEST_ASSERT_EQUAL_UINT8(2u, callsOf(0xF202));
+  TEST_ASSERT_EQUAL_UINT8(7u, s_commits_u8);
+}
+
+/* Test: nothing sampled or queued while a ReadDataByIdentifier response is reserved in the ring */
+void test_LinDiagMainFunction_PeriodicHeldWhileRdbiPending(void) {
+  requestPeriodic(DIAG_PDID_MODE_FAST, 0x01u);
+  s_pendingCalls_u8 = 2u;
+  request(0xF308, 0u);
+
+  LinDiagMainFunction();
+  TEST_ASSERT_EQUAL_UINT8(0u, callsOf(0xF201));
+  TEST_ASSERT_EQUAL_UINT8(0u, s_commits_u8);
+
+  /* RDBI completes first, then the due identifier is served in the same call */
+  LinDiagSendPosResponse_Expect();
+  LinDiagMainFunction();
+  TEST_ASSERT_EQUAL_UINT8(1u, callsOf(0xF201));
+  TEST_ASSERT_EQUAL_UINT8(1u, s_commits_u8);
+  TEST_ASSERT_EQUAL_HEX8(0x6Au, s_commitMsg_au8[0]);
+}
+
+/* Test: a pending periodic handler is cancelled and the period has no sample */
+void test_LinDiagMainFunction_PeriodicPendingHandlerCancelled(void) {
+  s_slowDid_u16 = 0xF201;
+  s_pendingCalls_u8 = 1u;
+  requestPeriodic(DIAG_PDID_MODE_FAST, 0x01u);
+
+  LinDiagMainFunction();
+  TEST_ASSERT_EQUAL_UINT8(2u, s_calls_u8);
+  TEST_ASSERT_EQUAL(DIAG_OPSTATUS_CANCEL, s_callOpStatus_au8[1]);
+  TEST_ASSERT_EQUAL_UINT8(0u, s_commits_u8);
+
+  LinDiagMainFunction();
+  LinDiagMainFunction();
+  TEST_ASSERT_EQUAL_UINT8(3u, s_calls_u8);
+  TEST_ASSERT_EQUAL_UINT8(1u, s_commits_u8);
+}
+
+/* Test: a sample without room in the ring is queued on a later call without sampling again */
+void test_LinDiagMainFunction_PeriodicRingFullRetried(void) {
+  requestPeriodic(DIAG_PDID_MODE_SLOW, 0x01u);
+  s_ringFull_b = true;
+
+  LinDiagMainFunction();
+  TEST_ASSERT_EQUAL_UINT8(1u, s_calls_u8);
+  TEST_ASSERT_EQUAL_UINT8(0u, s_commits_u8);
+
+  s_ringFull_b = false;
+  LinDiagMainFunction();
+  TEST_ASSERT_EQUAL_UINT8(1u, s_calls_u8);
+  TEST_ASSERT_EQUAL_UINT8(1u, s_commits_u8);
+}
+
+/* Test: stopSending without identifier clears the schedule */
+void test_LinDiagMainFunction_PeriodicStopped(void) {
+  requestPeriodic(DIAG_PDID_MODE_FAST, 0x01u);
+  LinDiagMainFunction();
+  requestPeriodic(DIAG_PDID_MODE_STOP, 0u);
+
+  LinDiagMainFunction();
+  LinDiagMainFunction();
+  LinDiagMainFunction();
+  TEST_ASSERT_EQUAL_UINT8(1u, s_calls_u8);
+  TEST_ASSERT_EQUAL_UINT8(1u, s_commits_u8);
+}
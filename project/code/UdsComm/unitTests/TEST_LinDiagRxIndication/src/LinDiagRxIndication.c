@@ -0,0 +1,43 @@
+#include "diagnostic_priv.h"
+
+/* Global buffers normally provided by LIN stack */
+uint8_t pbLinDiagBuffer[32];
+/* Message length */
+uint16_t g_linDiagDataLength_u16 = 0;
+
+/* No ReadDataByIdentifier request pending */
+static bool linDiagPending_b = false;
+
+/* Active session (DIAG_CFG_SESSION_* bit) and unlocked security level. No service changes them yet:
+ * the ECU stays in the default session, locked. */
+static uint8_t linDiagSession_u8 = DIAG_CFG_SESSION_DEFAULT;
+static uint8_t linDiagSecurityLevel_u8 = 0u;
+
+/* FUNCTION TO TEST */
+void LinDiagRxIndication(uint16_t length) {
+  const DiagCfg_SidCfg_t *l_sidCfg_pst;
+  Std_ReturnType l_result_ = E_OK;
+
+  /* A new request abandons the one still waiting for a handler */
+  if(linDiagPending_b) { linDiagRdbiCancel(); }
+  g_linDiagDataLength_u16 = length;
+
+  /* Pre-checks shared by all services, run once per request; a request for another node gets no response */
+  checkCurrentNad((uint8_t)0u, &l_result_);
+  if(E_OK == l_result_) {
+    checkMsgDataLength(length, &l_result_);
+    l_sidCfg_pst = getSidCfg(pbLinDiagBuffer[0]);
+    if(NULL == l_sidCfg_pst) {
+      LinDiagSendNegResponse(kLinDiagNrcServiceNotSupported);
+    } else if(0u == (l_sidCfg_pst->session_u8 & linDiagSession_u8)) {
+      LinDiagSendNegResponse(kLinDiagNrcServiceNotSupportedInActiveSession);
+    } else if(l_sidCfg_pst->security_u8 > linDiagSecurityLevel_u8) {
+      /* ISO 14229-1 order: SID, session, security, then the request length */
+      LinDiagSendNegResponse(kLinDiagNrcSecurityAccessDenied);
+    } else if((E_OK != l_result_) || (length < l_sidCfg_pst->minLen_u8)) {
+      LinDiagSendNegResponse(kLinDiagNrcIncorrectMessageLength);
+    } else {
+      l_sidCfg_pst->service_pf();
+    }
+  }
+}
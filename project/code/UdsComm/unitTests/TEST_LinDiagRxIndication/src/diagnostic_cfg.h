@@ -0,0 +1,36 @@
+#ifndef DIAGNOSTIC_CFG_H
+#define DIAGNOSTIC_CFG_H
+
+#include <stdint.h>
+
+typedef uint8_t uint8;
+typedef uint16_t uint16;
+typedef uint8_t Std_ReturnType;
+
+#define E_OK ((Std_ReturnType)0x00u)
+#define E_NOT_OK ((Std_ReturnType)0x01u)
+#define kLinDiagNrcIncorrectMessageLength ((uint8)0x13u)
+#define kLinDiagNrcServiceNotSupported ((uint8)0x11u)
+#define kLinDiagNrcSecurityAccessDenied ((uint8)0x33u)
+#define kLinDiagNrcServiceNotSupportedInActiveSession ((uint8)0x7Fu)
+
+#define DIAG_CFG_SESSION_DEFAULT 0x01U
+#define DIAG_CFG_SESSION_PROGRAMMING 0x02U
+#define DIAG_CFG_SESSION_EXTENDED 0x04U
+
+typedef void (*diagServiceHandler_t)(void);
+
+typedef struct {
+  uint8 minLen_u8;
+  uint8 session_u8;
+  uint8 security_u8;
+  diagServiceHandler_t service_pf;
+} DiagCfg_SidCfg_t;
+
+void checkCurrentNad(uint8 currentNad, Std_ReturnType *result);
+
+void checkMsgDataLength(uint16_t dataLength, Std_ReturnType *result);
+
+const DiagCfg_SidCfg_t *getSidCfg(uint8 sid_u8);
+
+#endif
@@ -0,0 +1,10 @@
+#include "LinDiagRxIndication.h"
+#include "diagnostic_cfg.h"
+#include <stdbool.h>
+#include <stddef.h>
+
+/* Cancel the ReadDataByIdentifier request waiting for a pending DID handler */
+void linDiagRdbiCancel(void);
+
+/* Send negative response with error code */
+void LinDiagSendNegResponse(uint8_t errorCode);
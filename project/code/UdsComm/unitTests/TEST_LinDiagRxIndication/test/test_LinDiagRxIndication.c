@@ -0,0 +1,155 @@
+#include "LinDiagRxIndication.h"
+#include "mock_diagnostic_cfg.h"
+#include "mock_diagnostic_priv.h"
+#include "unity.h"
+#include <string.h>
+
+/* Service called through the SID table */
+static uint8_t s_serviceCalls_u8;
+static uint16_t s_serviceLen_u16;
+
+static void Service_Stub(void) {
+  s_serviceCalls_u8++;
+  s_serviceLen_u16 = g_linDiagDataLength_u16;
+}
+
+/* Entry returned by getSidCfg() for SID 0x22; other SIDs have no service */
+static DiagCfg_SidCfg_t s_sidCfg_st;
+
+static const DiagCfg_SidCfg_t *getSidCfg_Callback(uint8 sid_u8, int cmock_num_calls) {
+  (void)cmock_num_calls;
+
+  return (0x22u == sid_u8) ? &s_sidCfg_st : NULL;
+}
+
+static Std_ReturnType s_nadResult_;
+static Std_ReturnType s_lenResult_;
+
+static void CurrentNad_Callback(uint8 currentNad, Std_ReturnType *result, int cmock_num_calls) {
+  (void)currentNad;
+  (void)cmock_num_calls;
+  *result = s_nadResult_;
+}
+
+static void MsgDataLength_Callback(uint16_t dataLength, Std_ReturnType *result, int cmock_num_calls) {
+  (void)dataLength;
+  (void)cmock_num_calls;
+  *result = s_lenResult_;
+}
+
+void setUp(void) {
+  checkCurrentNad_StubWithCallback(CurrentNad_Callback);
+  checkMsgDataLength_StubWithCallback(MsgDataLength_Callback);
+  getSidCfg_StubWithCallback(getSidCfg_Callback);
+
+  s_nadResult_ = E_OK;
+  s_lenResult_ = E_OK;
+  s_sidCfg_st.minLen_u8 = 3u;
+  s_sidCfg_st.session_u8 = DIAG_CFG_SESSION_DEFAULT | DIAG_CFG_SESSION_EXTENDED;
+  s_sidCfg_st.security_u8 = 0u;
+  s_sidCfg_st.service_pf = &Service_Stub;
+  s_serviceCalls_u8 = 0u;
+  s_serviceLen_u16 = 0u;
+
+  memset(pbLinDiagBuffer, 0, sizeof(pbLinDiagBuffer));
+  pbLinDiagBuffer[0] = 0x22u;
+  g_linDiagDataLength_u16 = 0u;
+}
+
+void tearDown(void) {}
+
+/* Test: valid request -> service of the SID called once with the request length */
+void test_LinDiagRxIndication_DispatchToService(void) {
+  LinDiagRxIndication(3u);
+
+  TEST_ASSERT_EQUAL_UINT8(1u, s_serviceCalls_u8);
+  TEST_ASSERT_EQUAL_UINT16(3u, s_serviceLen_u16);
+}
+
+/* Test: request for another NAD -> no response, service not called */
+void test_LinDiagRxIndication_WrongNad_NoResponse(void) {
+  s_nadResult_ = E_NOT_OK;
+
+  LinDiagRxIndication(3u);
+
+  TEST_ASSERT_EQUAL_UINT8(0u, s_serviceCalls_u8);
+}
+
+/* Test: SID without service -> serviceNotSupported */
+void test_LinDiagRxIndication_UnknownSid(void) {
+  pbLinDiagBuffer[0] = 0x23u;
+  LinDiagSendNegResponse_Expect(kLinDiagNrcServiceNotSupported);
+
+  LinDiagRxIndication(3u);
+
+  TEST_ASSERT_EQUAL_UINT8(0u, s_serviceCalls_u8);
+}
+
+/* Test: unknown SID is reported before a wrong length */
+void test_LinDiagRxIndication_UnknownSidBeforeLength(void) {
+  pbLinDiagBuffer[0] = 0x23u;
+  s_lenResult_ = E_NOT_OK;
+  LinDiagSendNegResponse_Expect(kLinDiagNrcServiceNotSupported);
+
+  LinDiagRxIndication(1u);
+}
+
+/* Test: service not allowed in the default session -> serviceNotSupportedInActiveSession */
+void test_LinDiagRxIndication_WrongSession(void) {
+  s_sidCfg_st.session_u8 = DIAG_CFG_SESSION_EXTENDED;
+  LinDiagSendNegResponse_Expect(kLinDiagNrcServiceNotSupportedInActiveSession);
+
+  LinDiagRxIndication(3u);
+
+  TEST_ASSERT_EQUAL_UINT8(0u, s_serviceCalls_u8);
+}
+
+/* Test: checkMsgDataLength fails -> incorrectMessageLength */
+void test_LinDiagRxIndication_MsgDataLength_Fails(void) {
+  s_lenResult_ = E_NOT_OK;
+  LinDiagSendNegResponse_Expect(kLinDiagNrcIncorrectMessageLength);
+
+  LinDiagRxIndication(3u);
+
+  TEST_ASSERT_EQUAL_UINT8(0u, s_serviceCalls_u8);
+}
+
+/* Test: request shorter than the SID minimum -> incorrectMessageLength */
+void test_LinDiagRxIndication_BelowMinLength(void) {
+  LinDiagSendNegResponse_Expect(kLinDiagNrcIncorrectMessageLength);
+
+  LinDiagRxIndication(2u);
+
+  TEST_ASSERT_EQUAL_UINT8(0u, s_serviceCalls_u8);
+}
+
+/* Test: service requiring an unlocked security level -> securityAccessDenied */
+void test_LinDiagRxIndication_SecurityLocked(void) {
+  s_sidCfg_st.security_u8 = 1u;
+  LinDiagSendNegResponse_Expect(kLinDiagNrcSecurityAccessDenied);
+
+  LinDiagRxIndication(3u);
+
+  TEST_ASSERT_EQUAL_UINT8(0u, s_serviceCalls_u8);
+}
+
+/* Test: a locked service is reported before a request shorter than its minimum */
+void test_LinDiagRxIndication_SecurityBeforeMinLength(void) {
+  s_sidCfg_st.security_u8 = 1u;
+  LinDiagSendNegResponse_Expect(kLinDiagNrcSecurityAccessDenied);
+
+  LinDiagRxIndication(2u);
+
+  TEST_ASSERT_EQUAL_UINT8(0u, s_serviceCalls_u8);
+}
+
+/* Test: a locked service is reported before a failing checkMsgDataLength */
+void test_LinDiagRxIndication_SecurityBeforeMsgDataLength(void) {
+  s_sidCfg_st.security_u8 = 1u;
+  s_lenResult_ = E_NOT_OK;
+  LinDiagSendNegResponse_Expect(kLinDiagNrcSecurityAccessDenied);
+
+  LinDiagRxIndication(3u);
+
+  TEST_ASSERT_EQUAL_UINT8(0u, s_serviceCalls_u8);
+}
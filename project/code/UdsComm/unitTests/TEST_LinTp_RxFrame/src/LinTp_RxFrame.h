@@ -0,0 +1,249 @@
+#ifndef LINTP_H
+#define LINTP_H
+
+#include "linTp_cfg.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ * @defgroup LinTpModule LIN Transport Layer
+ * @brief Segmentation and reassembly of LIN diagnostic messages (ISO 17987-2).
+ *
+ * @details
+ * This module is composed of:
+ * - **linTp.h**: public interface (this file)
+ * - **linTp.c**: implementation
+ * - **linTp_cfg.h**: NAD, timing, buffer sizes, binding to the diagnostic layer
+ *
+ * **Frames** (8 bytes: NAD, PCI, 6 bytes)
+ * - Single frame (SF), PCI `0x0L`: messages of 1..6 bytes.
+ * - First frame (FF), PCI `0x1H` + length LSB: first 5 bytes of a message of 7..4095 bytes.
+ * - Consecutive frame (CF), PCI `0x2N`: next 6 bytes, sequence number N = 1, 2, .. 15, 0, 1, ..
+ *
+ * **Requests** (master request frames) are reassembled in place into
+ * @ref LINTP_RX_BUFFER; a complete request is passed on through
+ * @ref LINTP_RX_INDICATION. A new SF or FF aborts a reassembly in progress;
+ * a CF with a wrong sequence number or a gap longer than N_Cr aborts it too.
+ *
+ * **Responses** are queued in a ring buffer. A service reserves a contiguous
+ * area with LinTp_TxReserve(), writes the response straight into it and
+ * commits it with LinTp_TxCommit(); segmentation reads the frames from the
+ * ring, so the response is never copied. Responses are sent in commit order.
+ * A frame that is not confirmed within N_As drops its response.
+ *
+ * **Response pending** (NRC 0x78) notices do not go through the ring: the
+ * final response may already be reserved there while its service waits for
+ * a slow data source. LinTp_TxResponsePending() requests one notice, sent as
+ * a single frame on the next slave response header while no other response
+ * is in transmission.
+ * @{
+ */
+
+/** @brief Length of a LIN frame handled by the transport layer [byte]. */
+#define LINTP_FRAME_LEN 8u
+
+/** @brief Longest response the ring can hold as a single record [byte]. */
+#define LINTP_TX_MAX_MSG_LEN (((LINTP_TX_RING_SIZE - 2u) < 4095u) ? (uint16_t)(LINTP_TX_RING_SIZE - 2u) : (uint16_t)4095u)
+
+/**
+ * @brief Reset reassembly, the response ring and both timers.
+ *
+ * @details
+ * **Goal of the function**
+ *
+ * The purpose of this function is to bring the transport layer to its idle
+ * state at startup (or after a bus reset): no request in reassembly, no
+ * response queued or in transmission.
+ *
+ * @return None.
+ */
+void LinTp_Init(void);
+
+/**
+ * @brief Process a received master request frame.
+ *
+ * @details
+ * **Goal of the function**
+ *
+ * The purpose of this function is to reassemble diagnostic requests from the
+ * master request frames delivered by the LIN driver.
+ *
+ * The processing logic:
+ * - Ignores frames addressed to another NAD than @ref LINTP_NAD or @ref LINTP_NAD_BROADCAST.
+ * - SF or FF: aborts the reassembly in progress, drops the response in
+ *   transmission and the response pending notice; queued responses are kept.
+ * - SF with 1..6 bytes: copies the data and indicates the request.
+ * - FF with 7..@ref LINTP_RX_BUFFER_SIZE bytes: copies 5 bytes, expects CF #1,
+ *   starts N_Cr. Longer messages are ignored.
+ * - CF with the expected sequence number: copies up to 6 bytes, restarts N_Cr,
+ *   indicates the request once complete. A wrong sequence number aborts the
+ *   reassembly.
+ *
+ * @par Interface summary
+ *
+ * | Interface            | In | Out | Data type / Signature | Param | Data factor | Data offset | Data size | Data range | Data unit |
+ * |----------------------|:--:|:---:|-----------------------|:-----:|------------:|------------:|----------:|------------|----------|
+ * | frame_pu8            | X  |     | const uint8_t*        |   -   |      1      |      0      |     8     | [0,255]    | [-]      |
+ * | LINTP_RX_BUFFER      |    |  X  | uint8_t[]             |   -   |      1      |      0      |     N     | [0,255]    | [-]      |
+ * | LINTP_RX_INDICATION  |    |  X  | void(uint16_t len)    |   -   |      -      |      -      |     -     | -          | [-]      |
+ *
+ * @par Activity diagram (PlantUML)
+ *
+ * @startuml
+ * start
+ * if (NAD accepted?) then (YES)
+ *   switch (PCI type)
+ *   case (SF)
+ *     :abort reassembly;
+ *     :drop response in transmission and RCRRP notice;
+ *     if (1 <= len <= 6) then (YES)
+ *       :copy data; indicate(len);
+ *     endif
+ *   case (FF)
+ *     :abort reassembly;
+ *     :drop response in transmission and RCRRP notice;
+ *     if (7 <= len <= RX buffer) then (YES)
+ *       :copy 5 bytes; sn = 1; start N_Cr;
+ *     endif
+ *   case (CF)
+ *     if (reassembly active AND sn matches) then (YES)
+ *       :copy up to 6 bytes; sn++; restart N_Cr;
+ *       if (complete?) then (YES)
+ *         :stop N_Cr; indicate(len);
+ *       endif
+ *     else (NO)
+ *       :abort reassembly;
+ *     endif
+ *   endswitch
+ * endif
+ * stop
+ * @enduml
+ *
+ * @return None.
+ */
+void LinTp_RxFrame(const uint8_t frame_pu8[LINTP_FRAME_LEN]);
+
+/**
+ * @brief Fill the next slave response frame.
+ *
+ * @details
+ * **Goal of the function**
+ *
+ * The purpose of this function is to provide the LIN driver with the next
+ * frame of the oldest queued response when a slave response header is
+ * received. The frame is built straight from the ring buffer.
+ *
+ * The processing logic:
+ * - If no response is in transmission and a response pending notice is
+ *   requested, builds it as a single frame.
+ * - If no response is in transmission, takes the oldest committed one.
+ * - If nothing is queued, returns `false` (the slave stays silent).
+ * - Builds a SF (response of up to 6 bytes), else the FF, else the next CF;
+ *   unused bytes are set to 0xFF.
+ * - Starts N_As. The frame is built again from the same position until
+ *   LinTp_TxConfirmation() is called.
+ *
+ * @par Interface summary
+ *
+ * | Interface   | In | Out | Data type / Signature | Param | Data factor | Data offset | Data size | Data range   | Data unit |
+ * |-------------|:--:|:---:|-----------------------|:-----:|------------:|------------:|----------:|--------------|----------|
+ * | frame_pu8   |    |  X  | uint8_t*              |   -   |      1      |      0      |     8     | [0,255]      | [-]      |
+ * | return      |    |  X  | bool                  |   -   |      -      |      -      |     1     | true/false   | [-]      |
+ *
+ * @return `true` if `frame_pu8` holds a frame to send, `false` if no response is queued.
+ */
+bool LinTp_TxFrame(uint8_t frame_pu8[LINTP_FRAME_LEN]);
+
+/**
+ * @brief Confirm the transmission of the last frame built by LinTp_TxFrame().
+ *
+ * @details
+ * Stops N_As and moves to the next frame. After the last frame the response
+ * is removed from the ring.
+ *
+ * @return None.
+ */
+void LinTp_TxConfirmation(void);
+
+/**
+ * @brief Reserve a contiguous area of the response ring.
+ *
+ * @details
+ * **Goal of the function**
+ *
+ * The purpose of this function is to let a service write its response in
+ * place, in the memory the frames will be sent from.
+ *
+ * The processing logic:
+ * - Discards a reservation that was not committed.
+ * - Returns NULL if `len` is 0 or above @ref LINTP_TX_MAX_MSG_LEN.
+ * - If the ring is empty, restarts it at offset 0.
+ * - Takes the area right after the last record if it fits before the end of
+ *   the ring, otherwise the area at the start of the ring (the end is then
+ *   skipped as padding). Returns NULL if neither is free.
+ *
+ * @par Interface summary
+ *
+ * | Interface   | In | Out | Data type / Signature | Param | Data factor | Data offset | Data size | Data range                  | Data unit |
+ * |-------------|:--:|:---:|-----------------------|:-----:|------------:|------------:|----------:|-----------------------------|----------|
+ * | len_u16     | X  |     | uint16_t              |   -   |      1      |      0      |     1     | [1,LINTP_TX_MAX_MSG_LEN]    | [byte]   |
+ * | return      |    |  X  | uint8_t*              |   -   |      -      |      -      |  len_u16  | area or NULL                | [-]      |
+ *
+ * @return Pointer to `len_u16` writable bytes, NULL if the ring has no room.
+ */
+uint8_t *LinTp_TxReserve(uint16_t len_u16);
+
+/**
+ * @brief Queue the reserved response for transmission.
+ *
+ * @details
+ * Queues the first `len_u16` bytes of the open reservation (the service may
+ * use less than it reserved). Ignored without an open reservation or if
+ * `len_u16` is 0 or larger than the reservation.
+ *
+ * @return None.
+ */
+void LinTp_TxCommit(uint16_t len_u16);
+
+/**
+ * @brief Queue one "response pending" notice (7F sid 78).
+ *
+ * @details
+ * **Goal of the function**
+ *
+ * The purpose of this function is to let a service whose response is not
+ * ready keep the tester waiting (P2* instead of P2) without touching the
+ * response ring, where its final response may be reserved.
+ *
+ * The processing logic:
+ * - Stores `sid_u8`; a notice requested and not yet sent is replaced.
+ * - LinTp_TxFrame() sends it as a single frame when no response is in
+ *   transmission, before the responses queued in the ring.
+ * - Confirmation or N_As expiry ends the notice.
+ * - A new complete request drops a notice that was not sent yet.
+ *
+ * @par Interface summary
+ *
+ * | Interface   | In | Out | Data type / Signature | Param | Data factor | Data offset | Data size | Data range | Data unit |
+ * |-------------|:--:|:---:|-----------------------|:-----:|------------:|------------:|----------:|------------|----------|
+ * | sid_u8      | X  |     | uint8_t               |   -   |      1      |      0      |     1     | [0,255]    | [-]      |
+ *
+ * @return None.
+ */
+void LinTp_TxResponsePending(uint8_t sid_u8);
+
+/**
+ * @brief Supervise the N_As and N_Cr timeouts.
+ *
+ * @details
+ * Called every @ref LINTP_MAIN_PERIOD_MS. On N_Cr expiry the reassembly in
+ * progress is aborted; on N_As expiry the response in transmission is
+ * dropped and the next one is sent.
+ *
+ * @return None.
+ */
+void LinTp_MainFunction(void);
+
+/** @} */
+
+#endif /* LINTP_H */
@@ -0,0 +1,36 @@
+#ifndef LINTP_CFG_H
+#define LINTP_CFG_H
+
+#include <stdint.h>
+
+#define LINTP_NAD 0x10u
+#define LINTP_NAD_BROADCAST 0x7Fu
+
+/* N_As = N_Cr = 3 ticks */
+#define LINTP_MAIN_PERIOD_MS 10u
+#define LINTP_N_AS_MS 30u
+#define LINTP_N_CR_MS 30u
+
+/* Small ring so that the tests reach the wrap-around */
+#define LINTP_TX_RING_SIZE 64u
+
+extern uint8_t testRxBuffer_au8[32];
+extern uint16_t testRxIndicationLen_u16;
+extern uint8_t testRxIndicationCount_u8;
+extern uint8_t testRxOverflowSid_u8;
+extern uint8_t testRxOverflowCount_u8;
+
+#define LINTP_RX_BUFFER testRxBuffer_au8
+#define LINTP_RX_BUFFER_SIZE ((uint16_t)sizeof(testRxBuffer_au8))
+#define LINTP_RX_INDICATION(len)     \
+  do {                               \
+    testRxIndicationLen_u16 = (len); \
+    testRxIndicationCount_u8++;      \
+  } while(0)
+#define LINTP_RX_OVERFLOW(sid)     \
+  do {                             \
+    testRxOverflowSid_u8 = (sid);  \
+    testRxOverflowCount_u8++;      \
+  } while(0)
+
+#endif
@@ -0,0 +1,38 @@
+#ifndef LINTP_PRIV_H
+#define LINTP_PRIV_H
+
+#include "LinTp_RxFrame.h"
+#include "linTp_cfg.h"
+#include <stddef.h>
+
+/* Protocol control information, high nibble of the PCI byte */
+#define LINTP_PCI_SF 0x00u
+#define LINTP_PCI_FF 0x10u
+#define LINTP_PCI_CF 0x20u
+#define LINTP_PCI_TYPE_MASK 0xF0u
+
+/* Data bytes carried by a single, first and consecutive frame */
+#define LINTP_SF_MAX_DATA 6u
+#define LINTP_FF_DATA 5u
+#define LINTP_CF_DATA 6u
+
+/* Filler byte of unused frame bytes */
+#define LINTP_FILLER 0xFFu
+
+/* Response ring record: 2-byte big-endian length followed by the message. A
+ * length of LINTP_TX_WRAP_MARK tells the reader that the rest of the ring is
+ * padding and the next record starts at offset 0. */
+#define LINTP_TX_HDR_LEN 2u
+#define LINTP_TX_WRAP_MARK 0xFFFFu
+
+/* Response pending notice: 7F <sid> 78 */
+#define LINTP_RCRRP_LEN 3u
+#define LINTP_RCRRP_NRC 0x78u
+#define LINTP_RCRRP_NONE 0u      /* No notice */
+#define LINTP_RCRRP_REQUESTED 1u /* Waiting for a slave response header */
+#define LINTP_RCRRP_SENT 2u      /* Frame handed to the driver, awaiting confirmation */
+
+#define LINTP_N_AS_TICKS ((uint16_t)((LINTP_N_AS_MS + LINTP_MAIN_PERIOD_MS - 1u) / LINTP_MAIN_PERIOD_MS))
+#define LINTP_N_CR_TICKS ((uint16_t)((LINTP_N_CR_MS + LINTP_MAIN_PERIOD_MS - 1u) / LINTP_MAIN_PERIOD_MS))
+
+#endif
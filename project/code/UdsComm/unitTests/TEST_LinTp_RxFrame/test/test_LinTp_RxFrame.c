@@ -0,0 +1,207 @@
+#include "LinTp_RxFrame.h"
+#include "unity.h"
+#include <string.h>
+
+uint8_t testRxBuffer_au8[32];
+uint16_t testRxIndicationLen_u16;
+uint8_t testRxIndicationCount_u8;
+uint8_t testRxOverflowSid_u8;
+uint8_t testRxOverflowCount_u8;
+
+static void rxFrame(uint8_t nad, uint8_t pci, uint8_t d0, uint8_t d1, uint8_t d2, uint8_t d3, uint8_t d4, uint8_t d5) {
+  const uint8_t l_frame_au8[LINTP_FRAME_LEN] = {nad, pci, d0, d1, d2, d3, d4, d5};
+
+  LinTp_RxFrame(l_frame_au8);
+}
+
+/* FF + CF#1 + CF#2 of a 15-byte request: 0x22, then bytes 1..14 */
+static void rxFirstFrame15(void) { rxFrame(0x10u, 0x10u, 15u, 0x22u, 1u, 2u, 3u, 4u); }
+static void rxConsecutiveFrame1(void) { rxFrame(0x10u, 0x21u, 5u, 6u, 7u, 8u, 9u, 10u); }
+static void rxConsecutiveFrame2(void) { rxFrame(0x10u, 0x22u, 11u, 12u, 13u, 14u, 0xFFu, 0xFFu); }
+
+void setUp(void) {
+  memset(testRxBuffer_au8, 0, sizeof(testRxBuffer_au8));
+  testRxIndicationLen_u16 = 0u;
+  testRxIndicationCount_u8 = 0u;
+  testRxOverflowSid_u8 = 0u;
+  testRxOverflowCount_u8 = 0u;
+  LinTp_Init();
+}
+
+void tearDown(void) {}
+
+/* Test: single frame is copied and indicated at once */
+void test_LinTp_RxFrame_SingleFrame(void) {
+  rxFrame(0x10u, 0x03u, 0x22u, 0xF3u, 0x08u, 0xFFu, 0xFFu, 0xFFu);
+
+  TEST_ASSERT_EQUAL_UINT8(1u, testRxIndicationCount_u8);
+  TEST_ASSERT_EQUAL_UINT16(3u, testRxIndicationLen_u16);
+  TEST_ASSERT_EQUAL_HEX8(0x22u, testRxBuffer_au8[0]);
+  TEST_ASSERT_EQUAL_HEX8(0xF3u, testRxBuffer_au8[1]);
+  TEST_ASSERT_EQUAL_HEX8(0x08u, testRxBuffer_au8[2]);
+  TEST_ASSERT_EQUAL_HEX8(0x00u, testRxBuffer_au8[3]);
+}
+
+/* Test: broadcast NAD is accepted, other NADs are ignored */
+void test_LinTp_RxFrame_NadFiltering(void) {
+  rxFrame(0x11u, 0x01u, 0x3Eu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu);
+  TEST_ASSERT_EQUAL_UINT8(0u, testRxIndicationCount_u8);
+
+  rxFrame(0x7Fu, 0x01u, 0x3Eu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu);
+  TEST_ASSERT_EQUAL_UINT8(1u, testRxIndicationCount_u8);
+  TEST_ASSERT_EQUAL_UINT16(1u, testRxIndicationLen_u16);
+}
+
+/* Test: single frame with length 0 or above 6 is ignored */
+void test_LinTp_RxFrame_SingleFrameInvalidLength(void) {
+  rxFrame(0x10u, 0x00u, 0x22u, 0xF3u, 0x08u, 0xFFu, 0xFFu, 0xFFu);
+  rxFrame(0x10u, 0x07u, 0x22u, 0xF3u, 0x08u, 0xFFu, 0xFFu, 0xFFu);
+
+  TEST_ASSERT_EQUAL_UINT8(0u, testRxIndicationCount_u8);
+}
+
+/* Test: FF + 2 CF are reassembled, indication only after the last CF */
+void test_LinTp_RxFrame_Segmented(void) {
+  uint8_t l_idx_u8;
+
+  rxFirstFrame15();
+  rxConsecutiveFrame1();
+  TEST_ASSERT_EQUAL_UINT8(0u, testRxIndicationCount_u8);
+
+  rxConsecutiveFrame2();
+  TEST_ASSERT_EQUAL_UINT8(1u, testRxIndicationCount_u8);
+  TEST_ASSERT_EQUAL_UINT16(15u, testRxIndicationLen_u16);
+  TEST_ASSERT_EQUAL_HEX8(0x22u, testRxBuffer_au8[0]);
+  for(l_idx_u8 = 1u; l_idx_u8 < 15u; l_idx_u8++) { TEST_ASSERT_EQUAL_HEX8(l_idx_u8, testRxBuffer_au8[l_idx_u8]); }
+  /* Filler bytes of the last CF are not copied */
+  TEST_ASSERT_EQUAL_HEX8(0x00u, testRxBuffer_au8[15]);
+}
+
+/* Test: CF with a wrong sequence number aborts the reassembly */
+void test_LinTp_RxFrame_WrongSequenceNumber(void) {
+  rxFirstFrame15();
+  rxConsecutiveFrame2();
+  rxConsecutiveFrame1();
+
+  TEST_ASSERT_EQUAL_UINT8(0u, testRxIndicationCount_u8);
+}
+
+/* Test: CF without FF is ignored */
+void test_LinTp_RxFrame_ConsecutiveFrameWithoutFirstFrame(void) {
+  rxConsecutiveFrame1();
+
+  TEST_ASSERT_EQUAL_UINT8(0u, testRxIndicationCount_u8);
+}
+
+/* Test: FF announcing more than the RX buffer is not reassembled, its SID is reported once */
+void test_LinTp_RxFrame_FirstFrameTooLong(void) {
+  rxFrame(0x10u, 0x10u, 33u, 0x22u, 1u, 2u, 3u, 4u);
+  rxConsecutiveFrame1();
+
+  TEST_ASSERT_EQUAL_UINT8(0u, testRxIndicationCount_u8);
+  TEST_ASSERT_EQUAL_UINT8(1u, testRxOverflowCount_u8);
+  TEST_ASSERT_EQUAL_HEX8(0x22u, testRxOverflowSid_u8);
+  TEST_ASSERT_EQUAL_HEX8(0x00u, testRxBuffer_au8[0]);
+}
+
+/* Test: FF that fits the RX buffer is not reported as overflow */
+void test_LinTp_RxFrame_FirstFrameFitsBuffer(void) {
+  rxFrame(0x10u, 0x10u, 32u, 0x22u, 1u, 2u, 3u, 4u);
+
+  TEST_ASSERT_EQUAL_UINT8(0u, testRxOverflowCount_u8);
+}
+
+/* Test: SF during a reassembly replaces the segmented request */
+void test_LinTp_RxFrame_SingleFrameAbortsReassembly(void) {
+  rxFirstFrame15();
+  rxFrame(0x10u, 0x01u, 0x3Eu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu);
+  rxConsecutiveFrame1();
+  rxConsecutiveFrame2();
+
+  TEST_ASSERT_EQUAL_UINT8(1u, testRxIndicationCount_u8);
+  TEST_ASSERT_EQUAL_UINT16(1u, testRxIndicationLen_u16);
+}
+
+/* Test: gap of N_Cr between two frames aborts the reassembly */
+void test_LinTp_RxFrame_NcrTimeout(void) {
+  rxFirstFrame15();
+  LinTp_MainFunction();
+  LinTp_MainFunction();
+  LinTp_MainFunction();
+  rxConsecutiveFrame1();
+  rxConsecutiveFrame2();
+
+  TEST_ASSERT_EQUAL_UINT8(0u, testRxIndicationCount_u8);
+}
+
+/* Test: each CF restarts N_Cr */
+void test_LinTp_RxFrame_NcrRestartedByConsecutiveFrame(void) {
+  rxFirstFrame15();
+  LinTp_MainFunction();
+  LinTp_MainFunction();
+  rxConsecutiveFrame1();
+  LinTp_MainFunction();
+  LinTp_MainFunction();
+  rxConsecutiveFrame2();
+
+  TEST_ASSERT_EQUAL_UINT8(1u, testRxIndicationCount_u8);
+  TEST_ASSERT_EQUAL_UINT16(15u, testRxIndicationLen_u16);
+}
+
+/* Test: a new request drops a response pending notice that was not sent yet */
+void test_LinTp_RxFrame_NewRequestDropsResponsePending(void) {
+  uint8_t l_frame_au8[LINTP_FRAME_LEN];
+
+  LinTp_TxResponsePending(0x22u);
+  rxFrame(0x10u, 0x01u, 0x3Eu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu);
+
+  TEST_ASSERT_EQUAL_UINT8(1u, testRxIndicationCount_u8);
+  TEST_ASSERT_FALSE(LinTp_TxFrame(l_frame_au8));
+}
+
+/* Test: a new request drops the segmented response in transmission, the record queued behind it is sent next */
+void test_LinTp_RxFrame_NewRequestDropsSegmentedResponse(void) {
+  uint8_t l_frame_au8[LINTP_FRAME_LEN];
+  uint8_t *l_area_pu8;
+
+  /* 10-byte response in transmission, 3-byte periodic DID record queued behind it */
+  l_area_pu8 = LinTp_TxReserve(10u);
+  memset(l_area_pu8, 0x62, 10u);
+  LinTp_TxCommit(10u);
+  l_area_pu8 = LinTp_TxReserve(3u);
+  l_area_pu8[0] = 0xA1u;
+  l_area_pu8[1] = 0x55u;
+  l_area_pu8[2] = 0x66u;
+  LinTp_TxCommit(3u);
+  TEST_ASSERT_TRUE(LinTp_TxFrame(l_frame_au8));
+  TEST_ASSERT_EQUAL_HEX8(0x10u, l_frame_au8[1]); /* FF */
+  LinTp_TxConfirmation();
+
+  rxFirstFrame15();
+
+  TEST_ASSERT_TRUE(LinTp_TxFrame(l_frame_au8));
+  TEST_ASSERT_EQUAL_HEX8(0x03u, l_frame_au8[1]); /* SF of the queued record, not CF#1 */
+  TEST_ASSERT_EQUAL_HEX8(0xA1u, l_frame_au8[2]);
+  LinTp_TxConfirmation();
+  TEST_ASSERT_FALSE(LinTp_TxFrame(l_frame_au8));
+}
+
+/* Test: a new request drops a response pending notice awaiting confirmation, it is not repeated */
+void test_LinTp_RxFrame_NewRequestDropsSentResponsePending(void) {
+  uint8_t l_frame_au8[LINTP_FRAME_LEN];
+  uint8_t *l_area_pu8;
+
+  LinTp_TxResponsePending(0x22u);
+  TEST_ASSERT_TRUE(LinTp_TxFrame(l_frame_au8));
+  TEST_ASSERT_EQUAL_HEX8(0x78u, l_frame_au8[4]);
+
+  rxFrame(0x10u, 0x01u, 0x3Eu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu);
+  l_area_pu8 = LinTp_TxReserve(2u);
+  l_area_pu8[0] = 0x7Eu;
+  l_area_pu8[1] = 0x00u;
+  LinTp_TxCommit(2u);
+
+  TEST_ASSERT_TRUE(LinTp_TxFrame(l_frame_au8));
+  TEST_ASSERT_EQUAL_HEX8(0x02u, l_frame_au8[1]);
+  TEST_ASSERT_EQUAL_HEX8(0x7Eu, l_frame_au8[2]);
+}
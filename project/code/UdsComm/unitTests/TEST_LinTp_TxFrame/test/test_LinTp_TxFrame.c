@@ -0,0 +1,258 @@
+#include "LinTp_TxFrame.h"
+#include "unity.h"
+#include <string.h>
+
+uint8_t testRxBuffer_au8[32];
+uint16_t testRxIndicationLen_u16;
+uint8_t testRxIndicationCount_u8;
+uint8_t testRxOverflowSid_u8;
+uint8_t testRxOverflowCount_u8;
+
+/* Queue a response of len bytes: first, first + 1, .. */
+static void queueResponse(uint16_t len, uint8_t first) {
+  uint8_t *l_area_pu8 = LinTp_TxReserve(len);
+  uint16_t l_idx_u16;
+
+  TEST_ASSERT_NOT_NULL(l_area_pu8);
+  for(l_idx_u16 = 0u; l_idx_u16 < len; l_idx_u16++) { l_area_pu8[l_idx_u16] = (uint8_t)(first + l_idx_u16); }
+  LinTp_TxCommit(len);
+}
+
+/* Send and confirm one frame, checking NAD and PCI */
+static void sendFrame(uint8_t frame[LINTP_FRAME_LEN], uint8_t pci) {
+  TEST_ASSERT_TRUE(LinTp_TxFrame(frame));
+  TEST_ASSERT_EQUAL_HEX8(0x10u, frame[0]);
+  TEST_ASSERT_EQUAL_HEX8(pci, frame[1]);
+  LinTp_TxConfirmation();
+}
+
+void setUp(void) { LinTp_Init(); }
+
+void tearDown(void) {}
+
+/* Test: nothing queued, the slave stays silent */
+void test_LinTp_TxFrame_Empty(void) {
+  uint8_t l_frame_au8[LINTP_FRAME_LEN];
+
+  TEST_ASSERT_FALSE(LinTp_TxFrame(l_frame_au8));
+}
+
+/* Test: response of up to 6 bytes is sent as a padded single frame */
+void test_LinTp_TxFrame_SingleFrame(void) {
+  uint8_t l_frame_au8[LINTP_FRAME_LEN];
+
+  queueResponse(3u, 0x62u);
+  sendFrame(l_frame_au8, 0x03u);
+
+  TEST_ASSERT_EQUAL_HEX8(0x62u, l_frame_au8[2]);
+  TEST_ASSERT_EQUAL_HEX8(0x63u, l_frame_au8[3]);
+  TEST_ASSERT_EQUAL_HEX8(0x64u, l_frame_au8[4]);
+  TEST_ASSERT_EQUAL_HEX8(0xFFu, l_frame_au8[5]);
+  TEST_ASSERT_EQUAL_HEX8(0xFFu, l_frame_au8[7]);
+  TEST_ASSERT_FALSE(LinTp_TxFrame(l_frame_au8));
+}
+
+/* Test: 20-byte response is sent as FF (5) + CF#1 (6) + CF#2 (6) + CF#3 (3) */
+void test_LinTp_TxFrame_Segmented(void) {
+  uint8_t l_frame_au8[LINTP_FRAME_LEN];
+
+  queueResponse(20u, 0u);
+
+  sendFrame(l_frame_au8, 0x10u);
+  TEST_ASSERT_EQUAL_HEX8(20u, l_frame_au8[2]);
+  TEST_ASSERT_EQUAL_HEX8(0u, l_frame_au8[3]);
+  TEST_ASSERT_EQUAL_HEX8(4u, l_frame_au8[7]);
+
+  sendFrame(l_frame_au8, 0x21u);
+  TEST_ASSERT_EQUAL_HEX8(5u, l_frame_au8[2]);
+  TEST_ASSERT_EQUAL_HEX8(10u, l_frame_au8[7]);
+
+  sendFrame(l_frame_au8, 0x22u);
+  TEST_ASSERT_EQUAL_HEX8(11u, l_frame_au8[2]);
+
+  sendFrame(l_frame_au8, 0x23u);
+  TEST_ASSERT_EQUAL_HEX8(17u, l_frame_au8[2]);
+  TEST_ASSERT_EQUAL_HEX8(19u, l_frame_au8[4]);
+  TEST_ASSERT_EQUAL_HEX8(0xFFu, l_frame_au8[5]);
+
+  TEST_ASSERT_FALSE(LinTp_TxFrame(l_frame_au8));
+}
+
+/* Test: an unconfirmed frame is built again from the same position */
+void test_LinTp_TxFrame_RepeatUntilConfirmed(void) {
+  uint8_t l_frame_au8[LINTP_FRAME_LEN];
+
+  queueResponse(8u, 0u);
+  TEST_ASSERT_TRUE(LinTp_TxFrame(l_frame_au8));
+  sendFrame(l_frame_au8, 0x10u);
+  TEST_ASSERT_TRUE(LinTp_TxFrame(l_frame_au8));
+  sendFrame(l_frame_au8, 0x21u);
+  TEST_ASSERT_EQUAL_HEX8(5u, l_frame_au8[2]);
+}
+
+/* Test: responses are sent in commit order */
+void test_LinTp_TxFrame_CommitOrder(void) {
+  uint8_t l_frame_au8[LINTP_FRAME_LEN];
+
+  queueResponse(2u, 0xA0u);
+  queueResponse(1u, 0xB0u);
+
+  sendFrame(l_frame_au8, 0x02u);
+  TEST_ASSERT_EQUAL_HEX8(0xA0u, l_frame_au8[2]);
+  sendFrame(l_frame_au8, 0x01u);
+  TEST_ASSERT_EQUAL_HEX8(0xB0u, l_frame_au8[2]);
+}
+
+/* Test: commit of fewer bytes than reserved sends only those */
+void test_LinTp_TxFrame_PartialCommit(void) {
+  uint8_t l_frame_au8[LINTP_FRAME_LEN];
+  uint8_t *l_area_pu8 = LinTp_TxReserve(10u);
+
+  TEST_ASSERT_NOT_NULL(l_area_pu8);
+  l_area_pu8[0] = 0x7Fu;
+  l_area_pu8[1] = 0x22u;
+  l_area_pu8[2] = 0x31u;
+  LinTp_TxCommit(3u);
+
+  sendFrame(l_frame_au8, 0x03u);
+  TEST_ASSERT_EQUAL_HEX8(0x31u, l_frame_au8[4]);
+}
+
+/* Test: reservation without commit sends nothing and is replaced by the next one */
+void test_LinTp_TxFrame_UncommittedReservation(void) {
+  uint8_t l_frame_au8[LINTP_FRAME_LEN];
+
+  TEST_ASSERT_NOT_NULL(LinTp_TxReserve(4u));
+  TEST_ASSERT_FALSE(LinTp_TxFrame(l_frame_au8));
+  LinTp_TxCommit(5u);
+  TEST_ASSERT_FALSE(LinTp_TxFrame(l_frame_au8));
+
+  queueResponse(1u, 0x50u);
+  sendFrame(l_frame_au8, 0x01u);
+  TEST_ASSERT_EQUAL_HEX8(0x50u, l_frame_au8[2]);
+}
+
+/* Test: length 0, above the max length, or without room returns NULL */
+void test_LinTp_TxFrame_ReserveLimits(void) {
+  TEST_ASSERT_NULL(LinTp_TxReserve(0u));
+  TEST_ASSERT_NULL(LinTp_TxReserve(LINTP_TX_MAX_MSG_LEN + 1u));
+  queueResponse(40u, 0u);
+  /* 64 - 42 = 22 bytes left: 20 + header fits, 21 + header does not */
+  TEST_ASSERT_NULL(LinTp_TxReserve(21u));
+  TEST_ASSERT_NOT_NULL(LinTp_TxReserve(20u));
+}
+
+/* Test: a record that does not fit before the end of the ring wraps to offset 0 */
+void test_LinTp_TxFrame_RingWrap(void) {
+  uint8_t l_frame_au8[LINTP_FRAME_LEN];
+  uint8_t l_cf_u8;
+
+  /* Ring: [0,22) A, [22,44) B; A sent and released */
+  queueResponse(20u, 0u);
+  queueResponse(20u, 100u);
+  sendFrame(l_frame_au8, 0x10u);
+  for(l_cf_u8 = 1u; l_cf_u8 <= 3u; l_cf_u8++) { sendFrame(l_frame_au8, (uint8_t)(0x20u + l_cf_u8)); }
+
+  /* 20 bytes left at the end, 22 free at the start: C wraps */
+  queueResponse(20u, 200u);
+  TEST_ASSERT_NULL(LinTp_TxReserve(1u));
+
+  sendFrame(l_frame_au8, 0x10u);
+  TEST_ASSERT_EQUAL_HEX8(100u, l_frame_au8[3]);
+  for(l_cf_u8 = 1u; l_cf_u8 <= 3u; l_cf_u8++) { sendFrame(l_frame_au8, (uint8_t)(0x20u + l_cf_u8)); }
+
+  sendFrame(l_frame_au8, 0x10u);
+  TEST_ASSERT_EQUAL_HEX8(200u, l_frame_au8[3]);
+  for(l_cf_u8 = 1u; l_cf_u8 <= 3u; l_cf_u8++) { sendFrame(l_frame_au8, (uint8_t)(0x20u + l_cf_u8)); }
+  TEST_ASSERT_EQUAL_HEX8(219u, l_frame_au8[4]);
+
+  TEST_ASSERT_FALSE(LinTp_TxFrame(l_frame_au8));
+  /* Empty ring restarts at offset 0: the largest record fits again */
+  TEST_ASSERT_NOT_NULL(LinTp_TxReserve(LINTP_TX_MAX_MSG_LEN));
+}
+
+/* Test: longest response of the ring, 62 = FF (5) + 9 x CF (6) + CF#10 (3) */
+void test_LinTp_TxFrame_LongestResponse(void) {
+  uint8_t l_frame_au8[LINTP_FRAME_LEN];
+  uint8_t l_cf_u8;
+
+  queueResponse(LINTP_TX_MAX_MSG_LEN, 0u);
+  sendFrame(l_frame_au8, 0x10u);
+  TEST_ASSERT_EQUAL_HEX8(62u, l_frame_au8[2]);
+  for(l_cf_u8 = 1u; l_cf_u8 <= 10u; l_cf_u8++) { sendFrame(l_frame_au8, (uint8_t)(0x20u + l_cf_u8)); }
+  TEST_ASSERT_EQUAL_HEX8(61u, l_frame_au8[4]);
+  TEST_ASSERT_EQUAL_HEX8(0xFFu, l_frame_au8[5]);
+  TEST_ASSERT_FALSE(LinTp_TxFrame(l_frame_au8));
+}
+
+/* Test: frame not confirmed within N_As drops its response */
+void test_LinTp_TxFrame_NasTimeout(void) {
+  uint8_t l_frame_au8[LINTP_FRAME_LEN];
+
+  queueResponse(20u, 0u);
+  queueResponse(1u, 0xB0u);
+  sendFrame(l_frame_au8, 0x10u);
+  TEST_ASSERT_TRUE(LinTp_TxFrame(l_frame_au8));
+  LinTp_MainFunction();
+  LinTp_MainFunction();
+  LinTp_MainFunction();
+
+  sendFrame(l_frame_au8, 0x01u);
+  TEST_ASSERT_EQUAL_HEX8(0xB0u, l_frame_au8[2]);
+}
+
+/* Test: response pending notice is a single frame 7F sid 78, sent once */
+void test_LinTp_TxFrame_ResponsePending(void) {
+  uint8_t l_frame_au8[LINTP_FRAME_LEN];
+
+  LinTp_TxResponsePending(0x22u);
+  sendFrame(l_frame_au8, 0x03u);
+
+  TEST_ASSERT_EQUAL_HEX8(0x7Fu, l_frame_au8[2]);
+  TEST_ASSERT_EQUAL_HEX8(0x22u, l_frame_au8[3]);
+  TEST_ASSERT_EQUAL_HEX8(0x78u, l_frame_au8[4]);
+  TEST_ASSERT_EQUAL_HEX8(0xFFu, l_frame_au8[5]);
+  TEST_ASSERT_FALSE(LinTp_TxFrame(l_frame_au8));
+}
+
+/* Test: notice goes out while the final response is reserved, the response follows once committed */
+void test_LinTp_TxFrame_ResponsePendingWithOpenReservation(void) {
+  uint8_t l_frame_au8[LINTP_FRAME_LEN];
+  uint8_t *l_area_pu8 = LinTp_TxReserve(2u);
+
+  TEST_ASSERT_NOT_NULL(l_area_pu8);
+  LinTp_TxResponsePending(0x22u);
+  sendFrame(l_frame_au8, 0x03u);
+  TEST_ASSERT_EQUAL_HEX8(0x78u, l_frame_au8[4]);
+
+  l_area_pu8[0] = 0x62u;
+  l_area_pu8[1] = 0x01u;
+  LinTp_TxCommit(2u);
+  sendFrame(l_frame_au8, 0x02u);
+  TEST_ASSERT_EQUAL_HEX8(0x62u, l_frame_au8[2]);
+}
+
+/* Test: notice waits for the end of a segmented response in transmission */
+void test_LinTp_TxFrame_ResponsePendingAfterSegmentedResponse(void) {
+  uint8_t l_frame_au8[LINTP_FRAME_LEN];
+
+  queueResponse(8u, 0u);
+  sendFrame(l_frame_au8, 0x10u);
+  LinTp_TxResponsePending(0x22u);
+  sendFrame(l_frame_au8, 0x21u);
+  sendFrame(l_frame_au8, 0x03u);
+  TEST_ASSERT_EQUAL_HEX8(0x78u, l_frame_au8[4]);
+}
+
+/* Test: unconfirmed notice is dropped on N_As expiry */
+void test_LinTp_TxFrame_ResponsePendingNasTimeout(void) {
+  uint8_t l_frame_au8[LINTP_FRAME_LEN];
+
+  LinTp_TxResponsePending(0x22u);
+  TEST_ASSERT_TRUE(LinTp_TxFrame(l_frame_au8));
+  LinTp_MainFunction();
+  LinTp_MainFunction();
+  LinTp_MainFunction();
+
+  TEST_ASSERT_FALSE(LinTp_TxFrame(l_frame_au8));
+}
@@ -0,0 +1,20 @@
+#include "checkDidAccess.h"
+#include "diagnostic_cfg.h"
+#define NULL ((void *)0)
+
+/* FUNCTION TO TEST */
+
+Std_ReturnType checkDidAccess(const DiagCfg_DidCfg_t *didCfg_pst, uint8 access_u8, uint8 *errCode_pu8) {
+  Std_ReturnType l_result_ = E_NOT_OK;
+
+  /* A DID outside the active session is hidden like an unknown DID */
+  if((NULL == didCfg_pst) || (0u == (didCfg_pst->access_u8 & access_u8)) || (0u == (didCfg_pst->session_u8 & LinDiagGetSession()))) {
+    *errCode_pu8 = kLinDiagNrcRequestOutOfRange;
+  } else if(didCfg_pst->security_u8 > LinDiagGetSecurityLevel()) {
+    *errCode_pu8 = kLinDiagNrcSecurityAccessDenied;
+  } else {
+    l_result_ = E_OK;
+  }
+
+  return l_result_;
+}
@@ -0,0 +1,8 @@
+#ifndef DIAGNOSTIC_H
+#define DIAGNOSTIC_H
+#include "diagnostic_cfg.h"
+#include <stdint.h>
+
+Std_ReturnType checkDidAccess(const DiagCfg_DidCfg_t *didCfg_pst, uint8 access_u8, uint8 *errCode_pu8);
+
+#endif
@@ -0,0 +1,84 @@
+#include "checkDidAccess.h"
+#include "mock_diagnostic_cfg.h"
+#include "unity.h"
+
+/* Readable in the default and extended sessions, unlocked */
+static const DiagCfg_DidCfg_t s_openCfg_cst = {0xF308, 1u, DIAG_CFG_ACCESS_READ, DIAG_CFG_SESSION_DEFAULT | DIAG_CFG_SESSION_EXTENDED, 0u, DIAG_CFG_DID_DYNAMIC,
+                                               DIAG_CFG_CACHE_NEVER, DIAG_CFG_CACHE_NO_SLOT, 0u, 0u, NULL, NULL};
+/* Readable and writable in the extended session only, security level 1 */
+static const DiagCfg_DidCfg_t s_lockedCfg_cst = {0xFD00, 3u, DIAG_CFG_ACCESS_READ | DIAG_CFG_ACCESS_WRITE, DIAG_CFG_SESSION_EXTENDED, 1u, DIAG_CFG_DID_DYNAMIC,
+                                                 DIAG_CFG_CACHE_NEVER, DIAG_CFG_CACHE_NO_SLOT, 0u, 0u, NULL, NULL};
+
+void setUp(void) {}
+
+void tearDown(void) {}
+
+/* Test: DID readable in the active session and unlocked, NRC untouched */
+void test_checkDidAccess_Allowed(void) {
+  uint8 l_errCode_u8 = 0u;
+
+  LinDiagGetSession_IgnoreAndReturn(DIAG_CFG_SESSION_DEFAULT);
+  LinDiagGetSecurityLevel_IgnoreAndReturn(0u);
+
+  TEST_ASSERT_EQUAL(E_OK, checkDidAccess(&s_openCfg_cst, DIAG_CFG_ACCESS_READ, &l_errCode_u8));
+  TEST_ASSERT_EQUAL_HEX8(0x00, l_errCode_u8);
+}
+
+/* Test: unknown DID is answered with requestOutOfRange */
+void test_checkDidAccess_UnknownDid(void) {
+  uint8 l_errCode_u8 = 0u;
+
+  LinDiagGetSession_IgnoreAndReturn(DIAG_CFG_SESSION_DEFAULT);
+  LinDiagGetSecurityLevel_IgnoreAndReturn(0u);
+
+  TEST_ASSERT_EQUAL(E_NOT_OK, checkDidAccess(NULL, DIAG_CFG_ACCESS_READ, &l_errCode_u8));
+  TEST_ASSERT_EQUAL_HEX8(kLinDiagNrcRequestOutOfRange, l_errCode_u8);
+}
+
+/* Test: service not in the access mask is answered with requestOutOfRange */
+void test_checkDidAccess_AccessNotAllowed(void) {
+  uint8 l_errCode_u8 = 0u;
+
+  LinDiagGetSession_IgnoreAndReturn(DIAG_CFG_SESSION_DEFAULT);
+  LinDiagGetSecurityLevel_IgnoreAndReturn(0u);
+
+  TEST_ASSERT_EQUAL(E_NOT_OK, checkDidAccess(&s_openCfg_cst, DIAG_CFG_ACCESS_WRITE, &l_errCode_u8));
+  TEST_ASSERT_EQUAL_HEX8(kLinDiagNrcRequestOutOfRange, l_errCode_u8);
+}
+
+/* Test: DID of the extended session read in the default session is answered with requestOutOfRange */
+void test_checkDidAccess_SessionMismatch(void) {
+  uint8 l_errCode_u8 = 0u;
+
+  LinDiagGetSession_IgnoreAndReturn(DIAG_CFG_SESSION_DEFAULT);
+  LinDiagGetSecurityLevel_IgnoreAndReturn(1u);
+
+  TEST_ASSERT_EQUAL(E_NOT_OK, checkDidAccess(&s_lockedCfg_cst, DIAG_CFG_ACCESS_READ, &l_errCode_u8));
+  TEST_ASSERT_EQUAL_HEX8(kLinDiagNrcRequestOutOfRange, l_errCode_u8);
+}
+
+/* Test: DID above the unlocked security level is answered with securityAccessDenied, for reads and writes */
+void test_checkDidAccess_SecurityLocked(void) {
+  uint8 l_errCode_u8 = 0u;
+
+  LinDiagGetSession_IgnoreAndReturn(DIAG_CFG_SESSION_EXTENDED);
+  LinDiagGetSecurityLevel_IgnoreAndReturn(0u);
+
+  TEST_ASSERT_EQUAL(E_NOT_OK, checkDidAccess(&s_lockedCfg_cst, DIAG_CFG_ACCESS_READ, &l_errCode_u8));
+  TEST_ASSERT_EQUAL_HEX8(kLinDiagNrcSecurityAccessDenied, l_errCode_u8);
+
+  l_errCode_u8 = 0u;
+  TEST_ASSERT_EQUAL(E_NOT_OK, checkDidAccess(&s_lockedCfg_cst, DIAG_CFG_ACCESS_WRITE, &l_errCode_u8));
+  TEST_ASSERT_EQUAL_HEX8(kLinDiagNrcSecurityAccessDenied, l_errCode_u8);
+}
+
+/* Test: the same DID is accessible once the session and the security level match */
+void test_checkDidAccess_SecurityUnlocked(void) {
+  uint8 l_errCode_u8 = 0u;
+
+  LinDiagGetSession_IgnoreAndReturn(DIAG_CFG_SESSION_EXTENDED);
+  LinDiagGetSecurityLevel_IgnoreAndReturn(1u);
+
+  TEST_ASSERT_EQUAL(E_OK, checkDidAccess(&s_lockedCfg_cst, DIAG_CFG_ACCESS_WRITE, &l_errCode_u8));
+  TEST_ASSERT_EQUAL_HEX8(0x00, l_errCode_u8);
+}
@@ -0,0 +1,66 @@
+#include "checkDidCfgCrc.h"
+#define NULL ((void *)0)
+
+/* CRC-8/ATM of one byte as an integer constant expression (same expansion as
+ * EDD_CRC8_CT_BYTE; the component is built standalone and does not see the
+ * ErrorDataDetection headers). */
+#define DIAG_CFG_CRC8_BYTE(crc, byte)                                                                                                                                          \
+  ((((((crc) ^ (byte)) >> 0) & 1u) * 0x07u) ^ (((((crc) ^ (byte)) >> 1) & 1u) * 0x0Eu) ^ (((((crc) ^ (byte)) >> 2) & 1u) * 0x1Cu) ^                                           \
+   (((((crc) ^ (byte)) >> 3) & 1u) * 0x38u) ^ (((((crc) ^ (byte)) >> 4) & 1u) * 0x70u) ^ (((((crc) ^ (byte)) >> 5) & 1u) * 0xE0u) ^                                            \
+   (((((crc) ^ (byte)) >> 6) & 1u) * 0xC7u) ^ (((((crc) ^ (byte)) >> 7) & 1u) * 0x89u))
+
+#define DIAG_CFG_CRC8_U16(crc, value) DIAG_CFG_CRC8_BYTE(DIAG_CFG_CRC8_BYTE((crc), ((value) & 0xFFu)), (((value) >> 8) & 0xFFu))
+
+DiagCfg_DidCfg_t DiagCfg_DidCfg_cst[DIAG_CFG_DID_COUNT] = {
+    /* IS_OVERVOLT_FLAG */
+    {DID_F308, DID_F308_SIZE, DID_F308_ACCESS, DID_F308_SESSION, DID_F308_SECURITY, DID_F308_KIND, DID_F308_CACHE, DID_F308_CACHE_SLOT, DID_F308_CACHE_TTL, DID_F308_CACHE_OFS, NULL},
+};
+
+/* One constant per table field, in table order: the expansion stays linear */
+enum {
+  DIAG_CFG_CRC_F308_DID = DIAG_CFG_CRC8_U16(0x00u, DID_F308),
+  DIAG_CFG_CRC_F308_SIZE = DIAG_CFG_CRC8_BYTE(DIAG_CFG_CRC_F308_DID, DID_F308_SIZE),
+  DIAG_CFG_CRC_F308_ACCESS = DIAG_CFG_CRC8_BYTE(DIAG_CFG_CRC_F308_SIZE, DID_F308_ACCESS),
+  DIAG_CFG_CRC_F308_SESSION = DIAG_CFG_CRC8_BYTE(DIAG_CFG_CRC_F308_ACCESS, DID_F308_SESSION),
+  DIAG_CFG_CRC_F308_SECURITY = DIAG_CFG_CRC8_BYTE(DIAG_CFG_CRC_F308_SESSION, DID_F308_SECURITY),
+  DIAG_CFG_CRC_F308_KIND = DIAG_CFG_CRC8_BYTE(DIAG_CFG_CRC_F308_SECURITY, DID_F308_KIND),
+  DIAG_CFG_CRC_F308_CACHE = DIAG_CFG_CRC8_BYTE(DIAG_CFG_CRC_F308_KIND, DID_F308_CACHE),
+  DIAG_CFG_CRC_F308_CACHE_SLOT = DIAG_CFG_CRC8_BYTE(DIAG_CFG_CRC_F308_CACHE, DID_F308_CACHE_SLOT),
+  DIAG_CFG_CRC_F308_CACHE_TTL = DIAG_CFG_CRC8_U16(DIAG_CFG_CRC_F308_CACHE_SLOT, DID_F308_CACHE_TTL),
+  DIAG_CFG_CRC_F308_CACHE_OFS = DIAG_CFG_CRC8_U16(DIAG_CFG_CRC_F308_CACHE_TTL, DID_F308_CACHE_OFS)
+};
+
+const uint8 DiagCfg_DidCfgCrc_cu8 = (uint8)DIAG_CFG_CRC_F308_CACHE_OFS;
+
+/* FUNCTION TO TEST */
+
+Std_ReturnType checkDidCfgCrc(void) {
+  uint8 l_crc_u8 = 0x00u;
+  uint8 l_bytes_au8[13];
+  uint16 l_entry_u16;
+  uint8 l_byte_u8;
+  uint8 l_bit_u8;
+
+  for(l_entry_u16 = 0u; l_entry_u16 < DIAG_CFG_DID_COUNT; l_entry_u16++) {
+    l_bytes_au8[0] = (uint8)(DiagCfg_DidCfg_cst[l_entry_u16].did_u16 & 0xFFu);
+    l_bytes_au8[1] = (uint8)(DiagCfg_DidCfg_cst[l_entry_u16].did_u16 >> 8);
+    l_bytes_au8[2] = DiagCfg_DidCfg_cst[l_entry_u16].size_u8;
+    l_bytes_au8[3] = DiagCfg_DidCfg_cst[l_entry_u16].access_u8;
+    l_bytes_au8[4] = DiagCfg_DidCfg_cst[l_entry_u16].session_u8;
+    l_bytes_au8[5] = DiagCfg_DidCfg_cst[l_entry_u16].security_u8;
+    l_bytes_au8[6] = DiagCfg_DidCfg_cst[l_entry_u16].kind_u8;
+    l_bytes_au8[7] = DiagCfg_DidCfg_cst[l_entry_u16].cache_u8;
+    l_bytes_au8[8] = DiagCfg_DidCfg_cst[l_entry_u16].cacheSlot_u8;
+    l_bytes_au8[9] = (uint8)(DiagCfg_DidCfg_cst[l_entry_u16].cacheTtl_u16 & 0xFFu);
+    l_bytes_au8[10] = (uint8)(DiagCfg_DidCfg_cst[l_entry_u16].cacheTtl_u16 >> 8);
+    l_bytes_au8[11] = (uint8)(DiagCfg_DidCfg_cst[l_entry_u16].cacheOfs_u16 & 0xFFu);
+    l_bytes_au8[12] = (uint8)(DiagCfg_DidCfg_cst[l_entry_u16].cacheOfs_u16 >> 8);
+
+    for(l_byte_u8 = 0u; l_byte_u8 < 13u; l_byte_u8++) {
+      l_crc_u8 ^= l_bytes_au8[l_byte_u8];
+      for(l_bit_u8 = 0u; l_bit_u8 < 8u; l_bit_u8++) { l_crc_u8 = ((l_crc_u8 & 0x80u) != 0u) ? (uint8)((uint8)(l_crc_u8 << 1) ^ 0x07u) : (uint8)(l_crc_u8 << 1); }
+    }
+  }
+
+  return (l_crc_u8 == DiagCfg_DidCfgCrc_cu8) ? E_OK : E_NOT_OK;
+}
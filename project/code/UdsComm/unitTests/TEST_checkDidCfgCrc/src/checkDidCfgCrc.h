@@ -0,0 +1,9 @@
+#ifndef DIAGNOSTIC_H
+#define DIAGNOSTIC_H
+#include "diagnostic_cfg.h"
+#include "diagnostic_cfg_priv.h"
+#include <stdint.h>
+
+Std_ReturnType checkDidCfgCrc(void);
+
+#endif
@@ -0,0 +1,253 @@
+
+
+#ifndef DIAGNOSTIC_CFG_PRIV_H
+#define DIAGNOSTIC_CFG_PRIV_H
+/**
+ * @file diagnostic_cfg_priv.h
+ * @brief Configuration and helper services for the Diagnostic module.
+ *
+ * @defgroup DiagnosticCfgModule Diagnostic Configuration
+ * @{
+ *
+ * @details
+ * This header collects the privare API of the diagnostic configuration layer.
+ *
+ */
+#include "diagnostic_cfg.h"
+
+#define DID_F308 0xF308U
+#define DID_F308_SIZE 1U
+#define DID_F308_ACCESS (DIAG_CFG_ACCESS_READ)
+#define DID_F308_SESSION (DIAG_CFG_SESSION_DEFAULT | DIAG_CFG_SESSION_EXTENDED)
+#define DID_F308_SECURITY 0U
+#define DID_F308_KIND DIAG_CFG_DID_DYNAMIC
+#define DID_F308_CACHE DIAG_CFG_CACHE_NEVER
+#define DID_F308_CACHE_SLOT DIAG_CFG_CACHE_NO_SLOT
+#define DID_F308_CACHE_TTL 0U
+#define DID_F308_CACHE_OFS 0U
+
+/** @brief DID may be read (ReadDataByIdentifier 0x22). */
+#define DIAG_CFG_ACCESS_READ 0x01U
+/** @brief DID may be written (WriteDataByIdentifier 0x2E). */
+#define DIAG_CFG_ACCESS_WRITE 0x02U
+
+/** @brief DID is available in the default session (0x01). */
+#define DIAG_CFG_SESSION_DEFAULT 0x01U
+/** @brief DID is available in the programming session (0x02). */
+#define DIAG_CFG_SESSION_PROGRAMMING 0x02U
+/** @brief DID is available in the extended session (0x03). */
+#define DIAG_CFG_SESSION_EXTENDED 0x04U
+
+/** @brief DID payload is sampled on every request. */
+#define DIAG_CFG_DID_DYNAMIC 0x00U
+/** @brief DID payload does not change while the ECU runs. */
+#define DIAG_CFG_DID_STATIC 0x01U
+
+/** @brief Response payload is never cached, the handler runs on every request. */
+#define DIAG_CFG_CACHE_NEVER 0x00U
+/** @brief Cached payload stays valid until invalidateDidCache() is called for the DID. */
+#define DIAG_CFG_CACHE_UNTIL_INVALIDATED 0x01U
+/** @brief Cached payload expires after the DID's TTL, or earlier on invalidateDidCache(). */
+#define DIAG_CFG_CACHE_TTL 0x02U
+
+/** @brief Cache slot of a DID that is not cached. */
+#define DIAG_CFG_CACHE_NO_SLOT 0xFFU
+
+/** @brief Number of entries of the DID configuration table. */
+#define DIAG_CFG_DID_COUNT 1U
+
+typedef Std_ReturnType (*diagHandler_t)(uint8 *const output_pu8, uint8 *const size_pu8, uint8 *const errCode_pu8);
+
+/**
+ * @brief Constant descriptor of one supported DID.
+ *
+ * @details
+ * `DiagCfg_DidCfg_cst` is generated by cfgGen/didCfgGen.py, sorted by
+ * ascending `did_u16` (binary search in `getDidCfg`). The table is covered
+ * by `DiagCfg_DidCfgCrc_cu8`; each entry contributes 7 bytes to the CRC:
+ * DID low byte, DID high byte, size, access mask, session mask, security
+ * level, kind. Handler addresses are not known to the preprocessor and are
+ * not covered.
+ */
+typedef struct {
+  uint16 did_u16;        /**< Data identifier. */
+  uint8 size_u8;         /**< Response payload size in bytes. */
+  uint8 access_u8;       /**< Allowed services, DIAG_CFG_ACCESS_* bits. */
+  uint8 session_u8;      /**< Sessions the DID is available in, DIAG_CFG_SESSION_* bits. */
+  uint8 security_u8;     /**< Security level needed, 0 = unlocked. */
+  uint8 kind_u8;         /**< DIAG_CFG_DID_STATIC or DIAG_CFG_DID_DYNAMIC. */
+  uint8 cache_u8;        /**< Response cache policy, DIAG_CFG_CACHE_NEVER/UNTIL_INVALIDATED/TTL. */
+  uint8 cacheSlot_u8;    /**< Cache slot, DIAG_CFG_CACHE_NO_SLOT if not cached. */
+  uint16 cacheTtl_u16;   /**< Lifetime of a cached payload [ms], 0 unless DIAG_CFG_CACHE_TTL. */
+  uint16 cacheOfs_u16;   /**< Offset of the payload in the cache arena [byte]. */
+  diagHandler_t read_pf; /**< Handler writing the response payload. */
+} DiagCfg_DidCfg_t;
+
+/** @brief DID descriptor table (ROM), sorted by DID. */
+extern DiagCfg_DidCfg_t DiagCfg_DidCfg_cst[DIAG_CFG_DID_COUNT];
+
+/** @brief CRC-8/ATM of `DiagCfg_DidCfg_cst`, computed at compile time. */
+extern const uint8 DiagCfg_DidCfgCrc_cu8;
+
+/**
+ * @brief DID handler that provides the Over Voltage Fault diagnostic information.
+ *
+ * @details
+ * **Goal of the function**
+ *
+ * The purpose of this function is to populate the diagnostic output buffer with
+ * the payload associated to the DID 0xF308 (Over Voltage Flag). This handler
+ * provides a project-defined byte that represents the diagnostic state.
+ *
+ * The processing logic:
+ * - Ignores `size_pu8` and `errCode_pu8` if not needed by this handler.
+ * - Writes a constant example payload into `output_pu8[0]`.
+ * - Returns `E_OK` to indicate that the DID payload was successfully produced.
+ *
+ * @par Interface summary
+ *
+ * | Interface     | In | Out | Data type / Signature               | Param | Data factor | Data offset | Data size | Data range      | Data unit |
+ * |---------------|:--:|:---:|------------------------------------|:-----:|------------:|------------:|----------:|-----------------|----------|
+ * | output_pu8    | X  |  X  | uint8*                              |   -   |      1      |      0      |     N     | project-defined | [-]      |
+ * | size_pu8      | X  |     | uint8*                              |   -   |      1      |      0      |     1     | [0,255]         | [byte]   |
+ * | errCode_pu8   | X  |  X  | uint8*                              |   -   |      1      |      0      |     1     | [0,255]         | [-]      |
+ *
+ * @par Activity diagram (PlantUML)
+ *
+ * @startuml
+ * start
+ * :output_pu8[0] = 0x01;
+ * :return E_OK;
+ * stop
+ * @enduml
+ *
+ * @return Std_ReturnType.
+ * - E_OK: payload produced successfully.
+ * - E_NOT_OK: not used by this handler in current implementation.
+ */
+/**
+ * @brief DID handler that provides the Over Voltage Fault diagnostic information.
+ *
+ * @details
+ * **Goal of the function**
+ *
+ * The purpose of this function is to populate the diagnostic output buffer with
+ * the payload associated to the DID 0xF308 (Over Voltage Flag). This handler
+ * provides a project-defined byte that represents the diagnostic state.
+ *
+ * The processing logic:
+ * - Writes the Over Voltage status into `output_pu8[0]`.
+ * - Sets `*size_pu8 = 1` to indicate that one payload byte was written.
+ * - Leaves `*errCode_pu8` unchanged because this is a positive path.
+ * - Returns `E_OK`.
+ *
+ * @par Interface summary
+ *
+ * | Interface     | In | Out | Data type / Signature               | Param | Data factor | Data offset | Data size | Data range      | Data unit |
+ * |---------------|:--:|:---:|------------------------------------|:-----:|------------:|------------:|----------:|-----------------|----------|
+ * | output_pu8    | X  |  X  | uint8*                              |   -   |      1      |      0      |     N     | project-defined | [-]      |
+ * | size_pu8      | X  |  X  | uint8*                              |   -   |      1      |      0      |     1     | [0,255]         | [byte]   |
+ * | errCode_pu8   | X  |  X  | uint8*                              |   -   |      1      |      0      |     1     | [0,255]         | [-]      |
+ *
+ * @par Activity diagram (PlantUML)
+ *
+ * @startuml
+ * start
+ * :output_pu8[0] = <overvoltage_status>;
+ * :*size_pu8 = 1;
+ * :return E_OK;
+ * stop
+ * @enduml
+ *
+ * @return Std_ReturnType.
+ * - E_OK: payload produced successfully.
+ * - E_NOT_OK: handler failure (not expected in current implementation).
+ */
+
+Std_ReturnType RdbiVhitOverVoltageFaultDiag_(uint8 *const output_pu8, uint8 *const size_pu8, uint8 *const errCode_pu8);
+
+/**
+ * @brief Default DID handler used for unsupported requests ("Request Out Of Range").
+ *
+ * @details
+ * **Goal of the function**
+ *
+ * The purpose of this function is to act as a fallback diagnostic handler when
+ * the requested DID or subfunction is not supported. It provides the correct
+ * NRC (Negative Response Code) by filling `*errCode_pu8` with the configured
+ * error and returning `E_NOT_OK`.
+ *
+ * The processing logic:
+ * - Ignores `output_pu8` and `size_pu8` because no payload is generated.
+ * - If `errCode_pu8` is not NULL:
+ *   - sets `*errCode_pu8 = 0x12` (Request Out Of Range).
+ * - Returns `E_NOT_OK`.
+ *
+ * @par Interface summary
+ *
+ * | Interface     | In | Out | Data type / Signature               | Param | Data factor | Data offset | Data size | Data range      | Data unit |
+ * |---------------|:--:|:---:|------------------------------------|:-----:|------------:|------------:|----------:|-----------------|----------|
+ * | output_pu8    | X  |     | uint8*                              |   -   |      1      |      0      |     N     | project-defined | [-]      |
+ * | size_pu8      | X  |     | uint8*                              |   -   |      1      |      0      |     1     | [0,255]         | [byte]   |
+ * | errCode_pu8   | X  |  X  | uint8*                              |   -   |      1      |      0      |     1     | [0,255]         | [-]      |
+ *
+ * @par Activity diagram (PlantUML)
+ *
+ * @startuml
+ * start
+ * if (errCode_pu8 != NULL) then (YES)
+ *   :*errCode_pu8 = 0x12;
+ * endif
+ * :return E_NOT_OK;
+ * stop
+ * @enduml
+ *
+ * @return Std_ReturnType.
+ * - E_NOT_OK: request is not supported.
+ */
+/**
+ * @brief Default DID handler used for unsupported requests ("Request Out Of Range").
+ *
+ * @details
+ * **Goal of the function**
+ *
+ * The purpose of this function is to act as a fallback diagnostic handler when
+ * the requested DID or subfunction is not supported. It provides the correct
+ * NRC (Negative Response Code) by filling `*errCode_pu8` with the configured
+ * error and returning `E_NOT_OK`.
+ *
+ * The processing logic:
+ * - Does not write any payload to `output_pu8`.
+ * - If `size_pu8` is not NULL, sets `*size_pu8 = 0`.
+ * - If `errCode_pu8` is not NULL, sets `*errCode_pu8 = 0x12` (Request Out Of Range).
+ * - Returns `E_NOT_OK`.
+ *
+ * @par Interface summary
+ *
+ * | Interface     | In | Out | Data type / Signature               | Param | Data factor | Data offset | Data size | Data range      | Data unit |
+ * |---------------|:--:|:---:|------------------------------------|:-----:|------------:|------------:|----------:|-----------------|----------|
+ * | output_pu8    | X  |     | uint8*                              |   -   |      1      |      0      |     N     | project-defined | [-]      |
+ * | size_pu8      | X  |  X  | uint8*                              |   -   |      1      |      0      |     1     | [0,255]         | [byte]   |
+ * | errCode_pu8   | X  |  X  | uint8*                              |   -   |      1      |      0      |     1     | [0,255]         | [-]      |
+ *
+ * @par Activity diagram (PlantUML)
+ *
+ * @startuml
+ * start
+ * if (size_pu8 != NULL) then (YES)
+ *   :*size_pu8 = 0;
+ * endif
+ * if (errCode_pu8 != NULL) then (YES)
+ *   :*errCode_pu8 = 0x12;
+ * endif
+ * :return E_NOT_OK;
+ * stop
+ * @enduml
+ *
+ * @return Std_ReturnType.
+ * - E_NOT_OK: request is not supported.
+ */
+
+Std_ReturnType SubfunctionRequestOutOfRange_(uint8 *const output_pu8, uint8 *const size_pu8, uint8 *const errCode_pu8);
+
+#endif
\ No newline at end of file
@@ -0,0 +1,83 @@
+#include "checkDidCfgCrc.h"
+#include "unity.h"
+
+void setUp(void) {}
+
+void tearDown(void) {}
+
+/* Test: DID configuration as delivered matches its compile-time CRC */
+void test_checkDidCfgCrc_ConfigIntact(void) { TEST_ASSERT_EQUAL(E_OK, checkDidCfgCrc()); }
+
+/* Test: compile-time CRC of {0x08, 0xF3, 0x01, 0x01, 0x05, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00} (DID 0xF308
+ * little endian, size 1, read access, default + extended session, unlocked, dynamic, not cached: no slot, TTL 0,
+ * offset 0) is 0xBA */
+void test_checkDidCfgCrc_CompileTimeValue(void) { TEST_ASSERT_EQUAL_HEX8(0xBA, DiagCfg_DidCfgCrc_cu8); }
+
+/* Test: corrupted DID number is detected */
+void test_checkDidCfgCrc_CorruptedDid(void) {
+  DiagCfg_DidCfg_cst[0].did_u16 = 0xF309u;
+
+  TEST_ASSERT_EQUAL(E_NOT_OK, checkDidCfgCrc());
+
+  DiagCfg_DidCfg_cst[0].did_u16 = DID_F308;
+}
+
+/* Test: corrupted response size is detected */
+void test_checkDidCfgCrc_CorruptedSize(void) {
+  DiagCfg_DidCfg_cst[0].size_u8 = 2u;
+
+  TEST_ASSERT_EQUAL(E_NOT_OK, checkDidCfgCrc());
+
+  DiagCfg_DidCfg_cst[0].size_u8 = DID_F308_SIZE;
+}
+
+/* Test: corrupted access mask is detected */
+void test_checkDidCfgCrc_CorruptedAccess(void) {
+  DiagCfg_DidCfg_cst[0].access_u8 = (uint8)(DIAG_CFG_ACCESS_READ | DIAG_CFG_ACCESS_WRITE);
+
+  TEST_ASSERT_EQUAL(E_NOT_OK, checkDidCfgCrc());
+
+  DiagCfg_DidCfg_cst[0].access_u8 = DID_F308_ACCESS;
+}
+
+/* Test: corrupted session mask is detected */
+void test_checkDidCfgCrc_CorruptedSession(void) {
+  DiagCfg_DidCfg_cst[0].session_u8 = DIAG_CFG_SESSION_PROGRAMMING;
+
+  TEST_ASSERT_EQUAL(E_NOT_OK, checkDidCfgCrc());
+
+  DiagCfg_DidCfg_cst[0].session_u8 = DID_F308_SESSION;
+}
+
+/* Test: corrupted security level is detected */
+void test_checkDidCfgCrc_CorruptedSecurity(void) {
+  DiagCfg_DidCfg_cst[0].security_u8 = 1u;
+
+  TEST_ASSERT_EQUAL(E_NOT_OK, checkDidCfgCrc());
+
+  DiagCfg_DidCfg_cst[0].security_u8 = DID_F308_SECURITY;
+}
+
+/* Test: corrupted cache policy is detected */
+void test_checkDidCfgCrc_CorruptedCachePolicy(void) {
+  DiagCfg_DidCfg_cst[0].cache_u8 = DIAG_CFG_CACHE_UNTIL_INVALIDATED;
+
+  TEST_ASSERT_EQUAL(E_NOT_OK, checkDidCfgCrc());
+
+  DiagCfg_DidCfg_cst[0].cache_u8 = DID_F308_CACHE;
+}
+
+/* Test: corrupted cache layout (slot, TTL high byte, arena offset) is detected */
+void test_checkDidCfgCrc_CorruptedCacheLayout(void) {
+  DiagCfg_DidCfg_cst[0].cacheSlot_u8 = 0u;
+  TEST_ASSERT_EQUAL(E_NOT_OK, checkDidCfgCrc());
+  DiagCfg_DidCfg_cst[0].cacheSlot_u8 = DID_F308_CACHE_SLOT;
+
+  DiagCfg_DidCfg_cst[0].cacheTtl_u16 = 0x0100u;
+  TEST_ASSERT_EQUAL(E_NOT_OK, checkDidCfgCrc());
+  DiagCfg_DidCfg_cst[0].cacheTtl_u16 = DID_F308_CACHE_TTL;
+
+  DiagCfg_DidCfg_cst[0].cacheOfs_u16 = 1u;
+  TEST_ASSERT_EQUAL(E_NOT_OK, checkDidCfgCrc());
+  DiagCfg_DidCfg_cst[0].cacheOfs_u16 = DID_F308_CACHE_OFS;
+}
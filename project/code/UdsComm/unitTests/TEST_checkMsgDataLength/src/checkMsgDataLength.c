@@ -3,7 +3,7 @@
 /* FUNCTION TO TEST */
 
 void checkMsgDataLength(uint16_t dataLength, Std_ReturnType *result) {
-  if(dataLength > 0u && dataLength <= 32u) {
+  if(dataLength > 0u && dataLength <= DIAG_CFG_RX_BUFFER_SIZE) {
     *result = E_OK;
   } else {
     *result = E_NOT_OK;
@@ -15,11 +15,11 @@ void test_checkMsgDataLength_ValidMinimumBoundary(void) {
   TEST_ASSERT_EQUAL(E_OK, result);
 }
 
-/* Test: Valid maximum boundary - dataLength = 32 should return E_OK */
+/* Test: Valid maximum boundary - dataLength = DIAG_CFG_RX_BUFFER_SIZE should return E_OK */
 void test_checkMsgDataLength_ValidMaximumBoundary(void) {
   Std_ReturnType result;
 
-  checkMsgDataLength(32u, &result);
+  checkMsgDataLength(DIAG_CFG_RX_BUFFER_SIZE, &result);
 
   TEST_ASSERT_EQUAL(E_OK, result);
 }
@@ -33,6 +33,15 @@ void test_checkMsgDataLength_ValidMiddleValue(void) {
   TEST_ASSERT_EQUAL(E_OK, result);
 }
 
+/* Test: Valid - ReadDataByIdentifier with 20 DIDs (41 bytes) should return E_OK */
+void test_checkMsgDataLength_ValidTwentyDids(void) {
+  Std_ReturnType result;
+
+  checkMsgDataLength(41u, &result);
+
+  TEST_ASSERT_EQUAL(E_OK, result);
+}
+
 /* Test: Invalid - dataLength = 0 should return E_NOT_OK */
 void test_checkMsgDataLength_InvalidZero(void) {
   Std_ReturnType result;
@@ -42,11 +51,11 @@ void test_checkMsgDataLength_InvalidZero(void) {
   TEST_ASSERT_EQUAL(E_NOT_OK, result);
 }
 
-/* Test: Invalid - dataLength > 32 should return E_NOT_OK */
+/* Test: Invalid - dataLength > DIAG_CFG_RX_BUFFER_SIZE should return E_NOT_OK */
 void test_checkMsgDataLength_InvalidAboveMaximum(void) {
   Std_ReturnType result;
 
-  checkMsgDataLength(33u, &result);
+  checkMsgDataLength(DIAG_CFG_RX_BUFFER_SIZE + 1u, &result);
 
   TEST_ASSERT_EQUAL(E_NOT_OK, result);
 }
@@ -0,0 +1,32 @@
+#include "getDidCfg.h"
+#define NULL ((void *)0)
+
+const DiagCfg_DidCfg_t DiagCfg_DidCfg_cst[DIAG_CFG_DID_COUNT] = {
+    {0x0100, 2u, DIAG_CFG_ACCESS_READ, DIAG_CFG_SESSION_DEFAULT, 0u, DIAG_CFG_DID_DYNAMIC, NULL},
+    {0xF186, 1u, DIAG_CFG_ACCESS_READ, DIAG_CFG_SESSION_DEFAULT, 0u, DIAG_CFG_DID_DYNAMIC, NULL},
+    {0xF190, 17u, DIAG_CFG_ACCESS_READ | DIAG_CFG_ACCESS_WRITE, DIAG_CFG_SESSION_EXTENDED, 1u, DIAG_CFG_DID_STATIC, NULL},
+    {0xF308, 1u, DIAG_CFG_ACCESS_READ, DIAG_CFG_SESSION_DEFAULT | DIAG_CFG_SESSION_EXTENDED, 0u, DIAG_CFG_DID_DYNAMIC, NULL},
+    {0xFD00, 4u, DIAG_CFG_ACCESS_WRITE, DIAG_CFG_SESSION_EXTENDED, 0u, DIAG_CFG_DID_DYNAMIC, NULL},
+};
+
+/* FUNCTION TO TEST */
+
+const DiagCfg_DidCfg_t *getDidCfg(uint16 did_u16) {
+  uint16 l_low_u16 = 0u;
+  uint16 l_high_u16 = DIAG_CFG_DID_COUNT;
+  uint16 l_mid_u16;
+  const DiagCfg_DidCfg_t *l_didCfg_pst = NULL;
+
+  while((l_low_u16 < l_high_u16) && (NULL == l_didCfg_pst)) {
+    l_mid_u16 = (uint16)((l_low_u16 + l_high_u16) >> 1);
+    if(DiagCfg_DidCfg_cst[l_mid_u16].did_u16 < did_u16) {
+      l_low_u16 = (uint16)(l_mid_u16 + 1u);
+    } else if(DiagCfg_DidCfg_cst[l_mid_u16].did_u16 > did_u16) {
+      l_high_u16 = l_mid_u16;
+    } else {
+      l_didCfg_pst = &DiagCfg_DidCfg_cst[l_mid_u16];
+    }
+  }
+
+  return l_didCfg_pst;
+}
@@ -0,0 +1,8 @@
+#ifndef DIAGNOSTIC_H
+#define DIAGNOSTIC_H
+#include "diagnostic_cfg.h"
+#include <stdint.h>
+
+const DiagCfg_DidCfg_t *getDidCfg(uint16 did_u16);
+
+#endif
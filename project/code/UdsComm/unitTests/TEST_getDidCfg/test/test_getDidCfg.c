@@ -0,0 +1,39 @@
+#include "getDidCfg.h"
+#include "unity.h"
+
+void setUp(void) {}
+
+void tearDown(void) {}
+
+/* Test: every configured DID is found at its own table row */
+void test_getDidCfg_AllConfiguredDidsFound(void) {
+  uint16 l_idx_u16;
+
+  for(l_idx_u16 = 0u; l_idx_u16 < DIAG_CFG_DID_COUNT; l_idx_u16++) { TEST_ASSERT_EQUAL_PTR(&DiagCfg_DidCfg_cst[l_idx_u16], getDidCfg(DiagCfg_DidCfg_cst[l_idx_u16].did_u16)); }
+}
+
+/* Test: descriptor fields are returned unchanged */
+void test_getDidCfg_F308Descriptor(void) {
+  const DiagCfg_DidCfg_t *l_cfg_pst = getDidCfg(0xF308);
+
+  TEST_ASSERT_NOT_NULL(l_cfg_pst);
+  TEST_ASSERT_EQUAL_HEX16(0xF308, l_cfg_pst->did_u16);
+  TEST_ASSERT_EQUAL(1u, l_cfg_pst->size_u8);
+  TEST_ASSERT_EQUAL(DIAG_CFG_ACCESS_READ, l_cfg_pst->access_u8);
+}
+
+/* Test: DIDs below, between and above the configured ones are not found */
+void test_getDidCfg_UnknownDids(void) {
+  uint16 unknown_dids[] = {0x0000, 0x00FF, 0x0101, 0xF187, 0xF307, 0xF309, 0xFCFF, 0xFD01, 0xFFFF};
+  uint8 l_idx_u8;
+
+  for(l_idx_u8 = 0u; l_idx_u8 < (uint8)(sizeof(unknown_dids) / sizeof(unknown_dids[0])); l_idx_u8++) { TEST_ASSERT_NULL(getDidCfg(unknown_dids[l_idx_u8])); }
+}
+
+/* Test: lookup does not filter on access, write-only DIDs are returned too */
+void test_getDidCfg_WriteOnlyDidFound(void) {
+  const DiagCfg_DidCfg_t *l_cfg_pst = getDidCfg(0xFD00);
+
+  TEST_ASSERT_NOT_NULL(l_cfg_pst);
+  TEST_ASSERT_EQUAL(DIAG_CFG_ACCESS_WRITE, l_cfg_pst->access_u8);
+}
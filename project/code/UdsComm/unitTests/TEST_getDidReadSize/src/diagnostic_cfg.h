@@ -0,0 +1,38 @@
+#ifndef DIAGNOSTIC_CFG_H
+#define DIAGNOSTIC_CFG_H
+
+#include <stdint.h>
+
+typedef uint8_t uint8;
+typedef uint16_t uint16;
+typedef uint8_t Std_ReturnType;
+
+#define E_OK ((Std_ReturnType)0x00u)
+#define E_NOT_OK ((Std_ReturnType)0x01u)
+#define kLinDiagNrcRequestOutOfRange ((uint8)0x31u)
+#define kLinDiagNrcSecurityAccessDenied ((uint8)0x33u)
+
+#define DIAG_CFG_ACCESS_READ 0x01U
+#define DIAG_CFG_ACCESS_WRITE 0x02U
+#define DIAG_CFG_SESSION_DEFAULT 0x01U
+#define DIAG_CFG_SESSION_EXTENDED 0x04U
+#define DIAG_CFG_DID_DYNAMIC 0x00U
+#define DIAG_CFG_DID_STATIC 0x01U
+
+typedef Std_ReturnType (*diagHandler_t)(uint8 *const output_pu8, uint8 *const size_pu8, uint8 *const errCode_pu8);
+
+typedef struct {
+  uint16 did_u16;
+  uint8 size_u8;
+  uint8 access_u8;
+  uint8 session_u8;
+  uint8 security_u8;
+  uint8 kind_u8;
+  diagHandler_t read_pf;
+} DiagCfg_DidCfg_t;
+
+const DiagCfg_DidCfg_t *getDidCfg(uint16 did_u16);
+
+Std_ReturnType checkDidAccess(const DiagCfg_DidCfg_t *didCfg_pst, uint8 access_u8, uint8 *errCode_pu8);
+
+#endif
@@ -0,0 +1,19 @@
+#include "getDidReadSize.h"
+#include "diagnostic_cfg.h"
+#define NULL ((void *)0)
+
+/* FUNCTION TO TEST */
+
+Std_ReturnType getDidReadSize(uint16 did_u16, uint8 *size_pu8) {
+  const DiagCfg_DidCfg_t *l_didCfg_pst = getDidCfg(did_u16);
+  uint8 l_nrc_u8 = 0u;
+  Std_ReturnType l_result_ = E_NOT_OK;
+
+  /* A DID locked by security is sized anyway: its read answers securityAccessDenied */
+  if((E_OK == checkDidAccess(l_didCfg_pst, DIAG_CFG_ACCESS_READ, &l_nrc_u8)) || (kLinDiagNrcSecurityAccessDenied == l_nrc_u8)) {
+    *size_pu8 = l_didCfg_pst->size_u8;
+    l_result_ = E_OK;
+  }
+
+  return l_result_;
+}
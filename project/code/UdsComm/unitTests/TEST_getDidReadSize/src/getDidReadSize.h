@@ -0,0 +1,8 @@
+#ifndef DIAGNOSTIC_H
+#define DIAGNOSTIC_H
+#include "diagnostic_cfg.h"
+#include <stdint.h>
+
+Std_ReturnType getDidReadSize(uint16 did_u16, uint8 *size_pu8);
+
+#endif
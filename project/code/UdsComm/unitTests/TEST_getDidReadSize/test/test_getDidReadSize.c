@@ -0,0 +1,82 @@
+#include "getDidReadSize.h"
+#include "mock_diagnostic_cfg.h"
+#include "unity.h"
+
+static const DiagCfg_DidCfg_t s_readCfg_cst = {0xF308, 4u, DIAG_CFG_ACCESS_READ, DIAG_CFG_SESSION_DEFAULT, 0u, DIAG_CFG_DID_DYNAMIC, NULL};
+static const DiagCfg_DidCfg_t s_writeOnlyCfg_cst = {0xFD00, 3u, DIAG_CFG_ACCESS_WRITE, DIAG_CFG_SESSION_EXTENDED, 0u, DIAG_CFG_DID_DYNAMIC, NULL};
+
+/* NRC of the session/security part of the access check, 0 = granted */
+static uint8 s_accessNrc_u8;
+
+static Std_ReturnType checkDidAccess_Callback(const DiagCfg_DidCfg_t *didCfg_pst, uint8 access_u8, uint8 *errCode_pu8, int cmock_num_calls) {
+  (void)cmock_num_calls;
+
+  if((NULL == didCfg_pst) || (0u == (didCfg_pst->access_u8 & access_u8))) {
+    *errCode_pu8 = kLinDiagNrcRequestOutOfRange;
+  } else if(0u != s_accessNrc_u8) {
+    *errCode_pu8 = s_accessNrc_u8;
+  } else {
+    return E_OK;
+  }
+
+  return E_NOT_OK;
+}
+
+void setUp(void) {
+  s_accessNrc_u8 = 0u;
+  checkDidAccess_StubWithCallback(checkDidAccess_Callback);
+}
+
+void tearDown(void) {}
+
+/* Test: readable DID reports its configured size */
+void test_getDidReadSize_ReadableDid(void) {
+  uint8 l_size_u8 = 0u;
+
+  getDidCfg_ExpectAndReturn(0xF308, &s_readCfg_cst);
+
+  TEST_ASSERT_EQUAL(E_OK, getDidReadSize(0xF308, &l_size_u8));
+  TEST_ASSERT_EQUAL(4u, l_size_u8);
+}
+
+/* Test: unknown DID is rejected, size untouched */
+void test_getDidReadSize_UnknownDid(void) {
+  uint8 l_size_u8 = 0xFFu;
+
+  getDidCfg_ExpectAndReturn(0x1234, NULL);
+
+  TEST_ASSERT_EQUAL(E_NOT_OK, getDidReadSize(0x1234, &l_size_u8));
+  TEST_ASSERT_EQUAL(0xFFu, l_size_u8);
+}
+
+/* Test: write-only DID is rejected, size untouched */
+void test_getDidReadSize_WriteOnlyDid(void) {
+  uint8 l_size_u8 = 0xFFu;
+
+  getDidCfg_ExpectAndReturn(0xFD00, &s_writeOnlyCfg_cst);
+
+  TEST_ASSERT_EQUAL(E_NOT_OK, getDidReadSize(0xFD00, &l_size_u8));
+  TEST_ASSERT_EQUAL(0xFFu, l_size_u8);
+}
+
+/* Test: DID of another session is rejected, size untouched */
+void test_getDidReadSize_SessionMismatch(void) {
+  uint8 l_size_u8 = 0xFFu;
+
+  s_accessNrc_u8 = kLinDiagNrcRequestOutOfRange;
+  getDidCfg_ExpectAndReturn(0xF308, &s_readCfg_cst);
+
+  TEST_ASSERT_EQUAL(E_NOT_OK, getDidReadSize(0xF308, &l_size_u8));
+  TEST_ASSERT_EQUAL(0xFFu, l_size_u8);
+}
+
+/* Test: DID locked by security is still sized, its read reports securityAccessDenied */
+void test_getDidReadSize_SecurityLockedDid(void) {
+  uint8 l_size_u8 = 0u;
+
+  s_accessNrc_u8 = kLinDiagNrcSecurityAccessDenied;
+  getDidCfg_ExpectAndReturn(0xF308, &s_readCfg_cst);
+
+  TEST_ASSERT_EQUAL(E_OK, getDidReadSize(0xF308, &l_size_u8));
+  TEST_ASSERT_EQUAL(4u, l_size_u8);
+}
@@ -15,16 +15,18 @@ void checkMsgDataLength(uint16_t dataLength, Std_ReturnType *result) {
   }
 }
 
-Std_ReturnType RdbiVhitOverVoltageFaultDiag_(uint8 *const output_pu8, uint8 *const size_pu8, uint8 *const errCode_pu8) {
+Std_ReturnType RdbiVhitOverVoltageFaultDiag_(uint8 *const output_pu8, uint8 *const size_pu8, uint8 *const errCode_pu8, uint8 opStatus_u8) {
   (void)size_pu8;
   (void)errCode_pu8;
+  (void)opStatus_u8;
   output_pu8[0] = 0x01; /* Example data */
   return E_OK;
 }
 
-Std_ReturnType SubfunctionRequestOutOfRange_(uint8 *const output_pu8, uint8 *const size_pu8, uint8 *const errCode_pu8) {
+Std_ReturnType SubfunctionRequestOutOfRange_(uint8 *const output_pu8, uint8 *const size_pu8, uint8 *const errCode_pu8, uint8 opStatus_u8) {
   (void)output_pu8;
   (void)size_pu8;
+  (void)opStatus_u8;
   if(NULL != errCode_pu8) { *errCode_pu8 = 0x12; }
   return E_NOT_OK;
 }
@@ -10,7 +10,12 @@ typedef uint8_t Std_ReturnType;
 
 #define E_OK ((Std_ReturnType)0x00u)
 #define E_NOT_OK ((Std_ReturnType)0x01u)
+#define E_PENDING ((Std_ReturnType)0x0Au)
+#define DIAG_OPSTATUS_INITIAL ((uint8)0x00u)
+#define DIAG_OPSTATUS_PENDING ((uint8)0x01u)
+#define DIAG_OPSTATUS_CANCEL ((uint8)0x02u)
 #define kLinDiagNrcRequestOutOfRange ((uint8)0x31u)
+#define kLinDiagNrcSecurityAccessDenied ((uint8)0x33u)
 
 void checkCurrentNad(uint8 currentNad, Std_ReturnType *result);
 
@@ -18,10 +23,49 @@ void checkMsgDataLength(uint16_t dataLength, Std_ReturnType *result);
 
 #define DID_F308_SIZE 1U
 
-typedef Std_ReturnType (*diagHandler_t)(uint8 *const output_pu8, uint8 *const size_pu8, uint8 *const errCode_pu8);
+#define DIAG_CFG_ACCESS_READ 0x01U
+#define DIAG_CFG_ACCESS_WRITE 0x02U
+#define DIAG_CFG_SESSION_DEFAULT 0x01U
+#define DIAG_CFG_SESSION_EXTENDED 0x04U
+#define DIAG_CFG_DID_DYNAMIC 0x00U
+#define DIAG_CFG_DID_STATIC 0x01U
+#define DIAG_CFG_CACHE_NEVER 0x00U
+#define DIAG_CFG_CACHE_UNTIL_INVALIDATED 0x01U
+#define DIAG_CFG_CACHE_TTL 0x02U
+#define DIAG_CFG_CACHE_NO_SLOT 0xFFU
+#define DIAG_CFG_CACHE_INVALID 0x00U
+#define DIAG_CFG_CACHE_FILLING 0x01U
+#define DIAG_CFG_CACHE_VALID 0x02U
 
-Std_ReturnType RdbiVhitOverVoltageFaultDiag_(uint8 *const output_pu8, uint8 *const size_pu8, uint8 *const errCode_pu8);
+#define DIAG_CFG_MAIN_PERIOD_MS 10u
+#define DIAG_CFG_CACHE_SLOT_COUNT 2U
+#define DIAG_CFG_CACHE_ARENA_SIZE 8U
+#define DIAG_CFG_CACHE_SLOT_ALLOC ((DIAG_CFG_CACHE_SLOT_COUNT > 0U) ? DIAG_CFG_CACHE_SLOT_COUNT : 1U)
+#define DIAG_CFG_CACHE_ARENA_ALLOC ((DIAG_CFG_CACHE_ARENA_SIZE > 0U) ? DIAG_CFG_CACHE_ARENA_SIZE : 1U)
+#define DIAG_CFG_CACHE_TTL_TICKS(ms) ((((ms) / DIAG_CFG_MAIN_PERIOD_MS) > 0U) ? (uint16)((ms) / DIAG_CFG_MAIN_PERIOD_MS) : (uint16)1U)
 
-Std_ReturnType SubfunctionRequestOutOfRange_(uint8 *const output_pu8, uint8 *const size_pu8, uint8 *const errCode_pu8);
+typedef Std_ReturnType (*diagHandler_t)(uint8 *const output_pu8, uint8 *const size_pu8, uint8 *const errCode_pu8, uint8 opStatus_u8);
+
+typedef struct {
+  uint16 did_u16;
+  uint8 size_u8;
+  uint8 access_u8;
+  uint8 session_u8;
+  uint8 security_u8;
+  uint8 kind_u8;
+  uint8 cache_u8;
+  uint8 cacheSlot_u8;
+  uint16 cacheTtl_u16;
+  uint16 cacheOfs_u16;
+  diagHandler_t read_pf;
+} DiagCfg_DidCfg_t;
+
+const DiagCfg_DidCfg_t *getDidCfg(uint16 did_u16);
+
+Std_ReturnType checkDidAccess(const DiagCfg_DidCfg_t *didCfg_pst, uint8 access_u8, uint8 *errCode_pu8);
+
+Std_ReturnType RdbiVhitOverVoltageFaultDiag_(uint8 *const output_pu8, uint8 *const size_pu8, uint8 *const errCode_pu8, uint8 opStatus_u8);
+
+Std_ReturnType SubfunctionRequestOutOfRange_(uint8 *const output_pu8, uint8 *const size_pu8, uint8 *const errCode_pu8, uint8 opStatus_u8);
 
 #endif
\ No newline at end of file
@@ -1,25 +1,83 @@
 #include "getHandlersForReadDataById.h"
 #include "diagnostic_cfg.h"
+#define NULL ((void *)0)
 
 uint8 g_errCode_u8 = 0;
 uint16 g_did_cu16 = 0;
+
+/* Response cache: serialized payloads of the cached DIDs, their slot state,
+ * length and remaining lifetime (ageDidCache() ticks, 0 = no expiry) */
+static uint8 diagCfgCacheArena_au8[DIAG_CFG_CACHE_ARENA_ALLOC];
+static volatile uint8 diagCfgCacheState_au8[DIAG_CFG_CACHE_SLOT_ALLOC];
+static uint8 diagCfgCacheLen_au8[DIAG_CFG_CACHE_SLOT_ALLOC];
+static uint16 diagCfgCacheTicks_au16[DIAG_CFG_CACHE_SLOT_ALLOC];
+
+Std_ReturnType invalidateDidCache(uint16 did_u16) {
+  const DiagCfg_DidCfg_t *l_didCfg_pst = getDidCfg(did_u16);
+  Std_ReturnType l_result_ = E_NOT_OK;
+
+  if((NULL != l_didCfg_pst) && (DIAG_CFG_CACHE_NO_SLOT != l_didCfg_pst->cacheSlot_u8)) {
+    diagCfgCacheState_au8[l_didCfg_pst->cacheSlot_u8] = DIAG_CFG_CACHE_INVALID;
+    l_result_ = E_OK;
+  }
+
+  return l_result_;
+}
+
+void ageDidCache(void) {
+  uint8 l_slot_u8;
+
+  for(l_slot_u8 = 0u; l_slot_u8 < DIAG_CFG_CACHE_SLOT_ALLOC; l_slot_u8++) {
+    if(0u != diagCfgCacheTicks_au16[l_slot_u8]) {
+      diagCfgCacheTicks_au16[l_slot_u8]--;
+      if(0u == diagCfgCacheTicks_au16[l_slot_u8]) { diagCfgCacheState_au8[l_slot_u8] = DIAG_CFG_CACHE_INVALID; }
+    }
+  }
+}
+
 /* FUNCTION TO TEST */
 
-Std_ReturnType getHandlersForReadDataById(uint8 *l_errCode_u8, uint16 l_did_cu16, uint8 *l_diagBufSize_u8, Std_ReturnType *l_didSupported_, uint8 *l_diagBuf_pu8) {
+Std_ReturnType getHandlersForReadDataById(uint8 *l_errCode_u8, uint16 l_did_cu16, uint8 *l_diagBufSize_u8, Std_ReturnType *l_didSupported_, uint8 *l_diagBuf_pu8, uint8 opStatus_u8) {
   diagHandler_t l_handler_ = &SubfunctionRequestOutOfRange_;
+  const DiagCfg_DidCfg_t *l_didCfg_pst = getDidCfg(l_did_cu16);
+  uint8 l_slot_u8 = DIAG_CFG_CACHE_NO_SLOT;
+  uint8 l_byte_u8;
+  uint8 l_nrc_u8 = kLinDiagNrcRequestOutOfRange;
+  Std_ReturnType l_result_;
 
-  switch(l_did_cu16) {
-  /* IS_OVERVOLT_FLAG */
-  case 0xF308:
-    *l_diagBufSize_u8 = DID_F308_SIZE;
-    l_handler_ = &RdbiVhitOverVoltageFaultDiag_;
-    break;
-
-  default:
+  if(E_OK == checkDidAccess(l_didCfg_pst, DIAG_CFG_ACCESS_READ, &l_nrc_u8)) {
+    *l_diagBufSize_u8 = l_didCfg_pst->size_u8;
+    l_handler_ = l_didCfg_pst->read_pf;
+    l_slot_u8 = l_didCfg_pst->cacheSlot_u8;
+  } else {
     *l_didSupported_ = E_NOT_OK;
-    *l_errCode_u8 = kLinDiagNrcRequestOutOfRange;
-    break;
   }
 
-  return l_handler_(l_diagBuf_pu8, l_diagBufSize_u8, &l_errCode_u8);
+  if((DIAG_CFG_CACHE_NO_SLOT != l_slot_u8) && (DIAG_OPSTATUS_INITIAL == opStatus_u8) && (DIAG_CFG_CACHE_VALID == diagCfgCacheState_au8[l_slot_u8])) {
+    /* Cache hit: the handler is not called */
+    *l_diagBufSize_u8 = diagCfgCacheLen_au8[l_slot_u8];
+    for(l_byte_u8 = 0u; l_byte_u8 < *l_diagBufSize_u8; l_byte_u8++) { l_diagBuf_pu8[l_byte_u8] = diagCfgCacheArena_au8[l_didCfg_pst->cacheOfs_u16 + l_byte_u8]; }
+    l_result_ = E_OK;
+  } else {
+    /* An invalidation from now on resets the slot and the payload is not stored */
+    if((DIAG_CFG_CACHE_NO_SLOT != l_slot_u8) && (DIAG_OPSTATUS_INITIAL == opStatus_u8)) {
+      diagCfgCacheTicks_au16[l_slot_u8] = 0u;
+      diagCfgCacheState_au8[l_slot_u8] = DIAG_CFG_CACHE_FILLING;
+    }
+
+    l_result_ = l_handler_(l_diagBuf_pu8, l_diagBufSize_u8, l_errCode_u8, opStatus_u8);
+
+    if((DIAG_CFG_CACHE_NO_SLOT != l_slot_u8) && (DIAG_OPSTATUS_CANCEL != opStatus_u8) && (E_OK == l_result_) && (DIAG_CFG_CACHE_FILLING == diagCfgCacheState_au8[l_slot_u8]) &&
+       (*l_diagBufSize_u8 <= l_didCfg_pst->size_u8)) {
+      for(l_byte_u8 = 0u; l_byte_u8 < *l_diagBufSize_u8; l_byte_u8++) { diagCfgCacheArena_au8[l_didCfg_pst->cacheOfs_u16 + l_byte_u8] = l_diagBuf_pu8[l_byte_u8]; }
+      diagCfgCacheLen_au8[l_slot_u8] = *l_diagBufSize_u8;
+      diagCfgCacheTicks_au16[l_slot_u8] = (DIAG_CFG_CACHE_TTL == l_didCfg_pst->cache_u8) ? DIAG_CFG_CACHE_TTL_TICKS(l_didCfg_pst->cacheTtl_u16) : 0u;
+      diagCfgCacheState_au8[l_slot_u8] = DIAG_CFG_CACHE_VALID;
+    }
+  }
+
+  /* A DID that cannot be read now is answered with the NRC of the access check, whatever the fallback handler wrote */
+  if(E_NOT_OK == *l_didSupported_) { *l_errCode_u8 = l_nrc_u8; }
+
+  return l_result_;
 }
@@ -8,6 +8,10 @@
 extern uint8 g_errCode_u8;
 extern uint16 g_did_cu16;
 
-Std_ReturnType getHandlersForReadDataById(uint8 *l_errCode_u8, uint16 l_did_cu16, uint8 *l_diagBufSize_u8, Std_ReturnType *l_didSupported_, uint8 *l_diagBuf_pu8);
+Std_ReturnType getHandlersForReadDataById(uint8 *l_errCode_u8, uint16 l_did_cu16, uint8 *l_diagBufSize_u8, Std_ReturnType *l_didSupported_, uint8 *l_diagBuf_pu8, uint8 opStatus_u8);
+
+Std_ReturnType invalidateDidCache(uint16 did_u16);
+
+void ageDidCache(void);
 
 #endif
\ No newline at end of file
@@ -3,7 +3,81 @@
 #include "unity.h"
 #include <string.h>
 
-void setUp(void) { /* Reset all mocks before each test */ }
+/* Descriptor returned by the mocked table lookup for DID 0xF308 */
+static const DiagCfg_DidCfg_t s_didF308Cfg_cst = {0xF308, DID_F308_SIZE, DIAG_CFG_ACCESS_READ, DIAG_CFG_SESSION_DEFAULT, 0u, DIAG_CFG_DID_DYNAMIC, DIAG_CFG_CACHE_NEVER,
+                                                  DIAG_CFG_CACHE_NO_SLOT, 0u, 0u, &RdbiVhitOverVoltageFaultDiag_};
+
+/* Cached DIDs: 0xF190 until invalidated (slot 0, arena 0..3), 0xF200 with a 30 ms TTL = 3 ticks (slot 1, arena 4..5) */
+static const DiagCfg_DidCfg_t s_didF190Cfg_cst = {0xF190, 4u, DIAG_CFG_ACCESS_READ, DIAG_CFG_SESSION_DEFAULT, 0u, DIAG_CFG_DID_STATIC, DIAG_CFG_CACHE_UNTIL_INVALIDATED,
+                                                  0u, 0u, 0u, &RdbiVhitOverVoltageFaultDiag_};
+static const DiagCfg_DidCfg_t s_didF200Cfg_cst = {0xF200, 2u, DIAG_CFG_ACCESS_READ, DIAG_CFG_SESSION_DEFAULT, 0u, DIAG_CFG_DID_DYNAMIC, DIAG_CFG_CACHE_TTL,
+                                                  1u, 30u, 4u, &RdbiVhitOverVoltageFaultDiag_};
+
+/* Payloads written by the stub on its first and second call */
+static const uint8 s_firstPayload_au8[4] = {0x01, 0x01, 0x01, 0x01};
+static const uint8 s_secondPayload_au8[4] = {0x02, 0x02, 0x02, 0x02};
+
+/* Handler calls seen by the stub and the result it returns */
+static uint8 s_handlerCalls_u8;
+static Std_ReturnType s_handlerResult_;
+
+static const DiagCfg_DidCfg_t *getDidCfg_Callback(uint16 did_u16, int cmock_num_calls) {
+  (void)cmock_num_calls;
+
+  return (0xF190 == did_u16) ? &s_didF190Cfg_cst : ((0xF200 == did_u16) ? &s_didF200Cfg_cst : NULL);
+}
+
+/* Payload = call number in every byte, so a cached payload is told apart from a fresh one */
+static Std_ReturnType Handler_Callback(uint8 *const output_pu8, uint8 *const size_pu8, uint8 *const errCode_pu8, uint8 opStatus_u8, int cmock_num_calls) {
+  (void)errCode_pu8;
+  (void)opStatus_u8;
+  (void)cmock_num_calls;
+
+  s_handlerCalls_u8++;
+  if(E_OK == s_handlerResult_) { memset(output_pu8, (int)s_handlerCalls_u8, *size_pu8); }
+
+  return s_handlerResult_;
+}
+
+/* Read one DID as a new request and return the result */
+static Std_ReturnType readDid(uint16 did_u16, uint8 *buf_pu8, uint8 *size_pu8, uint8 opStatus_u8) {
+  Std_ReturnType l_didSupported_ = E_OK;
+
+  g_errCode_u8 = 0;
+  return getHandlersForReadDataById(&g_errCode_u8, did_u16, size_pu8, &l_didSupported_, buf_pu8, opStatus_u8);
+}
+
+/* Stubs for the cache tests, both slots emptied */
+static void cacheSetUp(void) {
+  getDidCfg_StubWithCallback(getDidCfg_Callback);
+  RdbiVhitOverVoltageFaultDiag__StubWithCallback(Handler_Callback);
+  s_handlerCalls_u8 = 0u;
+  s_handlerResult_ = E_OK;
+  (void)invalidateDidCache(0xF190);
+  (void)invalidateDidCache(0xF200);
+}
+
+/* NRC of the session/security part of the access check, 0 = granted */
+static uint8 s_accessNrc_u8;
+
+static Std_ReturnType checkDidAccess_Callback(const DiagCfg_DidCfg_t *didCfg_pst, uint8 access_u8, uint8 *errCode_pu8, int cmock_num_calls) {
+  (void)cmock_num_calls;
+
+  if((NULL == didCfg_pst) || (0u == (didCfg_pst->access_u8 & access_u8))) {
+    *errCode_pu8 = kLinDiagNrcRequestOutOfRange;
+  } else if(0u != s_accessNrc_u8) {
+    *errCode_pu8 = s_accessNrc_u8;
+  } else {
+    return E_OK;
+  }
+
+  return E_NOT_OK;
+}
+
+void setUp(void) {
+  s_accessNrc_u8 = 0u;
+  checkDidAccess_StubWithCallback(checkDidAccess_Callback);
+}
 
 void tearDown(void) { /* Verify all mock expectations were met */ }
 
@@ -18,10 +92,11 @@ void test_getHandlersForReadDataById_ValidDID_F308(void) {
   uint8 l_diagBuf_pu8[10] = {0};
   SubfunctionRequestOutOfRange__IgnoreAndReturn(E_NOT_OK);
   /* Expect handler to be called and return E_OK */
+  getDidCfg_ExpectAndReturn(0xF308, &s_didF308Cfg_cst);
   RdbiVhitOverVoltageFaultDiag__IgnoreAndReturn(E_OK);
 
   /* Call function */
-  Std_ReturnType result = getHandlersForReadDataById(&g_errCode_u8, l_did_cu16, &l_diagBufSize_u8, &l_didSupported_, l_diagBuf_pu8);
+  Std_ReturnType result = getHandlersForReadDataById(&g_errCode_u8, l_did_cu16, &l_diagBufSize_u8, &l_didSupported_, l_diagBuf_pu8, DIAG_OPSTATUS_INITIAL);
 
   /* Verify buffer size was set to DID_F308_SIZE */
   TEST_ASSERT_EQUAL(DID_F308_SIZE, l_diagBufSize_u8);
@@ -43,11 +118,12 @@ void test_getHandlersForReadDataById_InvalidDID(void) {
   Std_ReturnType l_didSupported_ = E_OK;
   uint8 l_diagBuf_pu8[10] = {0};
 
-  /* Expect Subfunction_Request_Out_Of_Range handler to be called */
+  /* DID is not in the table: expect Subfunction_Request_Out_Of_Range handler to be called */
+  getDidCfg_ExpectAndReturn(0x1234, NULL);
   SubfunctionRequestOutOfRange__IgnoreAndReturn(E_NOT_OK);
 
   /* Call function */
-  Std_ReturnType result = getHandlersForReadDataById(&g_errCode_u8, g_did_cu16, &l_diagBufSize_u8, &l_didSupported_, l_diagBuf_pu8);
+  Std_ReturnType result = getHandlersForReadDataById(&g_errCode_u8, g_did_cu16, &l_diagBufSize_u8, &l_didSupported_, l_diagBuf_pu8, DIAG_OPSTATUS_INITIAL);
 
   /* Verify didSupported was set to E_NOT_OK */
   TEST_ASSERT_EQUAL(E_NOT_OK, l_didSupported_);
@@ -72,9 +148,10 @@ void test_getHandlersForReadDataById_MultipleInvalidDIDs(void) {
     uint8 l_diagBuf_pu8[10] = {0};
     g_did_cu16 = invalid_dids[i];
 
+    getDidCfg_ExpectAndReturn(g_did_cu16, NULL);
     SubfunctionRequestOutOfRange__IgnoreAndReturn(E_NOT_OK);
 
-    Std_ReturnType result = getHandlersForReadDataById(&g_errCode_u8, g_did_cu16, &l_diagBufSize_u8, &l_didSupported_, l_diagBuf_pu8);
+    Std_ReturnType result = getHandlersForReadDataById(&g_errCode_u8, g_did_cu16, &l_diagBufSize_u8, &l_didSupported_, l_diagBuf_pu8, DIAG_OPSTATUS_INITIAL);
 
     TEST_ASSERT_EQUAL_MESSAGE(E_NOT_OK, l_didSupported_, "didSupported should be E_NOT_OK");
     TEST_ASSERT_EQUAL_MESSAGE(kLinDiagNrcRequestOutOfRange, g_errCode_u8, "errCode should be set to kLinDiagNrcRequestOutOfRange");
@@ -93,9 +170,10 @@ void test_getHandlersForReadDataById_ValidDID_HandlerReturnsError(void) {
   SubfunctionRequestOutOfRange__IgnoreAndReturn(E_NOT_OK);
 
   /* Expect handler to be called and return E_NOT_OK */
+  getDidCfg_ExpectAndReturn(0xF308, &s_didF308Cfg_cst);
   RdbiVhitOverVoltageFaultDiag__IgnoreAndReturn(E_NOT_OK); /* Handler returns error */
 
-  Std_ReturnType result = getHandlersForReadDataById(&g_errCode_u8, g_did_cu16, &l_diagBufSize_u8, &l_didSupported_, l_diagBuf_pu8);
+  Std_ReturnType result = getHandlersForReadDataById(&g_errCode_u8, g_did_cu16, &l_diagBufSize_u8, &l_didSupported_, l_diagBuf_pu8, DIAG_OPSTATUS_INITIAL);
 
   /* Verify buffer size was still set */
   TEST_ASSERT_EQUAL(DID_F308_SIZE, l_diagBufSize_u8);
@@ -115,9 +193,10 @@ void test_getHandlersForReadDataById_ErrorCodePassedToHandler(void) {
   uint8 l_diagBuf_pu8[10] = {0};
 
   SubfunctionRequestOutOfRange__IgnoreAndReturn(E_NOT_OK);
+  getDidCfg_ExpectAndReturn(0xF308, &s_didF308Cfg_cst);
   RdbiVhitOverVoltageFaultDiag__IgnoreAndReturn(E_OK);
 
-  Std_ReturnType result = getHandlersForReadDataById(&g_errCode_u8, g_did_cu16, &l_diagBufSize_u8, &l_didSupported_, l_diagBuf_pu8);
+  Std_ReturnType result = getHandlersForReadDataById(&g_errCode_u8, g_did_cu16, &l_diagBufSize_u8, &l_didSupported_, l_diagBuf_pu8, DIAG_OPSTATUS_INITIAL);
 
   TEST_ASSERT_EQUAL(E_OK, result);
 }
@@ -134,9 +213,10 @@ void test_getHandlersForReadDataById_OutputBufferPassedToHandler(void) {
 
   /* Expect the specific buffer to be passed to handler */
   SubfunctionRequestOutOfRange__IgnoreAndReturn(E_NOT_OK);
+  getDidCfg_ExpectAndReturn(0xF308, &s_didF308Cfg_cst);
   RdbiVhitOverVoltageFaultDiag__IgnoreAndReturn(E_OK);
 
-  Std_ReturnType result = getHandlersForReadDataById(&g_errCode_u8, g_did_cu16, &l_diagBufSize_u8, &l_didSupported_, l_diagBuf_pu8);
+  Std_ReturnType result = getHandlersForReadDataById(&g_errCode_u8, g_did_cu16, &l_diagBufSize_u8, &l_didSupported_, l_diagBuf_pu8, DIAG_OPSTATUS_INITIAL);
   TEST_ASSERT_EQUAL(E_OK, result);
 }
 
@@ -151,11 +231,206 @@ void test_getHandlersForReadDataById_BufferSizePointerPassedToHandler(void) {
   uint8 l_diagBuf_pu8[10] = {0};
 
   SubfunctionRequestOutOfRange__IgnoreAndReturn(E_NOT_OK);
+  getDidCfg_ExpectAndReturn(0xF308, &s_didF308Cfg_cst);
   RdbiVhitOverVoltageFaultDiag__IgnoreAndReturn(E_OK);
 
-  Std_ReturnType result = getHandlersForReadDataById(&g_errCode_u8, g_did_cu16, &l_diagBufSize_u8, &l_didSupported_, l_diagBuf_pu8);
+  Std_ReturnType result = getHandlersForReadDataById(&g_errCode_u8, g_did_cu16, &l_diagBufSize_u8, &l_didSupported_, l_diagBuf_pu8, DIAG_OPSTATUS_INITIAL);
 
   /* Verify the size was set before handler was called */
   TEST_ASSERT_EQUAL(DID_F308_SIZE, l_diagBufSize_u8);
   TEST_ASSERT_EQUAL(E_OK, result);
 }
+
+/**
+ * Test: DID present in the table without read access is rejected like an unknown DID
+ */
+void test_getHandlersForReadDataById_WriteOnlyDID(void) {
+  static const DiagCfg_DidCfg_t l_writeOnlyCfg_cst = {0xF308, DID_F308_SIZE, DIAG_CFG_ACCESS_WRITE, DIAG_CFG_SESSION_DEFAULT, 0u, DIAG_CFG_DID_DYNAMIC, DIAG_CFG_CACHE_NEVER,
+                                                       DIAG_CFG_CACHE_NO_SLOT, 0u, 0u, &RdbiVhitOverVoltageFaultDiag_};
+  g_errCode_u8 = 0;
+  g_did_cu16 = 0xF308;
+  uint8 l_diagBufSize_u8 = 0xFF;
+  Std_ReturnType l_didSupported_ = E_OK;
+  uint8 l_diagBuf_pu8[10] = {0};
+
+  getDidCfg_ExpectAndReturn(0xF308, &l_writeOnlyCfg_cst);
+  SubfunctionRequestOutOfRange__IgnoreAndReturn(E_NOT_OK);
+
+  Std_ReturnType result = getHandlersForReadDataById(&g_errCode_u8, g_did_cu16, &l_diagBufSize_u8, &l_didSupported_, l_diagBuf_pu8, DIAG_OPSTATUS_INITIAL);
+
+  /* Size is not taken from a descriptor that cannot be read */
+  TEST_ASSERT_EQUAL(0xFF, l_diagBufSize_u8);
+  TEST_ASSERT_EQUAL(E_NOT_OK, l_didSupported_);
+  TEST_ASSERT_EQUAL(kLinDiagNrcRequestOutOfRange, g_errCode_u8);
+  TEST_ASSERT_EQUAL(E_NOT_OK, result);
+}
+
+/**
+ * Test: DID of another session is rejected like an unknown DID, its handler is not called
+ */
+void test_getHandlersForReadDataById_SessionMismatch(void) {
+  g_errCode_u8 = 0;
+  uint8 l_diagBufSize_u8 = 0xFF;
+  Std_ReturnType l_didSupported_ = E_OK;
+  uint8 l_diagBuf_pu8[10] = {0};
+
+  s_accessNrc_u8 = kLinDiagNrcRequestOutOfRange;
+  getDidCfg_ExpectAndReturn(0xF308, &s_didF308Cfg_cst);
+  SubfunctionRequestOutOfRange__IgnoreAndReturn(E_NOT_OK);
+
+  Std_ReturnType result = getHandlersForReadDataById(&g_errCode_u8, 0xF308, &l_diagBufSize_u8, &l_didSupported_, l_diagBuf_pu8, DIAG_OPSTATUS_INITIAL);
+
+  TEST_ASSERT_EQUAL(0xFF, l_diagBufSize_u8);
+  TEST_ASSERT_EQUAL(E_NOT_OK, l_didSupported_);
+  TEST_ASSERT_EQUAL(kLinDiagNrcRequestOutOfRange, g_errCode_u8);
+  TEST_ASSERT_EQUAL(E_NOT_OK, result);
+}
+
+/**
+ * Test: DID above the unlocked security level is answered with securityAccessDenied, its handler is not called
+ */
+void test_getHandlersForReadDataById_SecurityLocked(void) {
+  g_errCode_u8 = 0;
+  uint8 l_diagBufSize_u8 = 0xFF;
+  Std_ReturnType l_didSupported_ = E_OK;
+  uint8 l_diagBuf_pu8[10] = {0};
+
+  s_accessNrc_u8 = kLinDiagNrcSecurityAccessDenied;
+  getDidCfg_ExpectAndReturn(0xF308, &s_didF308Cfg_cst);
+  SubfunctionRequestOutOfRange__IgnoreAndReturn(E_NOT_OK);
+
+  Std_ReturnType result = getHandlersForReadDataById(&g_errCode_u8, 0xF308, &l_diagBufSize_u8, &l_didSupported_, l_diagBuf_pu8, DIAG_OPSTATUS_INITIAL);
+
+  TEST_ASSERT_EQUAL(0xFF, l_diagBufSize_u8);
+  TEST_ASSERT_EQUAL(E_NOT_OK, l_didSupported_);
+  TEST_ASSERT_EQUAL(kLinDiagNrcSecurityAccessDenied, g_errCode_u8);
+  TEST_ASSERT_EQUAL(E_NOT_OK, result);
+}
+
+/**
+ * Test: E_PENDING from the handler is propagated and the operation status reaches it
+ */
+void test_getHandlersForReadDataById_HandlerPending(void) {
+  g_errCode_u8 = 0;
+  g_did_cu16 = 0xF308;
+  uint8 l_diagBufSize_u8 = 0;
+  Std_ReturnType l_didSupported_ = E_OK;
+  uint8 l_diagBuf_pu8[10] = {0};
+
+  getDidCfg_ExpectAndReturn(0xF308, &s_didF308Cfg_cst);
+  RdbiVhitOverVoltageFaultDiag__ExpectAndReturn(l_diagBuf_pu8, &l_diagBufSize_u8, &g_errCode_u8, DIAG_OPSTATUS_PENDING, E_PENDING);
+
+  Std_ReturnType result = getHandlersForReadDataById(&g_errCode_u8, g_did_cu16, &l_diagBufSize_u8, &l_didSupported_, l_diagBuf_pu8, DIAG_OPSTATUS_PENDING);
+
+  /* Pending is not a failure: DID still supported, no NRC */
+  TEST_ASSERT_EQUAL(E_PENDING, result);
+  TEST_ASSERT_EQUAL(E_OK, l_didSupported_);
+  TEST_ASSERT_EQUAL(0, g_errCode_u8);
+}
+
+/**
+ * Test: second read of a cached DID is served from the cache, the handler is not called again
+ */
+void test_getHandlersForReadDataById_CacheHit(void) {
+  uint8 l_diagBuf_pu8[10] = {0};
+  uint8 l_diagBufSize_u8 = 0;
+  cacheSetUp();
+
+  TEST_ASSERT_EQUAL(E_OK, readDid(0xF190, l_diagBuf_pu8, &l_diagBufSize_u8, DIAG_OPSTATUS_INITIAL));
+  TEST_ASSERT_EQUAL_UINT8(1u, s_handlerCalls_u8);
+
+  memset(l_diagBuf_pu8, 0, sizeof(l_diagBuf_pu8));
+  l_diagBufSize_u8 = 0;
+  TEST_ASSERT_EQUAL(E_OK, readDid(0xF190, l_diagBuf_pu8, &l_diagBufSize_u8, DIAG_OPSTATUS_INITIAL));
+
+  TEST_ASSERT_EQUAL_UINT8(1u, s_handlerCalls_u8);
+  TEST_ASSERT_EQUAL(4u, l_diagBufSize_u8);
+  TEST_ASSERT_EQUAL_HEX8_ARRAY(s_firstPayload_au8, l_diagBuf_pu8, 4);
+  TEST_ASSERT_EQUAL_HEX8(0x00, l_diagBuf_pu8[4]);
+}
+
+/**
+ * Test: invalidateDidCache drops the cached payload, the next read calls the handler
+ */
+void test_getHandlersForReadDataById_CacheInvalidated(void) {
+  uint8 l_diagBuf_pu8[10] = {0};
+  uint8 l_diagBufSize_u8 = 0;
+  cacheSetUp();
+
+  (void)readDid(0xF190, l_diagBuf_pu8, &l_diagBufSize_u8, DIAG_OPSTATUS_INITIAL);
+  TEST_ASSERT_EQUAL(E_OK, invalidateDidCache(0xF190));
+  TEST_ASSERT_EQUAL(E_OK, readDid(0xF190, l_diagBuf_pu8, &l_diagBufSize_u8, DIAG_OPSTATUS_INITIAL));
+
+  TEST_ASSERT_EQUAL_UINT8(2u, s_handlerCalls_u8);
+  TEST_ASSERT_EQUAL_HEX8_ARRAY(s_secondPayload_au8, l_diagBuf_pu8, 4);
+
+  /* The fresh payload is cached again */
+  (void)readDid(0xF190, l_diagBuf_pu8, &l_diagBufSize_u8, DIAG_OPSTATUS_INITIAL);
+  TEST_ASSERT_EQUAL_UINT8(2u, s_handlerCalls_u8);
+}
+
+/**
+ * Test: a TTL payload is served for TTL / main period ticks of ageDidCache, then read again
+ */
+void test_getHandlersForReadDataById_CacheTtlExpiry(void) {
+  uint8 l_diagBuf_pu8[10] = {0};
+  uint8 l_diagBufSize_u8 = 0;
+  cacheSetUp();
+
+  (void)readDid(0xF200, l_diagBuf_pu8, &l_diagBufSize_u8, DIAG_OPSTATUS_INITIAL);
+  ageDidCache();
+  ageDidCache();
+  (void)readDid(0xF200, l_diagBuf_pu8, &l_diagBufSize_u8, DIAG_OPSTATUS_INITIAL);
+  TEST_ASSERT_EQUAL_UINT8(1u, s_handlerCalls_u8);
+
+  ageDidCache();
+  (void)readDid(0xF200, l_diagBuf_pu8, &l_diagBufSize_u8, DIAG_OPSTATUS_INITIAL);
+  TEST_ASSERT_EQUAL_UINT8(2u, s_handlerCalls_u8);
+  TEST_ASSERT_EQUAL_HEX8_ARRAY(s_secondPayload_au8, l_diagBuf_pu8, 2);
+}
+
+/**
+ * Test: an invalidation while the handler is pending keeps its payload out of the cache
+ */
+void test_getHandlersForReadDataById_CacheInvalidatedWhilePending(void) {
+  uint8 l_diagBuf_pu8[10] = {0};
+  uint8 l_diagBufSize_u8 = 0;
+  cacheSetUp();
+
+  s_handlerResult_ = E_PENDING;
+  TEST_ASSERT_EQUAL(E_PENDING, readDid(0xF190, l_diagBuf_pu8, &l_diagBufSize_u8, DIAG_OPSTATUS_INITIAL));
+  TEST_ASSERT_EQUAL(E_OK, invalidateDidCache(0xF190));
+  s_handlerResult_ = E_OK;
+  TEST_ASSERT_EQUAL(E_OK, readDid(0xF190, l_diagBuf_pu8, &l_diagBufSize_u8, DIAG_OPSTATUS_PENDING));
+
+  /* The payload read across the invalidation is sent but not cached */
+  (void)readDid(0xF190, l_diagBuf_pu8, &l_diagBufSize_u8, DIAG_OPSTATUS_INITIAL);
+  TEST_ASSERT_EQUAL_UINT8(3u, s_handlerCalls_u8);
+}
+
+/**
+ * Test: a failing handler leaves nothing in the cache
+ */
+void test_getHandlersForReadDataById_CacheNotFilledOnError(void) {
+  uint8 l_diagBuf_pu8[10] = {0};
+  uint8 l_diagBufSize_u8 = 0;
+  cacheSetUp();
+
+  s_handlerResult_ = E_NOT_OK;
+  TEST_ASSERT_EQUAL(E_NOT_OK, readDid(0xF190, l_diagBuf_pu8, &l_diagBufSize_u8, DIAG_OPSTATUS_INITIAL));
+  s_handlerResult_ = E_OK;
+  TEST_ASSERT_EQUAL(E_OK, readDid(0xF190, l_diagBuf_pu8, &l_diagBufSize_u8, DIAG_OPSTATUS_INITIAL));
+
+  TEST_ASSERT_EQUAL_UINT8(2u, s_handlerCalls_u8);
+}
+
+/**
+ * Test: invalidateDidCache rejects DIDs that are unknown or not cached
+ */
+void test_getHandlersForReadDataById_InvalidateUncached(void) {
+  getDidCfg_ExpectAndReturn(0xF308, &s_didF308Cfg_cst);
+  TEST_ASSERT_EQUAL(E_NOT_OK, invalidateDidCache(0xF308));
+
+  getDidCfg_ExpectAndReturn(0x1234, NULL);
+  TEST_ASSERT_EQUAL(E_NOT_OK, invalidateDidCache(0x1234));
+}
@@ -0,0 +1,30 @@
+#ifndef DIAGNOSTIC_CFG_H
+#define DIAGNOSTIC_CFG_H
+
+#include <stdint.h>
+
+typedef uint8_t uint8;
+typedef uint16_t uint16;
+
+#define NULL ((void *)0)
+
+#define DIAG_CFG_SESSION_DEFAULT 0x01U
+#define DIAG_CFG_SESSION_PROGRAMMING 0x02U
+#define DIAG_CFG_SESSION_EXTENDED 0x04U
+
+#define DIAG_CFG_SID_FIRST 0x10u
+#define DIAG_CFG_SID_LAST 0x3Eu
+#define DIAG_CFG_SID_COUNT ((uint8)(DIAG_CFG_SID_LAST - DIAG_CFG_SID_FIRST + 1u))
+
+typedef void (*diagServiceHandler_t)(void);
+
+typedef struct {
+  uint8 minLen_u8;
+  uint8 session_u8;
+  uint8 security_u8;
+  diagServiceHandler_t service_pf;
+} DiagCfg_SidCfg_t;
+
+extern const DiagCfg_SidCfg_t DiagCfg_SidCfg_cst[DIAG_CFG_SID_COUNT];
+
+#endif
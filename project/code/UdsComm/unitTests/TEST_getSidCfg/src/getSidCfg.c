@@ -0,0 +1,39 @@
+#include "getSidCfg.h"
+
+/* Services are only referenced by the table */
+void ApplLinDiagClearDiagnosticInformation(void) {}
+void ApplLinDiagReadDtcInformation(void) {}
+void ApplLinDiagReadDataById(void) {}
+void ApplLinDiagReadDataByPeriodicId(void) {}
+void ApplLinDiagWriteDataById(void) {}
+void ApplLinDiagRoutineControl(void) {}
+void ApplLinDiagTesterPresent(void) {}
+
+/* Indexed by SID - DIAG_CFG_SID_FIRST; SIDs not listed have no service. Minimum lengths include the SID. */
+const DiagCfg_SidCfg_t DiagCfg_SidCfg_cst[DIAG_CFG_SID_COUNT] = {
+    /* ClearDiagnosticInformation: groupOfDTC (3 bytes) */
+    [0x14u - DIAG_CFG_SID_FIRST] = {4u, DIAG_CFG_SESSION_DEFAULT | DIAG_CFG_SESSION_EXTENDED, 0u, &ApplLinDiagClearDiagnosticInformation},
+    /* ReadDTCInformation: sub-function */
+    [0x19u - DIAG_CFG_SID_FIRST] = {2u, DIAG_CFG_SESSION_DEFAULT | DIAG_CFG_SESSION_EXTENDED, 0u, &ApplLinDiagReadDtcInformation},
+    /* ReadDataByIdentifier: DID#1 .. DID#n */
+    [0x22u - DIAG_CFG_SID_FIRST] = {3u, DIAG_CFG_SESSION_DEFAULT | DIAG_CFG_SESSION_EXTENDED, 0u, &ApplLinDiagReadDataById},
+    /* ReadDataByPeriodicIdentifier: transmissionMode, periodic identifiers (none with stopSending) */
+    [0x2Au - DIAG_CFG_SID_FIRST] = {2u, DIAG_CFG_SESSION_DEFAULT | DIAG_CFG_SESSION_EXTENDED, 0u, &ApplLinDiagReadDataByPeriodicId},
+    /* WriteDataByIdentifier: DID, at least one data byte */
+    [0x2Eu - DIAG_CFG_SID_FIRST] = {4u, DIAG_CFG_SESSION_DEFAULT | DIAG_CFG_SESSION_EXTENDED, 0u, &ApplLinDiagWriteDataById},
+    /* RoutineControl: sub-function, RID */
+    [0x31u - DIAG_CFG_SID_FIRST] = {4u, DIAG_CFG_SESSION_DEFAULT | DIAG_CFG_SESSION_EXTENDED, 0u, &ApplLinDiagRoutineControl},
+    /* TesterPresent: sub-function */
+    [0x3Eu - DIAG_CFG_SID_FIRST] = {2u, DIAG_CFG_SESSION_DEFAULT | DIAG_CFG_SESSION_PROGRAMMING | DIAG_CFG_SESSION_EXTENDED, 0u, &ApplLinDiagTesterPresent},
+};
+
+/* FUNCTION TO TEST */
+const DiagCfg_SidCfg_t *getSidCfg(uint8 sid_u8) {
+  const DiagCfg_SidCfg_t *l_sidCfg_pst = NULL;
+
+  if((sid_u8 >= DIAG_CFG_SID_FIRST) && (sid_u8 <= DIAG_CFG_SID_LAST) && (NULL != DiagCfg_SidCfg_cst[sid_u8 - DIAG_CFG_SID_FIRST].service_pf)) {
+    l_sidCfg_pst = &DiagCfg_SidCfg_cst[sid_u8 - DIAG_CFG_SID_FIRST];
+  }
+
+  return l_sidCfg_pst;
+}
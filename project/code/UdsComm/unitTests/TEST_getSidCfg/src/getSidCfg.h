@@ -0,0 +1,16 @@
+#ifndef DIAGNOSTIC_H
+#define DIAGNOSTIC_H
+#include "diagnostic_cfg.h"
+#include <stdint.h>
+
+void ApplLinDiagClearDiagnosticInformation(void);
+void ApplLinDiagReadDtcInformation(void);
+void ApplLinDiagReadDataById(void);
+void ApplLinDiagReadDataByPeriodicId(void);
+void ApplLinDiagWriteDataById(void);
+void ApplLinDiagRoutineControl(void);
+void ApplLinDiagTesterPresent(void);
+
+const DiagCfg_SidCfg_t *getSidCfg(uint8 sid_u8);
+
+#endif
@@ -0,0 +1,46 @@
+#include "getSidCfg.h"
+#include "unity.h"
+
+void setUp(void) {}
+
+void tearDown(void) {}
+
+/* Test: every configured SID returns its own table entry */
+void test_getSidCfg_ConfiguredSids(void) {
+  TEST_ASSERT_EQUAL_PTR(&DiagCfg_SidCfg_cst[0x22u - DIAG_CFG_SID_FIRST], getSidCfg(0x22u));
+  TEST_ASSERT_EQUAL_PTR(&ApplLinDiagClearDiagnosticInformation, getSidCfg(0x14u)->service_pf);
+  TEST_ASSERT_EQUAL_PTR(&ApplLinDiagReadDtcInformation, getSidCfg(0x19u)->service_pf);
+  TEST_ASSERT_EQUAL_PTR(&ApplLinDiagReadDataById, getSidCfg(0x22u)->service_pf);
+  TEST_ASSERT_EQUAL_PTR(&ApplLinDiagReadDataByPeriodicId, getSidCfg(0x2Au)->service_pf);
+  TEST_ASSERT_EQUAL_PTR(&ApplLinDiagWriteDataById, getSidCfg(0x2Eu)->service_pf);
+  TEST_ASSERT_EQUAL_PTR(&ApplLinDiagRoutineControl, getSidCfg(0x31u)->service_pf);
+  TEST_ASSERT_EQUAL_PTR(&ApplLinDiagTesterPresent, getSidCfg(0x3Eu)->service_pf);
+}
+
+/* Test: entry fields are returned unchanged */
+void test_getSidCfg_WriteDataByIdEntry(void) {
+  const DiagCfg_SidCfg_t *l_sidCfg_pst = getSidCfg(0x2Eu);
+
+  TEST_ASSERT_NOT_NULL(l_sidCfg_pst);
+  TEST_ASSERT_EQUAL(4u, l_sidCfg_pst->minLen_u8);
+  TEST_ASSERT_EQUAL(DIAG_CFG_SESSION_DEFAULT | DIAG_CFG_SESSION_EXTENDED, l_sidCfg_pst->session_u8);
+  TEST_ASSERT_EQUAL(0u, l_sidCfg_pst->security_u8);
+}
+
+/* Test: SIDs inside the table range without a service are not found */
+void test_getSidCfg_GapsInTable(void) {
+  uint8 gaps[] = {0x10u, 0x11u, 0x13u, 0x15u, 0x23u, 0x27u, 0x2Bu, 0x2Fu, 0x3Du};
+  uint8 l_idx_u8;
+
+  for(l_idx_u8 = 0u; l_idx_u8 < (uint8)(sizeof(gaps) / sizeof(gaps[0])); l_idx_u8++) { TEST_ASSERT_NULL(getSidCfg(gaps[l_idx_u8])); }
+}
+
+/* Test: SIDs outside the table range (including response SIDs) are not found */
+void test_getSidCfg_OutOfRange(void) {
+  TEST_ASSERT_NULL(getSidCfg(0x00u));
+  TEST_ASSERT_NULL(getSidCfg(0x0Fu));
+  TEST_ASSERT_NULL(getSidCfg(0x3Fu));
+  TEST_ASSERT_NULL(getSidCfg(0x62u));
+  TEST_ASSERT_NULL(getSidCfg(0x7Fu));
+  TEST_ASSERT_NULL(getSidCfg(0xFFu));
+}
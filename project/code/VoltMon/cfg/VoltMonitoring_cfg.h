@@ -118,6 +118,71 @@ extern const uint16_t VoltMon_DeactivationTime_ms;
  */
 extern const uint16_t VoltMon_TaskPeriod_ms;
 
+/*==============================================================================
+ * Configuration integrity
+ *============================================================================*/
+
+/**
+ * @brief Number of 16-bit configuration values covered by `VoltMon_CfgCrc_cu8`.
+ */
+#define VOLTMON_CFG_CRC_DATA_COUNT (10u)
+
+/**
+ * @brief CRC-8/ATM of the constant configuration values.
+ *
+ * @details
+ * Computed by the preprocessor from the configuration initializers and stored
+ * in ROM next to them, so that the startup path does not spend any time on it.
+ * Covered values, in this order, each as 2 bytes little endian:
+ * thresholds (under, over, hysteresis), times (activation, deactivation, task
+ * period) and the voltage reading limits (lower, higher, middle lower, middle
+ * higher).
+ */
+extern const uint8_t VoltMon_CfgCrc_cu8;
+
+/**
+ * @brief Check the constant configuration against its compile-time CRC.
+ *
+ * @details
+ * **Goal of the function**
+ *
+ * The purpose of this function is to detect a corruption of the configuration
+ * values in ROM. It is meant to be called on demand (e.g. from a diagnostic or
+ * a background safety task), not on the startup path.
+ *
+ * The processing logic:
+ * - Reads the covered configuration values from ROM, low byte first.
+ * - Computes their CRC-8/ATM bitwise (20 bytes, no lookup table needed).
+ * - Compares the result with `VoltMon_CfgCrc_cu8`.
+ *
+ * @par Interface summary
+ *
+ * | Interface                  | In | Out | Data type    | Param | Data factor | Data offset | Data size | Data range | Data unit |
+ * |----------------------------|:--:|:---:|--------------|-------|------------:|------------:|----------:|------------|-----------|
+ * | VoltMon_ThresholdUnder_mV ... middleHigherVoltMonCfg_cu16 | X |  | const uint16 | - | 1 | 0 | 10 | [0, 65535] | [-] |
+ * | VoltMon_CfgCrc_cu8         | X  |     | const uint8  |   -   |      1      |           0 |         1 | [0, 255]   | [-]       |
+ * | VoltMon_CheckCfgCrc()      |    | X   | uint8(void)  |   -   |      1      |           0 |         1 | {0, 1}     | [-]       |
+ *
+ * @par Activity diagram (PlantUML)
+ *
+ * @startuml
+ * start
+ * :crc = 0x00;
+ * while (more configuration bytes?) is (yes)
+ *   :crc = crc8(crc, next byte);
+ * endwhile (no)
+ * if (crc == VoltMon_CfgCrc_cu8) then (MATCH)
+ *   :return 1;
+ * else (MISMATCH)
+ *   :return 0;
+ * endif
+ * stop
+ * @enduml
+ *
+ * @return 1u if the configuration matches its CRC, 0u if it is corrupted.
+ */
+uint8_t VoltMon_CheckCfgCrc(void);
+
 /*==============================================================================
  * Project voltage reading function
  *============================================================================*/
@@ -0,0 +1,78 @@
+#include "VoltMon_CheckCfgCrc.h"
+
+#define VOLTMON_THRESHOLD_UNDER_MV (8000u)
+#define VOLTMON_THRESHOLD_OVER_MV (13000u)
+#define VOLTMON_HYSTERESIS_MV (500u)
+#define VOLTMON_ACTIVATION_TIME_MS (500u)
+#define VOLTMON_DEACTIVATION_TIME_MS (500u)
+#define VOLTMON_TASK_PERIOD_MS (10u)
+#define VOLTMON_LOWER_MV (0u)
+#define VOLTMON_HIGHER_MV (20000u)
+#define VOLTMON_MIDDLE_LOWER_MV (5000u)
+#define VOLTMON_MIDDLE_HIGHER_MV (10000u)
+
+uint16_t VoltMon_ThresholdUnder_mV = VOLTMON_THRESHOLD_UNDER_MV;
+uint16_t VoltMon_ThresholdOver_mV = VOLTMON_THRESHOLD_OVER_MV;
+uint16_t VoltMon_Hysteresis_mV = VOLTMON_HYSTERESIS_MV;
+
+uint16_t VoltMon_ActivationTime_ms = VOLTMON_ACTIVATION_TIME_MS;
+uint16_t VoltMon_DeactivationTime_ms = VOLTMON_DEACTIVATION_TIME_MS;
+
+/* Periodo task di monitoraggio (esempio: 10 ms) */
+uint16_t VoltMon_TaskPeriod_ms = VOLTMON_TASK_PERIOD_MS;
+
+uint16_t lowerVoltMonCfg_cu16 = VOLTMON_LOWER_MV;
+uint16_t higherVoltMonCfg_cu16 = VOLTMON_HIGHER_MV;
+uint16_t middleLowerVoltMonCfg_cu16 = VOLTMON_MIDDLE_LOWER_MV;
+uint16_t middleHigherVoltMonCfg_cu16 = VOLTMON_MIDDLE_HIGHER_MV;
+
+/* ---- CRC-8 DELLA CONFIGURAZIONE (calcolato a compile time) ---- */
+
+/* CRC-8/ATM di un byte come espressione costante (stessa espansione di EDD_CRC8_CT_BYTE,
+ * il componente viene compilato da solo e non vede gli header di ErrorDataDetection) */
+#define VOLTMON_CFG_CRC8_BYTE(crc, byte)                                                                                                                                       \
+  ((((((crc) ^ (byte)) >> 0) & 1u) * 0x07u) ^ (((((crc) ^ (byte)) >> 1) & 1u) * 0x0Eu) ^ (((((crc) ^ (byte)) >> 2) & 1u) * 0x1Cu) ^                                           \
+   (((((crc) ^ (byte)) >> 3) & 1u) * 0x38u) ^ (((((crc) ^ (byte)) >> 4) & 1u) * 0x70u) ^ (((((crc) ^ (byte)) >> 5) & 1u) * 0xE0u) ^                                            \
+   (((((crc) ^ (byte)) >> 6) & 1u) * 0xC7u) ^ (((((crc) ^ (byte)) >> 7) & 1u) * 0x89u))
+
+#define VOLTMON_CFG_CRC8_U16(crc, value) VOLTMON_CFG_CRC8_BYTE(VOLTMON_CFG_CRC8_BYTE((crc), ((value) & 0xFFu)), (((value) >> 8) & 0xFFu))
+
+/* Catena nello stesso ordine di VoltMon_CfgCrcData (un valore per costante: espansione lineare) */
+enum {
+  VOLTMON_CFG_CRC_0 = VOLTMON_CFG_CRC8_U16(0x00u, VOLTMON_THRESHOLD_UNDER_MV),
+  VOLTMON_CFG_CRC_1 = VOLTMON_CFG_CRC8_U16(VOLTMON_CFG_CRC_0, VOLTMON_THRESHOLD_OVER_MV),
+  VOLTMON_CFG_CRC_2 = VOLTMON_CFG_CRC8_U16(VOLTMON_CFG_CRC_1, VOLTMON_HYSTERESIS_MV),
+  VOLTMON_CFG_CRC_3 = VOLTMON_CFG_CRC8_U16(VOLTMON_CFG_CRC_2, VOLTMON_ACTIVATION_TIME_MS),
+  VOLTMON_CFG_CRC_4 = VOLTMON_CFG_CRC8_U16(VOLTMON_CFG_CRC_3, VOLTMON_DEACTIVATION_TIME_MS),
+  VOLTMON_CFG_CRC_5 = VOLTMON_CFG_CRC8_U16(VOLTMON_CFG_CRC_4, VOLTMON_TASK_PERIOD_MS),
+  VOLTMON_CFG_CRC_6 = VOLTMON_CFG_CRC8_U16(VOLTMON_CFG_CRC_5, VOLTMON_LOWER_MV),
+  VOLTMON_CFG_CRC_7 = VOLTMON_CFG_CRC8_U16(VOLTMON_CFG_CRC_6, VOLTMON_HIGHER_MV),
+  VOLTMON_CFG_CRC_8 = VOLTMON_CFG_CRC8_U16(VOLTMON_CFG_CRC_7, VOLTMON_MIDDLE_LOWER_MV),
+  VOLTMON_CFG_CRC_9 = VOLTMON_CFG_CRC8_U16(VOLTMON_CFG_CRC_8, VOLTMON_MIDDLE_HIGHER_MV)
+};
+
+const uint8_t VoltMon_CfgCrc_cu8 = (uint8_t)VOLTMON_CFG_CRC_9;
+
+/* Valori coperti dal CRC, letti dalla ROM al momento della verifica */
+static uint16_t *const VoltMon_CfgCrcData[VOLTMON_CFG_CRC_DATA_COUNT] = {&VoltMon_ThresholdUnder_mV, &VoltMon_ThresholdOver_mV,    &VoltMon_Hysteresis_mV,
+                                                                              &VoltMon_ActivationTime_ms, &VoltMon_DeactivationTime_ms, &VoltMon_TaskPeriod_ms,
+                                                                              &lowerVoltMonCfg_cu16,      &higherVoltMonCfg_cu16,       &middleLowerVoltMonCfg_cu16,
+                                                                              &middleHigherVoltMonCfg_cu16};
+
+/* FUNCTION TO TEST */
+
+uint8_t VoltMon_CheckCfgCrc(void) {
+  uint8_t l_crc_u8 = 0x00u;
+  uint8_t l_byte_u8;
+  uint8_t l_bit_u8;
+  uint8_t l_idx_u8;
+
+  for(l_idx_u8 = 0u; l_idx_u8 < (2u * VOLTMON_CFG_CRC_DATA_COUNT); l_idx_u8++) {
+    /* little endian: prima il byte basso di ogni valore */
+    l_byte_u8 = (uint8_t)(*VoltMon_CfgCrcData[l_idx_u8 >> 1] >> ((l_idx_u8 & 1u) * 8u));
+    l_crc_u8 ^= l_byte_u8;
+    for(l_bit_u8 = 0u; l_bit_u8 < 8u; l_bit_u8++) { l_crc_u8 = ((l_crc_u8 & 0x80u) != 0u) ? (uint8_t)((uint8_t)(l_crc_u8 << 1) ^ 0x07u) : (uint8_t)(l_crc_u8 << 1); }
+  }
+
+  return (l_crc_u8 == VoltMon_CfgCrc_cu8) ? 1u : 0u;
+}
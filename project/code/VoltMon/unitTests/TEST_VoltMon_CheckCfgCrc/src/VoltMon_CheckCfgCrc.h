@@ -0,0 +1,246 @@
+#ifndef VOLT_MONITORING_CFG_H
+#define VOLT_MONITORING_CFG_H
+
+#include <stdint.h>
+
+extern uint16_t lowerVoltMonCfg_cu16;
+extern uint16_t higherVoltMonCfg_cu16;
+extern uint16_t middleLowerVoltMonCfg_cu16;
+extern uint16_t middleHigherVoltMonCfg_cu16;
+
+/**
+ * @file VoltMonitoring_cfg.h
+ * @brief Configuration interface for the Voltage Monitoring module.
+ *
+ * @details
+ * This header defines all project-specific configuration parameters required by
+ * the Voltage Monitoring module.
+ *
+ * The configuration layer is responsible for:
+ * - Providing the project-specific supply voltage reading interface.
+ * - Defining undervoltage and overvoltage thresholds.
+ * - Defining hysteresis and timing parameters used by the monitoring state machine.
+ *
+ * All symbols declared in this file must be defined in the corresponding
+ * `VoltMonitoring_cfg.c` file.
+ *
+ * @note
+ * No application logic shall be implemented in this file.
+ * This file must only contain configuration data and interfaces.
+ */
+
+/*==============================================================================
+ * Voltage reading interface
+ *============================================================================*/
+
+/**
+ * @brief Project-specific macro to read the supply voltage in millivolts.
+ *
+ * @details
+ * This macro abstracts the project-specific voltage acquisition function.
+ * It allows the Voltage Monitoring platform code to remain independent from
+ * the actual ADC / HAL / hardware implementation.
+ *
+ * The macro shall expand to a function call returning the measured voltage
+ * expressed in millivolts.
+ *
+ * @return Supply voltage in millivolts [mV].
+ */
+#define READ_VOLT_PROJECT_MV VoltMon_ReadVoltageProject_mV()
+
+/*==============================================================================
+ * Voltage thresholds configuration
+ *============================================================================*/
+
+/**
+ * @brief Undervoltage threshold in millivolts.
+ *
+ * @details
+ * If the measured supply voltage is below this threshold for at least
+ * `VoltMon_ActivationTime_ms`, an undervoltage condition is detected.
+ *
+ * Typical value: 8000 mV.
+ */
+extern uint16_t VoltMon_ThresholdUnder_mV;
+
+/**
+ * @brief Overvoltage threshold in millivolts.
+ *
+ * @details
+ * If the measured supply voltage is above this threshold for at least
+ * `VoltMon_ActivationTime_ms`, an overvoltage condition is detected.
+ *
+ * Typical value: 13000 mV.
+ */
+extern uint16_t VoltMon_ThresholdOver_mV;
+
+/**
+ * @brief Voltage hysteresis in millivolts.
+ *
+ * @details
+ * This parameter defines the hysteresis band applied when recovering from
+ * undervoltage or overvoltage conditions.
+ *
+ * Typical value: 500 mV.
+ */
+extern uint16_t VoltMon_Hysteresis_mV;
+
+/*==============================================================================
+ * Timing configuration
+ *============================================================================*/
+
+/**
+ * @brief Activation time in milliseconds.
+ *
+ * @details
+ * Minimum time the voltage must continuously violate a threshold before
+ * entering an undervoltage or overvoltage state.
+ *
+ * Typical value: 500 ms.
+ */
+extern uint16_t VoltMon_ActivationTime_ms;
+
+/**
+ * @brief Deactivation time in milliseconds.
+ *
+ * @details
+ * Minimum time the voltage must continuously remain inside the safe range
+ * before returning to the NORMAL state.
+ *
+ * Typical value: 500 ms.
+ */
+extern uint16_t VoltMon_DeactivationTime_ms;
+
+/**
+ * @brief Voltage monitoring task period in milliseconds.
+ *
+ * @details
+ * Period at which the voltage monitoring function (`voltMonRun`) is called.
+ * This value may be used to convert time-based parameters (ms) into
+ * execution cycles if required.
+ *
+ * Typical value: application dependent.
+ */
+extern uint16_t VoltMon_TaskPeriod_ms;
+
+/*==============================================================================
+ * Configuration integrity
+ *============================================================================*/
+
+/**
+ * @brief Number of 16-bit configuration values covered by `VoltMon_CfgCrc_cu8`.
+ */
+#define VOLTMON_CFG_CRC_DATA_COUNT (10u)
+
+/**
+ * @brief CRC-8/ATM of the constant configuration values.
+ *
+ * @details
+ * Computed by the preprocessor from the configuration initializers and stored
+ * in ROM next to them, so that the startup path does not spend any time on it.
+ * Covered values, in this order, each as 2 bytes little endian:
+ * thresholds (under, over, hysteresis), times (activation, deactivation, task
+ * period) and the voltage reading limits (lower, higher, middle lower, middle
+ * higher).
+ */
+extern const uint8_t VoltMon_CfgCrc_cu8;
+
+/**
+ * @brief Check the constant configuration against its compile-time CRC.
+ *
+ * @details
+ * **Goal of the function**
+ *
+ * The purpose of this function is to detect a corruption of the configuration
+ * values in ROM. It is meant to be called on demand (e.g. from a diagnostic or
+ * a background safety task), not on the startup path.
+ *
+ * The processing logic:
+ * - Reads the covered configuration values from ROM, low byte first.
+ * - Computes their CRC-8/ATM bitwise (20 bytes, no lookup table needed).
+ * - Compares the result with `VoltMon_CfgCrc_cu8`.
+ *
+ * @par Interface summary
+ *
+ * | Interface                  | In | Out | Data type    | Param | Data factor | Data offset | Data size | Data range | Data unit |
+ * |----------------------------|:--:|:---:|--------------|-------|------------:|------------:|----------:|------------|-----------|
+ * | VoltMon_ThresholdUnder_mV ... middleHigherVoltMonCfg_cu16 | X |  | const uint16 | - | 1 | 0 | 10 | [0, 65535] | [-] |
+ * | VoltMon_CfgCrc_cu8         | X  |     | const uint8  |   -   |      1      |           0 |         1 | [0, 255]   | [-]       |
+ * | VoltMon_CheckCfgCrc()      |    | X   | uint8(void)  |   -   |      1      |           0 |         1 | {0, 1}     | [-]       |
+ *
+ * @par Activity diagram (PlantUML)
+ *
+ * @startuml
+ * start
+ * :crc = 0x00;
+ * while (more configuration bytes?) is (yes)
+ *   :crc = crc8(crc, next byte);
+ * endwhile (no)
+ * if (crc == VoltMon_CfgCrc_cu8) then (MATCH)
+ *   :return 1;
+ * else (MISMATCH)
+ *   :return 0;
+ * endif
+ * stop
+ * @enduml
+ *
+ * @return 1u if the configuration matches its CRC, 0u if it is corrupted.
+ */
+uint8_t VoltMon_CheckCfgCrc(void);
+
+/*==============================================================================
+ * Project voltage reading function
+ *============================================================================*/
+
+/**
+ * @brief Read and condition the project supply voltage in millivolts.
+ *
+ * @details
+ * **Goal of the function**
+ *
+ * The purpose of this function is to provide a robust project-specific voltage
+ * measurement (in mV) by selecting/combining two internal voltage samples:
+ * an unfiltered value (`supplyDcNotFiler_u16`) and a filtered value
+ * (`supplyDcFiler_u16`).
+ *
+ *
+ * @par Interface summary
+ *
+ * | Interface                                   | In | Out | Data type   | Param | Data factor | Data offset | Data size | Data range     | Data unit |
+ * |---------------------------------------------|:--:|:---:|-------------|-------|------------:|------------:|----------:|----------------|-----------|
+ * | supplyDcNotFiler_u16                        | X  |     | uint16      |   -   |      1      |           0 |         1 | [0, 65535]     | [mV]      |
+ * | supplyDcFiler_u16                           | X  |     | uint16      |   -   |      1      |           0 |         1 | [0, 65535]     | [mV]      |
+ * | lowerVoltMonCfg_cu16                        | X  |     | const uint16|   -   |      1      |           0 |         1 | [0, 20000]     | [mV]      |
+ * | middleLowerVoltMonCfg_cu16                  | X  |     | const uint16|   -   |      1      |           0 |         1 | [0, 20000]     | [mV]      |
+ * | middleHigherVoltMonCfg_cu16                 | X  |     | const uint16|   -   |      1      |           0 |         1 | [0, 20000]     | [mV]      |
+ * | higherVoltMonCfg_cu16                       | X  |     | const uint16|   -   |      1      |           0 |         1 | [0, 20000]     | [mV]      |
+ * | VoltMon_ReadVoltageProject_mV()             |    | X   | uint16(void)|   -   |      1      |           0 |         1 | [0, 19999]     | [mV]      |
+ *
+ * @par Activity diagram (PlantUML)
+ *
+ * @startuml
+ * start
+ * :Read l_supplyDcNotFiler_u16;
+ * :Read l_supplyDcFiler_u16;
+ * :Read limits (lower, midLow, midHigh, higher);
+ *
+ * if (l_supplyDcNotFiler_u16 > lower && l_supplyDcNotFiler_u16 < midLow) then (LOW BAND)
+ *   :l_voltage_mV = l_supplyDcNotFiler_u16;
+ * else if (l_supplyDcNotFiler_u16 >= midLow && l_supplyDcNotFiler_u16 <= midHigh) then (MIDDLE BAND)
+ *   :l_voltage_mV = (l_supplyDcFiler_u16 + l_supplyDcNotFiler_u16) >> 1;
+ * else if (l_supplyDcNotFiler_u16 > midHigh && l_supplyDcNotFiler_u16 < higher) then (HIGH BAND)
+ *   :l_voltage_mV = (l_supplyDcFiler_u16 + l_supplyDcNotFiler_u16) >> 1;
+ * else (OUT OF RANGE)
+ *   :l_voltage_mV = 0;
+ * endif
+ *
+ * :return l_voltage_mV;
+ * stop
+ * @enduml
+ *
+ * @return Conditioned project voltage in millivolts.
+ * Returns 0u if the unfiltered voltage is outside the configured valid range.
+ */
+uint16_t VoltMon_ReadVoltageProject_mV(void);
+
+#endif /* VOLT_MONITORING_CFG_H */
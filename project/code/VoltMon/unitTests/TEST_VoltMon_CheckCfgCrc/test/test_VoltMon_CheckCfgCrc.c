@@ -0,0 +1,80 @@
+#include "VoltMon_CheckCfgCrc.h"
+#include "unity.h"
+
+/* ============================================================================
+ * Setup and Teardown
+ * ============================================================================ */
+
+void setUp(void) { /* Configuration values are restored by the tests that modify them */ }
+
+void tearDown(void) { /* Cleanup after each test if needed */ }
+
+/* ============================================================================
+ * Helpers
+ * ============================================================================ */
+
+/**
+ * @brief Bitwise CRC-8/ATM reference (poly 0x07, init 0x00)
+ */
+static uint8_t referenceCrc8(const uint8_t *data, uint8_t length) {
+  uint8_t crc = 0x00u;
+  uint8_t i;
+  uint8_t bit;
+
+  for(i = 0u; i < length; i++) {
+    crc ^= data[i];
+    for(bit = 0u; bit < 8u; bit++) { crc = ((crc & 0x80u) != 0u) ? (uint8_t)((uint8_t)(crc << 1) ^ 0x07u) : (uint8_t)(crc << 1); }
+  }
+
+  return crc;
+}
+
+/* ============================================================================
+ * Test Cases
+ * ============================================================================ */
+
+/**
+ * @test Compile-time CRC matches the configured values
+ * Input: configuration as delivered
+ * Expected: Return 1
+ */
+void test_VoltMon_CheckCfgCrc_ConfigIntact(void) { TEST_ASSERT_EQUAL_UINT8(1u, VoltMon_CheckCfgCrc()); }
+
+/**
+ * @test Compile-time CRC equals the CRC of the little endian configuration image
+ * Input: byte image of the 10 configuration values
+ * Expected: VoltMon_CfgCrc_cu8 equals the reference CRC
+ */
+void test_VoltMon_CheckCfgCrc_CompileTimeValue(void) {
+  const uint8_t image[2u * VOLTMON_CFG_CRC_DATA_COUNT] = {0x40u, 0x1Fu, 0xC8u, 0x32u, 0xF4u, 0x01u, 0xF4u, 0x01u, 0xF4u, 0x01u,
+                                                         0x0Au, 0x00u, 0x00u, 0x00u, 0x20u, 0x4Eu, 0x88u, 0x13u, 0x10u, 0x27u};
+
+  TEST_ASSERT_EQUAL_HEX8(referenceCrc8(image, sizeof(image)), VoltMon_CfgCrc_cu8);
+}
+
+/**
+ * @test Single bit flip in a threshold is detected
+ * Input: VoltMon_ThresholdOver_mV with bit 0 inverted
+ * Expected: Return 0, then 1 once the value is restored
+ */
+void test_VoltMon_CheckCfgCrc_ThresholdBitFlip(void) {
+  VoltMon_ThresholdOver_mV ^= 0x0001u;
+  TEST_ASSERT_EQUAL_UINT8(0u, VoltMon_CheckCfgCrc());
+
+  VoltMon_ThresholdOver_mV ^= 0x0001u;
+  TEST_ASSERT_EQUAL_UINT8(1u, VoltMon_CheckCfgCrc());
+}
+
+/**
+ * @test Corruption of the high byte of the last covered value is detected
+ * Input: middleHigherVoltMonCfg_cu16 high byte changed
+ * Expected: Return 0
+ */
+void test_VoltMon_CheckCfgCrc_LastValueHighByte(void) {
+  const uint16_t saved = middleHigherVoltMonCfg_cu16;
+
+  middleHigherVoltMonCfg_cu16 = (uint16_t)(saved ^ 0x8000u);
+  TEST_ASSERT_EQUAL_UINT8(0u, VoltMon_CheckCfgCrc());
+
+  middleHigherVoltMonCfg_cu16 = saved;
+}
@@ -127,6 +127,14 @@ def build_modules(root: Path):
 
         matches = find_function_definition(search_root, func_name)
 
+        # Prefer the real definition over call sites (host tools, callers) and
+        # over the copies kept in the unit test folders.
+        definition_pattern = re.compile(rf"^[A-Za-z_][\w\s\*]*\b{func_name}\s*\(.*\{{$")
+        definitions = [m for m in matches if definition_pattern.match(m[2])]
+        definitions.sort(key=lambda m: any(p.startswith(UNIT_TEST_PREFIX) for p in m[0].parts))
+        if definitions:
+            matches = definitions
+
         if matches:
             file_path, _, _ = matches[0]
             module_name = file_path.name